@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/APU.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/APU.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/APU.cpp.o.d"
+  "/root/repo/source/BlockCache.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/BlockCache.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/BlockCache.cpp.o.d"
+  "/root/repo/source/CPU.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/CPU.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/CPU.cpp.o.d"
+  "/root/repo/source/CPUHelper.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/CPUHelper.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/CPUHelper.cpp.o.d"
+  "/root/repo/source/Cartridge.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Cartridge.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Cartridge.cpp.o.d"
+  "/root/repo/source/Condition.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Condition.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Condition.cpp.o.d"
+  "/root/repo/source/Controller.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Controller.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Controller.cpp.o.d"
+  "/root/repo/source/Emulator.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Emulator.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Emulator.cpp.o.d"
+  "/root/repo/source/EmulatorBatch.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/EmulatorBatch.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/EmulatorBatch.cpp.o.d"
+  "/root/repo/source/Encoding6502.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Encoding6502.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Encoding6502.cpp.o.d"
+  "/root/repo/source/Header.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Header.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Header.cpp.o.d"
+  "/root/repo/source/HiLowLatch.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/HiLowLatch.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/HiLowLatch.cpp.o.d"
+  "/root/repo/source/Jit6502.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Jit6502.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Jit6502.cpp.o.d"
+  "/root/repo/source/MappedFile.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MappedFile.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MappedFile.cpp.o.d"
+  "/root/repo/source/Memory.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Memory.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Memory.cpp.o.d"
+  "/root/repo/source/MemoryAxROM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryAxROM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryAxROM.cpp.o.d"
+  "/root/repo/source/MemoryCNROM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryCNROM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryCNROM.cpp.o.d"
+  "/root/repo/source/MemoryFactory.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryFactory.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryFactory.cpp.o.d"
+  "/root/repo/source/MemoryMMC1.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMMC1.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMMC1.cpp.o.d"
+  "/root/repo/source/MemoryMap.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMap.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMap.cpp.o.d"
+  "/root/repo/source/MemoryMapper.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMapper.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMapper.cpp.o.d"
+  "/root/repo/source/MemoryNROM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryNROM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryNROM.cpp.o.d"
+  "/root/repo/source/MemorySystem.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemorySystem.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemorySystem.cpp.o.d"
+  "/root/repo/source/MemoryUxROM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryUxROM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/MemoryUxROM.cpp.o.d"
+  "/root/repo/source/Mode.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Mode.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Mode.cpp.o.d"
+  "/root/repo/source/NROMBus.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/NROMBus.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/NROMBus.cpp.o.d"
+  "/root/repo/source/OpCode.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/OpCode.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/OpCode.cpp.o.d"
+  "/root/repo/source/PPU.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/PPU.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/PPU.cpp.o.d"
+  "/root/repo/source/PPURegisters.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/PPURegisters.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/PPURegisters.cpp.o.d"
+  "/root/repo/source/ROMImage.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/ROMImage.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/ROMImage.cpp.o.d"
+  "/root/repo/source/RecompiledROM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/RecompiledROM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/RecompiledROM.cpp.o.d"
+  "/root/repo/source/Scheduler.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Scheduler.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Scheduler.cpp.o.d"
+  "/root/repo/source/TileCache.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/TileCache.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/TileCache.cpp.o.d"
+  "/root/repo/source/Trace.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/Trace.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/Trace.cpp.o.d"
+  "/root/repo/source/VRAM.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/VRAM.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/VRAM.cpp.o.d"
+  "/root/repo/source/X64Emitter.cpp" "CMakeFiles/NyraEmulationSystem.dir/source/X64Emitter.cpp.o" "gcc" "CMakeFiles/NyraEmulationSystem.dir/source/X64Emitter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
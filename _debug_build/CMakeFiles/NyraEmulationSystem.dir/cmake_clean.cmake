@@ -0,0 +1,81 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NyraEmulationSystem.dir/source/APU.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/APU.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/BlockCache.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/BlockCache.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/CPU.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/CPU.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/CPUHelper.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/CPUHelper.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Cartridge.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Cartridge.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Condition.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Condition.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Controller.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Controller.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Emulator.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Emulator.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/EmulatorBatch.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/EmulatorBatch.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Encoding6502.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Encoding6502.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Header.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Header.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/HiLowLatch.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/HiLowLatch.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Jit6502.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Jit6502.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MappedFile.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MappedFile.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Memory.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Memory.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryAxROM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryAxROM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryCNROM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryCNROM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryFactory.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryFactory.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMMC1.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMMC1.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMap.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMap.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMapper.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryMapper.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryNROM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryNROM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemorySystem.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemorySystem.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryUxROM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/MemoryUxROM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Mode.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Mode.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/NROMBus.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/NROMBus.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/OpCode.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/OpCode.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/PPU.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/PPU.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/PPURegisters.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/PPURegisters.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/ROMImage.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/ROMImage.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/RecompiledROM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/RecompiledROM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Scheduler.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Scheduler.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/TileCache.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/TileCache.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Trace.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/Trace.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/VRAM.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/VRAM.cpp.o.d"
+  "CMakeFiles/NyraEmulationSystem.dir/source/X64Emitter.cpp.o"
+  "CMakeFiles/NyraEmulationSystem.dir/source/X64Emitter.cpp.o.d"
+  "lib/libNyraEmulationSystem.a"
+  "lib/libNyraEmulationSystem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NyraEmulationSystem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nes_aot.dir/aot/StaticRecompiler.cpp.o"
+  "CMakeFiles/nes_aot.dir/aot/StaticRecompiler.cpp.o.d"
+  "CMakeFiles/nes_aot.dir/aot/main.cpp.o"
+  "CMakeFiles/nes_aot.dir/aot/main.cpp.o.d"
+  "nes_aot"
+  "nes_aot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nes_aot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
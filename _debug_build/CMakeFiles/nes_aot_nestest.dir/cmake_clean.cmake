@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nes_aot_nestest.dir/nes_aot_nestest.cpp.o"
+  "CMakeFiles/nes_aot_nestest.dir/nes_aot_nestest.cpp.o.d"
+  "aot/nes_aot_nestest.pdb"
+  "aot/nes_aot_nestest.so"
+  "nes_aot_nestest.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nes_aot_nestest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/Benchmark.cpp" "CMakeFiles/nes_bench.dir/bench/Benchmark.cpp.o" "gcc" "CMakeFiles/nes_bench.dir/bench/Benchmark.cpp.o.d"
+  "/root/repo/bench/PairHistogram.cpp" "CMakeFiles/nes_bench.dir/bench/PairHistogram.cpp.o" "gcc" "CMakeFiles/nes_bench.dir/bench/PairHistogram.cpp.o.d"
+  "/root/repo/bench/main.cpp" "CMakeFiles/nes_bench.dir/bench/main.cpp.o" "gcc" "CMakeFiles/nes_bench.dir/bench/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/CMakeFiles/NyraEmulationSystem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nes_bench.dir/bench/Benchmark.cpp.o"
+  "CMakeFiles/nes_bench.dir/bench/Benchmark.cpp.o.d"
+  "CMakeFiles/nes_bench.dir/bench/PairHistogram.cpp.o"
+  "CMakeFiles/nes_bench.dir/bench/PairHistogram.cpp.o.d"
+  "CMakeFiles/nes_bench.dir/bench/main.cpp.o"
+  "CMakeFiles/nes_bench.dir/bench/main.cpp.o.d"
+  "nes_bench"
+  "nes_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nes_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
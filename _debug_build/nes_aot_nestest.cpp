@@ -0,0 +1,3744 @@
+// Generated by nes_aot from /root/repo/python/test/nestest.nes
+// Do not edit.
+#include <nes/Recompiled6502.hpp>
+
+using namespace nyra::nes;
+
+namespace
+{
+/*****************************************************************************/
+static const uint8_t PRG[] =
+{
+    0x4C, 0xF5, 0xC5, 0x60, 0x78, 0xD8, 0xA2, 0xFF, 0x9A, 0xAD, 0x02, 0x20, 0x10, 0xFB, 0xAD, 0x02,
+    0x20, 0x10, 0xFB, 0xA9, 0x00, 0x8D, 0x00, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x05, 0x20, 0x8D, 0x05,
+    0x20, 0xAD, 0x02, 0x20, 0xA2, 0x20, 0x8E, 0x06, 0x20, 0xA2, 0x00, 0x8E, 0x06, 0x20, 0xA2, 0x00,
+    0xA0, 0x0F, 0xA9, 0x00, 0x8D, 0x07, 0x20, 0xCA, 0xD0, 0xFA, 0x88, 0xD0, 0xF7, 0xA9, 0x3F, 0x8D,
+    0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA2, 0x00, 0xBD, 0x78, 0xFF, 0x8D, 0x07, 0x20, 0xE8,
+    0xE0, 0x20, 0xD0, 0xF5, 0xA9, 0xC0, 0x8D, 0x17, 0x40, 0xA9, 0x00, 0x8D, 0x15, 0x40, 0xA9, 0x78,
+    0x85, 0xD0, 0xA9, 0xFB, 0x85, 0xD1, 0xA9, 0x7F, 0x85, 0xD3, 0xA0, 0x00, 0x8C, 0x06, 0x20, 0x8C,
+    0x06, 0x20, 0xA9, 0x00, 0x85, 0xD7, 0xA9, 0x07, 0x85, 0xD0, 0xA9, 0xC3, 0x85, 0xD1, 0x20, 0xA7,
+    0xC2, 0x20, 0x8D, 0xC2, 0xA2, 0x12, 0x20, 0x61, 0xC2, 0xA5, 0xD5, 0x4A, 0x4A, 0x4A, 0xB0, 0x1C,
+    0x4A, 0xB0, 0x0C, 0x4A, 0xB0, 0x27, 0x4A, 0xB0, 0x03, 0x4C, 0x81, 0xC0, 0x4C, 0x26, 0xC1, 0x20,
+    0x6F, 0xC6, 0xC6, 0xD7, 0x10, 0xDB, 0xA9, 0x0D, 0x85, 0xD7, 0xD0, 0xD5, 0x20, 0x6F, 0xC6, 0xE6,
+    0xD7, 0xA5, 0xD7, 0xC9, 0x0E, 0x90, 0xCA, 0xA9, 0x00, 0x85, 0xD7, 0xF0, 0xC4, 0x20, 0x89, 0xC6,
+    0xA5, 0xD7, 0xF0, 0x06, 0x20, 0xED, 0xC0, 0x4C, 0x81, 0xC0, 0xA9, 0x00, 0x85, 0xD8, 0xE6, 0xD7,
+    0x20, 0xED, 0xC0, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0E, 0xD0, 0xF5, 0xA9, 0x00, 0x85, 0xD7, 0xA5,
+    0xD8, 0xF0, 0x02, 0xA9, 0xFF, 0x85, 0x00, 0x20, 0xED, 0xC1, 0x4C, 0x81, 0xC0, 0xA5, 0xD7, 0x0A,
+    0xAA, 0xBD, 0x0A, 0xC1, 0x8D, 0x00, 0x02, 0xBD, 0x0B, 0xC1, 0x8D, 0x01, 0x02, 0xA9, 0xC1, 0x48,
+    0xA9, 0xDE, 0x48, 0xA9, 0x00, 0x85, 0x00, 0x6C, 0x00, 0x02, 0x2D, 0xC7, 0x2D, 0xC7, 0xDB, 0xC7,
+    0x85, 0xC8, 0xDE, 0xCB, 0xF8, 0xCD, 0xEE, 0xCE, 0xA2, 0xCF, 0x74, 0xD1, 0xFB, 0xD4, 0xD4, 0xC1,
+    0x4A, 0xDF, 0xB8, 0xDB, 0xAA, 0xE1, 0xA9, 0x00, 0x85, 0xD7, 0xA9, 0x92, 0x85, 0xD0, 0xA9, 0xC4,
+    0x85, 0xD1, 0x20, 0xA7, 0xC2, 0x20, 0x8D, 0xC2, 0xA2, 0x0F, 0x20, 0x61, 0xC2, 0xA5, 0xD5, 0x4A,
+    0x4A, 0x4A, 0xB0, 0x1C, 0x4A, 0xB0, 0x0C, 0x4A, 0xB0, 0x27, 0x4A, 0xB0, 0x03, 0x4C, 0x35, 0xC1,
+    0x4C, 0x72, 0xC0, 0x20, 0x6F, 0xC6, 0xC6, 0xD7, 0x10, 0xDB, 0xA9, 0x0A, 0x85, 0xD7, 0xD0, 0xD5,
+    0x20, 0x6F, 0xC6, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0B, 0x90, 0xCA, 0xA9, 0x00, 0x85, 0xD7, 0xF0,
+    0xC4, 0x20, 0x89, 0xC6, 0xA5, 0xD7, 0xF0, 0x06, 0x20, 0xA1, 0xC1, 0x4C, 0x35, 0xC1, 0xA9, 0x00,
+    0x85, 0xD8, 0xE6, 0xD7, 0x20, 0xA1, 0xC1, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0B, 0xD0, 0xF5, 0xA9,
+    0x00, 0x85, 0xD7, 0xA5, 0xD8, 0xF0, 0x02, 0xA9, 0xFF, 0x85, 0x00, 0x20, 0xED, 0xC1, 0x4C, 0x35,
+    0xC1, 0xA5, 0xD7, 0x0A, 0xAA, 0xBD, 0xBE, 0xC1, 0x8D, 0x00, 0x02, 0xBD, 0xBF, 0xC1, 0x8D, 0x01,
+    0x02, 0xA9, 0xC1, 0x48, 0xA9, 0xDE, 0x48, 0xA9, 0x00, 0x85, 0x00, 0x6C, 0x00, 0x02, 0xA3, 0xC6,
+    0xA3, 0xC6, 0x1E, 0xE5, 0x3D, 0xE7, 0xD3, 0xE8, 0x16, 0xE9, 0x86, 0xEB, 0xF6, 0xED, 0x66, 0xF0,
+    0xD6, 0xF2, 0x46, 0xF5, 0xA9, 0x00, 0x85, 0x00, 0x20, 0x00, 0xD9, 0x20, 0xE0, 0xDA, 0xEA, 0xEA,
+    0xEA, 0xA5, 0x00, 0xF0, 0x02, 0x85, 0xD8, 0x4C, 0xED, 0xC1, 0x4C, 0x81, 0xC0, 0x20, 0x8D, 0xC2,
+    0xA9, 0x00, 0x85, 0xD3, 0xA5, 0xD7, 0x18, 0x69, 0x04, 0x0A, 0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x0A,
+    0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x48, 0xA5, 0xD3, 0x09, 0x20, 0x8D, 0x06, 0x20,
+    0x68, 0x09, 0x04, 0x8D, 0x06, 0x20, 0xA5, 0x00, 0xF0, 0x1D, 0xC9, 0xFF, 0xF0, 0x26, 0x4A, 0x4A,
+    0x4A, 0x4A, 0xAA, 0xBD, 0x51, 0xC2, 0x8D, 0x07, 0x20, 0xA5, 0x00, 0x29, 0x0F, 0xAA, 0xBD, 0x51,
+    0xC2, 0x8D, 0x07, 0x20, 0x4C, 0x94, 0xC2, 0xA9, 0x4F, 0x8D, 0x07, 0x20, 0xA9, 0x4B, 0x8D, 0x07,
+    0x20, 0x4C, 0x94, 0xC2, 0xA9, 0x45, 0x8D, 0x07, 0x20, 0xA9, 0x72, 0x8D, 0x07, 0x20, 0x4C, 0x94,
+    0xC2, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0xA5, 0xD7, 0x18, 0x69, 0x04, 0xA8, 0xA9, 0x84, 0x8D, 0x00, 0x20, 0xA9, 0x20, 0x8D, 0x06,
+    0x20, 0xA9, 0x02, 0x8D, 0x06, 0x20, 0xA9, 0x20, 0x88, 0xC8, 0xD0, 0x02, 0xA9, 0x2A, 0x8D, 0x07,
+    0x20, 0x88, 0xCA, 0xD0, 0xF1, 0xA9, 0x80, 0x8D, 0x00, 0x20, 0x4C, 0x94, 0xC2, 0xA5, 0xD2, 0xC5,
+    0xD2, 0xF0, 0xFC, 0x60, 0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20, 0xA9, 0x00, 0x8D, 0x06,
+    0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0x60, 0xA9, 0x00, 0x8D, 0x00, 0x20, 0x8D, 0x01, 0x20, 0x20,
+    0xED, 0xC2, 0xA9, 0x20, 0x8D, 0x06, 0x20, 0xA0, 0x00, 0x8C, 0x06, 0x20, 0xA2, 0x20, 0xB1, 0xD0,
+    0xF0, 0x20, 0xC9, 0xFF, 0xF0, 0x0D, 0x8D, 0x07, 0x20, 0xC8, 0xD0, 0x02, 0xE6, 0xD1, 0xCA, 0xD0,
+    0xED, 0xF0, 0xE9, 0xC8, 0xD0, 0x02, 0xE6, 0xD1, 0xA9, 0x20, 0x8D, 0x07, 0x20, 0xCA, 0xD0, 0xF8,
+    0xF0, 0xDA, 0xA9, 0x80, 0x8D, 0x00, 0x20, 0xA9, 0x0E, 0x8D, 0x01, 0x20, 0x60, 0xA9, 0x20, 0x8D,
+    0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA2, 0x1E, 0xA9, 0x20, 0xA0, 0x20, 0x8D, 0x07, 0x20,
+    0x88, 0xD0, 0xFA, 0xCA, 0xD0, 0xF5, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D,
+    0x2D, 0x20, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x42, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x6C, 0x61, 0x67, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x49, 0x6D, 0x6D,
+    0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x49, 0x6D, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74,
+    0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x63, 0x63, 0x75,
+    0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x28, 0x49, 0x6E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2C, 0x58,
+    0x29, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x5A,
+    0x65, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x28, 0x49, 0x6E, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x29, 0x2C, 0x59, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x2C, 0x59, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x5A, 0x65, 0x72,
+    0x6F, 0x70, 0x61, 0x67, 0x65, 0x2C, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x2C, 0x58, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2F, 0x44,
+    0x6F, 0x77, 0x6E, 0x3A, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x72, 0x75,
+    0x6E, 0x20, 0x74, 0x65, 0x73, 0x74, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6C, 0x65,
+    0x63, 0x74, 0x3A, 0x20, 0x49, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x6F, 0x70, 0x73, 0x21,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x75, 0x6E,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D,
+    0x2D, 0x20, 0x4E, 0x4F, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20,
+    0x2D, 0x2D, 0x20, 0x4C, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x53, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x42, 0x43, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x28, 0x6F,
+    0x70, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x30, 0x45, 0x42, 0x68, 0x29, 0xFF, 0x20, 0x20, 0x20, 0x20,
+    0x2D, 0x2D, 0x20, 0x44, 0x43, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x49, 0x53, 0x42, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x4C, 0x4F, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20,
+    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x4C, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x52, 0x45, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
+    0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x52, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2F, 0x44, 0x6F,
+    0x77, 0x6E, 0x3A, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x72, 0x75, 0x6E,
+    0x20, 0x74, 0x65, 0x73, 0x74, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6C, 0x65, 0x63,
+    0x74, 0x3A, 0x20, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x6F, 0x70, 0x73, 0xFF, 0x00, 0x48,
+    0x8A, 0x48, 0xAD, 0x02, 0x20, 0xA9, 0x20, 0x8D, 0x06, 0x20, 0xA9, 0x40, 0x8D, 0x06, 0x20, 0xE6,
+    0xD2, 0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA9, 0x00,
+    0x8D, 0x06, 0x20, 0xA2, 0x09, 0x8E, 0x16, 0x40, 0xCA, 0x8E, 0x16, 0x40, 0xAD, 0x16, 0x40, 0x4A,
+    0x26, 0xD4, 0xCA, 0xD0, 0xF7, 0xA5, 0xD4, 0xAA, 0x45, 0xD6, 0x25, 0xD4, 0x85, 0xD5, 0x86, 0xD6,
+    0x68, 0xAA, 0x68, 0x40, 0x40, 0xA2, 0x00, 0x86, 0x00, 0x86, 0x10, 0x86, 0x11, 0x20, 0x2D, 0xC7,
+    0x20, 0xDB, 0xC7, 0x20, 0x85, 0xC8, 0x20, 0xDE, 0xCB, 0x20, 0xF8, 0xCD, 0x20, 0xEE, 0xCE, 0x20,
+    0xA2, 0xCF, 0x20, 0x74, 0xD1, 0x20, 0xFB, 0xD4, 0x20, 0x00, 0xD9, 0xA5, 0x00, 0x85, 0x10, 0xA9,
+    0x00, 0x85, 0x00, 0x20, 0xE0, 0xDA, 0x20, 0x4A, 0xDF, 0x20, 0xB8, 0xDB, 0x20, 0xAA, 0xE1, 0x20,
+    0xA3, 0xC6, 0x20, 0x1E, 0xE5, 0x20, 0x3D, 0xE7, 0x20, 0xD3, 0xE8, 0x20, 0x16, 0xE9, 0x20, 0x86,
+    0xEB, 0x20, 0xF6, 0xED, 0x20, 0x66, 0xF0, 0x20, 0xD6, 0xF2, 0xA5, 0x00, 0x85, 0x11, 0xA9, 0x00,
+    0x85, 0x00, 0x20, 0x46, 0xF5, 0xA5, 0x00, 0x05, 0x10, 0x05, 0x11, 0xF0, 0x0E, 0x20, 0x6F, 0xC6,
+    0xA6, 0x00, 0x86, 0x02, 0xA6, 0x10, 0x86, 0x03, 0x4C, 0x6E, 0xC6, 0x20, 0x89, 0xC6, 0x60, 0xA9,
+    0x03, 0x8D, 0x15, 0x40, 0xA9, 0x87, 0x8D, 0x00, 0x40, 0xA9, 0x89, 0x8D, 0x01, 0x40, 0xA9, 0xF0,
+    0x8D, 0x02, 0x40, 0xA9, 0x00, 0x8D, 0x03, 0x40, 0x60, 0xA9, 0x02, 0x8D, 0x15, 0x40, 0xA9, 0x3F,
+    0x8D, 0x04, 0x40, 0xA9, 0x9A, 0x8D, 0x05, 0x40, 0xA9, 0xFF, 0x8D, 0x06, 0x40, 0xA9, 0x00, 0x8D,
+    0x07, 0x40, 0x60, 0xA0, 0x4E, 0xA9, 0xFF, 0x85, 0x01, 0x20, 0xB0, 0xC6, 0x20, 0xB7, 0xC6, 0x60,
+    0xA9, 0xFF, 0x48, 0xA9, 0xAA, 0xD0, 0x05, 0xA9, 0x34, 0x48, 0xA9, 0x55, 0x28, 0x04, 0xA9, 0x44,
+    0xA9, 0x64, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA, 0x08, 0x48, 0x0C, 0xA9, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x08, 0x48, 0x14, 0xA9, 0x34, 0xA9, 0x54, 0xA9, 0x74, 0xA9, 0xD4, 0xA9, 0xF4, 0xA9, 0xEA, 0xEA,
+    0xEA, 0xEA, 0x08, 0x48, 0x1A, 0x3A, 0x5A, 0x7A, 0xDA, 0xFA, 0x80, 0x89, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x08, 0x48, 0x1C, 0xA9, 0xA9, 0x3C, 0xA9, 0xA9, 0x5C, 0xA9, 0xA9, 0x7C, 0xA9, 0xA9, 0xDC, 0xA9,
+    0xA9, 0xFC, 0xA9, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA, 0x08, 0x48, 0xA2, 0x05, 0x68, 0xC9, 0x55, 0xF0,
+    0x0A, 0xC9, 0xAA, 0xF0, 0x06, 0x68, 0x84, 0x00, 0x4C, 0x28, 0xC7, 0x68, 0x29, 0xCB, 0xC9, 0x00,
+    0xF0, 0x06, 0xC9, 0xCB, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xCA, 0xD0, 0xE0, 0x60, 0xEA, 0x38, 0xB0,
+    0x04, 0xA2, 0x01, 0x86, 0x00, 0xEA, 0x18, 0xB0, 0x03, 0x4C, 0x40, 0xC7, 0xA2, 0x02, 0x86, 0x00,
+    0xEA, 0x38, 0x90, 0x03, 0x4C, 0x4B, 0xC7, 0xA2, 0x03, 0x86, 0x00, 0xEA, 0x18, 0x90, 0x04, 0xA2,
+    0x04, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0xF0, 0x04, 0xA2, 0x05, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0xF0,
+    0x03, 0x4C, 0x68, 0xC7, 0xA2, 0x06, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0xD0, 0x04, 0xA2, 0x07, 0x86,
+    0x00, 0xEA, 0xA9, 0x00, 0xD0, 0x03, 0x4C, 0x7D, 0xC7, 0xA2, 0x08, 0x86, 0x00, 0xEA, 0xA9, 0xFF,
+    0x85, 0x01, 0x24, 0x01, 0x70, 0x04, 0xA2, 0x09, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x50, 0x03, 0x4C,
+    0x96, 0xC7, 0xA2, 0x0A, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x50, 0x04, 0xA2,
+    0x0B, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x70, 0x03, 0x4C, 0xAF, 0xC7, 0xA2, 0x0C, 0x86, 0x00, 0xEA,
+    0xA9, 0x00, 0x10, 0x04, 0xA2, 0x0D, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x10, 0x03, 0x4C, 0xD9, 0xC7,
+    0xA2, 0x0E, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x30, 0x04, 0xA2, 0x0F, 0x86, 0x00, 0xEA, 0xA9, 0x00,
+    0x30, 0x03, 0x4C, 0xD9, 0xC7, 0xA2, 0x10, 0x86, 0x00, 0xEA, 0x60, 0xEA, 0xA9, 0xFF, 0x85, 0x01,
+    0x24, 0x01, 0xA9, 0x00, 0x38, 0x78, 0xF8, 0x08, 0x68, 0x29, 0xEF, 0xC9, 0x6F, 0xF0, 0x04, 0xA2,
+    0x11, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0x85, 0x01, 0x24, 0x01, 0xD8, 0xA9, 0x10, 0x18, 0x08, 0x68,
+    0x29, 0xEF, 0xC9, 0x64, 0xF0, 0x04, 0xA2, 0x12, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x85, 0x01, 0x24,
+    0x01, 0xF8, 0xA9, 0x00, 0x38, 0x08, 0x68, 0x29, 0xEF, 0xC9, 0x2F, 0xF0, 0x04, 0xA2, 0x13, 0x86,
+    0x00, 0xEA, 0xA9, 0xFF, 0x48, 0x28, 0xD0, 0x09, 0x10, 0x07, 0x50, 0x05, 0x90, 0x03, 0x4C, 0x35,
+    0xC8, 0xA2, 0x14, 0x86, 0x00, 0xEA, 0xA9, 0x04, 0x48, 0x28, 0xF0, 0x09, 0x30, 0x07, 0x70, 0x05,
+    0xB0, 0x03, 0x4C, 0x49, 0xC8, 0xA2, 0x15, 0x86, 0x00, 0xEA, 0xF8, 0xA9, 0xFF, 0x85, 0x01, 0x24,
+    0x01, 0x18, 0xA9, 0x00, 0x48, 0xA9, 0xFF, 0x68, 0xD0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xB0, 0x03,
+    0x4C, 0x67, 0xC8, 0xA2, 0x16, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xA9,
+    0xFF, 0x48, 0xA9, 0x00, 0x68, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x84, 0xC8,
+    0xA2, 0x17, 0x86, 0x00, 0x60, 0xEA, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0x55, 0x09,
+    0xAA, 0xB0, 0x0B, 0x10, 0x09, 0xC9, 0xFF, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0xA2, 0xC8, 0xA2, 0x18,
+    0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x00, 0x09, 0x00, 0xD0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30,
+    0x03, 0x4C, 0xB8, 0xC8, 0xA2, 0x19, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x55, 0x29, 0xAA,
+    0xD0, 0x09, 0x50, 0x07, 0xB0, 0x05, 0x30, 0x03, 0x4C, 0xCF, 0xC8, 0xA2, 0x1A, 0x86, 0x00, 0xEA,
+    0x38, 0xB8, 0xA9, 0xF8, 0x29, 0xEF, 0x90, 0x0B, 0x10, 0x09, 0xC9, 0xE8, 0xD0, 0x05, 0x70, 0x03,
+    0x4C, 0xE7, 0xC8, 0xA2, 0x1B, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x5F, 0x49, 0xAA, 0xB0,
+    0x0B, 0x10, 0x09, 0xC9, 0xF5, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0x00, 0xC9, 0xA2, 0x1C, 0x86, 0x00,
+    0xEA, 0x38, 0xB8, 0xA9, 0x70, 0x49, 0x70, 0xD0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30, 0x03, 0x4C,
+    0x16, 0xC9, 0xA2, 0x1D, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x00, 0x69, 0x69, 0x30, 0x0B,
+    0xB0, 0x09, 0xC9, 0x69, 0xD0, 0x05, 0x70, 0x03, 0x4C, 0x2F, 0xC9, 0xA2, 0x1E, 0x86, 0x00, 0xEA,
+    0x38, 0xF8, 0x24, 0x01, 0xA9, 0x01, 0x69, 0x69, 0x30, 0x0B, 0xB0, 0x09, 0xC9, 0x6B, 0xD0, 0x05,
+    0x70, 0x03, 0x4C, 0x49, 0xC9, 0xA2, 0x1F, 0x86, 0x00, 0xEA, 0xD8, 0x38, 0xB8, 0xA9, 0x7F, 0x69,
+    0x7F, 0x10, 0x0B, 0xB0, 0x09, 0xC9, 0xFF, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0x62, 0xC9, 0xA2, 0x20,
+    0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x7F, 0x69, 0x80, 0x10, 0x0B, 0xB0, 0x09, 0xC9, 0xFF,
+    0xD0, 0x05, 0x70, 0x03, 0x4C, 0x7B, 0xC9, 0xA2, 0x21, 0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x7F,
+    0x69, 0x80, 0xD0, 0x09, 0x30, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x91, 0xC9, 0xA2, 0x22, 0x86,
+    0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x9F, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0xA5,
+    0xC9, 0xA2, 0x23, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x00, 0xD0, 0x09, 0x30, 0x07, 0x50,
+    0x05, 0xB0, 0x03, 0x4C, 0xBA, 0xC9, 0xA2, 0x23, 0x86, 0x00, 0xEA, 0x24, 0x01, 0xA9, 0x40, 0xC9,
+    0x40, 0x30, 0x09, 0x90, 0x07, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0xD0, 0xC9, 0xA2, 0x24, 0x86, 0x00,
+    0xEA, 0xB8, 0xC9, 0x3F, 0xF0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0xE3, 0xC9, 0xA2,
+    0x25, 0x86, 0x00, 0xEA, 0xC9, 0x41, 0xF0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4C, 0xF3, 0xC9, 0xA2,
+    0x26, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0xC9, 0x00, 0xF0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4C, 0x05,
+    0xCA, 0xA2, 0x27, 0x86, 0x00, 0xEA, 0xC9, 0x80, 0xD0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4C, 0x15,
+    0xCA, 0xA2, 0x28, 0x86, 0x00, 0xEA, 0xC9, 0x81, 0xB0, 0x07, 0xF0, 0x05, 0x10, 0x03, 0x4C, 0x25,
+    0xCA, 0xA2, 0x29, 0x86, 0x00, 0xEA, 0xC9, 0x7F, 0x90, 0x07, 0xF0, 0x05, 0x30, 0x03, 0x4C, 0x35,
+    0xCA, 0xA2, 0x2A, 0x86, 0x00, 0xEA, 0x24, 0x01, 0xA0, 0x40, 0xC0, 0x40, 0xD0, 0x09, 0x30, 0x07,
+    0x90, 0x05, 0x50, 0x03, 0x4C, 0x4B, 0xCA, 0xA2, 0x2B, 0x86, 0x00, 0xEA, 0xB8, 0xC0, 0x3F, 0xF0,
+    0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0x5E, 0xCA, 0xA2, 0x2C, 0x86, 0x00, 0xEA, 0xC0,
+    0x41, 0xF0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4C, 0x6E, 0xCA, 0xA2, 0x2D, 0x86, 0x00, 0xEA, 0xA0,
+    0x80, 0xC0, 0x00, 0xF0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4C, 0x80, 0xCA, 0xA2, 0x2E, 0x86, 0x00,
+    0xEA, 0xC0, 0x80, 0xD0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4C, 0x90, 0xCA, 0xA2, 0x2F, 0x86, 0x00,
+    0xEA, 0xC0, 0x81, 0xB0, 0x07, 0xF0, 0x05, 0x10, 0x03, 0x4C, 0xA0, 0xCA, 0xA2, 0x30, 0x86, 0x00,
+    0xEA, 0xC0, 0x7F, 0x90, 0x07, 0xF0, 0x05, 0x30, 0x03, 0x4C, 0xB0, 0xCA, 0xA2, 0x31, 0x86, 0x00,
+    0xEA, 0x24, 0x01, 0xA2, 0x40, 0xE0, 0x40, 0xD0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x50, 0x03, 0x4C,
+    0xC6, 0xCA, 0xA9, 0x32, 0x85, 0x00, 0xEA, 0xB8, 0xE0, 0x3F, 0xF0, 0x09, 0x30, 0x07, 0x90, 0x05,
+    0x70, 0x03, 0x4C, 0xD9, 0xCA, 0xA9, 0x33, 0x85, 0x00, 0xEA, 0xE0, 0x41, 0xF0, 0x07, 0x10, 0x05,
+    0x10, 0x03, 0x4C, 0xE9, 0xCA, 0xA9, 0x34, 0x85, 0x00, 0xEA, 0xA2, 0x80, 0xE0, 0x00, 0xF0, 0x07,
+    0x10, 0x05, 0x90, 0x03, 0x4C, 0xFB, 0xCA, 0xA9, 0x35, 0x85, 0x00, 0xEA, 0xE0, 0x80, 0xD0, 0x07,
+    0x30, 0x05, 0x90, 0x03, 0x4C, 0x0B, 0xCB, 0xA9, 0x36, 0x85, 0x00, 0xEA, 0xE0, 0x81, 0xB0, 0x07,
+    0xF0, 0x05, 0x10, 0x03, 0x4C, 0x1B, 0xCB, 0xA9, 0x37, 0x85, 0x00, 0xEA, 0xE0, 0x7F, 0x90, 0x07,
+    0xF0, 0x05, 0x30, 0x03, 0x4C, 0x2B, 0xCB, 0xA9, 0x38, 0x85, 0x00, 0xEA, 0x38, 0xB8, 0xA2, 0x9F,
+    0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x3F, 0xCB, 0xA2, 0x39, 0x86, 0x00, 0xEA,
+    0x18, 0x24, 0x01, 0xA2, 0x00, 0xD0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x4C, 0x54, 0xCB,
+    0xA2, 0x3A, 0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA0, 0x9F, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90,
+    0x03, 0x4C, 0x68, 0xCB, 0xA2, 0x3B, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA0, 0x00, 0xD0, 0x09,
+    0x30, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x4C, 0x7D, 0xCB, 0xA2, 0x3C, 0x86, 0x00, 0xEA, 0xA9, 0x55,
+    0xA2, 0xAA, 0xA0, 0x33, 0xC9, 0x55, 0xD0, 0x23, 0xE0, 0xAA, 0xD0, 0x1F, 0xC0, 0x33, 0xD0, 0x1B,
+    0xC9, 0x55, 0xD0, 0x17, 0xE0, 0xAA, 0xD0, 0x13, 0xC0, 0x33, 0xD0, 0x0F, 0xC9, 0x56, 0xF0, 0x0B,
+    0xE0, 0xAB, 0xF0, 0x07, 0xC0, 0x34, 0xF0, 0x03, 0x4C, 0xAF, 0xCB, 0xA2, 0x3D, 0x86, 0x00, 0xA0,
+    0x71, 0x20, 0x31, 0xF9, 0xE9, 0x40, 0x20, 0x37, 0xF9, 0xC8, 0x20, 0x47, 0xF9, 0xE9, 0x3F, 0x20,
+    0x4C, 0xF9, 0xC8, 0x20, 0x5C, 0xF9, 0xE9, 0x41, 0x20, 0x62, 0xF9, 0xC8, 0x20, 0x72, 0xF9, 0xE9,
+    0x00, 0x20, 0x76, 0xF9, 0xC8, 0x20, 0x80, 0xF9, 0xE9, 0x7F, 0x20, 0x84, 0xF9, 0x60, 0xEA, 0xA9,
+    0xFF, 0x85, 0x01, 0xA9, 0x44, 0xA2, 0x55, 0xA0, 0x66, 0xE8, 0x88, 0xE0, 0x56, 0xD0, 0x21, 0xC0,
+    0x65, 0xD0, 0x1D, 0xE8, 0xE8, 0x88, 0x88, 0xE0, 0x58, 0xD0, 0x15, 0xC0, 0x63, 0xD0, 0x11, 0xCA,
+    0xC8, 0xE0, 0x57, 0xD0, 0x0B, 0xC0, 0x64, 0xD0, 0x07, 0xC9, 0x44, 0xD0, 0x03, 0x4C, 0x14, 0xCC,
+    0xA2, 0x3E, 0x86, 0x00, 0xEA, 0x38, 0xA2, 0x69, 0xA9, 0x96, 0x24, 0x01, 0xA0, 0xFF, 0xC8, 0xD0,
+    0x3D, 0x30, 0x3B, 0x90, 0x39, 0x50, 0x37, 0xC0, 0x00, 0xD0, 0x33, 0xC8, 0xF0, 0x30, 0x30, 0x2E,
+    0x90, 0x2C, 0x50, 0x2A, 0x18, 0xB8, 0xA0, 0x00, 0x88, 0xF0, 0x23, 0x10, 0x21, 0xB0, 0x1F, 0x70,
+    0x1D, 0xC0, 0xFF, 0xD0, 0x19, 0x18, 0x88, 0xF0, 0x15, 0x10, 0x13, 0xB0, 0x11, 0x70, 0x0F, 0xC0,
+    0xFE, 0xD0, 0x0B, 0xC9, 0x96, 0xD0, 0x07, 0xE0, 0x69, 0xD0, 0x03, 0x4C, 0x62, 0xCC, 0xA2, 0x3F,
+    0x86, 0x00, 0xEA, 0x38, 0xA0, 0x69, 0xA9, 0x96, 0x24, 0x01, 0xA2, 0xFF, 0xE8, 0xD0, 0x3D, 0x30,
+    0x3B, 0x90, 0x39, 0x50, 0x37, 0xE0, 0x00, 0xD0, 0x33, 0xE8, 0xF0, 0x30, 0x30, 0x2E, 0x90, 0x2C,
+    0x50, 0x2A, 0x18, 0xB8, 0xA2, 0x00, 0xCA, 0xF0, 0x23, 0x10, 0x21, 0xB0, 0x1F, 0x70, 0x1D, 0xE0,
+    0xFF, 0xD0, 0x19, 0x18, 0xCA, 0xF0, 0x15, 0x10, 0x13, 0xB0, 0x11, 0x70, 0x0F, 0xE0, 0xFE, 0xD0,
+    0x0B, 0xC9, 0x96, 0xD0, 0x07, 0xC0, 0x69, 0xD0, 0x03, 0x4C, 0xB0, 0xCC, 0xA2, 0x40, 0x86, 0x00,
+    0xEA, 0xA9, 0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0xA8, 0xF0, 0x2E, 0xB0, 0x2C, 0x50,
+    0x2A, 0x10, 0x28, 0xC9, 0x85, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x85, 0xD0, 0x1C, 0xA9,
+    0x00, 0x38, 0xB8, 0xA8, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B,
+    0xE0, 0x34, 0xD0, 0x07, 0xC0, 0x00, 0xD0, 0x03, 0x4C, 0xEF, 0xCC, 0xA2, 0x41, 0x86, 0x00, 0xEA,
+    0xA9, 0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0xAA, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A,
+    0x10, 0x28, 0xC9, 0x85, 0xD0, 0x24, 0xE0, 0x85, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA9, 0x00,
+    0x38, 0xB8, 0xAA, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0,
+    0x00, 0xD0, 0x07, 0xC0, 0x99, 0xD0, 0x03, 0x4C, 0x2E, 0xCD, 0xA2, 0x42, 0x86, 0x00, 0xEA, 0xA9,
+    0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0x98, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A, 0x10,
+    0x28, 0xC9, 0x99, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA0, 0x00, 0x38,
+    0xB8, 0x98, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0, 0x34,
+    0xD0, 0x07, 0xC0, 0x00, 0xD0, 0x03, 0x4C, 0x6D, 0xCD, 0xA2, 0x43, 0x86, 0x00, 0xEA, 0xA9, 0x85,
+    0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0x8A, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A, 0x30, 0x28,
+    0xC9, 0x34, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA2, 0x00, 0x38, 0xB8,
+    0x8A, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0, 0x00, 0xD0,
+    0x07, 0xC0, 0x99, 0xD0, 0x03, 0x4C, 0xAC, 0xCD, 0xA2, 0x44, 0x86, 0x00, 0xEA, 0xBA, 0x8E, 0xFF,
+    0x07, 0xA0, 0x33, 0xA2, 0x69, 0xA9, 0x84, 0x18, 0x24, 0x01, 0x9A, 0xF0, 0x32, 0x10, 0x30, 0xB0,
+    0x2E, 0x50, 0x2C, 0xC9, 0x84, 0xD0, 0x28, 0xE0, 0x69, 0xD0, 0x24, 0xC0, 0x33, 0xD0, 0x20, 0xA0,
+    0x01, 0xA9, 0x04, 0x38, 0xB8, 0xA2, 0x00, 0xBA, 0xF0, 0x15, 0x30, 0x13, 0x90, 0x11, 0x70, 0x0F,
+    0xE0, 0x69, 0xD0, 0x0B, 0xC9, 0x04, 0xD0, 0x07, 0xC0, 0x01, 0xD0, 0x03, 0x4C, 0xF3, 0xCD, 0xA2,
+    0x45, 0x86, 0x00, 0xAE, 0xFF, 0x07, 0x9A, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xBA, 0x8E, 0xFF, 0x07,
+    0xEA, 0xA2, 0x80, 0x9A, 0xA9, 0x33, 0x48, 0xA9, 0x69, 0x48, 0xBA, 0xE0, 0x7E, 0xD0, 0x20, 0x68,
+    0xC9, 0x69, 0xD0, 0x1B, 0x68, 0xC9, 0x33, 0xD0, 0x16, 0xBA, 0xE0, 0x80, 0xD0, 0x11, 0xAD, 0x80,
+    0x01, 0xC9, 0x33, 0xD0, 0x0A, 0xAD, 0x7F, 0x01, 0xC9, 0x69, 0xD0, 0x03, 0x4C, 0x33, 0xCE, 0xA2,
+    0x46, 0x86, 0x00, 0xEA, 0xA2, 0x80, 0x9A, 0x20, 0x3D, 0xCE, 0x4C, 0x5B, 0xCE, 0xBA, 0xE0, 0x7E,
+    0xD0, 0x19, 0x68, 0x68, 0xBA, 0xE0, 0x80, 0xD0, 0x12, 0xA9, 0x00, 0x20, 0x4E, 0xCE, 0x68, 0xC9,
+    0x4D, 0xD0, 0x08, 0x68, 0xC9, 0xCE, 0xD0, 0x03, 0x4C, 0x5F, 0xCE, 0xA2, 0x47, 0x86, 0x00, 0xEA,
+    0xA9, 0xCE, 0x48, 0xA9, 0x66, 0x48, 0x60, 0xA2, 0x77, 0xA0, 0x69, 0x18, 0x24, 0x01, 0xA9, 0x83,
+    0x20, 0x66, 0xCE, 0xF0, 0x24, 0x10, 0x22, 0xB0, 0x20, 0x50, 0x1E, 0xC9, 0x83, 0xD0, 0x1A, 0xC0,
+    0x69, 0xD0, 0x16, 0xE0, 0x77, 0xD0, 0x12, 0x38, 0xB8, 0xA9, 0x00, 0x20, 0x66, 0xCE, 0xD0, 0x09,
+    0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0x9D, 0xCE, 0xA2, 0x48, 0x86, 0x00, 0xEA, 0xA9, 0xCE,
+    0x48, 0xA9, 0xAE, 0x48, 0xA9, 0x65, 0x48, 0xA9, 0x55, 0xA0, 0x88, 0xA2, 0x99, 0x40, 0x30, 0x35,
+    0x50, 0x33, 0xF0, 0x31, 0x90, 0x2F, 0xC9, 0x55, 0xD0, 0x2B, 0xC0, 0x88, 0xD0, 0x27, 0xE0, 0x99,
+    0xD0, 0x23, 0xA9, 0xCE, 0x48, 0xA9, 0xCE, 0x48, 0xA9, 0x87, 0x48, 0xA9, 0x55, 0x40, 0x10, 0x15,
+    0x70, 0x13, 0xD0, 0x11, 0x90, 0x0F, 0xC9, 0x55, 0xD0, 0x0B, 0xC0, 0x88, 0xD0, 0x07, 0xE0, 0x99,
+    0xD0, 0x03, 0x4C, 0xE9, 0xCE, 0xA2, 0x49, 0x86, 0x00, 0xAE, 0xFF, 0x07, 0x9A, 0x60, 0xA2, 0x55,
+    0xA0, 0x69, 0xA9, 0xFF, 0x85, 0x01, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x4A, 0x90, 0x1D, 0xD0,
+    0x1B, 0x30, 0x19, 0x50, 0x17, 0xC9, 0x00, 0xD0, 0x13, 0xB8, 0xA9, 0xAA, 0x4A, 0xB0, 0x0D, 0xF0,
+    0x0B, 0x30, 0x09, 0x70, 0x07, 0xC9, 0x55, 0xD0, 0x03, 0x4C, 0x20, 0xCF, 0xA2, 0x4A, 0x86, 0x00,
+    0xEA, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x0A, 0x90, 0x1E, 0xD0, 0x1C, 0x30, 0x1A, 0x50, 0x18, 0xC9,
+    0x00, 0xD0, 0x14, 0xB8, 0x38, 0xA9, 0x55, 0x0A, 0xB0, 0x0D, 0xF0, 0x0B, 0x10, 0x09, 0x70, 0x07,
+    0xC9, 0xAA, 0xD0, 0x03, 0x4C, 0x4B, 0xCF, 0xA2, 0x4B, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x38, 0xA9,
+    0x01, 0x6A, 0x90, 0x1E, 0xF0, 0x1C, 0x10, 0x1A, 0x50, 0x18, 0xC9, 0x80, 0xD0, 0x14, 0xB8, 0x18,
+    0xA9, 0x55, 0x6A, 0x90, 0x0D, 0xF0, 0x0B, 0x30, 0x09, 0x70, 0x07, 0xC9, 0x2A, 0xD0, 0x03, 0x4C,
+    0x76, 0xCF, 0xA2, 0x4C, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x2A, 0x90, 0x1E, 0xF0,
+    0x1C, 0x30, 0x1A, 0x50, 0x18, 0xC9, 0x01, 0xD0, 0x14, 0xB8, 0x18, 0xA9, 0x55, 0x2A, 0xB0, 0x0D,
+    0xF0, 0x0B, 0x10, 0x09, 0x70, 0x07, 0xC9, 0xAA, 0xD0, 0x03, 0x4C, 0xA1, 0xCF, 0xA2, 0x4D, 0x86,
+    0x00, 0x60, 0xA5, 0x00, 0x8D, 0xFF, 0x07, 0xA9, 0x00, 0x85, 0x80, 0xA9, 0x02, 0x85, 0x81, 0xA9,
+    0xFF, 0x85, 0x01, 0xA9, 0x00, 0x85, 0x82, 0xA9, 0x03, 0x85, 0x83, 0x85, 0x84, 0xA9, 0x00, 0x85,
+    0xFF, 0xA9, 0x04, 0x85, 0x00, 0xA9, 0x5A, 0x8D, 0x00, 0x02, 0xA9, 0x5B, 0x8D, 0x00, 0x03, 0xA9,
+    0x5C, 0x8D, 0x03, 0x03, 0xA9, 0x5D, 0x8D, 0x00, 0x04, 0xA2, 0x00, 0xA1, 0x80, 0xC9, 0x5A, 0xD0,
+    0x1F, 0xE8, 0xE8, 0xA1, 0x80, 0xC9, 0x5B, 0xD0, 0x17, 0xE8, 0xA1, 0x80, 0xC9, 0x5C, 0xD0, 0x10,
+    0xA2, 0x00, 0xA1, 0xFF, 0xC9, 0x5D, 0xD0, 0x08, 0xA2, 0x81, 0xA1, 0xFF, 0xC9, 0x5A, 0xF0, 0x05,
+    0xA9, 0x58, 0x8D, 0xFF, 0x07, 0xA9, 0xAA, 0xA2, 0x00, 0x81, 0x80, 0xE8, 0xE8, 0xA9, 0xAB, 0x81,
+    0x80, 0xE8, 0xA9, 0xAC, 0x81, 0x80, 0xA2, 0x00, 0xA9, 0xAD, 0x81, 0xFF, 0xAD, 0x00, 0x02, 0xC9,
+    0xAA, 0xD0, 0x15, 0xAD, 0x00, 0x03, 0xC9, 0xAB, 0xD0, 0x0E, 0xAD, 0x03, 0x03, 0xC9, 0xAC, 0xD0,
+    0x07, 0xAD, 0x00, 0x04, 0xC9, 0xAD, 0xF0, 0x05, 0xA9, 0x59, 0x8D, 0xFF, 0x07, 0xAD, 0xFF, 0x07,
+    0x85, 0x00, 0xA9, 0x00, 0x8D, 0x00, 0x03, 0xA9, 0xAA, 0x8D, 0x00, 0x02, 0xA2, 0x00, 0xA0, 0x5A,
+    0x20, 0xB6, 0xF7, 0x01, 0x80, 0x20, 0xC0, 0xF7, 0xC8, 0x20, 0xCE, 0xF7, 0x01, 0x82, 0x20, 0xD3,
+    0xF7, 0xC8, 0x20, 0xDF, 0xF7, 0x21, 0x80, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x8D, 0x00, 0x03,
+    0x20, 0xF1, 0xF7, 0x21, 0x82, 0x20, 0xF6, 0xF7, 0xC8, 0x20, 0x04, 0xF8, 0x41, 0x80, 0x20, 0x0A,
+    0xF8, 0xC8, 0xA9, 0x70, 0x8D, 0x00, 0x03, 0x20, 0x18, 0xF8, 0x41, 0x82, 0x20, 0x1D, 0xF8, 0xC8,
+    0xA9, 0x69, 0x8D, 0x00, 0x02, 0x20, 0x29, 0xF8, 0x61, 0x80, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D,
+    0xF8, 0x61, 0x80, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x20, 0x51, 0xF8, 0x61,
+    0x80, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x00, 0x02, 0x20, 0x64, 0xF8, 0x61, 0x80, 0x20,
+    0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x61, 0x80, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x00,
+    0x02, 0x20, 0x89, 0xF8, 0xC1, 0x80, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x8D, 0x00, 0x02,
+    0x68, 0x20, 0x9A, 0xF8, 0xC1, 0x80, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x8D, 0x00, 0x02,
+    0x68, 0xC1, 0x80, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x8D, 0x00, 0x02, 0x68, 0x20, 0xB2,
+    0xF8, 0xC1, 0x80, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80,
+    0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80, 0x20, 0xC9, 0xF8,
+    0xC8, 0x48, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40,
+    0x8D, 0x00, 0x02, 0x20, 0x31, 0xF9, 0xE1, 0x80, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x00,
+    0x02, 0x20, 0x47, 0xF9, 0xE1, 0x80, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x00, 0x02, 0x20,
+    0x5C, 0xF9, 0xE1, 0x80, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x00, 0x02, 0x20, 0x72, 0xF9,
+    0xE1, 0x80, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x20, 0x80, 0xF9, 0xE1, 0x80,
+    0x20, 0x84, 0xF9, 0x60, 0xA9, 0x55, 0x85, 0x78, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x11,
+    0xA2, 0x23, 0xA9, 0x00, 0xA5, 0x78, 0xF0, 0x10, 0x30, 0x0E, 0xC9, 0x55, 0xD0, 0x0A, 0xC0, 0x11,
+    0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0x76, 0x85, 0x00, 0xA9, 0x46, 0x24, 0x01,
+    0x85, 0x78, 0xF0, 0x0A, 0x10, 0x08, 0x50, 0x06, 0xA5, 0x78, 0xC9, 0x46, 0xF0, 0x04, 0xA9, 0x77,
+    0x85, 0x00, 0xA9, 0x55, 0x85, 0x78, 0x24, 0x01, 0xA9, 0x11, 0xA2, 0x23, 0xA0, 0x00, 0xA4, 0x78,
+    0xF0, 0x10, 0x30, 0x0E, 0xC0, 0x55, 0xD0, 0x0A, 0xC9, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02,
+    0xF0, 0x04, 0xA9, 0x78, 0x85, 0x00, 0xA0, 0x46, 0x24, 0x01, 0x84, 0x78, 0xF0, 0x0A, 0x10, 0x08,
+    0x50, 0x06, 0xA4, 0x78, 0xC0, 0x46, 0xF0, 0x04, 0xA9, 0x79, 0x85, 0x00, 0x24, 0x01, 0xA9, 0x55,
+    0x85, 0x78, 0xA0, 0x11, 0xA9, 0x23, 0xA2, 0x00, 0xA6, 0x78, 0xF0, 0x10, 0x30, 0x0E, 0xE0, 0x55,
+    0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xC9, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0x7A, 0x85, 0x00,
+    0xA2, 0x46, 0x24, 0x01, 0x86, 0x78, 0xF0, 0x0A, 0x10, 0x08, 0x50, 0x06, 0xA6, 0x78, 0xE0, 0x46,
+    0xF0, 0x04, 0xA9, 0x7B, 0x85, 0x00, 0xA9, 0xC0, 0x85, 0x78, 0xA2, 0x33, 0xA0, 0x88, 0xA9, 0x05,
+    0x24, 0x78, 0x10, 0x10, 0x50, 0x0E, 0xD0, 0x0C, 0xC9, 0x05, 0xD0, 0x08, 0xE0, 0x33, 0xD0, 0x04,
+    0xC0, 0x88, 0xF0, 0x04, 0xA9, 0x7C, 0x85, 0x00, 0xA9, 0x03, 0x85, 0x78, 0xA9, 0x01, 0x24, 0x78,
+    0x30, 0x08, 0x70, 0x06, 0xF0, 0x04, 0xC9, 0x01, 0xF0, 0x04, 0xA9, 0x7D, 0x85, 0x00, 0xA0, 0x7E,
+    0xA9, 0xAA, 0x85, 0x78, 0x20, 0xB6, 0xF7, 0x05, 0x78, 0x20, 0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x85,
+    0x78, 0x20, 0xCE, 0xF7, 0x05, 0x78, 0x20, 0xD3, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0xDF,
+    0xF7, 0x25, 0x78, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x85, 0x78, 0x20, 0xF1, 0xF7, 0x25, 0x78,
+    0x20, 0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0x04, 0xF8, 0x45, 0x78, 0x20, 0x0A, 0xF8,
+    0xC8, 0xA9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xF8, 0x45, 0x78, 0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69,
+    0x85, 0x78, 0x20, 0x29, 0xF8, 0x65, 0x78, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D, 0xF8, 0x65, 0x78,
+    0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x51, 0xF8, 0x65, 0x78, 0x20, 0x56, 0xF8,
+    0xC8, 0xA9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xF8, 0x65, 0x78, 0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78,
+    0xF8, 0x65, 0x78, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xF8, 0xC5, 0x78,
+    0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x85, 0x78, 0x68, 0x20, 0x9A, 0xF8, 0xC5, 0x78, 0x20,
+    0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xA8, 0xF8, 0xC8, 0x48,
+    0xA9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xB2, 0xF8, 0xC5, 0x78, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9,
+    0x80, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x85, 0x78, 0x68,
+    0xC5, 0x78, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xD3,
+    0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xF9, 0xE5, 0x78, 0x20, 0x37, 0xF9, 0xC8, 0xA9,
+    0x3F, 0x85, 0x78, 0x20, 0x47, 0xF9, 0xE5, 0x78, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x85, 0x78,
+    0x20, 0x5C, 0xF9, 0xE5, 0x78, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0x72, 0xF9,
+    0xE5, 0x78, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x80, 0xF9, 0xE5, 0x78, 0x20,
+    0x84, 0xF9, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xF8, 0xAA, 0xE4, 0x78, 0x20, 0x8E, 0xF8,
+    0xC8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0x9A, 0xF8, 0xE4, 0x78, 0x20, 0x9C, 0xF8, 0xC8, 0xA9, 0x41,
+    0x85, 0x78, 0xE4, 0x78, 0x20, 0xA8, 0xF8, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0xB2, 0xF8, 0xAA,
+    0xE4, 0x78, 0x20, 0xB5, 0xF8, 0xC8, 0xA9, 0x80, 0x85, 0x78, 0xE4, 0x78, 0x20, 0xBF, 0xF8, 0xC8,
+    0xA9, 0x81, 0x85, 0x78, 0xE4, 0x78, 0x20, 0xC9, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0xE4, 0x78,
+    0x20, 0xD3, 0xF8, 0xC8, 0x98, 0xAA, 0xA9, 0x40, 0x85, 0x78, 0x20, 0xDD, 0xF8, 0xC4, 0x78, 0x20,
+    0xE2, 0xF8, 0xE8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0xEE, 0xF8, 0xC4, 0x78, 0x20, 0xF0, 0xF8, 0xE8,
+    0xA9, 0x41, 0x85, 0x78, 0xC4, 0x78, 0x20, 0xFC, 0xF8, 0xE8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0x06,
+    0xF9, 0xC4, 0x78, 0x20, 0x09, 0xF9, 0xE8, 0xA9, 0x80, 0x85, 0x78, 0xC4, 0x78, 0x20, 0x13, 0xF9,
+    0xE8, 0xA9, 0x81, 0x85, 0x78, 0xC4, 0x78, 0x20, 0x1D, 0xF9, 0xE8, 0xA9, 0x7F, 0x85, 0x78, 0xC4,
+    0x78, 0x20, 0x27, 0xF9, 0xE8, 0x8A, 0xA8, 0x20, 0x90, 0xF9, 0x85, 0x78, 0x46, 0x78, 0xA5, 0x78,
+    0x20, 0x9D, 0xF9, 0xC8, 0x85, 0x78, 0x46, 0x78, 0xA5, 0x78, 0x20, 0xAD, 0xF9, 0xC8, 0x20, 0xBD,
+    0xF9, 0x85, 0x78, 0x06, 0x78, 0xA5, 0x78, 0x20, 0xC3, 0xF9, 0xC8, 0x85, 0x78, 0x06, 0x78, 0xA5,
+    0x78, 0x20, 0xD4, 0xF9, 0xC8, 0x20, 0xE4, 0xF9, 0x85, 0x78, 0x66, 0x78, 0xA5, 0x78, 0x20, 0xEA,
+    0xF9, 0xC8, 0x85, 0x78, 0x66, 0x78, 0xA5, 0x78, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x85,
+    0x78, 0x26, 0x78, 0xA5, 0x78, 0x20, 0x10, 0xFA, 0xC8, 0x85, 0x78, 0x26, 0x78, 0xA5, 0x78, 0x20,
+    0x21, 0xFA, 0xA9, 0xFF, 0x85, 0x78, 0x85, 0x01, 0x24, 0x01, 0x38, 0xE6, 0x78, 0xD0, 0x0C, 0x30,
+    0x0A, 0x50, 0x08, 0x90, 0x06, 0xA5, 0x78, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0xAB, 0x85, 0x00, 0xA9,
+    0x7F, 0x85, 0x78, 0xB8, 0x18, 0xE6, 0x78, 0xF0, 0x0C, 0x10, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xA5,
+    0x78, 0xC9, 0x80, 0xF0, 0x04, 0xA9, 0xAC, 0x85, 0x00, 0xA9, 0x00, 0x85, 0x78, 0x24, 0x01, 0x38,
+    0xC6, 0x78, 0xF0, 0x0C, 0x10, 0x0A, 0x50, 0x08, 0x90, 0x06, 0xA5, 0x78, 0xC9, 0xFF, 0xF0, 0x04,
+    0xA9, 0xAD, 0x85, 0x00, 0xA9, 0x80, 0x85, 0x78, 0xB8, 0x18, 0xC6, 0x78, 0xF0, 0x0C, 0x30, 0x0A,
+    0x70, 0x08, 0xB0, 0x06, 0xA5, 0x78, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0xAE, 0x85, 0x00, 0xA9, 0x01,
+    0x85, 0x78, 0xC6, 0x78, 0xF0, 0x04, 0xA9, 0xAF, 0x85, 0x00, 0x60, 0xA9, 0x55, 0x8D, 0x78, 0x06,
+    0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x11, 0xA2, 0x23, 0xA9, 0x00, 0xAD, 0x78, 0x06, 0xF0,
+    0x10, 0x30, 0x0E, 0xC9, 0x55, 0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0,
+    0x04, 0xA9, 0xB0, 0x85, 0x00, 0xA9, 0x46, 0x24, 0x01, 0x8D, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09,
+    0x50, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x46, 0xF0, 0x04, 0xA9, 0xB1, 0x85, 0x00, 0xA9, 0x55, 0x8D,
+    0x78, 0x06, 0x24, 0x01, 0xA9, 0x11, 0xA2, 0x23, 0xA0, 0x00, 0xAC, 0x78, 0x06, 0xF0, 0x10, 0x30,
+    0x0E, 0xC0, 0x55, 0xD0, 0x0A, 0xC9, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9,
+    0xB2, 0x85, 0x00, 0xA0, 0x46, 0x24, 0x01, 0x8C, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09, 0x50, 0x07,
+    0xAC, 0x78, 0x06, 0xC0, 0x46, 0xF0, 0x04, 0xA9, 0xB3, 0x85, 0x00, 0x24, 0x01, 0xA9, 0x55, 0x8D,
+    0x78, 0x06, 0xA0, 0x11, 0xA9, 0x23, 0xA2, 0x00, 0xAE, 0x78, 0x06, 0xF0, 0x10, 0x30, 0x0E, 0xE0,
+    0x55, 0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xC9, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0xB4, 0x85,
+    0x00, 0xA2, 0x46, 0x24, 0x01, 0x8E, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09, 0x50, 0x07, 0xAE, 0x78,
+    0x06, 0xE0, 0x46, 0xF0, 0x04, 0xA9, 0xB5, 0x85, 0x00, 0xA9, 0xC0, 0x8D, 0x78, 0x06, 0xA2, 0x33,
+    0xA0, 0x88, 0xA9, 0x05, 0x2C, 0x78, 0x06, 0x10, 0x10, 0x50, 0x0E, 0xD0, 0x0C, 0xC9, 0x05, 0xD0,
+    0x08, 0xE0, 0x33, 0xD0, 0x04, 0xC0, 0x88, 0xF0, 0x04, 0xA9, 0xB6, 0x85, 0x00, 0xA9, 0x03, 0x8D,
+    0x78, 0x06, 0xA9, 0x01, 0x2C, 0x78, 0x06, 0x30, 0x08, 0x70, 0x06, 0xF0, 0x04, 0xC9, 0x01, 0xF0,
+    0x04, 0xA9, 0xB7, 0x85, 0x00, 0xA0, 0xB8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xB6, 0xF7, 0x0D,
+    0x78, 0x06, 0x20, 0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xCE, 0xF7, 0x0D, 0x78,
+    0x06, 0x20, 0xD3, 0xF7, 0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xDF, 0xF7, 0x2D, 0x78, 0x06,
+    0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x8D, 0x78, 0x06, 0x20, 0xF1, 0xF7, 0x2D, 0x78, 0x06, 0x20,
+    0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0x04, 0xF8, 0x4D, 0x78, 0x06, 0x20, 0x0A,
+    0xF8, 0xC8, 0xA9, 0x70, 0x8D, 0x78, 0x06, 0x20, 0x18, 0xF8, 0x4D, 0x78, 0x06, 0x20, 0x1D, 0xF8,
+    0xC8, 0xA9, 0x69, 0x8D, 0x78, 0x06, 0x20, 0x29, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x2F, 0xF8, 0xC8,
+    0x20, 0x3D, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20,
+    0x51, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x20, 0x64,
+    0xF8, 0x6D, 0x78, 0x06, 0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x7D,
+    0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0x8E, 0xF8,
+    0xC8, 0x48, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x68, 0x20, 0x9A, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0x9C,
+    0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xA8, 0xF8, 0xC8,
+    0x48, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x68, 0x20, 0xB2, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0xB5, 0xF8,
+    0xC8, 0x48, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0x48,
+    0xA9, 0x81, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F,
+    0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06,
+    0x20, 0x31, 0xF9, 0xED, 0x78, 0x06, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20,
+    0x47, 0xF9, 0xED, 0x78, 0x06, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x20, 0x5C,
+    0xF9, 0xED, 0x78, 0x06, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x72, 0xF9,
+    0xED, 0x78, 0x06, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x80, 0xF9, 0xED,
+    0x78, 0x06, 0x20, 0x84, 0xF9, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xAA, 0xEC,
+    0x78, 0x06, 0x20, 0x8E, 0xF8, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0x9A, 0xF8, 0xEC, 0x78,
+    0x06, 0x20, 0x9C, 0xF8, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xA8, 0xF8,
+    0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xB2, 0xF8, 0xAA, 0xEC, 0x78, 0x06, 0x20, 0xB5, 0xF8,
+    0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0xA9, 0x81, 0x8D,
+    0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xEC, 0x78,
+    0x06, 0x20, 0xD3, 0xF8, 0xC8, 0x98, 0xAA, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0xDD, 0xF8, 0xCC,
+    0x78, 0x06, 0x20, 0xE2, 0xF8, 0xE8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0xEE, 0xF8, 0xCC, 0x78,
+    0x06, 0x20, 0xF0, 0xF8, 0xE8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06, 0x20, 0xFC, 0xF8,
+    0xE8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x06, 0xF9, 0xCC, 0x78, 0x06, 0x20, 0x09, 0xF9, 0xE8,
+    0xA9, 0x80, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06, 0x20, 0x13, 0xF9, 0xE8, 0xA9, 0x81, 0x8D, 0x78,
+    0x06, 0xCC, 0x78, 0x06, 0x20, 0x1D, 0xF9, 0xE8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06,
+    0x20, 0x27, 0xF9, 0xE8, 0x8A, 0xA8, 0x20, 0x90, 0xF9, 0x8D, 0x78, 0x06, 0x4E, 0x78, 0x06, 0xAD,
+    0x78, 0x06, 0x20, 0x9D, 0xF9, 0xC8, 0x8D, 0x78, 0x06, 0x4E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20,
+    0xAD, 0xF9, 0xC8, 0x20, 0xBD, 0xF9, 0x8D, 0x78, 0x06, 0x0E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20,
+    0xC3, 0xF9, 0xC8, 0x8D, 0x78, 0x06, 0x0E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xD4, 0xF9, 0xC8,
+    0x20, 0xE4, 0xF9, 0x8D, 0x78, 0x06, 0x6E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xEA, 0xF9, 0xC8,
+    0x8D, 0x78, 0x06, 0x6E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA,
+    0x8D, 0x78, 0x06, 0x2E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0x10, 0xFA, 0xC8, 0x8D, 0x78, 0x06,
+    0x2E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x8D, 0x78, 0x06, 0x85, 0x01,
+    0x24, 0x01, 0x38, 0xEE, 0x78, 0x06, 0xD0, 0x0D, 0x30, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xAD, 0x78,
+    0x06, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0xE5, 0x85, 0x00, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xB8, 0x18,
+    0xEE, 0x78, 0x06, 0xF0, 0x0D, 0x10, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x80,
+    0xF0, 0x04, 0xA9, 0xE6, 0x85, 0x00, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x24, 0x01, 0x38, 0xCE, 0x78,
+    0x06, 0xF0, 0x0D, 0x10, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0xFF, 0xF0, 0x04,
+    0xA9, 0xE7, 0x85, 0x00, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0xB8, 0x18, 0xCE, 0x78, 0x06, 0xF0, 0x0D,
+    0x30, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0xE8, 0x85,
+    0x00, 0xA9, 0x01, 0x8D, 0x78, 0x06, 0xCE, 0x78, 0x06, 0xF0, 0x04, 0xA9, 0xE9, 0x85, 0x00, 0x60,
+    0xA9, 0xA3, 0x85, 0x33, 0xA9, 0x89, 0x8D, 0x00, 0x03, 0xA9, 0x12, 0x8D, 0x45, 0x02, 0xA9, 0xFF,
+    0x85, 0x01, 0xA2, 0x65, 0xA9, 0x00, 0x85, 0x89, 0xA9, 0x03, 0x85, 0x8A, 0xA0, 0x00, 0x38, 0xA9,
+    0x00, 0xB8, 0xB1, 0x89, 0xF0, 0x0C, 0x90, 0x0A, 0x70, 0x08, 0xC9, 0x89, 0xD0, 0x04, 0xE0, 0x65,
+    0xF0, 0x04, 0xA9, 0xEA, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x97, 0x85, 0x98, 0x24, 0x98, 0xA0, 0x34,
+    0xB1, 0x97, 0xC9, 0xA3, 0xD0, 0x02, 0xB0, 0x04, 0xA9, 0xEB, 0x85, 0x00, 0xA5, 0x00, 0x48, 0xA9,
+    0x46, 0x85, 0xFF, 0xA9, 0x01, 0x85, 0x00, 0xA0, 0xFF, 0xB1, 0xFF, 0xC9, 0x12, 0xF0, 0x04, 0x68,
+    0xA9, 0xEC, 0x48, 0x68, 0x85, 0x00, 0xA2, 0xED, 0xA9, 0x00, 0x85, 0x33, 0xA9, 0x04, 0x85, 0x34,
+    0xA0, 0x00, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0xAA, 0x8D, 0x00, 0x04, 0xA9, 0x55,
+    0x11, 0x33, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x38,
+    0xB8, 0xA9, 0x00, 0x11, 0x33, 0xF0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8,
+    0x18, 0x24, 0x01, 0xA9, 0x55, 0x31, 0x33, 0xD0, 0x06, 0x50, 0x04, 0xB0, 0x02, 0x10, 0x02, 0x86,
+    0x00, 0xE8, 0x38, 0xB8, 0xA9, 0xEF, 0x8D, 0x00, 0x04, 0xA9, 0xF8, 0x31, 0x33, 0x90, 0x08, 0x10,
+    0x06, 0xC9, 0xE8, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0xAA, 0x8D,
+    0x00, 0x04, 0xA9, 0x5F, 0x51, 0x33, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xF5, 0xD0, 0x02, 0x70, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x70, 0x8D, 0x00, 0x04, 0x51, 0x33, 0xD0, 0x06, 0x70, 0x04,
+    0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x69, 0x8D, 0x00, 0x04, 0xA9,
+    0x00, 0x71, 0x33, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x69, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8,
+    0x38, 0x24, 0x01, 0xA9, 0x00, 0x71, 0x33, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x6A, 0xD0, 0x02, 0x50,
+    0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x7F, 0x8D, 0x00, 0x04, 0x71, 0x33, 0x10, 0x08, 0xB0,
+    0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x80, 0x8D,
+    0x00, 0x04, 0xA9, 0x7F, 0x71, 0x33, 0x10, 0x08, 0xB0, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x50, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x80, 0x8D, 0x00, 0x04, 0xA9, 0x7F, 0x71, 0x33, 0xD0, 0x06,
+    0x30, 0x04, 0x70, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0x24, 0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04,
+    0xD1, 0x33, 0x30, 0x06, 0x90, 0x04, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0xCE, 0x00,
+    0x04, 0xD1, 0x33, 0xF0, 0x06, 0x30, 0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00,
+    0x04, 0xEE, 0x00, 0x04, 0xD1, 0x33, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0x8D,
+    0x00, 0x04, 0xA9, 0x80, 0xD1, 0x33, 0xF0, 0x04, 0x10, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xA0,
+    0x80, 0x8C, 0x00, 0x04, 0xA0, 0x00, 0xD1, 0x33, 0xD0, 0x04, 0x30, 0x02, 0xB0, 0x02, 0x86, 0x00,
+    0xE8, 0xEE, 0x00, 0x04, 0xD1, 0x33, 0xB0, 0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xCE,
+    0x00, 0x04, 0xCE, 0x00, 0x04, 0xD1, 0x33, 0x90, 0x04, 0xF0, 0x02, 0x10, 0x02, 0x86, 0x00, 0x60,
+    0xA9, 0x00, 0x85, 0x33, 0xA9, 0x04, 0x85, 0x34, 0xA0, 0x00, 0xA2, 0x01, 0x24, 0x01, 0xA9, 0x40,
+    0x8D, 0x00, 0x04, 0x38, 0xF1, 0x33, 0x30, 0x0A, 0x90, 0x08, 0xD0, 0x06, 0x70, 0x04, 0xC9, 0x00,
+    0xF0, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0x38, 0xA9, 0x40, 0xCE, 0x00, 0x04, 0xF1, 0x33, 0xF0, 0x0A,
+    0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xC9, 0x01, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x40, 0x38,
+    0x24, 0x01, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xF1, 0x33, 0xB0, 0x0A, 0xF0, 0x08, 0x10, 0x06,
+    0x70, 0x04, 0xC9, 0xFF, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x18, 0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9,
+    0x80, 0xF1, 0x33, 0x90, 0x04, 0xC9, 0x7F, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xA9, 0x7F, 0x8D,
+    0x00, 0x04, 0xA9, 0x81, 0xF1, 0x33, 0x50, 0x06, 0x90, 0x04, 0xC9, 0x02, 0xF0, 0x02, 0x86, 0x00,
+    0xE8, 0xA9, 0x00, 0xA9, 0x87, 0x91, 0x33, 0xAD, 0x00, 0x04, 0xC9, 0x87, 0xF0, 0x02, 0x86, 0x00,
+    0xE8, 0xA9, 0x7E, 0x8D, 0x00, 0x02, 0xA9, 0xDB, 0x8D, 0x01, 0x02, 0x6C, 0x00, 0x02, 0xA9, 0x00,
+    0x8D, 0xFF, 0x02, 0xA9, 0x01, 0x8D, 0x00, 0x03, 0xA9, 0x03, 0x8D, 0x00, 0x02, 0xA9, 0xA9, 0x8D,
+    0x00, 0x01, 0xA9, 0x55, 0x8D, 0x01, 0x01, 0xA9, 0x60, 0x8D, 0x02, 0x01, 0xA9, 0xA9, 0x8D, 0x00,
+    0x03, 0xA9, 0xAA, 0x8D, 0x01, 0x03, 0xA9, 0x60, 0x8D, 0x02, 0x03, 0x20, 0xB5, 0xDB, 0xC9, 0xAA,
+    0xF0, 0x02, 0x86, 0x00, 0x60, 0x6C, 0xFF, 0x02, 0xA9, 0xFF, 0x85, 0x01, 0xA9, 0xAA, 0x85, 0x33,
+    0xA9, 0xBB, 0x85, 0x89, 0xA2, 0x00, 0xA9, 0x66, 0x24, 0x01, 0x38, 0xA0, 0x00, 0xB4, 0x33, 0x10,
+    0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC0,
+    0xAA, 0xF0, 0x04, 0xA9, 0x08, 0x85, 0x00, 0xA2, 0x8A, 0xA9, 0x66, 0xB8, 0x18, 0xA0, 0x00, 0xB4,
+    0xFF, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC0, 0xBB, 0xD0, 0x08, 0xC9, 0x66, 0xD0,
+    0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x09, 0x85, 0x00, 0x24, 0x01, 0x38, 0xA0, 0x44, 0xA2, 0x00,
+    0x94, 0x33, 0xA5, 0x33, 0x90, 0x18, 0xC9, 0x44, 0xD0, 0x14, 0x50, 0x12, 0x18, 0xB8, 0xA0, 0x99,
+    0xA2, 0x80, 0x94, 0x85, 0xA5, 0x05, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x0A,
+    0x85, 0x00, 0xA0, 0x0B, 0xA9, 0xAA, 0xA2, 0x78, 0x85, 0x78, 0x20, 0xB6, 0xF7, 0x15, 0x00, 0x20,
+    0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0xCE, 0xF7, 0x15, 0x00, 0x20, 0xD3, 0xF7, 0xC8,
+    0xA9, 0xAA, 0x85, 0x78, 0x20, 0xDF, 0xF7, 0x35, 0x00, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x85,
+    0x78, 0x20, 0xF1, 0xF7, 0x35, 0x00, 0x20, 0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0x04,
+    0xF8, 0x55, 0x00, 0x20, 0x0A, 0xF8, 0xC8, 0xA9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xF8, 0x55, 0x00,
+    0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69, 0x85, 0x78, 0x20, 0x29, 0xF8, 0x75, 0x00, 0x20, 0x2F, 0xF8,
+    0xC8, 0x20, 0x3D, 0xF8, 0x75, 0x00, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x51,
+    0xF8, 0x75, 0x00, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xF8, 0x75, 0x00,
+    0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x75, 0x00, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x85,
+    0x78, 0x20, 0x89, 0xF8, 0xD5, 0x00, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x85, 0x78, 0x68,
+    0x20, 0x9A, 0xF8, 0xD5, 0x00, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x85, 0x78, 0x68, 0xD5,
+    0x00, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xB2, 0xF8, 0xD5, 0x00,
+    0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80, 0x85, 0x78, 0x68, 0xD5, 0x00, 0x20, 0xBF, 0xF8, 0xC8,
+    0x48, 0xA9, 0x81, 0x85, 0x78, 0x68, 0xD5, 0x00, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x85,
+    0x78, 0x68, 0xD5, 0x00, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xF9, 0xF5,
+    0x00, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0x47, 0xF9, 0xF5, 0x00, 0x20, 0x4C,
+    0xF9, 0xC8, 0xA9, 0x41, 0x85, 0x78, 0x20, 0x5C, 0xF9, 0xF5, 0x00, 0x20, 0x62, 0xF9, 0xC8, 0xA9,
+    0x00, 0x85, 0x78, 0x20, 0x72, 0xF9, 0xF5, 0x00, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x85, 0x78,
+    0x20, 0x80, 0xF9, 0xF5, 0x00, 0x20, 0x84, 0xF9, 0xA9, 0xAA, 0x85, 0x33, 0xA9, 0xBB, 0x85, 0x89,
+    0xA2, 0x00, 0xA0, 0x66, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xB5, 0x33, 0x10, 0x12, 0xF0, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC0, 0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC9, 0xAA, 0xF0, 0x04, 0xA9,
+    0x22, 0x85, 0x00, 0xA2, 0x8A, 0xA0, 0x66, 0xB8, 0x18, 0xA9, 0x00, 0xB5, 0xFF, 0x10, 0x12, 0xF0,
+    0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xBB, 0xD0, 0x08, 0xC0, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0,
+    0x04, 0xA9, 0x23, 0x85, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x44, 0xA2, 0x00, 0x95, 0x33, 0xA5, 0x33,
+    0x90, 0x18, 0xC9, 0x44, 0xD0, 0x14, 0x50, 0x12, 0x18, 0xB8, 0xA9, 0x99, 0xA2, 0x80, 0x95, 0x85,
+    0xA5, 0x05, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x24, 0x85, 0x00, 0xA0, 0x25,
+    0xA2, 0x78, 0x20, 0x90, 0xF9, 0x95, 0x00, 0x56, 0x00, 0xB5, 0x00, 0x20, 0x9D, 0xF9, 0xC8, 0x95,
+    0x00, 0x56, 0x00, 0xB5, 0x00, 0x20, 0xAD, 0xF9, 0xC8, 0x20, 0xBD, 0xF9, 0x95, 0x00, 0x16, 0x00,
+    0xB5, 0x00, 0x20, 0xC3, 0xF9, 0xC8, 0x95, 0x00, 0x16, 0x00, 0xB5, 0x00, 0x20, 0xD4, 0xF9, 0xC8,
+    0x20, 0xE4, 0xF9, 0x95, 0x00, 0x76, 0x00, 0xB5, 0x00, 0x20, 0xEA, 0xF9, 0xC8, 0x95, 0x00, 0x76,
+    0x00, 0xB5, 0x00, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x95, 0x00, 0x36, 0x00, 0xB5, 0x00,
+    0x20, 0x10, 0xFA, 0xC8, 0x95, 0x00, 0x36, 0x00, 0xB5, 0x00, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x95,
+    0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xF6, 0x00, 0xD0, 0x0C, 0x30, 0x0A, 0x50, 0x08, 0x90, 0x06,
+    0xB5, 0x00, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x2D, 0x85, 0x00, 0xA9, 0x7F, 0x95, 0x00, 0xB8, 0x18,
+    0xF6, 0x00, 0xF0, 0x0C, 0x10, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xB5, 0x00, 0xC9, 0x80, 0xF0, 0x04,
+    0xA9, 0x2E, 0x85, 0x00, 0xA9, 0x00, 0x95, 0x00, 0x24, 0x01, 0x38, 0xD6, 0x00, 0xF0, 0x0C, 0x10,
+    0x0A, 0x50, 0x08, 0x90, 0x06, 0xB5, 0x00, 0xC9, 0xFF, 0xF0, 0x04, 0xA9, 0x2F, 0x85, 0x00, 0xA9,
+    0x80, 0x95, 0x00, 0xB8, 0x18, 0xD6, 0x00, 0xF0, 0x0C, 0x30, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xB5,
+    0x00, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0x30, 0x85, 0x00, 0xA9, 0x01, 0x95, 0x00, 0xD6, 0x00, 0xF0,
+    0x04, 0xA9, 0x31, 0x85, 0x00, 0xA9, 0x33, 0x85, 0x78, 0xA9, 0x44, 0xA0, 0x78, 0xA2, 0x00, 0x38,
+    0x24, 0x01, 0xB6, 0x00, 0x90, 0x12, 0x50, 0x10, 0x30, 0x0E, 0xF0, 0x0C, 0xE0, 0x33, 0xD0, 0x08,
+    0xC0, 0x78, 0xD0, 0x04, 0xC9, 0x44, 0xF0, 0x04, 0xA9, 0x32, 0x85, 0x00, 0xA9, 0x97, 0x85, 0x7F,
+    0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x00, 0x18, 0xB8, 0xB6, 0x80, 0xB0, 0x12, 0x70, 0x10, 0x10, 0x0E,
+    0xF0, 0x0C, 0xE0, 0x97, 0xD0, 0x08, 0xC0, 0xFF, 0xD0, 0x04, 0xC9, 0x47, 0xF0, 0x04, 0xA9, 0x33,
+    0x85, 0x00, 0xA9, 0x00, 0x85, 0x7F, 0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x69, 0x18, 0xB8, 0x96, 0x80,
+    0xB0, 0x18, 0x70, 0x16, 0x30, 0x14, 0xF0, 0x12, 0xE0, 0x69, 0xD0, 0x0E, 0xC0, 0xFF, 0xD0, 0x0A,
+    0xC9, 0x47, 0xD0, 0x06, 0xA5, 0x7F, 0xC9, 0x69, 0xF0, 0x04, 0xA9, 0x34, 0x85, 0x00, 0xA9, 0xF5,
+    0x85, 0x4F, 0xA9, 0x47, 0xA0, 0x4F, 0x24, 0x01, 0xA2, 0x00, 0x38, 0x96, 0x00, 0x90, 0x16, 0x50,
+    0x14, 0x30, 0x12, 0xD0, 0x10, 0xE0, 0x00, 0xD0, 0x0C, 0xC0, 0x4F, 0xD0, 0x08, 0xC9, 0x47, 0xD0,
+    0x04, 0xA5, 0x4F, 0xF0, 0x04, 0xA9, 0x35, 0x85, 0x00, 0x60, 0xA9, 0x89, 0x8D, 0x00, 0x03, 0xA9,
+    0xA3, 0x85, 0x33, 0xA9, 0x12, 0x8D, 0x45, 0x02, 0xA2, 0x65, 0xA0, 0x00, 0x38, 0xA9, 0x00, 0xB8,
+    0xB9, 0x00, 0x03, 0xF0, 0x0C, 0x90, 0x0A, 0x70, 0x08, 0xC9, 0x89, 0xD0, 0x04, 0xE0, 0x65, 0xF0,
+    0x04, 0xA9, 0x36, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x34, 0xB9, 0xFF, 0xFF,
+    0xC9, 0xA3, 0xD0, 0x02, 0xB0, 0x04, 0xA9, 0x37, 0x85, 0x00, 0xA9, 0x46, 0x85, 0xFF, 0xA0, 0xFF,
+    0xB9, 0x46, 0x01, 0xC9, 0x12, 0xF0, 0x04, 0xA9, 0x38, 0x85, 0x00, 0xA2, 0x39, 0x18, 0xA9, 0xFF,
+    0x85, 0x01, 0x24, 0x01, 0xA9, 0xAA, 0x8D, 0x00, 0x04, 0xA9, 0x55, 0xA0, 0x00, 0x19, 0x00, 0x04,
+    0xB0, 0x08, 0x10, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9,
+    0x00, 0x19, 0x00, 0x04, 0xF0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0x18,
+    0x24, 0x01, 0xA9, 0x55, 0x39, 0x00, 0x04, 0xD0, 0x06, 0x50, 0x04, 0xB0, 0x02, 0x10, 0x02, 0x86,
+    0x00, 0xE8, 0x38, 0xB8, 0xA9, 0xEF, 0x8D, 0x00, 0x04, 0xA9, 0xF8, 0x39, 0x00, 0x04, 0x90, 0x08,
+    0x10, 0x06, 0xC9, 0xE8, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0xAA,
+    0x8D, 0x00, 0x04, 0xA9, 0x5F, 0x59, 0x00, 0x04, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xF5, 0xD0, 0x02,
+    0x70, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x70, 0x8D, 0x00, 0x04, 0x59, 0x00, 0x04, 0xD0,
+    0x06, 0x70, 0x04, 0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x69, 0x8D,
+    0x00, 0x04, 0xA9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x69, 0xD0, 0x02, 0x50,
+    0x02, 0x86, 0x00, 0xE8, 0x38, 0x24, 0x01, 0xA9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xB0, 0x06,
+    0xC9, 0x6A, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x7F, 0x8D, 0x00, 0x04,
+    0x79, 0x00, 0x04, 0x10, 0x08, 0xB0, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8,
+    0x18, 0x24, 0x01, 0xA9, 0x80, 0x8D, 0x00, 0x04, 0xA9, 0x7F, 0x79, 0x00, 0x04, 0x10, 0x08, 0xB0,
+    0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x80, 0x8D, 0x00,
+    0x04, 0xA9, 0x7F, 0x79, 0x00, 0x04, 0xD0, 0x06, 0x30, 0x04, 0x70, 0x02, 0xB0, 0x02, 0x86, 0x00,
+    0xE8, 0x24, 0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04, 0xD9, 0x00, 0x04, 0x30, 0x06, 0x90, 0x04, 0xD0,
+    0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0xCE, 0x00, 0x04, 0xD9, 0x00, 0x04, 0xF0, 0x06, 0x30,
+    0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xD9, 0x00,
+    0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9, 0x80, 0xD9,
+    0x00, 0x04, 0xF0, 0x04, 0x10, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xA0, 0x80, 0x8C, 0x00, 0x04,
+    0xA0, 0x00, 0xD9, 0x00, 0x04, 0xD0, 0x04, 0x30, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00,
+    0x04, 0xD9, 0x00, 0x04, 0xB0, 0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xCE, 0x00, 0x04,
+    0xCE, 0x00, 0x04, 0xD9, 0x00, 0x04, 0x90, 0x04, 0xF0, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x24,
+    0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04, 0x38, 0xF9, 0x00, 0x04, 0x30, 0x0A, 0x90, 0x08, 0xD0, 0x06,
+    0x70, 0x04, 0xC9, 0x00, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0x38, 0xA9, 0x40, 0xCE, 0x00, 0x04,
+    0xF9, 0x00, 0x04, 0xF0, 0x0A, 0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xC9, 0x01, 0xF0, 0x02, 0x86,
+    0x00, 0xE8, 0xA9, 0x40, 0x38, 0x24, 0x01, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xF9, 0x00, 0x04,
+    0xB0, 0x0A, 0xF0, 0x08, 0x10, 0x06, 0x70, 0x04, 0xC9, 0xFF, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x18,
+    0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9, 0x80, 0xF9, 0x00, 0x04, 0x90, 0x04, 0xC9, 0x7F, 0xF0, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xA9, 0x7F, 0x8D, 0x00, 0x04, 0xA9, 0x81, 0xF9, 0x00, 0x04, 0x50, 0x06,
+    0x90, 0x04, 0xC9, 0x02, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0xA9, 0x87, 0x99, 0x00, 0x04,
+    0xAD, 0x00, 0x04, 0xC9, 0x87, 0xF0, 0x02, 0x86, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA9, 0xAA,
+    0x8D, 0x33, 0x06, 0xA9, 0xBB, 0x8D, 0x89, 0x06, 0xA2, 0x00, 0xA9, 0x66, 0x24, 0x01, 0x38, 0xA0,
+    0x00, 0xBC, 0x33, 0x06, 0x10, 0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x66, 0xD0, 0x08,
+    0xE0, 0x00, 0xD0, 0x04, 0xC0, 0xAA, 0xF0, 0x04, 0xA9, 0x51, 0x85, 0x00, 0xA2, 0x8A, 0xA9, 0x66,
+    0xB8, 0x18, 0xA0, 0x00, 0xBC, 0xFF, 0x05, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC0,
+    0xBB, 0xD0, 0x08, 0xC9, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x52, 0x85, 0x00, 0xA0,
+    0x53, 0xA9, 0xAA, 0xA2, 0x78, 0x8D, 0x78, 0x06, 0x20, 0xB6, 0xF7, 0x1D, 0x00, 0x06, 0x20, 0xC0,
+    0xF7, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xCE, 0xF7, 0x1D, 0x00, 0x06, 0x20, 0xD3, 0xF7,
+    0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xDF, 0xF7, 0x3D, 0x00, 0x06, 0x20, 0xE5, 0xF7, 0xC8,
+    0xA9, 0xEF, 0x8D, 0x78, 0x06, 0x20, 0xF1, 0xF7, 0x3D, 0x00, 0x06, 0x20, 0xF6, 0xF7, 0xC8, 0xA9,
+    0xAA, 0x8D, 0x78, 0x06, 0x20, 0x04, 0xF8, 0x5D, 0x00, 0x06, 0x20, 0x0A, 0xF8, 0xC8, 0xA9, 0x70,
+    0x8D, 0x78, 0x06, 0x20, 0x18, 0xF8, 0x5D, 0x00, 0x06, 0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69, 0x8D,
+    0x78, 0x06, 0x20, 0x29, 0xF8, 0x7D, 0x00, 0x06, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D, 0xF8, 0x7D,
+    0x00, 0x06, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x51, 0xF8, 0x7D, 0x00,
+    0x06, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x20, 0x64, 0xF8, 0x7D, 0x00, 0x06,
+    0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x7D, 0x00, 0x06, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40,
+    0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F,
+    0x8D, 0x78, 0x06, 0x68, 0x20, 0x9A, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9,
+    0x41, 0x8D, 0x78, 0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x8D,
+    0x78, 0x06, 0x68, 0x20, 0xB2, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80,
+    0x8D, 0x78, 0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x8D, 0x78,
+    0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x68,
+    0xDD, 0x00, 0x06, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x31, 0xF9, 0xFD,
+    0x00, 0x06, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0x47, 0xF9, 0xFD, 0x00,
+    0x06, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x20, 0x5C, 0xF9, 0xFD, 0x00, 0x06,
+    0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x72, 0xF9, 0xFD, 0x00, 0x06, 0x20,
+    0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x80, 0xF9, 0xFD, 0x00, 0x06, 0x20, 0x84,
+    0xF9, 0xA9, 0xAA, 0x8D, 0x33, 0x06, 0xA9, 0xBB, 0x8D, 0x89, 0x06, 0xA2, 0x00, 0xA0, 0x66, 0x24,
+    0x01, 0x38, 0xA9, 0x00, 0xBD, 0x33, 0x06, 0x10, 0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC0,
+    0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC9, 0xAA, 0xF0, 0x04, 0xA9, 0x6A, 0x85, 0x00, 0xA2,
+    0x8A, 0xA0, 0x66, 0xB8, 0x18, 0xA9, 0x00, 0xBD, 0xFF, 0x05, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E,
+    0xB0, 0x0C, 0xC9, 0xBB, 0xD0, 0x08, 0xC0, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x6B,
+    0x85, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x44, 0xA2, 0x00, 0x9D, 0x33, 0x06, 0xAD, 0x33, 0x06, 0x90,
+    0x1A, 0xC9, 0x44, 0xD0, 0x16, 0x50, 0x14, 0x18, 0xB8, 0xA9, 0x99, 0xA2, 0x80, 0x9D, 0x85, 0x05,
+    0xAD, 0x05, 0x06, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x6C, 0x85, 0x00, 0xA0,
+    0x6D, 0xA2, 0x6D, 0x20, 0x90, 0xF9, 0x9D, 0x00, 0x06, 0x5E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20,
+    0x9D, 0xF9, 0xC8, 0x9D, 0x00, 0x06, 0x5E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xAD, 0xF9, 0xC8,
+    0x20, 0xBD, 0xF9, 0x9D, 0x00, 0x06, 0x1E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xC3, 0xF9, 0xC8,
+    0x9D, 0x00, 0x06, 0x1E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xD4, 0xF9, 0xC8, 0x20, 0xE4, 0xF9,
+    0x9D, 0x00, 0x06, 0x7E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xEA, 0xF9, 0xC8, 0x9D, 0x00, 0x06,
+    0x7E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x9D, 0x00, 0x06,
+    0x3E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0x10, 0xFA, 0xC8, 0x9D, 0x00, 0x06, 0x3E, 0x00, 0x06,
+    0xBD, 0x00, 0x06, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x9D, 0x00, 0x06, 0x85, 0x01, 0x24, 0x01, 0x38,
+    0xFE, 0x00, 0x06, 0xD0, 0x0D, 0x30, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x00,
+    0xF0, 0x04, 0xA9, 0x75, 0x85, 0x00, 0xA9, 0x7F, 0x9D, 0x00, 0x06, 0xB8, 0x18, 0xFE, 0x00, 0x06,
+    0xF0, 0x0D, 0x10, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x80, 0xF0, 0x04, 0xA9,
+    0x76, 0x85, 0x00, 0xA9, 0x00, 0x9D, 0x00, 0x06, 0x24, 0x01, 0x38, 0xDE, 0x00, 0x06, 0xF0, 0x0D,
+    0x10, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0xFF, 0xF0, 0x04, 0xA9, 0x77, 0x85,
+    0x00, 0xA9, 0x80, 0x9D, 0x00, 0x06, 0xB8, 0x18, 0xDE, 0x00, 0x06, 0xF0, 0x0D, 0x30, 0x0B, 0x70,
+    0x09, 0xB0, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0x78, 0x85, 0x00, 0xA9, 0x01,
+    0x9D, 0x00, 0x06, 0xDE, 0x00, 0x06, 0xF0, 0x04, 0xA9, 0x79, 0x85, 0x00, 0xA9, 0x33, 0x8D, 0x78,
+    0x06, 0xA9, 0x44, 0xA0, 0x78, 0xA2, 0x00, 0x38, 0x24, 0x01, 0xBE, 0x00, 0x06, 0x90, 0x12, 0x50,
+    0x10, 0x30, 0x0E, 0xF0, 0x0C, 0xE0, 0x33, 0xD0, 0x08, 0xC0, 0x78, 0xD0, 0x04, 0xC9, 0x44, 0xF0,
+    0x04, 0xA9, 0x7A, 0x85, 0x00, 0xA9, 0x97, 0x8D, 0x7F, 0x06, 0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x00,
+    0x18, 0xB8, 0xBE, 0x80, 0x05, 0xB0, 0x12, 0x70, 0x10, 0x10, 0x0E, 0xF0, 0x0C, 0xE0, 0x97, 0xD0,
+    0x08, 0xC0, 0xFF, 0xD0, 0x04, 0xC9, 0x47, 0xF0, 0x04, 0xA9, 0x7B, 0x85, 0x00, 0x60, 0xA9, 0x55,
+    0x8D, 0x80, 0x05, 0xA9, 0xAA, 0x8D, 0x32, 0x04, 0xA9, 0x80, 0x85, 0x43, 0xA9, 0x05, 0x85, 0x44,
+    0xA9, 0x32, 0x85, 0x45, 0xA9, 0x04, 0x85, 0x46, 0xA2, 0x03, 0xA0, 0x77, 0xA9, 0xFF, 0x85, 0x01,
+    0x24, 0x01, 0x38, 0xA9, 0x00, 0xA3, 0x40, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC9, 0x55, 0xD0, 0x08, 0xE0, 0x55, 0xD0, 0x04, 0xC0, 0x77, 0xF0, 0x04, 0xA9,
+    0x7C, 0x85, 0x00, 0xA2, 0x05, 0xA0, 0x33, 0xB8, 0x18, 0xA9, 0x00, 0xA3, 0x40, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xF0, 0x12, 0x10, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xAA, 0xD0, 0x08, 0xE0, 0xAA, 0xD0,
+    0x04, 0xC0, 0x33, 0xF0, 0x04, 0xA9, 0x7D, 0x85, 0x00, 0xA9, 0x87, 0x85, 0x67, 0xA9, 0x32, 0x85,
+    0x68, 0xA0, 0x57, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xA7, 0x67, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12,
+    0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0, 0x57,
+    0xF0, 0x04, 0xA9, 0x7E, 0x85, 0x00, 0xA0, 0x53, 0xB8, 0x18, 0xA9, 0x00, 0xA7, 0x68, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08, 0xE0, 0x32,
+    0xD0, 0x04, 0xC0, 0x53, 0xF0, 0x04, 0xA9, 0x7F, 0x85, 0x00, 0xA9, 0x87, 0x8D, 0x77, 0x05, 0xA9,
+    0x32, 0x8D, 0x78, 0x05, 0xA0, 0x57, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xAF, 0x77, 0x05, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x12, 0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87,
+    0xD0, 0x04, 0xC0, 0x57, 0xF0, 0x04, 0xA9, 0x80, 0x85, 0x00, 0xA0, 0x53, 0xB8, 0x18, 0xA9, 0x00,
+    0xAF, 0x78, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9,
+    0x32, 0xD0, 0x08, 0xE0, 0x32, 0xD0, 0x04, 0xC0, 0x53, 0xF0, 0x04, 0xA9, 0x81, 0x85, 0x00, 0xA9,
+    0xFF, 0x85, 0x43, 0xA9, 0x04, 0x85, 0x44, 0xA9, 0x32, 0x85, 0x45, 0xA9, 0x04, 0x85, 0x46, 0xA9,
+    0x55, 0x8D, 0x80, 0x05, 0xA9, 0xAA, 0x8D, 0x32, 0x04, 0xA2, 0x03, 0xA0, 0x81, 0x24, 0x01, 0x38,
+    0xA9, 0x00, 0xB3, 0x43, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x50, 0x0E, 0x90, 0x0C,
+    0xC9, 0x55, 0xD0, 0x08, 0xE0, 0x55, 0xD0, 0x04, 0xC0, 0x81, 0xF0, 0x04, 0xA9, 0x82, 0x85, 0x00,
+    0xA2, 0x05, 0xA0, 0x00, 0xB8, 0x18, 0xA9, 0x00, 0xB3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12,
+    0x10, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xAA, 0xD0, 0x08, 0xE0, 0xAA, 0xD0, 0x04, 0xC0, 0x00,
+    0xF0, 0x04, 0xA9, 0x83, 0x85, 0x00, 0xA9, 0x87, 0x85, 0x67, 0xA9, 0x32, 0x85, 0x68, 0xA0, 0x57,
+    0x24, 0x01, 0x38, 0xA9, 0x00, 0xB7, 0x10, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x10, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0, 0x57, 0xF0, 0x04, 0xA9,
+    0x84, 0x85, 0x00, 0xA0, 0xFF, 0xB8, 0x18, 0xA9, 0x00, 0xB7, 0x69, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08, 0xE0, 0x32, 0xD0, 0x04, 0xC0,
+    0xFF, 0xF0, 0x04, 0xA9, 0x85, 0x85, 0x00, 0xA9, 0x87, 0x8D, 0x87, 0x05, 0xA9, 0x32, 0x8D, 0x88,
+    0x05, 0xA0, 0x30, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xBF, 0x57, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x12, 0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0,
+    0x30, 0xF0, 0x04, 0xA9, 0x86, 0x85, 0x00, 0xA0, 0x40, 0xB8, 0x18, 0xA9, 0x00, 0xBF, 0x48, 0x05,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08,
+    0xE0, 0x32, 0xD0, 0x04, 0xC0, 0x40, 0xF0, 0x04, 0xA9, 0x87, 0x85, 0x00, 0x60, 0xA9, 0xC0, 0x85,
+    0x01, 0xA9, 0x00, 0x8D, 0x89, 0x04, 0xA9, 0x89, 0x85, 0x60, 0xA9, 0x04, 0x85, 0x61, 0xA0, 0x44,
+    0xA2, 0x17, 0xA9, 0x3E, 0x24, 0x01, 0x18, 0x83, 0x49, 0xEA, 0xEA, 0xEA, 0xEA, 0xD0, 0x19, 0xB0,
+    0x17, 0x50, 0x15, 0x10, 0x13, 0xC9, 0x3E, 0xD0, 0x0F, 0xC0, 0x44, 0xD0, 0x0B, 0xE0, 0x17, 0xD0,
+    0x07, 0xAD, 0x89, 0x04, 0xC9, 0x16, 0xF0, 0x04, 0xA9, 0x88, 0x85, 0x00, 0xA0, 0x44, 0xA2, 0x7A,
+    0xA9, 0x66, 0x38, 0xB8, 0x83, 0xE6, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x19, 0x90, 0x17, 0x70, 0x15,
+    0x30, 0x13, 0xC9, 0x66, 0xD0, 0x0F, 0xC0, 0x44, 0xD0, 0x0B, 0xE0, 0x7A, 0xD0, 0x07, 0xAD, 0x89,
+    0x04, 0xC9, 0x62, 0xF0, 0x04, 0xA9, 0x89, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x49, 0xA0, 0x44, 0xA2,
+    0xAA, 0xA9, 0x55, 0x24, 0x01, 0x18, 0x87, 0x49, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0xB0, 0x16,
+    0x50, 0x14, 0x10, 0x12, 0xC9, 0x55, 0xD0, 0x0E, 0xC0, 0x44, 0xD0, 0x0A, 0xE0, 0xAA, 0xD0, 0x06,
+    0xA5, 0x49, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x8A, 0x85, 0x00, 0xA9, 0x00, 0x85, 0x56, 0xA0, 0x58,
+    0xA2, 0xEF, 0xA9, 0x66, 0x38, 0xB8, 0x87, 0x56, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0x90, 0x16,
+    0x70, 0x14, 0x30, 0x12, 0xC9, 0x66, 0xD0, 0x0E, 0xC0, 0x58, 0xD0, 0x0A, 0xE0, 0xEF, 0xD0, 0x06,
+    0xA5, 0x56, 0xC9, 0x66, 0xF0, 0x04, 0xA9, 0x8B, 0x85, 0x00, 0xA9, 0xFF, 0x8D, 0x49, 0x05, 0xA0,
+    0xE5, 0xA2, 0xAF, 0xA9, 0xF5, 0x24, 0x01, 0x18, 0x8F, 0x49, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x19, 0xB0, 0x17, 0x50, 0x15, 0x10, 0x13, 0xC9, 0xF5, 0xD0, 0x0F, 0xC0, 0xE5, 0xD0, 0x0B, 0xE0,
+    0xAF, 0xD0, 0x07, 0xAD, 0x49, 0x05, 0xC9, 0xA5, 0xF0, 0x04, 0xA9, 0x8C, 0x85, 0x00, 0xA9, 0x00,
+    0x8D, 0x56, 0x05, 0xA0, 0x58, 0xA2, 0xB3, 0xA9, 0x97, 0x38, 0xB8, 0x8F, 0x56, 0x05, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x19, 0x90, 0x17, 0x70, 0x15, 0x10, 0x13, 0xC9, 0x97, 0xD0, 0x0F, 0xC0, 0x58,
+    0xD0, 0x0B, 0xE0, 0xB3, 0xD0, 0x07, 0xAD, 0x56, 0x05, 0xC9, 0x93, 0xF0, 0x04, 0xA9, 0x8D, 0x85,
+    0x00, 0xA9, 0xFF, 0x85, 0x49, 0xA0, 0xFF, 0xA2, 0xAA, 0xA9, 0x55, 0x24, 0x01, 0x18, 0x97, 0x4A,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0xB0, 0x16, 0x50, 0x14, 0x10, 0x12, 0xC9, 0x55, 0xD0, 0x0E,
+    0xC0, 0xFF, 0xD0, 0x0A, 0xE0, 0xAA, 0xD0, 0x06, 0xA5, 0x49, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x8E,
+    0x85, 0x00, 0xA9, 0x00, 0x85, 0x56, 0xA0, 0x06, 0xA2, 0xEF, 0xA9, 0x66, 0x38, 0xB8, 0x97, 0x50,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0x90, 0x16, 0x70, 0x14, 0x30, 0x12, 0xC9, 0x66, 0xD0, 0x0E,
+    0xC0, 0x06, 0xD0, 0x0A, 0xE0, 0xEF, 0xD0, 0x06, 0xA5, 0x56, 0xC9, 0x66, 0xF0, 0x04, 0xA9, 0x8F,
+    0x85, 0x00, 0x60, 0xA0, 0x90, 0x20, 0x31, 0xF9, 0xEB, 0x40, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37,
+    0xF9, 0xC8, 0x20, 0x47, 0xF9, 0xEB, 0x3F, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x4C, 0xF9, 0xC8, 0x20,
+    0x5C, 0xF9, 0xEB, 0x41, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x62, 0xF9, 0xC8, 0x20, 0x72, 0xF9, 0xEB,
+    0x00, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x76, 0xF9, 0xC8, 0x20, 0x80, 0xF9, 0xEB, 0x7F, 0xEA, 0xEA,
+    0xEA, 0xEA, 0x20, 0x84, 0xF9, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0x95, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xC3, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x00, 0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xC3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x54, 0xFA, 0xC3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0x31, 0xFA, 0xC7, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37, 0xFA, 0xA5, 0x47, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x00, 0x85, 0x47, 0x20, 0x42, 0xFA, 0xC7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xA5, 0x47, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xFA,
+    0xC7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xA5, 0x47, 0xC9, 0x36, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x54, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x36, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x31, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x9E, 0x68,
+    0x28, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x00, 0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x9F, 0x68,
+    0x28, 0x20, 0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x54, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA0, 0x68,
+    0x28, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xA1, 0xA2,
+    0xFF, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0x31, 0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37,
+    0xFA, 0xA5, 0x47, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00, 0x85, 0x47, 0x20, 0x42,
+    0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA, 0xA5, 0x47, 0xC9, 0xFF, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x59, 0xFA, 0xA5, 0x47, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x31, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA4, 0x68, 0x28,
+    0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA5, 0x68,
+    0x28, 0x20, 0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x54, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA6,
+    0x68, 0x28, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xA7,
+    0xA2, 0xFF, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x54, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x36, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xAA, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xE3, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0xFF, 0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xE3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0xD4, 0xFA, 0xE3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0xB1, 0xFA, 0xE7, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7, 0xFA, 0xA5, 0x47, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0xFF, 0x85, 0x47, 0x20, 0xC2, 0xFA, 0xE7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xA5, 0x47, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0xD4, 0xFA,
+    0xE7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xA5, 0x47, 0xC9, 0x38, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0xD4, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x38, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0xB1, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB3, 0x68,
+    0x28, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0xFF, 0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB4, 0x68,
+    0x28, 0x20, 0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0xD4, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB5, 0x68,
+    0x28, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xB6, 0xA2,
+    0xFF, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0xB1, 0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7,
+    0xFA, 0xA5, 0x47, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF, 0x85, 0x47, 0x20, 0xC2,
+    0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA, 0xA5, 0x47, 0xC9, 0x00, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0xD4, 0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0xDA, 0xFA, 0xA5, 0x47, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0xB1, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB9, 0x68, 0x28,
+    0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xBA, 0x68,
+    0x28, 0x20, 0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0xD4, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xBB,
+    0x68, 0x28, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xBC,
+    0xA2, 0xFF, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0xD4, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x38, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xBF, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x03, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x03, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x9E, 0xFA, 0x03, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x7B, 0xFA, 0x07, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81, 0xFA, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x8C, 0xFA, 0x07, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x9E, 0xFA,
+    0x07, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xA5, 0x47, 0xC9, 0x6E, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x9E, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x7B, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xC8, 0x68,
+    0x28, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xC9, 0x68,
+    0x28, 0x20, 0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x9E, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCA, 0x68,
+    0x28, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xCB, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x7B, 0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81,
+    0xFA, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x8C,
+    0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x9E, 0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0xA4, 0xFA, 0xA5, 0x47, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x7B, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCE, 0x68, 0x28,
+    0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCF, 0x68,
+    0x28, 0x20, 0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x9E, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xD0,
+    0x68, 0x28, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xD1,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x9E, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6E, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xD4, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x23, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x23, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x68, 0xFA, 0x23, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x53, 0xFB, 0x27, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFB, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x64, 0xFB, 0x27, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xFA,
+    0x27, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xA5, 0x47, 0xC9, 0x6F, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x68, 0xFA, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x53, 0xFB, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDD, 0x68,
+    0x28, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDE, 0x68,
+    0x28, 0x20, 0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x68, 0xFA, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDF, 0x68,
+    0x28, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xE0, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x53, 0xFB, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59,
+    0xFB, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x64,
+    0xFB, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xFA, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x6E, 0xFA, 0xA5, 0x47, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x53, 0xFB, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE3, 0x68, 0x28,
+    0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE4, 0x68,
+    0x28, 0x20, 0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x68, 0xFA, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE5,
+    0x68, 0x28, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xE6,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x68, 0xFA, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6F, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xE9, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x43, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x43, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x40, 0xFB, 0x43, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06,
+    0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x1D, 0xFB, 0x47, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23, 0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x2E, 0xFB, 0x47, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xFB,
+    0x47, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xA5, 0x47, 0xC9, 0x1B, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x40, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x1D, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF2, 0x68,
+    0x28, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF3, 0x68,
+    0x28, 0x20, 0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x40, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF4, 0x68,
+    0x28, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xF5, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x1D, 0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23,
+    0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x2E,
+    0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB, 0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x46, 0xFB, 0xA5, 0x47, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x1D, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF8, 0x68, 0x28,
+    0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF9, 0x68,
+    0x28, 0x20, 0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x40, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xFA,
+    0x68, 0x28, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFB,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x40, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x1B, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0x01, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x63, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x63, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x0A, 0xFB, 0x63, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06,
+    0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0xE9, 0xFA, 0x67, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF, 0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0xFA, 0xFA, 0x67, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x0A, 0xFB,
+    0x67, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xA5, 0x47, 0xC9, 0x9B, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x0A, 0xFB, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0xE9, 0xFA, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0A, 0x68,
+    0x28, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0B, 0x68,
+    0x28, 0x20, 0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x0A, 0xFB, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0C, 0x68,
+    0x28, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0x0D, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0xE9, 0xFA, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF,
+    0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0xFA,
+    0xFA, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA, 0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x0A, 0xFB, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x10, 0xFB, 0xA5, 0x47, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0xE9, 0xFA, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x10, 0x68, 0x28,
+    0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x11, 0x68,
+    0x28, 0x20, 0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x0A, 0xFB, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x12,
+    0x68, 0x28, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0x13,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x0A, 0xFB, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x9B, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0x55, 0x60,
+    0xB0, 0x09, 0x10, 0x07, 0xC9, 0xFF, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8,
+    0xA9, 0x00, 0x60, 0xD0, 0x07, 0x70, 0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18,
+    0x24, 0x01, 0xA9, 0x55, 0x60, 0xD0, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x38, 0xB8, 0xA9, 0xF8, 0x60, 0x90, 0x09, 0x10, 0x07, 0xC9, 0xE8, 0xD0, 0x03, 0x70, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x5F, 0x60, 0xB0, 0x09, 0x10, 0x07, 0xC9, 0xF5,
+    0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8, 0xA9, 0x70, 0x60, 0xD0, 0x07, 0x70,
+    0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x00, 0x60, 0x30,
+    0x09, 0xB0, 0x07, 0xC9, 0x69, 0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0x24, 0x01,
+    0xA9, 0x00, 0x60, 0x30, 0x09, 0xB0, 0x07, 0xC9, 0x6A, 0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x38, 0xB8, 0xA9, 0x7F, 0x60, 0x10, 0x09, 0xB0, 0x07, 0xC9, 0xFF, 0xD0, 0x03, 0x50, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x7F, 0x60, 0x10, 0x09, 0xB0, 0x07, 0xC9, 0xFF,
+    0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8, 0xA9, 0x7F, 0x60, 0xD0, 0x07, 0x30,
+    0x05, 0x70, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xA9, 0x40, 0x60, 0x30, 0x07,
+    0x90, 0x05, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB8, 0x60, 0xF0, 0x07, 0x30, 0x05,
+    0x90, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x10, 0x01, 0x60, 0x84,
+    0x00, 0x60, 0xA9, 0x80, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xD0,
+    0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB0, 0x05, 0xF0, 0x03, 0x10, 0x01, 0x60,
+    0x84, 0x00, 0x60, 0x90, 0x05, 0xF0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xA0,
+    0x40, 0x60, 0x30, 0x07, 0x90, 0x05, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x86, 0x00, 0x60, 0xB8, 0x60,
+    0xF0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x70, 0x01, 0x60, 0x86, 0x00, 0x60, 0xF0, 0x05, 0x10, 0x03,
+    0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0xA0, 0x80, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60,
+    0x86, 0x00, 0x60, 0xD0, 0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x86, 0x00, 0x60, 0xB0, 0x05, 0xF0,
+    0x03, 0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0x90, 0x05, 0xF0, 0x03, 0x30, 0x01, 0x60, 0x86, 0x00,
+    0x60, 0x24, 0x01, 0xA9, 0x40, 0x38, 0x60, 0x30, 0x0B, 0x90, 0x09, 0xD0, 0x07, 0x70, 0x05, 0xC9,
+    0x00, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB8, 0x38, 0xA9, 0x40, 0x60, 0xF0, 0x0B, 0x30, 0x09,
+    0x90, 0x07, 0x70, 0x05, 0xC9, 0x01, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xA9, 0x40, 0x38, 0x24,
+    0x01, 0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xFF, 0xD0, 0x01, 0x60, 0x84,
+    0x00, 0x60, 0x18, 0xA9, 0x80, 0x60, 0x90, 0x05, 0xC9, 0x7F, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60,
+    0x38, 0xA9, 0x81, 0x60, 0x50, 0x07, 0x90, 0x05, 0xC9, 0x02, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60,
+    0xA2, 0x55, 0xA9, 0xFF, 0x85, 0x01, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x60, 0x90, 0x1B, 0xD0,
+    0x19, 0x30, 0x17, 0x50, 0x15, 0xC9, 0x00, 0xD0, 0x11, 0xB8, 0xA9, 0xAA, 0x60, 0xB0, 0x0B, 0xF0,
+    0x09, 0x30, 0x07, 0x70, 0x05, 0xC9, 0x55, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38,
+    0xA9, 0x80, 0x60, 0x90, 0x1C, 0xD0, 0x1A, 0x30, 0x18, 0x50, 0x16, 0xC9, 0x00, 0xD0, 0x12, 0xB8,
+    0xA9, 0x55, 0x38, 0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xAA, 0xD0, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x60, 0x90, 0x1C, 0xF0, 0x1A, 0x10, 0x18,
+    0x50, 0x16, 0xC9, 0x80, 0xD0, 0x12, 0xB8, 0x18, 0xA9, 0x55, 0x60, 0x90, 0x0B, 0xF0, 0x09, 0x30,
+    0x07, 0x70, 0x05, 0xC9, 0x2A, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x60,
+    0x90, 0x1C, 0xF0, 0x1A, 0x30, 0x18, 0x50, 0x16, 0xC9, 0x01, 0xD0, 0x12, 0xB8, 0x18, 0xA9, 0x55,
+    0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xAA, 0xD0, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x24, 0x01, 0x18, 0xA9, 0x40, 0x60, 0x50, 0x2C, 0xB0, 0x2A, 0x30, 0x28, 0xC9, 0x40, 0xD0,
+    0x24, 0x60, 0xB8, 0x38, 0xA9, 0xFF, 0x60, 0x70, 0x1C, 0xD0, 0x1A, 0x30, 0x18, 0x90, 0x16, 0xC9,
+    0xFF, 0xD0, 0x12, 0x60, 0x24, 0x01, 0xA9, 0xF0, 0x60, 0x50, 0x0A, 0xF0, 0x08, 0x10, 0x06, 0x90,
+    0x04, 0xC9, 0xF0, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x75, 0x60, 0x50, 0x76,
+    0xF0, 0x74, 0x30, 0x72, 0xB0, 0x70, 0xC9, 0x65, 0xD0, 0x6C, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB3,
+    0x60, 0x50, 0x63, 0x90, 0x61, 0x10, 0x5F, 0xC9, 0xFB, 0xD0, 0x5B, 0x60, 0xB8, 0x18, 0xA9, 0xC3,
+    0x60, 0x70, 0x53, 0xF0, 0x51, 0x10, 0x4F, 0xB0, 0x4D, 0xC9, 0xD3, 0xD0, 0x49, 0x60, 0x24, 0x01,
+    0x38, 0xA9, 0x10, 0x60, 0x50, 0x40, 0xF0, 0x3E, 0x30, 0x3C, 0xB0, 0x3A, 0xC9, 0x7E, 0xD0, 0x36,
+    0x60, 0x24, 0x01, 0x18, 0xA9, 0x40, 0x60, 0x70, 0x2D, 0xB0, 0x2B, 0x30, 0x29, 0xC9, 0x53, 0xD0,
+    0x25, 0x60, 0xB8, 0x38, 0xA9, 0xFF, 0x60, 0x70, 0x1D, 0xF0, 0x1B, 0x10, 0x19, 0x90, 0x17, 0xC9,
+    0xFF, 0xD0, 0x13, 0x60, 0x24, 0x01, 0x38, 0xA9, 0xF0, 0x60, 0x70, 0x0A, 0xF0, 0x08, 0x10, 0x06,
+    0x90, 0x04, 0xC9, 0xB8, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB2, 0x60, 0x70,
+    0x2A, 0x90, 0x28, 0x30, 0x26, 0xC9, 0x05, 0xD0, 0x22, 0x60, 0xB8, 0x18, 0xA9, 0x42, 0x60, 0x70,
+    0x1A, 0x30, 0x18, 0xB0, 0x16, 0xC9, 0x57, 0xD0, 0x12, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x75, 0x60,
+    0x70, 0x09, 0x30, 0x07, 0x90, 0x05, 0xC9, 0x11, 0xD0, 0x01, 0x60, 0x85, 0x00, 0x24, 0x01, 0x18,
+    0xA9, 0xB3, 0x60, 0x50, 0x50, 0x90, 0x4E, 0x10, 0x4C, 0xC9, 0xE1, 0xD0, 0x48, 0x60, 0xB8, 0x18,
+    0xA9, 0x42, 0x60, 0x70, 0x40, 0xF0, 0x3E, 0x30, 0x3C, 0x90, 0x3A, 0xC9, 0x56, 0xD0, 0x36, 0x60,
+    0x24, 0x01, 0x38, 0xA9, 0x75, 0x60, 0x50, 0x2D, 0xF0, 0x2B, 0x30, 0x29, 0x90, 0x27, 0xC9, 0x6E,
+    0xD0, 0x23, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB3, 0x60, 0x50, 0x1A, 0x90, 0x18, 0x30, 0x16, 0xC9,
+    0x02, 0xD0, 0x12, 0x60, 0xB8, 0x18, 0xA9, 0x42, 0x60, 0x70, 0x0A, 0xF0, 0x08, 0x30, 0x06, 0xB0,
+    0x04, 0xC9, 0x42, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0x00, 0xC0, 0xC0, 0xFE, 0x7C, 0x00,
+    0xFE, 0xFE, 0x00, 0xF0, 0xC0, 0xFE, 0xFE, 0x00, 0xC6, 0xC6, 0x02, 0xFE, 0xC6, 0xC6, 0xC6, 0x00,
+    0xCC, 0xD8, 0x00, 0xF0, 0xD8, 0xCC, 0xC6, 0x00, 0xC6, 0xEE, 0x02, 0xD6, 0xC6, 0xC6, 0xC6, 0x00,
+    0xC6, 0xC6, 0x02, 0xD6, 0xCE, 0xC6, 0xC6, 0x00, 0x7C, 0xFE, 0x02, 0xC6, 0xC6, 0xFE, 0x7C, 0x00,
+    0xFC, 0xFE, 0x02, 0xFC, 0xC0, 0xC0, 0xC0, 0x00, 0xCC, 0xCC, 0x00, 0x78, 0x30, 0x30, 0x30, 0x00,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xFC, 0xFE, 0x02, 0x06, 0x1C, 0x70, 0xFE, 0x00,
+    0xFC, 0xFE, 0x02, 0x3C, 0x3C, 0x02, 0xFE, 0x00, 0x18, 0x18, 0xD8, 0xD8, 0xFE, 0x18, 0x18, 0x00,
+    0xFE, 0xFE, 0x00, 0x80, 0xFC, 0x06, 0xFE, 0x00, 0x7C, 0xFE, 0x00, 0xC0, 0xFC, 0xC6, 0xFE, 0x00,
+    0xFE, 0xFE, 0x06, 0x0C, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x33, 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0xFF, 0x66, 0xFF, 0x66, 0x66, 0x00, 0x18, 0x3E, 0x60, 0x3C, 0x06, 0x7C, 0x18, 0x00,
+    0x62, 0x66, 0x0C, 0x18, 0x30, 0x66, 0x46, 0x00, 0x3C, 0x66, 0x3C, 0x38, 0x67, 0x66, 0x3F, 0x00,
+    0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00,
+    0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30,
+    0x00, 0x00, 0x00, 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
+    0x00, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x3E, 0x63, 0x67, 0x6B, 0x73, 0x63, 0x3E, 0x00,
+    0x0C, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00, 0x3E, 0x63, 0x63, 0x0E, 0x38, 0x63, 0x7F, 0x00,
+    0x3E, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x3E, 0x00, 0x06, 0x0E, 0x1E, 0x26, 0x7F, 0x06, 0x06, 0x00,
+    0x7F, 0x63, 0x60, 0x7E, 0x03, 0x63, 0x3E, 0x00, 0x3E, 0x63, 0x60, 0x7E, 0x63, 0x63, 0x3E, 0x00,
+    0x7F, 0x63, 0x06, 0x0C, 0x18, 0x18, 0x3C, 0x00, 0x3E, 0x63, 0x63, 0x3E, 0x63, 0x63, 0x3E, 0x00,
+    0x3E, 0x63, 0x63, 0x3F, 0x03, 0x63, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00,
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30, 0x0E, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0E, 0x00,
+    0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x70, 0x18, 0x0C, 0x06, 0x0C, 0x18, 0x70, 0x00,
+    0x7E, 0x63, 0x03, 0x06, 0x1C, 0x00, 0x18, 0x18, 0x7C, 0xC6, 0xCE, 0xEE, 0xE0, 0xE6, 0x7C, 0x00,
+    0x1C, 0x36, 0x63, 0x7F, 0x63, 0x63, 0x63, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x63, 0x63, 0x7E, 0x00,
+    0x1E, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1E, 0x00, 0x6C, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7C, 0x00,
+    0x7F, 0x31, 0x30, 0x3C, 0x30, 0x31, 0x7F, 0x00, 0x7F, 0x31, 0x30, 0x3C, 0x30, 0x30, 0x78, 0x00,
+    0x1E, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1D, 0x00, 0x63, 0x63, 0x63, 0x7F, 0x63, 0x63, 0x63, 0x00,
+    0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x1F, 0x06, 0x06, 0x06, 0x06, 0x66, 0x3C, 0x00,
+    0x66, 0x66, 0x6C, 0x78, 0x6C, 0x67, 0x63, 0x00, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7E, 0x00,
+    0x63, 0x77, 0x7F, 0x6B, 0x63, 0x63, 0x63, 0x00, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x63, 0x63, 0x00,
+    0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x60, 0x60, 0x60, 0x00,
+    0x1C, 0x36, 0x63, 0x6B, 0x67, 0x36, 0x1D, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x6C, 0x67, 0x63, 0x00,
+    0x3E, 0x63, 0x60, 0x3E, 0x03, 0x63, 0x3E, 0x00, 0x7E, 0x5A, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00,
+    0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3C, 0x00, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3C, 0x18, 0x00,
+    0x73, 0x33, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00, 0x63, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x63, 0x00,
+    0x33, 0x63, 0x63, 0x36, 0x1C, 0x78, 0x70, 0x00, 0x7F, 0x63, 0x06, 0x1C, 0x33, 0x63, 0x7E, 0x00,
+    0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00,
+    0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3C, 0x00, 0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x63, 0x63, 0x67, 0x3B, 0x00, 0x60, 0x60, 0x6E, 0x73, 0x63, 0x63, 0x3E, 0x00,
+    0x00, 0x00, 0x3E, 0x63, 0x60, 0x63, 0x3E, 0x00, 0x03, 0x03, 0x3B, 0x67, 0x63, 0x63, 0x3E, 0x00,
+    0x00, 0x00, 0x3E, 0x61, 0x7F, 0x60, 0x3E, 0x00, 0x0E, 0x18, 0x18, 0x3C, 0x18, 0x18, 0x3C, 0x00,
+    0x00, 0x00, 0x3E, 0x60, 0x63, 0x63, 0x3D, 0x00, 0x60, 0x60, 0x6E, 0x73, 0x63, 0x66, 0x67, 0x00,
+    0x00, 0x00, 0x1E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x06, 0x06, 0x66, 0x3C,
+    0x60, 0x60, 0x66, 0x6E, 0x7C, 0x67, 0x63, 0x00, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00,
+    0x00, 0x00, 0x6E, 0x7F, 0x6B, 0x62, 0x67, 0x00, 0x00, 0x00, 0x6E, 0x73, 0x63, 0x66, 0x67, 0x00,
+    0x00, 0x00, 0x3E, 0x63, 0x63, 0x63, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x63, 0x73, 0x6E, 0x60, 0x60,
+    0x00, 0x00, 0x3E, 0x63, 0x67, 0x3B, 0x03, 0x03, 0x00, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x63, 0x00,
+    0x00, 0x00, 0x3E, 0x71, 0x1C, 0x47, 0x3E, 0x00, 0x06, 0x0C, 0x3F, 0x18, 0x18, 0x1B, 0x0E, 0x00,
+    0x00, 0x00, 0x73, 0x33, 0x63, 0x67, 0x3B, 0x00, 0x00, 0x00, 0x73, 0x33, 0x63, 0x66, 0x3C, 0x00,
+    0x00, 0x00, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00, 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00,
+    0x00, 0x00, 0x33, 0x63, 0x63, 0x3F, 0x03, 0x3E, 0x00, 0x00, 0x7F, 0x0E, 0x1C, 0x38, 0x7F, 0x00,
+    0x3C, 0x42, 0x99, 0xA1, 0xA1, 0x99, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33,
+    0x38, 0x06, 0x12, 0x33, 0x3A, 0x06, 0x12, 0x33, 0x0F, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33,
+    0x38, 0x06, 0x12, 0x33, 0x3A, 0x06, 0x12, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC5, 0x04, 0xC0, 0xF4, 0xC5,
+    0x4C, 0xF5, 0xC5, 0x60, 0x78, 0xD8, 0xA2, 0xFF, 0x9A, 0xAD, 0x02, 0x20, 0x10, 0xFB, 0xAD, 0x02,
+    0x20, 0x10, 0xFB, 0xA9, 0x00, 0x8D, 0x00, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x05, 0x20, 0x8D, 0x05,
+    0x20, 0xAD, 0x02, 0x20, 0xA2, 0x20, 0x8E, 0x06, 0x20, 0xA2, 0x00, 0x8E, 0x06, 0x20, 0xA2, 0x00,
+    0xA0, 0x0F, 0xA9, 0x00, 0x8D, 0x07, 0x20, 0xCA, 0xD0, 0xFA, 0x88, 0xD0, 0xF7, 0xA9, 0x3F, 0x8D,
+    0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA2, 0x00, 0xBD, 0x78, 0xFF, 0x8D, 0x07, 0x20, 0xE8,
+    0xE0, 0x20, 0xD0, 0xF5, 0xA9, 0xC0, 0x8D, 0x17, 0x40, 0xA9, 0x00, 0x8D, 0x15, 0x40, 0xA9, 0x78,
+    0x85, 0xD0, 0xA9, 0xFB, 0x85, 0xD1, 0xA9, 0x7F, 0x85, 0xD3, 0xA0, 0x00, 0x8C, 0x06, 0x20, 0x8C,
+    0x06, 0x20, 0xA9, 0x00, 0x85, 0xD7, 0xA9, 0x07, 0x85, 0xD0, 0xA9, 0xC3, 0x85, 0xD1, 0x20, 0xA7,
+    0xC2, 0x20, 0x8D, 0xC2, 0xA2, 0x12, 0x20, 0x61, 0xC2, 0xA5, 0xD5, 0x4A, 0x4A, 0x4A, 0xB0, 0x1C,
+    0x4A, 0xB0, 0x0C, 0x4A, 0xB0, 0x27, 0x4A, 0xB0, 0x03, 0x4C, 0x81, 0xC0, 0x4C, 0x26, 0xC1, 0x20,
+    0x6F, 0xC6, 0xC6, 0xD7, 0x10, 0xDB, 0xA9, 0x0D, 0x85, 0xD7, 0xD0, 0xD5, 0x20, 0x6F, 0xC6, 0xE6,
+    0xD7, 0xA5, 0xD7, 0xC9, 0x0E, 0x90, 0xCA, 0xA9, 0x00, 0x85, 0xD7, 0xF0, 0xC4, 0x20, 0x89, 0xC6,
+    0xA5, 0xD7, 0xF0, 0x06, 0x20, 0xED, 0xC0, 0x4C, 0x81, 0xC0, 0xA9, 0x00, 0x85, 0xD8, 0xE6, 0xD7,
+    0x20, 0xED, 0xC0, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0E, 0xD0, 0xF5, 0xA9, 0x00, 0x85, 0xD7, 0xA5,
+    0xD8, 0xF0, 0x02, 0xA9, 0xFF, 0x85, 0x00, 0x20, 0xED, 0xC1, 0x4C, 0x81, 0xC0, 0xA5, 0xD7, 0x0A,
+    0xAA, 0xBD, 0x0A, 0xC1, 0x8D, 0x00, 0x02, 0xBD, 0x0B, 0xC1, 0x8D, 0x01, 0x02, 0xA9, 0xC1, 0x48,
+    0xA9, 0xDE, 0x48, 0xA9, 0x00, 0x85, 0x00, 0x6C, 0x00, 0x02, 0x2D, 0xC7, 0x2D, 0xC7, 0xDB, 0xC7,
+    0x85, 0xC8, 0xDE, 0xCB, 0xF8, 0xCD, 0xEE, 0xCE, 0xA2, 0xCF, 0x74, 0xD1, 0xFB, 0xD4, 0xD4, 0xC1,
+    0x4A, 0xDF, 0xB8, 0xDB, 0xAA, 0xE1, 0xA9, 0x00, 0x85, 0xD7, 0xA9, 0x92, 0x85, 0xD0, 0xA9, 0xC4,
+    0x85, 0xD1, 0x20, 0xA7, 0xC2, 0x20, 0x8D, 0xC2, 0xA2, 0x0F, 0x20, 0x61, 0xC2, 0xA5, 0xD5, 0x4A,
+    0x4A, 0x4A, 0xB0, 0x1C, 0x4A, 0xB0, 0x0C, 0x4A, 0xB0, 0x27, 0x4A, 0xB0, 0x03, 0x4C, 0x35, 0xC1,
+    0x4C, 0x72, 0xC0, 0x20, 0x6F, 0xC6, 0xC6, 0xD7, 0x10, 0xDB, 0xA9, 0x0A, 0x85, 0xD7, 0xD0, 0xD5,
+    0x20, 0x6F, 0xC6, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0B, 0x90, 0xCA, 0xA9, 0x00, 0x85, 0xD7, 0xF0,
+    0xC4, 0x20, 0x89, 0xC6, 0xA5, 0xD7, 0xF0, 0x06, 0x20, 0xA1, 0xC1, 0x4C, 0x35, 0xC1, 0xA9, 0x00,
+    0x85, 0xD8, 0xE6, 0xD7, 0x20, 0xA1, 0xC1, 0xE6, 0xD7, 0xA5, 0xD7, 0xC9, 0x0B, 0xD0, 0xF5, 0xA9,
+    0x00, 0x85, 0xD7, 0xA5, 0xD8, 0xF0, 0x02, 0xA9, 0xFF, 0x85, 0x00, 0x20, 0xED, 0xC1, 0x4C, 0x35,
+    0xC1, 0xA5, 0xD7, 0x0A, 0xAA, 0xBD, 0xBE, 0xC1, 0x8D, 0x00, 0x02, 0xBD, 0xBF, 0xC1, 0x8D, 0x01,
+    0x02, 0xA9, 0xC1, 0x48, 0xA9, 0xDE, 0x48, 0xA9, 0x00, 0x85, 0x00, 0x6C, 0x00, 0x02, 0xA3, 0xC6,
+    0xA3, 0xC6, 0x1E, 0xE5, 0x3D, 0xE7, 0xD3, 0xE8, 0x16, 0xE9, 0x86, 0xEB, 0xF6, 0xED, 0x66, 0xF0,
+    0xD6, 0xF2, 0x46, 0xF5, 0xA9, 0x00, 0x85, 0x00, 0x20, 0x00, 0xD9, 0x20, 0xE0, 0xDA, 0xEA, 0xEA,
+    0xEA, 0xA5, 0x00, 0xF0, 0x02, 0x85, 0xD8, 0x4C, 0xED, 0xC1, 0x4C, 0x81, 0xC0, 0x20, 0x8D, 0xC2,
+    0xA9, 0x00, 0x85, 0xD3, 0xA5, 0xD7, 0x18, 0x69, 0x04, 0x0A, 0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x0A,
+    0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x0A, 0x26, 0xD3, 0x48, 0xA5, 0xD3, 0x09, 0x20, 0x8D, 0x06, 0x20,
+    0x68, 0x09, 0x04, 0x8D, 0x06, 0x20, 0xA5, 0x00, 0xF0, 0x1D, 0xC9, 0xFF, 0xF0, 0x26, 0x4A, 0x4A,
+    0x4A, 0x4A, 0xAA, 0xBD, 0x51, 0xC2, 0x8D, 0x07, 0x20, 0xA5, 0x00, 0x29, 0x0F, 0xAA, 0xBD, 0x51,
+    0xC2, 0x8D, 0x07, 0x20, 0x4C, 0x94, 0xC2, 0xA9, 0x4F, 0x8D, 0x07, 0x20, 0xA9, 0x4B, 0x8D, 0x07,
+    0x20, 0x4C, 0x94, 0xC2, 0xA9, 0x45, 0x8D, 0x07, 0x20, 0xA9, 0x72, 0x8D, 0x07, 0x20, 0x4C, 0x94,
+    0xC2, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0xA5, 0xD7, 0x18, 0x69, 0x04, 0xA8, 0xA9, 0x84, 0x8D, 0x00, 0x20, 0xA9, 0x20, 0x8D, 0x06,
+    0x20, 0xA9, 0x02, 0x8D, 0x06, 0x20, 0xA9, 0x20, 0x88, 0xC8, 0xD0, 0x02, 0xA9, 0x2A, 0x8D, 0x07,
+    0x20, 0x88, 0xCA, 0xD0, 0xF1, 0xA9, 0x80, 0x8D, 0x00, 0x20, 0x4C, 0x94, 0xC2, 0xA5, 0xD2, 0xC5,
+    0xD2, 0xF0, 0xFC, 0x60, 0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20, 0xA9, 0x00, 0x8D, 0x06,
+    0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0x60, 0xA9, 0x00, 0x8D, 0x00, 0x20, 0x8D, 0x01, 0x20, 0x20,
+    0xED, 0xC2, 0xA9, 0x20, 0x8D, 0x06, 0x20, 0xA0, 0x00, 0x8C, 0x06, 0x20, 0xA2, 0x20, 0xB1, 0xD0,
+    0xF0, 0x20, 0xC9, 0xFF, 0xF0, 0x0D, 0x8D, 0x07, 0x20, 0xC8, 0xD0, 0x02, 0xE6, 0xD1, 0xCA, 0xD0,
+    0xED, 0xF0, 0xE9, 0xC8, 0xD0, 0x02, 0xE6, 0xD1, 0xA9, 0x20, 0x8D, 0x07, 0x20, 0xCA, 0xD0, 0xF8,
+    0xF0, 0xDA, 0xA9, 0x80, 0x8D, 0x00, 0x20, 0xA9, 0x0E, 0x8D, 0x01, 0x20, 0x60, 0xA9, 0x20, 0x8D,
+    0x06, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA2, 0x1E, 0xA9, 0x20, 0xA0, 0x20, 0x8D, 0x07, 0x20,
+    0x88, 0xD0, 0xFA, 0xCA, 0xD0, 0xF5, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D,
+    0x2D, 0x20, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x42, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x6C, 0x61, 0x67, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x49, 0x6D, 0x6D,
+    0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x49, 0x6D, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74,
+    0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x63, 0x63, 0x75,
+    0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x28, 0x49, 0x6E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x2C, 0x58,
+    0x29, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x5A,
+    0x65, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x74, 0x65,
+    0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x28, 0x49, 0x6E, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x29, 0x2C, 0x59, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x2C, 0x59, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x5A, 0x65, 0x72,
+    0x6F, 0x70, 0x61, 0x67, 0x65, 0x2C, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x2C, 0x58, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2F, 0x44,
+    0x6F, 0x77, 0x6E, 0x3A, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x72, 0x75,
+    0x6E, 0x20, 0x74, 0x65, 0x73, 0x74, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6C, 0x65,
+    0x63, 0x74, 0x3A, 0x20, 0x49, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x6F, 0x70, 0x73, 0x21,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x75, 0x6E,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D,
+    0x2D, 0x20, 0x4E, 0x4F, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20, 0x20,
+    0x2D, 0x2D, 0x20, 0x4C, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x53, 0x41, 0x58, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x42, 0x43, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x28, 0x6F,
+    0x70, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x30, 0x45, 0x42, 0x68, 0x29, 0xFF, 0x20, 0x20, 0x20, 0x20,
+    0x2D, 0x2D, 0x20, 0x44, 0x43, 0x50, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20, 0x20,
+    0x20, 0x2D, 0x2D, 0x20, 0x49, 0x53, 0x42, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20, 0x20,
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x4C, 0x4F, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF, 0x20,
+    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x4C, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x53, 0x52, 0x45, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73,
+    0xFF, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x52, 0x52, 0x41, 0x20, 0x74, 0x65, 0x73, 0x74,
+    0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x55, 0x70, 0x2F, 0x44, 0x6F,
+    0x77, 0x6E, 0x3A, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0xFF,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x72, 0x75, 0x6E,
+    0x20, 0x74, 0x65, 0x73, 0x74, 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x65, 0x6C, 0x65, 0x63,
+    0x74, 0x3A, 0x20, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x6F, 0x70, 0x73, 0xFF, 0x00, 0x48,
+    0x8A, 0x48, 0xAD, 0x02, 0x20, 0xA9, 0x20, 0x8D, 0x06, 0x20, 0xA9, 0x40, 0x8D, 0x06, 0x20, 0xE6,
+    0xD2, 0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20, 0xA9, 0x00, 0x8D, 0x06, 0x20, 0xA9, 0x00,
+    0x8D, 0x06, 0x20, 0xA2, 0x09, 0x8E, 0x16, 0x40, 0xCA, 0x8E, 0x16, 0x40, 0xAD, 0x16, 0x40, 0x4A,
+    0x26, 0xD4, 0xCA, 0xD0, 0xF7, 0xA5, 0xD4, 0xAA, 0x45, 0xD6, 0x25, 0xD4, 0x85, 0xD5, 0x86, 0xD6,
+    0x68, 0xAA, 0x68, 0x40, 0x40, 0xA2, 0x00, 0x86, 0x00, 0x86, 0x10, 0x86, 0x11, 0x20, 0x2D, 0xC7,
+    0x20, 0xDB, 0xC7, 0x20, 0x85, 0xC8, 0x20, 0xDE, 0xCB, 0x20, 0xF8, 0xCD, 0x20, 0xEE, 0xCE, 0x20,
+    0xA2, 0xCF, 0x20, 0x74, 0xD1, 0x20, 0xFB, 0xD4, 0x20, 0x00, 0xD9, 0xA5, 0x00, 0x85, 0x10, 0xA9,
+    0x00, 0x85, 0x00, 0x20, 0xE0, 0xDA, 0x20, 0x4A, 0xDF, 0x20, 0xB8, 0xDB, 0x20, 0xAA, 0xE1, 0x20,
+    0xA3, 0xC6, 0x20, 0x1E, 0xE5, 0x20, 0x3D, 0xE7, 0x20, 0xD3, 0xE8, 0x20, 0x16, 0xE9, 0x20, 0x86,
+    0xEB, 0x20, 0xF6, 0xED, 0x20, 0x66, 0xF0, 0x20, 0xD6, 0xF2, 0xA5, 0x00, 0x85, 0x11, 0xA9, 0x00,
+    0x85, 0x00, 0x20, 0x46, 0xF5, 0xA5, 0x00, 0x05, 0x10, 0x05, 0x11, 0xF0, 0x0E, 0x20, 0x6F, 0xC6,
+    0xA6, 0x00, 0x86, 0x02, 0xA6, 0x10, 0x86, 0x03, 0x4C, 0x6E, 0xC6, 0x20, 0x89, 0xC6, 0x60, 0xA9,
+    0x03, 0x8D, 0x15, 0x40, 0xA9, 0x87, 0x8D, 0x00, 0x40, 0xA9, 0x89, 0x8D, 0x01, 0x40, 0xA9, 0xF0,
+    0x8D, 0x02, 0x40, 0xA9, 0x00, 0x8D, 0x03, 0x40, 0x60, 0xA9, 0x02, 0x8D, 0x15, 0x40, 0xA9, 0x3F,
+    0x8D, 0x04, 0x40, 0xA9, 0x9A, 0x8D, 0x05, 0x40, 0xA9, 0xFF, 0x8D, 0x06, 0x40, 0xA9, 0x00, 0x8D,
+    0x07, 0x40, 0x60, 0xA0, 0x4E, 0xA9, 0xFF, 0x85, 0x01, 0x20, 0xB0, 0xC6, 0x20, 0xB7, 0xC6, 0x60,
+    0xA9, 0xFF, 0x48, 0xA9, 0xAA, 0xD0, 0x05, 0xA9, 0x34, 0x48, 0xA9, 0x55, 0x28, 0x04, 0xA9, 0x44,
+    0xA9, 0x64, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA, 0x08, 0x48, 0x0C, 0xA9, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x08, 0x48, 0x14, 0xA9, 0x34, 0xA9, 0x54, 0xA9, 0x74, 0xA9, 0xD4, 0xA9, 0xF4, 0xA9, 0xEA, 0xEA,
+    0xEA, 0xEA, 0x08, 0x48, 0x1A, 0x3A, 0x5A, 0x7A, 0xDA, 0xFA, 0x80, 0x89, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x08, 0x48, 0x1C, 0xA9, 0xA9, 0x3C, 0xA9, 0xA9, 0x5C, 0xA9, 0xA9, 0x7C, 0xA9, 0xA9, 0xDC, 0xA9,
+    0xA9, 0xFC, 0xA9, 0xA9, 0xEA, 0xEA, 0xEA, 0xEA, 0x08, 0x48, 0xA2, 0x05, 0x68, 0xC9, 0x55, 0xF0,
+    0x0A, 0xC9, 0xAA, 0xF0, 0x06, 0x68, 0x84, 0x00, 0x4C, 0x28, 0xC7, 0x68, 0x29, 0xCB, 0xC9, 0x00,
+    0xF0, 0x06, 0xC9, 0xCB, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xCA, 0xD0, 0xE0, 0x60, 0xEA, 0x38, 0xB0,
+    0x04, 0xA2, 0x01, 0x86, 0x00, 0xEA, 0x18, 0xB0, 0x03, 0x4C, 0x40, 0xC7, 0xA2, 0x02, 0x86, 0x00,
+    0xEA, 0x38, 0x90, 0x03, 0x4C, 0x4B, 0xC7, 0xA2, 0x03, 0x86, 0x00, 0xEA, 0x18, 0x90, 0x04, 0xA2,
+    0x04, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0xF0, 0x04, 0xA2, 0x05, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0xF0,
+    0x03, 0x4C, 0x68, 0xC7, 0xA2, 0x06, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0xD0, 0x04, 0xA2, 0x07, 0x86,
+    0x00, 0xEA, 0xA9, 0x00, 0xD0, 0x03, 0x4C, 0x7D, 0xC7, 0xA2, 0x08, 0x86, 0x00, 0xEA, 0xA9, 0xFF,
+    0x85, 0x01, 0x24, 0x01, 0x70, 0x04, 0xA2, 0x09, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x50, 0x03, 0x4C,
+    0x96, 0xC7, 0xA2, 0x0A, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x50, 0x04, 0xA2,
+    0x0B, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x70, 0x03, 0x4C, 0xAF, 0xC7, 0xA2, 0x0C, 0x86, 0x00, 0xEA,
+    0xA9, 0x00, 0x10, 0x04, 0xA2, 0x0D, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x10, 0x03, 0x4C, 0xD9, 0xC7,
+    0xA2, 0x0E, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x30, 0x04, 0xA2, 0x0F, 0x86, 0x00, 0xEA, 0xA9, 0x00,
+    0x30, 0x03, 0x4C, 0xD9, 0xC7, 0xA2, 0x10, 0x86, 0x00, 0xEA, 0x60, 0xEA, 0xA9, 0xFF, 0x85, 0x01,
+    0x24, 0x01, 0xA9, 0x00, 0x38, 0x78, 0xF8, 0x08, 0x68, 0x29, 0xEF, 0xC9, 0x6F, 0xF0, 0x04, 0xA2,
+    0x11, 0x86, 0x00, 0xEA, 0xA9, 0x40, 0x85, 0x01, 0x24, 0x01, 0xD8, 0xA9, 0x10, 0x18, 0x08, 0x68,
+    0x29, 0xEF, 0xC9, 0x64, 0xF0, 0x04, 0xA2, 0x12, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0x85, 0x01, 0x24,
+    0x01, 0xF8, 0xA9, 0x00, 0x38, 0x08, 0x68, 0x29, 0xEF, 0xC9, 0x2F, 0xF0, 0x04, 0xA2, 0x13, 0x86,
+    0x00, 0xEA, 0xA9, 0xFF, 0x48, 0x28, 0xD0, 0x09, 0x10, 0x07, 0x50, 0x05, 0x90, 0x03, 0x4C, 0x35,
+    0xC8, 0xA2, 0x14, 0x86, 0x00, 0xEA, 0xA9, 0x04, 0x48, 0x28, 0xF0, 0x09, 0x30, 0x07, 0x70, 0x05,
+    0xB0, 0x03, 0x4C, 0x49, 0xC8, 0xA2, 0x15, 0x86, 0x00, 0xEA, 0xF8, 0xA9, 0xFF, 0x85, 0x01, 0x24,
+    0x01, 0x18, 0xA9, 0x00, 0x48, 0xA9, 0xFF, 0x68, 0xD0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xB0, 0x03,
+    0x4C, 0x67, 0xC8, 0xA2, 0x16, 0x86, 0x00, 0xEA, 0xA9, 0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xA9,
+    0xFF, 0x48, 0xA9, 0x00, 0x68, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x84, 0xC8,
+    0xA2, 0x17, 0x86, 0x00, 0x60, 0xEA, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0x55, 0x09,
+    0xAA, 0xB0, 0x0B, 0x10, 0x09, 0xC9, 0xFF, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0xA2, 0xC8, 0xA2, 0x18,
+    0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x00, 0x09, 0x00, 0xD0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30,
+    0x03, 0x4C, 0xB8, 0xC8, 0xA2, 0x19, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x55, 0x29, 0xAA,
+    0xD0, 0x09, 0x50, 0x07, 0xB0, 0x05, 0x30, 0x03, 0x4C, 0xCF, 0xC8, 0xA2, 0x1A, 0x86, 0x00, 0xEA,
+    0x38, 0xB8, 0xA9, 0xF8, 0x29, 0xEF, 0x90, 0x0B, 0x10, 0x09, 0xC9, 0xE8, 0xD0, 0x05, 0x70, 0x03,
+    0x4C, 0xE7, 0xC8, 0xA2, 0x1B, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x5F, 0x49, 0xAA, 0xB0,
+    0x0B, 0x10, 0x09, 0xC9, 0xF5, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0x00, 0xC9, 0xA2, 0x1C, 0x86, 0x00,
+    0xEA, 0x38, 0xB8, 0xA9, 0x70, 0x49, 0x70, 0xD0, 0x09, 0x70, 0x07, 0x90, 0x05, 0x30, 0x03, 0x4C,
+    0x16, 0xC9, 0xA2, 0x1D, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x00, 0x69, 0x69, 0x30, 0x0B,
+    0xB0, 0x09, 0xC9, 0x69, 0xD0, 0x05, 0x70, 0x03, 0x4C, 0x2F, 0xC9, 0xA2, 0x1E, 0x86, 0x00, 0xEA,
+    0x38, 0xF8, 0x24, 0x01, 0xA9, 0x01, 0x69, 0x69, 0x30, 0x0B, 0xB0, 0x09, 0xC9, 0x6B, 0xD0, 0x05,
+    0x70, 0x03, 0x4C, 0x49, 0xC9, 0xA2, 0x1F, 0x86, 0x00, 0xEA, 0xD8, 0x38, 0xB8, 0xA9, 0x7F, 0x69,
+    0x7F, 0x10, 0x0B, 0xB0, 0x09, 0xC9, 0xFF, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0x62, 0xC9, 0xA2, 0x20,
+    0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x7F, 0x69, 0x80, 0x10, 0x0B, 0xB0, 0x09, 0xC9, 0xFF,
+    0xD0, 0x05, 0x70, 0x03, 0x4C, 0x7B, 0xC9, 0xA2, 0x21, 0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x7F,
+    0x69, 0x80, 0xD0, 0x09, 0x30, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x91, 0xC9, 0xA2, 0x22, 0x86,
+    0x00, 0xEA, 0x38, 0xB8, 0xA9, 0x9F, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0xA5,
+    0xC9, 0xA2, 0x23, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA9, 0x00, 0xD0, 0x09, 0x30, 0x07, 0x50,
+    0x05, 0xB0, 0x03, 0x4C, 0xBA, 0xC9, 0xA2, 0x23, 0x86, 0x00, 0xEA, 0x24, 0x01, 0xA9, 0x40, 0xC9,
+    0x40, 0x30, 0x09, 0x90, 0x07, 0xD0, 0x05, 0x50, 0x03, 0x4C, 0xD0, 0xC9, 0xA2, 0x24, 0x86, 0x00,
+    0xEA, 0xB8, 0xC9, 0x3F, 0xF0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0xE3, 0xC9, 0xA2,
+    0x25, 0x86, 0x00, 0xEA, 0xC9, 0x41, 0xF0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4C, 0xF3, 0xC9, 0xA2,
+    0x26, 0x86, 0x00, 0xEA, 0xA9, 0x80, 0xC9, 0x00, 0xF0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4C, 0x05,
+    0xCA, 0xA2, 0x27, 0x86, 0x00, 0xEA, 0xC9, 0x80, 0xD0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4C, 0x15,
+    0xCA, 0xA2, 0x28, 0x86, 0x00, 0xEA, 0xC9, 0x81, 0xB0, 0x07, 0xF0, 0x05, 0x10, 0x03, 0x4C, 0x25,
+    0xCA, 0xA2, 0x29, 0x86, 0x00, 0xEA, 0xC9, 0x7F, 0x90, 0x07, 0xF0, 0x05, 0x30, 0x03, 0x4C, 0x35,
+    0xCA, 0xA2, 0x2A, 0x86, 0x00, 0xEA, 0x24, 0x01, 0xA0, 0x40, 0xC0, 0x40, 0xD0, 0x09, 0x30, 0x07,
+    0x90, 0x05, 0x50, 0x03, 0x4C, 0x4B, 0xCA, 0xA2, 0x2B, 0x86, 0x00, 0xEA, 0xB8, 0xC0, 0x3F, 0xF0,
+    0x09, 0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0x5E, 0xCA, 0xA2, 0x2C, 0x86, 0x00, 0xEA, 0xC0,
+    0x41, 0xF0, 0x07, 0x10, 0x05, 0x10, 0x03, 0x4C, 0x6E, 0xCA, 0xA2, 0x2D, 0x86, 0x00, 0xEA, 0xA0,
+    0x80, 0xC0, 0x00, 0xF0, 0x07, 0x10, 0x05, 0x90, 0x03, 0x4C, 0x80, 0xCA, 0xA2, 0x2E, 0x86, 0x00,
+    0xEA, 0xC0, 0x80, 0xD0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x4C, 0x90, 0xCA, 0xA2, 0x2F, 0x86, 0x00,
+    0xEA, 0xC0, 0x81, 0xB0, 0x07, 0xF0, 0x05, 0x10, 0x03, 0x4C, 0xA0, 0xCA, 0xA2, 0x30, 0x86, 0x00,
+    0xEA, 0xC0, 0x7F, 0x90, 0x07, 0xF0, 0x05, 0x30, 0x03, 0x4C, 0xB0, 0xCA, 0xA2, 0x31, 0x86, 0x00,
+    0xEA, 0x24, 0x01, 0xA2, 0x40, 0xE0, 0x40, 0xD0, 0x09, 0x30, 0x07, 0x90, 0x05, 0x50, 0x03, 0x4C,
+    0xC6, 0xCA, 0xA9, 0x32, 0x85, 0x00, 0xEA, 0xB8, 0xE0, 0x3F, 0xF0, 0x09, 0x30, 0x07, 0x90, 0x05,
+    0x70, 0x03, 0x4C, 0xD9, 0xCA, 0xA9, 0x33, 0x85, 0x00, 0xEA, 0xE0, 0x41, 0xF0, 0x07, 0x10, 0x05,
+    0x10, 0x03, 0x4C, 0xE9, 0xCA, 0xA9, 0x34, 0x85, 0x00, 0xEA, 0xA2, 0x80, 0xE0, 0x00, 0xF0, 0x07,
+    0x10, 0x05, 0x90, 0x03, 0x4C, 0xFB, 0xCA, 0xA9, 0x35, 0x85, 0x00, 0xEA, 0xE0, 0x80, 0xD0, 0x07,
+    0x30, 0x05, 0x90, 0x03, 0x4C, 0x0B, 0xCB, 0xA9, 0x36, 0x85, 0x00, 0xEA, 0xE0, 0x81, 0xB0, 0x07,
+    0xF0, 0x05, 0x10, 0x03, 0x4C, 0x1B, 0xCB, 0xA9, 0x37, 0x85, 0x00, 0xEA, 0xE0, 0x7F, 0x90, 0x07,
+    0xF0, 0x05, 0x30, 0x03, 0x4C, 0x2B, 0xCB, 0xA9, 0x38, 0x85, 0x00, 0xEA, 0x38, 0xB8, 0xA2, 0x9F,
+    0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90, 0x03, 0x4C, 0x3F, 0xCB, 0xA2, 0x39, 0x86, 0x00, 0xEA,
+    0x18, 0x24, 0x01, 0xA2, 0x00, 0xD0, 0x09, 0x30, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x4C, 0x54, 0xCB,
+    0xA2, 0x3A, 0x86, 0x00, 0xEA, 0x38, 0xB8, 0xA0, 0x9F, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0x90,
+    0x03, 0x4C, 0x68, 0xCB, 0xA2, 0x3B, 0x86, 0x00, 0xEA, 0x18, 0x24, 0x01, 0xA0, 0x00, 0xD0, 0x09,
+    0x30, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x4C, 0x7D, 0xCB, 0xA2, 0x3C, 0x86, 0x00, 0xEA, 0xA9, 0x55,
+    0xA2, 0xAA, 0xA0, 0x33, 0xC9, 0x55, 0xD0, 0x23, 0xE0, 0xAA, 0xD0, 0x1F, 0xC0, 0x33, 0xD0, 0x1B,
+    0xC9, 0x55, 0xD0, 0x17, 0xE0, 0xAA, 0xD0, 0x13, 0xC0, 0x33, 0xD0, 0x0F, 0xC9, 0x56, 0xF0, 0x0B,
+    0xE0, 0xAB, 0xF0, 0x07, 0xC0, 0x34, 0xF0, 0x03, 0x4C, 0xAF, 0xCB, 0xA2, 0x3D, 0x86, 0x00, 0xA0,
+    0x71, 0x20, 0x31, 0xF9, 0xE9, 0x40, 0x20, 0x37, 0xF9, 0xC8, 0x20, 0x47, 0xF9, 0xE9, 0x3F, 0x20,
+    0x4C, 0xF9, 0xC8, 0x20, 0x5C, 0xF9, 0xE9, 0x41, 0x20, 0x62, 0xF9, 0xC8, 0x20, 0x72, 0xF9, 0xE9,
+    0x00, 0x20, 0x76, 0xF9, 0xC8, 0x20, 0x80, 0xF9, 0xE9, 0x7F, 0x20, 0x84, 0xF9, 0x60, 0xEA, 0xA9,
+    0xFF, 0x85, 0x01, 0xA9, 0x44, 0xA2, 0x55, 0xA0, 0x66, 0xE8, 0x88, 0xE0, 0x56, 0xD0, 0x21, 0xC0,
+    0x65, 0xD0, 0x1D, 0xE8, 0xE8, 0x88, 0x88, 0xE0, 0x58, 0xD0, 0x15, 0xC0, 0x63, 0xD0, 0x11, 0xCA,
+    0xC8, 0xE0, 0x57, 0xD0, 0x0B, 0xC0, 0x64, 0xD0, 0x07, 0xC9, 0x44, 0xD0, 0x03, 0x4C, 0x14, 0xCC,
+    0xA2, 0x3E, 0x86, 0x00, 0xEA, 0x38, 0xA2, 0x69, 0xA9, 0x96, 0x24, 0x01, 0xA0, 0xFF, 0xC8, 0xD0,
+    0x3D, 0x30, 0x3B, 0x90, 0x39, 0x50, 0x37, 0xC0, 0x00, 0xD0, 0x33, 0xC8, 0xF0, 0x30, 0x30, 0x2E,
+    0x90, 0x2C, 0x50, 0x2A, 0x18, 0xB8, 0xA0, 0x00, 0x88, 0xF0, 0x23, 0x10, 0x21, 0xB0, 0x1F, 0x70,
+    0x1D, 0xC0, 0xFF, 0xD0, 0x19, 0x18, 0x88, 0xF0, 0x15, 0x10, 0x13, 0xB0, 0x11, 0x70, 0x0F, 0xC0,
+    0xFE, 0xD0, 0x0B, 0xC9, 0x96, 0xD0, 0x07, 0xE0, 0x69, 0xD0, 0x03, 0x4C, 0x62, 0xCC, 0xA2, 0x3F,
+    0x86, 0x00, 0xEA, 0x38, 0xA0, 0x69, 0xA9, 0x96, 0x24, 0x01, 0xA2, 0xFF, 0xE8, 0xD0, 0x3D, 0x30,
+    0x3B, 0x90, 0x39, 0x50, 0x37, 0xE0, 0x00, 0xD0, 0x33, 0xE8, 0xF0, 0x30, 0x30, 0x2E, 0x90, 0x2C,
+    0x50, 0x2A, 0x18, 0xB8, 0xA2, 0x00, 0xCA, 0xF0, 0x23, 0x10, 0x21, 0xB0, 0x1F, 0x70, 0x1D, 0xE0,
+    0xFF, 0xD0, 0x19, 0x18, 0xCA, 0xF0, 0x15, 0x10, 0x13, 0xB0, 0x11, 0x70, 0x0F, 0xE0, 0xFE, 0xD0,
+    0x0B, 0xC9, 0x96, 0xD0, 0x07, 0xC0, 0x69, 0xD0, 0x03, 0x4C, 0xB0, 0xCC, 0xA2, 0x40, 0x86, 0x00,
+    0xEA, 0xA9, 0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0xA8, 0xF0, 0x2E, 0xB0, 0x2C, 0x50,
+    0x2A, 0x10, 0x28, 0xC9, 0x85, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x85, 0xD0, 0x1C, 0xA9,
+    0x00, 0x38, 0xB8, 0xA8, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B,
+    0xE0, 0x34, 0xD0, 0x07, 0xC0, 0x00, 0xD0, 0x03, 0x4C, 0xEF, 0xCC, 0xA2, 0x41, 0x86, 0x00, 0xEA,
+    0xA9, 0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0xAA, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A,
+    0x10, 0x28, 0xC9, 0x85, 0xD0, 0x24, 0xE0, 0x85, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA9, 0x00,
+    0x38, 0xB8, 0xAA, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0,
+    0x00, 0xD0, 0x07, 0xC0, 0x99, 0xD0, 0x03, 0x4C, 0x2E, 0xCD, 0xA2, 0x42, 0x86, 0x00, 0xEA, 0xA9,
+    0x85, 0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0x98, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A, 0x10,
+    0x28, 0xC9, 0x99, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA0, 0x00, 0x38,
+    0xB8, 0x98, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0, 0x34,
+    0xD0, 0x07, 0xC0, 0x00, 0xD0, 0x03, 0x4C, 0x6D, 0xCD, 0xA2, 0x43, 0x86, 0x00, 0xEA, 0xA9, 0x85,
+    0xA2, 0x34, 0xA0, 0x99, 0x18, 0x24, 0x01, 0x8A, 0xF0, 0x2E, 0xB0, 0x2C, 0x50, 0x2A, 0x30, 0x28,
+    0xC9, 0x34, 0xD0, 0x24, 0xE0, 0x34, 0xD0, 0x20, 0xC0, 0x99, 0xD0, 0x1C, 0xA2, 0x00, 0x38, 0xB8,
+    0x8A, 0xD0, 0x15, 0x90, 0x13, 0x70, 0x11, 0x30, 0x0F, 0xC9, 0x00, 0xD0, 0x0B, 0xE0, 0x00, 0xD0,
+    0x07, 0xC0, 0x99, 0xD0, 0x03, 0x4C, 0xAC, 0xCD, 0xA2, 0x44, 0x86, 0x00, 0xEA, 0xBA, 0x8E, 0xFF,
+    0x07, 0xA0, 0x33, 0xA2, 0x69, 0xA9, 0x84, 0x18, 0x24, 0x01, 0x9A, 0xF0, 0x32, 0x10, 0x30, 0xB0,
+    0x2E, 0x50, 0x2C, 0xC9, 0x84, 0xD0, 0x28, 0xE0, 0x69, 0xD0, 0x24, 0xC0, 0x33, 0xD0, 0x20, 0xA0,
+    0x01, 0xA9, 0x04, 0x38, 0xB8, 0xA2, 0x00, 0xBA, 0xF0, 0x15, 0x30, 0x13, 0x90, 0x11, 0x70, 0x0F,
+    0xE0, 0x69, 0xD0, 0x0B, 0xC9, 0x04, 0xD0, 0x07, 0xC0, 0x01, 0xD0, 0x03, 0x4C, 0xF3, 0xCD, 0xA2,
+    0x45, 0x86, 0x00, 0xAE, 0xFF, 0x07, 0x9A, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xBA, 0x8E, 0xFF, 0x07,
+    0xEA, 0xA2, 0x80, 0x9A, 0xA9, 0x33, 0x48, 0xA9, 0x69, 0x48, 0xBA, 0xE0, 0x7E, 0xD0, 0x20, 0x68,
+    0xC9, 0x69, 0xD0, 0x1B, 0x68, 0xC9, 0x33, 0xD0, 0x16, 0xBA, 0xE0, 0x80, 0xD0, 0x11, 0xAD, 0x80,
+    0x01, 0xC9, 0x33, 0xD0, 0x0A, 0xAD, 0x7F, 0x01, 0xC9, 0x69, 0xD0, 0x03, 0x4C, 0x33, 0xCE, 0xA2,
+    0x46, 0x86, 0x00, 0xEA, 0xA2, 0x80, 0x9A, 0x20, 0x3D, 0xCE, 0x4C, 0x5B, 0xCE, 0xBA, 0xE0, 0x7E,
+    0xD0, 0x19, 0x68, 0x68, 0xBA, 0xE0, 0x80, 0xD0, 0x12, 0xA9, 0x00, 0x20, 0x4E, 0xCE, 0x68, 0xC9,
+    0x4D, 0xD0, 0x08, 0x68, 0xC9, 0xCE, 0xD0, 0x03, 0x4C, 0x5F, 0xCE, 0xA2, 0x47, 0x86, 0x00, 0xEA,
+    0xA9, 0xCE, 0x48, 0xA9, 0x66, 0x48, 0x60, 0xA2, 0x77, 0xA0, 0x69, 0x18, 0x24, 0x01, 0xA9, 0x83,
+    0x20, 0x66, 0xCE, 0xF0, 0x24, 0x10, 0x22, 0xB0, 0x20, 0x50, 0x1E, 0xC9, 0x83, 0xD0, 0x1A, 0xC0,
+    0x69, 0xD0, 0x16, 0xE0, 0x77, 0xD0, 0x12, 0x38, 0xB8, 0xA9, 0x00, 0x20, 0x66, 0xCE, 0xD0, 0x09,
+    0x30, 0x07, 0x90, 0x05, 0x70, 0x03, 0x4C, 0x9D, 0xCE, 0xA2, 0x48, 0x86, 0x00, 0xEA, 0xA9, 0xCE,
+    0x48, 0xA9, 0xAE, 0x48, 0xA9, 0x65, 0x48, 0xA9, 0x55, 0xA0, 0x88, 0xA2, 0x99, 0x40, 0x30, 0x35,
+    0x50, 0x33, 0xF0, 0x31, 0x90, 0x2F, 0xC9, 0x55, 0xD0, 0x2B, 0xC0, 0x88, 0xD0, 0x27, 0xE0, 0x99,
+    0xD0, 0x23, 0xA9, 0xCE, 0x48, 0xA9, 0xCE, 0x48, 0xA9, 0x87, 0x48, 0xA9, 0x55, 0x40, 0x10, 0x15,
+    0x70, 0x13, 0xD0, 0x11, 0x90, 0x0F, 0xC9, 0x55, 0xD0, 0x0B, 0xC0, 0x88, 0xD0, 0x07, 0xE0, 0x99,
+    0xD0, 0x03, 0x4C, 0xE9, 0xCE, 0xA2, 0x49, 0x86, 0x00, 0xAE, 0xFF, 0x07, 0x9A, 0x60, 0xA2, 0x55,
+    0xA0, 0x69, 0xA9, 0xFF, 0x85, 0x01, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x4A, 0x90, 0x1D, 0xD0,
+    0x1B, 0x30, 0x19, 0x50, 0x17, 0xC9, 0x00, 0xD0, 0x13, 0xB8, 0xA9, 0xAA, 0x4A, 0xB0, 0x0D, 0xF0,
+    0x0B, 0x30, 0x09, 0x70, 0x07, 0xC9, 0x55, 0xD0, 0x03, 0x4C, 0x20, 0xCF, 0xA2, 0x4A, 0x86, 0x00,
+    0xEA, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x0A, 0x90, 0x1E, 0xD0, 0x1C, 0x30, 0x1A, 0x50, 0x18, 0xC9,
+    0x00, 0xD0, 0x14, 0xB8, 0x38, 0xA9, 0x55, 0x0A, 0xB0, 0x0D, 0xF0, 0x0B, 0x10, 0x09, 0x70, 0x07,
+    0xC9, 0xAA, 0xD0, 0x03, 0x4C, 0x4B, 0xCF, 0xA2, 0x4B, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x38, 0xA9,
+    0x01, 0x6A, 0x90, 0x1E, 0xF0, 0x1C, 0x10, 0x1A, 0x50, 0x18, 0xC9, 0x80, 0xD0, 0x14, 0xB8, 0x18,
+    0xA9, 0x55, 0x6A, 0x90, 0x0D, 0xF0, 0x0B, 0x30, 0x09, 0x70, 0x07, 0xC9, 0x2A, 0xD0, 0x03, 0x4C,
+    0x76, 0xCF, 0xA2, 0x4C, 0x86, 0x00, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x2A, 0x90, 0x1E, 0xF0,
+    0x1C, 0x30, 0x1A, 0x50, 0x18, 0xC9, 0x01, 0xD0, 0x14, 0xB8, 0x18, 0xA9, 0x55, 0x2A, 0xB0, 0x0D,
+    0xF0, 0x0B, 0x10, 0x09, 0x70, 0x07, 0xC9, 0xAA, 0xD0, 0x03, 0x4C, 0xA1, 0xCF, 0xA2, 0x4D, 0x86,
+    0x00, 0x60, 0xA5, 0x00, 0x8D, 0xFF, 0x07, 0xA9, 0x00, 0x85, 0x80, 0xA9, 0x02, 0x85, 0x81, 0xA9,
+    0xFF, 0x85, 0x01, 0xA9, 0x00, 0x85, 0x82, 0xA9, 0x03, 0x85, 0x83, 0x85, 0x84, 0xA9, 0x00, 0x85,
+    0xFF, 0xA9, 0x04, 0x85, 0x00, 0xA9, 0x5A, 0x8D, 0x00, 0x02, 0xA9, 0x5B, 0x8D, 0x00, 0x03, 0xA9,
+    0x5C, 0x8D, 0x03, 0x03, 0xA9, 0x5D, 0x8D, 0x00, 0x04, 0xA2, 0x00, 0xA1, 0x80, 0xC9, 0x5A, 0xD0,
+    0x1F, 0xE8, 0xE8, 0xA1, 0x80, 0xC9, 0x5B, 0xD0, 0x17, 0xE8, 0xA1, 0x80, 0xC9, 0x5C, 0xD0, 0x10,
+    0xA2, 0x00, 0xA1, 0xFF, 0xC9, 0x5D, 0xD0, 0x08, 0xA2, 0x81, 0xA1, 0xFF, 0xC9, 0x5A, 0xF0, 0x05,
+    0xA9, 0x58, 0x8D, 0xFF, 0x07, 0xA9, 0xAA, 0xA2, 0x00, 0x81, 0x80, 0xE8, 0xE8, 0xA9, 0xAB, 0x81,
+    0x80, 0xE8, 0xA9, 0xAC, 0x81, 0x80, 0xA2, 0x00, 0xA9, 0xAD, 0x81, 0xFF, 0xAD, 0x00, 0x02, 0xC9,
+    0xAA, 0xD0, 0x15, 0xAD, 0x00, 0x03, 0xC9, 0xAB, 0xD0, 0x0E, 0xAD, 0x03, 0x03, 0xC9, 0xAC, 0xD0,
+    0x07, 0xAD, 0x00, 0x04, 0xC9, 0xAD, 0xF0, 0x05, 0xA9, 0x59, 0x8D, 0xFF, 0x07, 0xAD, 0xFF, 0x07,
+    0x85, 0x00, 0xA9, 0x00, 0x8D, 0x00, 0x03, 0xA9, 0xAA, 0x8D, 0x00, 0x02, 0xA2, 0x00, 0xA0, 0x5A,
+    0x20, 0xB6, 0xF7, 0x01, 0x80, 0x20, 0xC0, 0xF7, 0xC8, 0x20, 0xCE, 0xF7, 0x01, 0x82, 0x20, 0xD3,
+    0xF7, 0xC8, 0x20, 0xDF, 0xF7, 0x21, 0x80, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x8D, 0x00, 0x03,
+    0x20, 0xF1, 0xF7, 0x21, 0x82, 0x20, 0xF6, 0xF7, 0xC8, 0x20, 0x04, 0xF8, 0x41, 0x80, 0x20, 0x0A,
+    0xF8, 0xC8, 0xA9, 0x70, 0x8D, 0x00, 0x03, 0x20, 0x18, 0xF8, 0x41, 0x82, 0x20, 0x1D, 0xF8, 0xC8,
+    0xA9, 0x69, 0x8D, 0x00, 0x02, 0x20, 0x29, 0xF8, 0x61, 0x80, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D,
+    0xF8, 0x61, 0x80, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x20, 0x51, 0xF8, 0x61,
+    0x80, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x00, 0x02, 0x20, 0x64, 0xF8, 0x61, 0x80, 0x20,
+    0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x61, 0x80, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x00,
+    0x02, 0x20, 0x89, 0xF8, 0xC1, 0x80, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x8D, 0x00, 0x02,
+    0x68, 0x20, 0x9A, 0xF8, 0xC1, 0x80, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x8D, 0x00, 0x02,
+    0x68, 0xC1, 0x80, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x8D, 0x00, 0x02, 0x68, 0x20, 0xB2,
+    0xF8, 0xC1, 0x80, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80,
+    0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80, 0x20, 0xC9, 0xF8,
+    0xC8, 0x48, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x68, 0xC1, 0x80, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40,
+    0x8D, 0x00, 0x02, 0x20, 0x31, 0xF9, 0xE1, 0x80, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x00,
+    0x02, 0x20, 0x47, 0xF9, 0xE1, 0x80, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x00, 0x02, 0x20,
+    0x5C, 0xF9, 0xE1, 0x80, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x00, 0x02, 0x20, 0x72, 0xF9,
+    0xE1, 0x80, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x00, 0x02, 0x20, 0x80, 0xF9, 0xE1, 0x80,
+    0x20, 0x84, 0xF9, 0x60, 0xA9, 0x55, 0x85, 0x78, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x11,
+    0xA2, 0x23, 0xA9, 0x00, 0xA5, 0x78, 0xF0, 0x10, 0x30, 0x0E, 0xC9, 0x55, 0xD0, 0x0A, 0xC0, 0x11,
+    0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0x76, 0x85, 0x00, 0xA9, 0x46, 0x24, 0x01,
+    0x85, 0x78, 0xF0, 0x0A, 0x10, 0x08, 0x50, 0x06, 0xA5, 0x78, 0xC9, 0x46, 0xF0, 0x04, 0xA9, 0x77,
+    0x85, 0x00, 0xA9, 0x55, 0x85, 0x78, 0x24, 0x01, 0xA9, 0x11, 0xA2, 0x23, 0xA0, 0x00, 0xA4, 0x78,
+    0xF0, 0x10, 0x30, 0x0E, 0xC0, 0x55, 0xD0, 0x0A, 0xC9, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02,
+    0xF0, 0x04, 0xA9, 0x78, 0x85, 0x00, 0xA0, 0x46, 0x24, 0x01, 0x84, 0x78, 0xF0, 0x0A, 0x10, 0x08,
+    0x50, 0x06, 0xA4, 0x78, 0xC0, 0x46, 0xF0, 0x04, 0xA9, 0x79, 0x85, 0x00, 0x24, 0x01, 0xA9, 0x55,
+    0x85, 0x78, 0xA0, 0x11, 0xA9, 0x23, 0xA2, 0x00, 0xA6, 0x78, 0xF0, 0x10, 0x30, 0x0E, 0xE0, 0x55,
+    0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xC9, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0x7A, 0x85, 0x00,
+    0xA2, 0x46, 0x24, 0x01, 0x86, 0x78, 0xF0, 0x0A, 0x10, 0x08, 0x50, 0x06, 0xA6, 0x78, 0xE0, 0x46,
+    0xF0, 0x04, 0xA9, 0x7B, 0x85, 0x00, 0xA9, 0xC0, 0x85, 0x78, 0xA2, 0x33, 0xA0, 0x88, 0xA9, 0x05,
+    0x24, 0x78, 0x10, 0x10, 0x50, 0x0E, 0xD0, 0x0C, 0xC9, 0x05, 0xD0, 0x08, 0xE0, 0x33, 0xD0, 0x04,
+    0xC0, 0x88, 0xF0, 0x04, 0xA9, 0x7C, 0x85, 0x00, 0xA9, 0x03, 0x85, 0x78, 0xA9, 0x01, 0x24, 0x78,
+    0x30, 0x08, 0x70, 0x06, 0xF0, 0x04, 0xC9, 0x01, 0xF0, 0x04, 0xA9, 0x7D, 0x85, 0x00, 0xA0, 0x7E,
+    0xA9, 0xAA, 0x85, 0x78, 0x20, 0xB6, 0xF7, 0x05, 0x78, 0x20, 0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x85,
+    0x78, 0x20, 0xCE, 0xF7, 0x05, 0x78, 0x20, 0xD3, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0xDF,
+    0xF7, 0x25, 0x78, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x85, 0x78, 0x20, 0xF1, 0xF7, 0x25, 0x78,
+    0x20, 0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0x04, 0xF8, 0x45, 0x78, 0x20, 0x0A, 0xF8,
+    0xC8, 0xA9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xF8, 0x45, 0x78, 0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69,
+    0x85, 0x78, 0x20, 0x29, 0xF8, 0x65, 0x78, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D, 0xF8, 0x65, 0x78,
+    0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x51, 0xF8, 0x65, 0x78, 0x20, 0x56, 0xF8,
+    0xC8, 0xA9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xF8, 0x65, 0x78, 0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78,
+    0xF8, 0x65, 0x78, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xF8, 0xC5, 0x78,
+    0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x85, 0x78, 0x68, 0x20, 0x9A, 0xF8, 0xC5, 0x78, 0x20,
+    0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xA8, 0xF8, 0xC8, 0x48,
+    0xA9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xB2, 0xF8, 0xC5, 0x78, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9,
+    0x80, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x85, 0x78, 0x68,
+    0xC5, 0x78, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x85, 0x78, 0x68, 0xC5, 0x78, 0x20, 0xD3,
+    0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xF9, 0xE5, 0x78, 0x20, 0x37, 0xF9, 0xC8, 0xA9,
+    0x3F, 0x85, 0x78, 0x20, 0x47, 0xF9, 0xE5, 0x78, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x85, 0x78,
+    0x20, 0x5C, 0xF9, 0xE5, 0x78, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0x72, 0xF9,
+    0xE5, 0x78, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x80, 0xF9, 0xE5, 0x78, 0x20,
+    0x84, 0xF9, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x89, 0xF8, 0xAA, 0xE4, 0x78, 0x20, 0x8E, 0xF8,
+    0xC8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0x9A, 0xF8, 0xE4, 0x78, 0x20, 0x9C, 0xF8, 0xC8, 0xA9, 0x41,
+    0x85, 0x78, 0xE4, 0x78, 0x20, 0xA8, 0xF8, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0xB2, 0xF8, 0xAA,
+    0xE4, 0x78, 0x20, 0xB5, 0xF8, 0xC8, 0xA9, 0x80, 0x85, 0x78, 0xE4, 0x78, 0x20, 0xBF, 0xF8, 0xC8,
+    0xA9, 0x81, 0x85, 0x78, 0xE4, 0x78, 0x20, 0xC9, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0xE4, 0x78,
+    0x20, 0xD3, 0xF8, 0xC8, 0x98, 0xAA, 0xA9, 0x40, 0x85, 0x78, 0x20, 0xDD, 0xF8, 0xC4, 0x78, 0x20,
+    0xE2, 0xF8, 0xE8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0xEE, 0xF8, 0xC4, 0x78, 0x20, 0xF0, 0xF8, 0xE8,
+    0xA9, 0x41, 0x85, 0x78, 0xC4, 0x78, 0x20, 0xFC, 0xF8, 0xE8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0x06,
+    0xF9, 0xC4, 0x78, 0x20, 0x09, 0xF9, 0xE8, 0xA9, 0x80, 0x85, 0x78, 0xC4, 0x78, 0x20, 0x13, 0xF9,
+    0xE8, 0xA9, 0x81, 0x85, 0x78, 0xC4, 0x78, 0x20, 0x1D, 0xF9, 0xE8, 0xA9, 0x7F, 0x85, 0x78, 0xC4,
+    0x78, 0x20, 0x27, 0xF9, 0xE8, 0x8A, 0xA8, 0x20, 0x90, 0xF9, 0x85, 0x78, 0x46, 0x78, 0xA5, 0x78,
+    0x20, 0x9D, 0xF9, 0xC8, 0x85, 0x78, 0x46, 0x78, 0xA5, 0x78, 0x20, 0xAD, 0xF9, 0xC8, 0x20, 0xBD,
+    0xF9, 0x85, 0x78, 0x06, 0x78, 0xA5, 0x78, 0x20, 0xC3, 0xF9, 0xC8, 0x85, 0x78, 0x06, 0x78, 0xA5,
+    0x78, 0x20, 0xD4, 0xF9, 0xC8, 0x20, 0xE4, 0xF9, 0x85, 0x78, 0x66, 0x78, 0xA5, 0x78, 0x20, 0xEA,
+    0xF9, 0xC8, 0x85, 0x78, 0x66, 0x78, 0xA5, 0x78, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x85,
+    0x78, 0x26, 0x78, 0xA5, 0x78, 0x20, 0x10, 0xFA, 0xC8, 0x85, 0x78, 0x26, 0x78, 0xA5, 0x78, 0x20,
+    0x21, 0xFA, 0xA9, 0xFF, 0x85, 0x78, 0x85, 0x01, 0x24, 0x01, 0x38, 0xE6, 0x78, 0xD0, 0x0C, 0x30,
+    0x0A, 0x50, 0x08, 0x90, 0x06, 0xA5, 0x78, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0xAB, 0x85, 0x00, 0xA9,
+    0x7F, 0x85, 0x78, 0xB8, 0x18, 0xE6, 0x78, 0xF0, 0x0C, 0x10, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xA5,
+    0x78, 0xC9, 0x80, 0xF0, 0x04, 0xA9, 0xAC, 0x85, 0x00, 0xA9, 0x00, 0x85, 0x78, 0x24, 0x01, 0x38,
+    0xC6, 0x78, 0xF0, 0x0C, 0x10, 0x0A, 0x50, 0x08, 0x90, 0x06, 0xA5, 0x78, 0xC9, 0xFF, 0xF0, 0x04,
+    0xA9, 0xAD, 0x85, 0x00, 0xA9, 0x80, 0x85, 0x78, 0xB8, 0x18, 0xC6, 0x78, 0xF0, 0x0C, 0x30, 0x0A,
+    0x70, 0x08, 0xB0, 0x06, 0xA5, 0x78, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0xAE, 0x85, 0x00, 0xA9, 0x01,
+    0x85, 0x78, 0xC6, 0x78, 0xF0, 0x04, 0xA9, 0xAF, 0x85, 0x00, 0x60, 0xA9, 0x55, 0x8D, 0x78, 0x06,
+    0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x11, 0xA2, 0x23, 0xA9, 0x00, 0xAD, 0x78, 0x06, 0xF0,
+    0x10, 0x30, 0x0E, 0xC9, 0x55, 0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0,
+    0x04, 0xA9, 0xB0, 0x85, 0x00, 0xA9, 0x46, 0x24, 0x01, 0x8D, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09,
+    0x50, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x46, 0xF0, 0x04, 0xA9, 0xB1, 0x85, 0x00, 0xA9, 0x55, 0x8D,
+    0x78, 0x06, 0x24, 0x01, 0xA9, 0x11, 0xA2, 0x23, 0xA0, 0x00, 0xAC, 0x78, 0x06, 0xF0, 0x10, 0x30,
+    0x0E, 0xC0, 0x55, 0xD0, 0x0A, 0xC9, 0x11, 0xD0, 0x06, 0xE0, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9,
+    0xB2, 0x85, 0x00, 0xA0, 0x46, 0x24, 0x01, 0x8C, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09, 0x50, 0x07,
+    0xAC, 0x78, 0x06, 0xC0, 0x46, 0xF0, 0x04, 0xA9, 0xB3, 0x85, 0x00, 0x24, 0x01, 0xA9, 0x55, 0x8D,
+    0x78, 0x06, 0xA0, 0x11, 0xA9, 0x23, 0xA2, 0x00, 0xAE, 0x78, 0x06, 0xF0, 0x10, 0x30, 0x0E, 0xE0,
+    0x55, 0xD0, 0x0A, 0xC0, 0x11, 0xD0, 0x06, 0xC9, 0x23, 0x50, 0x02, 0xF0, 0x04, 0xA9, 0xB4, 0x85,
+    0x00, 0xA2, 0x46, 0x24, 0x01, 0x8E, 0x78, 0x06, 0xF0, 0x0B, 0x10, 0x09, 0x50, 0x07, 0xAE, 0x78,
+    0x06, 0xE0, 0x46, 0xF0, 0x04, 0xA9, 0xB5, 0x85, 0x00, 0xA9, 0xC0, 0x8D, 0x78, 0x06, 0xA2, 0x33,
+    0xA0, 0x88, 0xA9, 0x05, 0x2C, 0x78, 0x06, 0x10, 0x10, 0x50, 0x0E, 0xD0, 0x0C, 0xC9, 0x05, 0xD0,
+    0x08, 0xE0, 0x33, 0xD0, 0x04, 0xC0, 0x88, 0xF0, 0x04, 0xA9, 0xB6, 0x85, 0x00, 0xA9, 0x03, 0x8D,
+    0x78, 0x06, 0xA9, 0x01, 0x2C, 0x78, 0x06, 0x30, 0x08, 0x70, 0x06, 0xF0, 0x04, 0xC9, 0x01, 0xF0,
+    0x04, 0xA9, 0xB7, 0x85, 0x00, 0xA0, 0xB8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xB6, 0xF7, 0x0D,
+    0x78, 0x06, 0x20, 0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xCE, 0xF7, 0x0D, 0x78,
+    0x06, 0x20, 0xD3, 0xF7, 0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xDF, 0xF7, 0x2D, 0x78, 0x06,
+    0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x8D, 0x78, 0x06, 0x20, 0xF1, 0xF7, 0x2D, 0x78, 0x06, 0x20,
+    0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0x04, 0xF8, 0x4D, 0x78, 0x06, 0x20, 0x0A,
+    0xF8, 0xC8, 0xA9, 0x70, 0x8D, 0x78, 0x06, 0x20, 0x18, 0xF8, 0x4D, 0x78, 0x06, 0x20, 0x1D, 0xF8,
+    0xC8, 0xA9, 0x69, 0x8D, 0x78, 0x06, 0x20, 0x29, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x2F, 0xF8, 0xC8,
+    0x20, 0x3D, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20,
+    0x51, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x20, 0x64,
+    0xF8, 0x6D, 0x78, 0x06, 0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x6D, 0x78, 0x06, 0x20, 0x7D,
+    0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0x8E, 0xF8,
+    0xC8, 0x48, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x68, 0x20, 0x9A, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0x9C,
+    0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xA8, 0xF8, 0xC8,
+    0x48, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x68, 0x20, 0xB2, 0xF8, 0xCD, 0x78, 0x06, 0x20, 0xB5, 0xF8,
+    0xC8, 0x48, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0x48,
+    0xA9, 0x81, 0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F,
+    0x8D, 0x78, 0x06, 0x68, 0xCD, 0x78, 0x06, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06,
+    0x20, 0x31, 0xF9, 0xED, 0x78, 0x06, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20,
+    0x47, 0xF9, 0xED, 0x78, 0x06, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x20, 0x5C,
+    0xF9, 0xED, 0x78, 0x06, 0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x72, 0xF9,
+    0xED, 0x78, 0x06, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x80, 0xF9, 0xED,
+    0x78, 0x06, 0x20, 0x84, 0xF9, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xAA, 0xEC,
+    0x78, 0x06, 0x20, 0x8E, 0xF8, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0x9A, 0xF8, 0xEC, 0x78,
+    0x06, 0x20, 0x9C, 0xF8, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xA8, 0xF8,
+    0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xB2, 0xF8, 0xAA, 0xEC, 0x78, 0x06, 0x20, 0xB5, 0xF8,
+    0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0xA9, 0x81, 0x8D,
+    0x78, 0x06, 0xEC, 0x78, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xEC, 0x78,
+    0x06, 0x20, 0xD3, 0xF8, 0xC8, 0x98, 0xAA, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0xDD, 0xF8, 0xCC,
+    0x78, 0x06, 0x20, 0xE2, 0xF8, 0xE8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0xEE, 0xF8, 0xCC, 0x78,
+    0x06, 0x20, 0xF0, 0xF8, 0xE8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06, 0x20, 0xFC, 0xF8,
+    0xE8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x06, 0xF9, 0xCC, 0x78, 0x06, 0x20, 0x09, 0xF9, 0xE8,
+    0xA9, 0x80, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06, 0x20, 0x13, 0xF9, 0xE8, 0xA9, 0x81, 0x8D, 0x78,
+    0x06, 0xCC, 0x78, 0x06, 0x20, 0x1D, 0xF9, 0xE8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xCC, 0x78, 0x06,
+    0x20, 0x27, 0xF9, 0xE8, 0x8A, 0xA8, 0x20, 0x90, 0xF9, 0x8D, 0x78, 0x06, 0x4E, 0x78, 0x06, 0xAD,
+    0x78, 0x06, 0x20, 0x9D, 0xF9, 0xC8, 0x8D, 0x78, 0x06, 0x4E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20,
+    0xAD, 0xF9, 0xC8, 0x20, 0xBD, 0xF9, 0x8D, 0x78, 0x06, 0x0E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20,
+    0xC3, 0xF9, 0xC8, 0x8D, 0x78, 0x06, 0x0E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xD4, 0xF9, 0xC8,
+    0x20, 0xE4, 0xF9, 0x8D, 0x78, 0x06, 0x6E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xEA, 0xF9, 0xC8,
+    0x8D, 0x78, 0x06, 0x6E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA,
+    0x8D, 0x78, 0x06, 0x2E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0x10, 0xFA, 0xC8, 0x8D, 0x78, 0x06,
+    0x2E, 0x78, 0x06, 0xAD, 0x78, 0x06, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x8D, 0x78, 0x06, 0x85, 0x01,
+    0x24, 0x01, 0x38, 0xEE, 0x78, 0x06, 0xD0, 0x0D, 0x30, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xAD, 0x78,
+    0x06, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0xE5, 0x85, 0x00, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0xB8, 0x18,
+    0xEE, 0x78, 0x06, 0xF0, 0x0D, 0x10, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x80,
+    0xF0, 0x04, 0xA9, 0xE6, 0x85, 0x00, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x24, 0x01, 0x38, 0xCE, 0x78,
+    0x06, 0xF0, 0x0D, 0x10, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0xFF, 0xF0, 0x04,
+    0xA9, 0xE7, 0x85, 0x00, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0xB8, 0x18, 0xCE, 0x78, 0x06, 0xF0, 0x0D,
+    0x30, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xAD, 0x78, 0x06, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0xE8, 0x85,
+    0x00, 0xA9, 0x01, 0x8D, 0x78, 0x06, 0xCE, 0x78, 0x06, 0xF0, 0x04, 0xA9, 0xE9, 0x85, 0x00, 0x60,
+    0xA9, 0xA3, 0x85, 0x33, 0xA9, 0x89, 0x8D, 0x00, 0x03, 0xA9, 0x12, 0x8D, 0x45, 0x02, 0xA9, 0xFF,
+    0x85, 0x01, 0xA2, 0x65, 0xA9, 0x00, 0x85, 0x89, 0xA9, 0x03, 0x85, 0x8A, 0xA0, 0x00, 0x38, 0xA9,
+    0x00, 0xB8, 0xB1, 0x89, 0xF0, 0x0C, 0x90, 0x0A, 0x70, 0x08, 0xC9, 0x89, 0xD0, 0x04, 0xE0, 0x65,
+    0xF0, 0x04, 0xA9, 0xEA, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x97, 0x85, 0x98, 0x24, 0x98, 0xA0, 0x34,
+    0xB1, 0x97, 0xC9, 0xA3, 0xD0, 0x02, 0xB0, 0x04, 0xA9, 0xEB, 0x85, 0x00, 0xA5, 0x00, 0x48, 0xA9,
+    0x46, 0x85, 0xFF, 0xA9, 0x01, 0x85, 0x00, 0xA0, 0xFF, 0xB1, 0xFF, 0xC9, 0x12, 0xF0, 0x04, 0x68,
+    0xA9, 0xEC, 0x48, 0x68, 0x85, 0x00, 0xA2, 0xED, 0xA9, 0x00, 0x85, 0x33, 0xA9, 0x04, 0x85, 0x34,
+    0xA0, 0x00, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0xAA, 0x8D, 0x00, 0x04, 0xA9, 0x55,
+    0x11, 0x33, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x38,
+    0xB8, 0xA9, 0x00, 0x11, 0x33, 0xF0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8,
+    0x18, 0x24, 0x01, 0xA9, 0x55, 0x31, 0x33, 0xD0, 0x06, 0x50, 0x04, 0xB0, 0x02, 0x10, 0x02, 0x86,
+    0x00, 0xE8, 0x38, 0xB8, 0xA9, 0xEF, 0x8D, 0x00, 0x04, 0xA9, 0xF8, 0x31, 0x33, 0x90, 0x08, 0x10,
+    0x06, 0xC9, 0xE8, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0xAA, 0x8D,
+    0x00, 0x04, 0xA9, 0x5F, 0x51, 0x33, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xF5, 0xD0, 0x02, 0x70, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x70, 0x8D, 0x00, 0x04, 0x51, 0x33, 0xD0, 0x06, 0x70, 0x04,
+    0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x69, 0x8D, 0x00, 0x04, 0xA9,
+    0x00, 0x71, 0x33, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x69, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8,
+    0x38, 0x24, 0x01, 0xA9, 0x00, 0x71, 0x33, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x6A, 0xD0, 0x02, 0x50,
+    0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x7F, 0x8D, 0x00, 0x04, 0x71, 0x33, 0x10, 0x08, 0xB0,
+    0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x80, 0x8D,
+    0x00, 0x04, 0xA9, 0x7F, 0x71, 0x33, 0x10, 0x08, 0xB0, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x50, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x80, 0x8D, 0x00, 0x04, 0xA9, 0x7F, 0x71, 0x33, 0xD0, 0x06,
+    0x30, 0x04, 0x70, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0x24, 0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04,
+    0xD1, 0x33, 0x30, 0x06, 0x90, 0x04, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0xCE, 0x00,
+    0x04, 0xD1, 0x33, 0xF0, 0x06, 0x30, 0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00,
+    0x04, 0xEE, 0x00, 0x04, 0xD1, 0x33, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0x8D,
+    0x00, 0x04, 0xA9, 0x80, 0xD1, 0x33, 0xF0, 0x04, 0x10, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xA0,
+    0x80, 0x8C, 0x00, 0x04, 0xA0, 0x00, 0xD1, 0x33, 0xD0, 0x04, 0x30, 0x02, 0xB0, 0x02, 0x86, 0x00,
+    0xE8, 0xEE, 0x00, 0x04, 0xD1, 0x33, 0xB0, 0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xCE,
+    0x00, 0x04, 0xCE, 0x00, 0x04, 0xD1, 0x33, 0x90, 0x04, 0xF0, 0x02, 0x10, 0x02, 0x86, 0x00, 0x60,
+    0xA9, 0x00, 0x85, 0x33, 0xA9, 0x04, 0x85, 0x34, 0xA0, 0x00, 0xA2, 0x01, 0x24, 0x01, 0xA9, 0x40,
+    0x8D, 0x00, 0x04, 0x38, 0xF1, 0x33, 0x30, 0x0A, 0x90, 0x08, 0xD0, 0x06, 0x70, 0x04, 0xC9, 0x00,
+    0xF0, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0x38, 0xA9, 0x40, 0xCE, 0x00, 0x04, 0xF1, 0x33, 0xF0, 0x0A,
+    0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xC9, 0x01, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x40, 0x38,
+    0x24, 0x01, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xF1, 0x33, 0xB0, 0x0A, 0xF0, 0x08, 0x10, 0x06,
+    0x70, 0x04, 0xC9, 0xFF, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x18, 0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9,
+    0x80, 0xF1, 0x33, 0x90, 0x04, 0xC9, 0x7F, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xA9, 0x7F, 0x8D,
+    0x00, 0x04, 0xA9, 0x81, 0xF1, 0x33, 0x50, 0x06, 0x90, 0x04, 0xC9, 0x02, 0xF0, 0x02, 0x86, 0x00,
+    0xE8, 0xA9, 0x00, 0xA9, 0x87, 0x91, 0x33, 0xAD, 0x00, 0x04, 0xC9, 0x87, 0xF0, 0x02, 0x86, 0x00,
+    0xE8, 0xA9, 0x7E, 0x8D, 0x00, 0x02, 0xA9, 0xDB, 0x8D, 0x01, 0x02, 0x6C, 0x00, 0x02, 0xA9, 0x00,
+    0x8D, 0xFF, 0x02, 0xA9, 0x01, 0x8D, 0x00, 0x03, 0xA9, 0x03, 0x8D, 0x00, 0x02, 0xA9, 0xA9, 0x8D,
+    0x00, 0x01, 0xA9, 0x55, 0x8D, 0x01, 0x01, 0xA9, 0x60, 0x8D, 0x02, 0x01, 0xA9, 0xA9, 0x8D, 0x00,
+    0x03, 0xA9, 0xAA, 0x8D, 0x01, 0x03, 0xA9, 0x60, 0x8D, 0x02, 0x03, 0x20, 0xB5, 0xDB, 0xC9, 0xAA,
+    0xF0, 0x02, 0x86, 0x00, 0x60, 0x6C, 0xFF, 0x02, 0xA9, 0xFF, 0x85, 0x01, 0xA9, 0xAA, 0x85, 0x33,
+    0xA9, 0xBB, 0x85, 0x89, 0xA2, 0x00, 0xA9, 0x66, 0x24, 0x01, 0x38, 0xA0, 0x00, 0xB4, 0x33, 0x10,
+    0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC0,
+    0xAA, 0xF0, 0x04, 0xA9, 0x08, 0x85, 0x00, 0xA2, 0x8A, 0xA9, 0x66, 0xB8, 0x18, 0xA0, 0x00, 0xB4,
+    0xFF, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC0, 0xBB, 0xD0, 0x08, 0xC9, 0x66, 0xD0,
+    0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x09, 0x85, 0x00, 0x24, 0x01, 0x38, 0xA0, 0x44, 0xA2, 0x00,
+    0x94, 0x33, 0xA5, 0x33, 0x90, 0x18, 0xC9, 0x44, 0xD0, 0x14, 0x50, 0x12, 0x18, 0xB8, 0xA0, 0x99,
+    0xA2, 0x80, 0x94, 0x85, 0xA5, 0x05, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x0A,
+    0x85, 0x00, 0xA0, 0x0B, 0xA9, 0xAA, 0xA2, 0x78, 0x85, 0x78, 0x20, 0xB6, 0xF7, 0x15, 0x00, 0x20,
+    0xC0, 0xF7, 0xC8, 0xA9, 0x00, 0x85, 0x78, 0x20, 0xCE, 0xF7, 0x15, 0x00, 0x20, 0xD3, 0xF7, 0xC8,
+    0xA9, 0xAA, 0x85, 0x78, 0x20, 0xDF, 0xF7, 0x35, 0x00, 0x20, 0xE5, 0xF7, 0xC8, 0xA9, 0xEF, 0x85,
+    0x78, 0x20, 0xF1, 0xF7, 0x35, 0x00, 0x20, 0xF6, 0xF7, 0xC8, 0xA9, 0xAA, 0x85, 0x78, 0x20, 0x04,
+    0xF8, 0x55, 0x00, 0x20, 0x0A, 0xF8, 0xC8, 0xA9, 0x70, 0x85, 0x78, 0x20, 0x18, 0xF8, 0x55, 0x00,
+    0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69, 0x85, 0x78, 0x20, 0x29, 0xF8, 0x75, 0x00, 0x20, 0x2F, 0xF8,
+    0xC8, 0x20, 0x3D, 0xF8, 0x75, 0x00, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x85, 0x78, 0x20, 0x51,
+    0xF8, 0x75, 0x00, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x85, 0x78, 0x20, 0x64, 0xF8, 0x75, 0x00,
+    0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x75, 0x00, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40, 0x85,
+    0x78, 0x20, 0x89, 0xF8, 0xD5, 0x00, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F, 0x85, 0x78, 0x68,
+    0x20, 0x9A, 0xF8, 0xD5, 0x00, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9, 0x41, 0x85, 0x78, 0x68, 0xD5,
+    0x00, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x85, 0x78, 0x68, 0x20, 0xB2, 0xF8, 0xD5, 0x00,
+    0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80, 0x85, 0x78, 0x68, 0xD5, 0x00, 0x20, 0xBF, 0xF8, 0xC8,
+    0x48, 0xA9, 0x81, 0x85, 0x78, 0x68, 0xD5, 0x00, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x85,
+    0x78, 0x68, 0xD5, 0x00, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x85, 0x78, 0x20, 0x31, 0xF9, 0xF5,
+    0x00, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x85, 0x78, 0x20, 0x47, 0xF9, 0xF5, 0x00, 0x20, 0x4C,
+    0xF9, 0xC8, 0xA9, 0x41, 0x85, 0x78, 0x20, 0x5C, 0xF9, 0xF5, 0x00, 0x20, 0x62, 0xF9, 0xC8, 0xA9,
+    0x00, 0x85, 0x78, 0x20, 0x72, 0xF9, 0xF5, 0x00, 0x20, 0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x85, 0x78,
+    0x20, 0x80, 0xF9, 0xF5, 0x00, 0x20, 0x84, 0xF9, 0xA9, 0xAA, 0x85, 0x33, 0xA9, 0xBB, 0x85, 0x89,
+    0xA2, 0x00, 0xA0, 0x66, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xB5, 0x33, 0x10, 0x12, 0xF0, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC0, 0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC9, 0xAA, 0xF0, 0x04, 0xA9,
+    0x22, 0x85, 0x00, 0xA2, 0x8A, 0xA0, 0x66, 0xB8, 0x18, 0xA9, 0x00, 0xB5, 0xFF, 0x10, 0x12, 0xF0,
+    0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xBB, 0xD0, 0x08, 0xC0, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0,
+    0x04, 0xA9, 0x23, 0x85, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x44, 0xA2, 0x00, 0x95, 0x33, 0xA5, 0x33,
+    0x90, 0x18, 0xC9, 0x44, 0xD0, 0x14, 0x50, 0x12, 0x18, 0xB8, 0xA9, 0x99, 0xA2, 0x80, 0x95, 0x85,
+    0xA5, 0x05, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x24, 0x85, 0x00, 0xA0, 0x25,
+    0xA2, 0x78, 0x20, 0x90, 0xF9, 0x95, 0x00, 0x56, 0x00, 0xB5, 0x00, 0x20, 0x9D, 0xF9, 0xC8, 0x95,
+    0x00, 0x56, 0x00, 0xB5, 0x00, 0x20, 0xAD, 0xF9, 0xC8, 0x20, 0xBD, 0xF9, 0x95, 0x00, 0x16, 0x00,
+    0xB5, 0x00, 0x20, 0xC3, 0xF9, 0xC8, 0x95, 0x00, 0x16, 0x00, 0xB5, 0x00, 0x20, 0xD4, 0xF9, 0xC8,
+    0x20, 0xE4, 0xF9, 0x95, 0x00, 0x76, 0x00, 0xB5, 0x00, 0x20, 0xEA, 0xF9, 0xC8, 0x95, 0x00, 0x76,
+    0x00, 0xB5, 0x00, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x95, 0x00, 0x36, 0x00, 0xB5, 0x00,
+    0x20, 0x10, 0xFA, 0xC8, 0x95, 0x00, 0x36, 0x00, 0xB5, 0x00, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x95,
+    0x00, 0x85, 0x01, 0x24, 0x01, 0x38, 0xF6, 0x00, 0xD0, 0x0C, 0x30, 0x0A, 0x50, 0x08, 0x90, 0x06,
+    0xB5, 0x00, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x2D, 0x85, 0x00, 0xA9, 0x7F, 0x95, 0x00, 0xB8, 0x18,
+    0xF6, 0x00, 0xF0, 0x0C, 0x10, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xB5, 0x00, 0xC9, 0x80, 0xF0, 0x04,
+    0xA9, 0x2E, 0x85, 0x00, 0xA9, 0x00, 0x95, 0x00, 0x24, 0x01, 0x38, 0xD6, 0x00, 0xF0, 0x0C, 0x10,
+    0x0A, 0x50, 0x08, 0x90, 0x06, 0xB5, 0x00, 0xC9, 0xFF, 0xF0, 0x04, 0xA9, 0x2F, 0x85, 0x00, 0xA9,
+    0x80, 0x95, 0x00, 0xB8, 0x18, 0xD6, 0x00, 0xF0, 0x0C, 0x30, 0x0A, 0x70, 0x08, 0xB0, 0x06, 0xB5,
+    0x00, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0x30, 0x85, 0x00, 0xA9, 0x01, 0x95, 0x00, 0xD6, 0x00, 0xF0,
+    0x04, 0xA9, 0x31, 0x85, 0x00, 0xA9, 0x33, 0x85, 0x78, 0xA9, 0x44, 0xA0, 0x78, 0xA2, 0x00, 0x38,
+    0x24, 0x01, 0xB6, 0x00, 0x90, 0x12, 0x50, 0x10, 0x30, 0x0E, 0xF0, 0x0C, 0xE0, 0x33, 0xD0, 0x08,
+    0xC0, 0x78, 0xD0, 0x04, 0xC9, 0x44, 0xF0, 0x04, 0xA9, 0x32, 0x85, 0x00, 0xA9, 0x97, 0x85, 0x7F,
+    0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x00, 0x18, 0xB8, 0xB6, 0x80, 0xB0, 0x12, 0x70, 0x10, 0x10, 0x0E,
+    0xF0, 0x0C, 0xE0, 0x97, 0xD0, 0x08, 0xC0, 0xFF, 0xD0, 0x04, 0xC9, 0x47, 0xF0, 0x04, 0xA9, 0x33,
+    0x85, 0x00, 0xA9, 0x00, 0x85, 0x7F, 0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x69, 0x18, 0xB8, 0x96, 0x80,
+    0xB0, 0x18, 0x70, 0x16, 0x30, 0x14, 0xF0, 0x12, 0xE0, 0x69, 0xD0, 0x0E, 0xC0, 0xFF, 0xD0, 0x0A,
+    0xC9, 0x47, 0xD0, 0x06, 0xA5, 0x7F, 0xC9, 0x69, 0xF0, 0x04, 0xA9, 0x34, 0x85, 0x00, 0xA9, 0xF5,
+    0x85, 0x4F, 0xA9, 0x47, 0xA0, 0x4F, 0x24, 0x01, 0xA2, 0x00, 0x38, 0x96, 0x00, 0x90, 0x16, 0x50,
+    0x14, 0x30, 0x12, 0xD0, 0x10, 0xE0, 0x00, 0xD0, 0x0C, 0xC0, 0x4F, 0xD0, 0x08, 0xC9, 0x47, 0xD0,
+    0x04, 0xA5, 0x4F, 0xF0, 0x04, 0xA9, 0x35, 0x85, 0x00, 0x60, 0xA9, 0x89, 0x8D, 0x00, 0x03, 0xA9,
+    0xA3, 0x85, 0x33, 0xA9, 0x12, 0x8D, 0x45, 0x02, 0xA2, 0x65, 0xA0, 0x00, 0x38, 0xA9, 0x00, 0xB8,
+    0xB9, 0x00, 0x03, 0xF0, 0x0C, 0x90, 0x0A, 0x70, 0x08, 0xC9, 0x89, 0xD0, 0x04, 0xE0, 0x65, 0xF0,
+    0x04, 0xA9, 0x36, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA0, 0x34, 0xB9, 0xFF, 0xFF,
+    0xC9, 0xA3, 0xD0, 0x02, 0xB0, 0x04, 0xA9, 0x37, 0x85, 0x00, 0xA9, 0x46, 0x85, 0xFF, 0xA0, 0xFF,
+    0xB9, 0x46, 0x01, 0xC9, 0x12, 0xF0, 0x04, 0xA9, 0x38, 0x85, 0x00, 0xA2, 0x39, 0x18, 0xA9, 0xFF,
+    0x85, 0x01, 0x24, 0x01, 0xA9, 0xAA, 0x8D, 0x00, 0x04, 0xA9, 0x55, 0xA0, 0x00, 0x19, 0x00, 0x04,
+    0xB0, 0x08, 0x10, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9,
+    0x00, 0x19, 0x00, 0x04, 0xF0, 0x06, 0x70, 0x04, 0x90, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0x18,
+    0x24, 0x01, 0xA9, 0x55, 0x39, 0x00, 0x04, 0xD0, 0x06, 0x50, 0x04, 0xB0, 0x02, 0x10, 0x02, 0x86,
+    0x00, 0xE8, 0x38, 0xB8, 0xA9, 0xEF, 0x8D, 0x00, 0x04, 0xA9, 0xF8, 0x39, 0x00, 0x04, 0x90, 0x08,
+    0x10, 0x06, 0xC9, 0xE8, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0xAA,
+    0x8D, 0x00, 0x04, 0xA9, 0x5F, 0x59, 0x00, 0x04, 0xB0, 0x08, 0x10, 0x06, 0xC9, 0xF5, 0xD0, 0x02,
+    0x70, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x70, 0x8D, 0x00, 0x04, 0x59, 0x00, 0x04, 0xD0,
+    0x06, 0x70, 0x04, 0x90, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x18, 0x24, 0x01, 0xA9, 0x69, 0x8D,
+    0x00, 0x04, 0xA9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xB0, 0x06, 0xC9, 0x69, 0xD0, 0x02, 0x50,
+    0x02, 0x86, 0x00, 0xE8, 0x38, 0x24, 0x01, 0xA9, 0x00, 0x79, 0x00, 0x04, 0x30, 0x08, 0xB0, 0x06,
+    0xC9, 0x6A, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x7F, 0x8D, 0x00, 0x04,
+    0x79, 0x00, 0x04, 0x10, 0x08, 0xB0, 0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x70, 0x02, 0x86, 0x00, 0xE8,
+    0x18, 0x24, 0x01, 0xA9, 0x80, 0x8D, 0x00, 0x04, 0xA9, 0x7F, 0x79, 0x00, 0x04, 0x10, 0x08, 0xB0,
+    0x06, 0xC9, 0xFF, 0xD0, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0x38, 0xB8, 0xA9, 0x80, 0x8D, 0x00,
+    0x04, 0xA9, 0x7F, 0x79, 0x00, 0x04, 0xD0, 0x06, 0x30, 0x04, 0x70, 0x02, 0xB0, 0x02, 0x86, 0x00,
+    0xE8, 0x24, 0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04, 0xD9, 0x00, 0x04, 0x30, 0x06, 0x90, 0x04, 0xD0,
+    0x02, 0x70, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0xCE, 0x00, 0x04, 0xD9, 0x00, 0x04, 0xF0, 0x06, 0x30,
+    0x04, 0x90, 0x02, 0x50, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xD9, 0x00,
+    0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9, 0x80, 0xD9,
+    0x00, 0x04, 0xF0, 0x04, 0x10, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xA0, 0x80, 0x8C, 0x00, 0x04,
+    0xA0, 0x00, 0xD9, 0x00, 0x04, 0xD0, 0x04, 0x30, 0x02, 0xB0, 0x02, 0x86, 0x00, 0xE8, 0xEE, 0x00,
+    0x04, 0xD9, 0x00, 0x04, 0xB0, 0x04, 0xF0, 0x02, 0x30, 0x02, 0x86, 0x00, 0xE8, 0xCE, 0x00, 0x04,
+    0xCE, 0x00, 0x04, 0xD9, 0x00, 0x04, 0x90, 0x04, 0xF0, 0x02, 0x10, 0x02, 0x86, 0x00, 0xE8, 0x24,
+    0x01, 0xA9, 0x40, 0x8D, 0x00, 0x04, 0x38, 0xF9, 0x00, 0x04, 0x30, 0x0A, 0x90, 0x08, 0xD0, 0x06,
+    0x70, 0x04, 0xC9, 0x00, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xB8, 0x38, 0xA9, 0x40, 0xCE, 0x00, 0x04,
+    0xF9, 0x00, 0x04, 0xF0, 0x0A, 0x30, 0x08, 0x90, 0x06, 0x70, 0x04, 0xC9, 0x01, 0xF0, 0x02, 0x86,
+    0x00, 0xE8, 0xA9, 0x40, 0x38, 0x24, 0x01, 0xEE, 0x00, 0x04, 0xEE, 0x00, 0x04, 0xF9, 0x00, 0x04,
+    0xB0, 0x0A, 0xF0, 0x08, 0x10, 0x06, 0x70, 0x04, 0xC9, 0xFF, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0x18,
+    0xA9, 0x00, 0x8D, 0x00, 0x04, 0xA9, 0x80, 0xF9, 0x00, 0x04, 0x90, 0x04, 0xC9, 0x7F, 0xF0, 0x02,
+    0x86, 0x00, 0xE8, 0x38, 0xA9, 0x7F, 0x8D, 0x00, 0x04, 0xA9, 0x81, 0xF9, 0x00, 0x04, 0x50, 0x06,
+    0x90, 0x04, 0xC9, 0x02, 0xF0, 0x02, 0x86, 0x00, 0xE8, 0xA9, 0x00, 0xA9, 0x87, 0x99, 0x00, 0x04,
+    0xAD, 0x00, 0x04, 0xC9, 0x87, 0xF0, 0x02, 0x86, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA9, 0xAA,
+    0x8D, 0x33, 0x06, 0xA9, 0xBB, 0x8D, 0x89, 0x06, 0xA2, 0x00, 0xA9, 0x66, 0x24, 0x01, 0x38, 0xA0,
+    0x00, 0xBC, 0x33, 0x06, 0x10, 0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x66, 0xD0, 0x08,
+    0xE0, 0x00, 0xD0, 0x04, 0xC0, 0xAA, 0xF0, 0x04, 0xA9, 0x51, 0x85, 0x00, 0xA2, 0x8A, 0xA9, 0x66,
+    0xB8, 0x18, 0xA0, 0x00, 0xBC, 0xFF, 0x05, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC0,
+    0xBB, 0xD0, 0x08, 0xC9, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x52, 0x85, 0x00, 0xA0,
+    0x53, 0xA9, 0xAA, 0xA2, 0x78, 0x8D, 0x78, 0x06, 0x20, 0xB6, 0xF7, 0x1D, 0x00, 0x06, 0x20, 0xC0,
+    0xF7, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0xCE, 0xF7, 0x1D, 0x00, 0x06, 0x20, 0xD3, 0xF7,
+    0xC8, 0xA9, 0xAA, 0x8D, 0x78, 0x06, 0x20, 0xDF, 0xF7, 0x3D, 0x00, 0x06, 0x20, 0xE5, 0xF7, 0xC8,
+    0xA9, 0xEF, 0x8D, 0x78, 0x06, 0x20, 0xF1, 0xF7, 0x3D, 0x00, 0x06, 0x20, 0xF6, 0xF7, 0xC8, 0xA9,
+    0xAA, 0x8D, 0x78, 0x06, 0x20, 0x04, 0xF8, 0x5D, 0x00, 0x06, 0x20, 0x0A, 0xF8, 0xC8, 0xA9, 0x70,
+    0x8D, 0x78, 0x06, 0x20, 0x18, 0xF8, 0x5D, 0x00, 0x06, 0x20, 0x1D, 0xF8, 0xC8, 0xA9, 0x69, 0x8D,
+    0x78, 0x06, 0x20, 0x29, 0xF8, 0x7D, 0x00, 0x06, 0x20, 0x2F, 0xF8, 0xC8, 0x20, 0x3D, 0xF8, 0x7D,
+    0x00, 0x06, 0x20, 0x43, 0xF8, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x51, 0xF8, 0x7D, 0x00,
+    0x06, 0x20, 0x56, 0xF8, 0xC8, 0xA9, 0x80, 0x8D, 0x78, 0x06, 0x20, 0x64, 0xF8, 0x7D, 0x00, 0x06,
+    0x20, 0x6A, 0xF8, 0xC8, 0x20, 0x78, 0xF8, 0x7D, 0x00, 0x06, 0x20, 0x7D, 0xF8, 0xC8, 0xA9, 0x40,
+    0x8D, 0x78, 0x06, 0x20, 0x89, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0x8E, 0xF8, 0xC8, 0x48, 0xA9, 0x3F,
+    0x8D, 0x78, 0x06, 0x68, 0x20, 0x9A, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0x9C, 0xF8, 0xC8, 0x48, 0xA9,
+    0x41, 0x8D, 0x78, 0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xA8, 0xF8, 0xC8, 0x48, 0xA9, 0x00, 0x8D,
+    0x78, 0x06, 0x68, 0x20, 0xB2, 0xF8, 0xDD, 0x00, 0x06, 0x20, 0xB5, 0xF8, 0xC8, 0x48, 0xA9, 0x80,
+    0x8D, 0x78, 0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xBF, 0xF8, 0xC8, 0x48, 0xA9, 0x81, 0x8D, 0x78,
+    0x06, 0x68, 0xDD, 0x00, 0x06, 0x20, 0xC9, 0xF8, 0xC8, 0x48, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x68,
+    0xDD, 0x00, 0x06, 0x20, 0xD3, 0xF8, 0xC8, 0xA9, 0x40, 0x8D, 0x78, 0x06, 0x20, 0x31, 0xF9, 0xFD,
+    0x00, 0x06, 0x20, 0x37, 0xF9, 0xC8, 0xA9, 0x3F, 0x8D, 0x78, 0x06, 0x20, 0x47, 0xF9, 0xFD, 0x00,
+    0x06, 0x20, 0x4C, 0xF9, 0xC8, 0xA9, 0x41, 0x8D, 0x78, 0x06, 0x20, 0x5C, 0xF9, 0xFD, 0x00, 0x06,
+    0x20, 0x62, 0xF9, 0xC8, 0xA9, 0x00, 0x8D, 0x78, 0x06, 0x20, 0x72, 0xF9, 0xFD, 0x00, 0x06, 0x20,
+    0x76, 0xF9, 0xC8, 0xA9, 0x7F, 0x8D, 0x78, 0x06, 0x20, 0x80, 0xF9, 0xFD, 0x00, 0x06, 0x20, 0x84,
+    0xF9, 0xA9, 0xAA, 0x8D, 0x33, 0x06, 0xA9, 0xBB, 0x8D, 0x89, 0x06, 0xA2, 0x00, 0xA0, 0x66, 0x24,
+    0x01, 0x38, 0xA9, 0x00, 0xBD, 0x33, 0x06, 0x10, 0x12, 0xF0, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC0,
+    0x66, 0xD0, 0x08, 0xE0, 0x00, 0xD0, 0x04, 0xC9, 0xAA, 0xF0, 0x04, 0xA9, 0x6A, 0x85, 0x00, 0xA2,
+    0x8A, 0xA0, 0x66, 0xB8, 0x18, 0xA9, 0x00, 0xBD, 0xFF, 0x05, 0x10, 0x12, 0xF0, 0x10, 0x70, 0x0E,
+    0xB0, 0x0C, 0xC9, 0xBB, 0xD0, 0x08, 0xC0, 0x66, 0xD0, 0x04, 0xE0, 0x8A, 0xF0, 0x04, 0xA9, 0x6B,
+    0x85, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x44, 0xA2, 0x00, 0x9D, 0x33, 0x06, 0xAD, 0x33, 0x06, 0x90,
+    0x1A, 0xC9, 0x44, 0xD0, 0x16, 0x50, 0x14, 0x18, 0xB8, 0xA9, 0x99, 0xA2, 0x80, 0x9D, 0x85, 0x05,
+    0xAD, 0x05, 0x06, 0xB0, 0x06, 0xC9, 0x99, 0xD0, 0x02, 0x50, 0x04, 0xA9, 0x6C, 0x85, 0x00, 0xA0,
+    0x6D, 0xA2, 0x6D, 0x20, 0x90, 0xF9, 0x9D, 0x00, 0x06, 0x5E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20,
+    0x9D, 0xF9, 0xC8, 0x9D, 0x00, 0x06, 0x5E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xAD, 0xF9, 0xC8,
+    0x20, 0xBD, 0xF9, 0x9D, 0x00, 0x06, 0x1E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xC3, 0xF9, 0xC8,
+    0x9D, 0x00, 0x06, 0x1E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xD4, 0xF9, 0xC8, 0x20, 0xE4, 0xF9,
+    0x9D, 0x00, 0x06, 0x7E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xEA, 0xF9, 0xC8, 0x9D, 0x00, 0x06,
+    0x7E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0xFB, 0xF9, 0xC8, 0x20, 0x0A, 0xFA, 0x9D, 0x00, 0x06,
+    0x3E, 0x00, 0x06, 0xBD, 0x00, 0x06, 0x20, 0x10, 0xFA, 0xC8, 0x9D, 0x00, 0x06, 0x3E, 0x00, 0x06,
+    0xBD, 0x00, 0x06, 0x20, 0x21, 0xFA, 0xA9, 0xFF, 0x9D, 0x00, 0x06, 0x85, 0x01, 0x24, 0x01, 0x38,
+    0xFE, 0x00, 0x06, 0xD0, 0x0D, 0x30, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x00,
+    0xF0, 0x04, 0xA9, 0x75, 0x85, 0x00, 0xA9, 0x7F, 0x9D, 0x00, 0x06, 0xB8, 0x18, 0xFE, 0x00, 0x06,
+    0xF0, 0x0D, 0x10, 0x0B, 0x70, 0x09, 0xB0, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x80, 0xF0, 0x04, 0xA9,
+    0x76, 0x85, 0x00, 0xA9, 0x00, 0x9D, 0x00, 0x06, 0x24, 0x01, 0x38, 0xDE, 0x00, 0x06, 0xF0, 0x0D,
+    0x10, 0x0B, 0x50, 0x09, 0x90, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0xFF, 0xF0, 0x04, 0xA9, 0x77, 0x85,
+    0x00, 0xA9, 0x80, 0x9D, 0x00, 0x06, 0xB8, 0x18, 0xDE, 0x00, 0x06, 0xF0, 0x0D, 0x30, 0x0B, 0x70,
+    0x09, 0xB0, 0x07, 0xBD, 0x00, 0x06, 0xC9, 0x7F, 0xF0, 0x04, 0xA9, 0x78, 0x85, 0x00, 0xA9, 0x01,
+    0x9D, 0x00, 0x06, 0xDE, 0x00, 0x06, 0xF0, 0x04, 0xA9, 0x79, 0x85, 0x00, 0xA9, 0x33, 0x8D, 0x78,
+    0x06, 0xA9, 0x44, 0xA0, 0x78, 0xA2, 0x00, 0x38, 0x24, 0x01, 0xBE, 0x00, 0x06, 0x90, 0x12, 0x50,
+    0x10, 0x30, 0x0E, 0xF0, 0x0C, 0xE0, 0x33, 0xD0, 0x08, 0xC0, 0x78, 0xD0, 0x04, 0xC9, 0x44, 0xF0,
+    0x04, 0xA9, 0x7A, 0x85, 0x00, 0xA9, 0x97, 0x8D, 0x7F, 0x06, 0xA9, 0x47, 0xA0, 0xFF, 0xA2, 0x00,
+    0x18, 0xB8, 0xBE, 0x80, 0x05, 0xB0, 0x12, 0x70, 0x10, 0x10, 0x0E, 0xF0, 0x0C, 0xE0, 0x97, 0xD0,
+    0x08, 0xC0, 0xFF, 0xD0, 0x04, 0xC9, 0x47, 0xF0, 0x04, 0xA9, 0x7B, 0x85, 0x00, 0x60, 0xA9, 0x55,
+    0x8D, 0x80, 0x05, 0xA9, 0xAA, 0x8D, 0x32, 0x04, 0xA9, 0x80, 0x85, 0x43, 0xA9, 0x05, 0x85, 0x44,
+    0xA9, 0x32, 0x85, 0x45, 0xA9, 0x04, 0x85, 0x46, 0xA2, 0x03, 0xA0, 0x77, 0xA9, 0xFF, 0x85, 0x01,
+    0x24, 0x01, 0x38, 0xA9, 0x00, 0xA3, 0x40, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC9, 0x55, 0xD0, 0x08, 0xE0, 0x55, 0xD0, 0x04, 0xC0, 0x77, 0xF0, 0x04, 0xA9,
+    0x7C, 0x85, 0x00, 0xA2, 0x05, 0xA0, 0x33, 0xB8, 0x18, 0xA9, 0x00, 0xA3, 0x40, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xF0, 0x12, 0x10, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xAA, 0xD0, 0x08, 0xE0, 0xAA, 0xD0,
+    0x04, 0xC0, 0x33, 0xF0, 0x04, 0xA9, 0x7D, 0x85, 0x00, 0xA9, 0x87, 0x85, 0x67, 0xA9, 0x32, 0x85,
+    0x68, 0xA0, 0x57, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xA7, 0x67, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12,
+    0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0, 0x57,
+    0xF0, 0x04, 0xA9, 0x7E, 0x85, 0x00, 0xA0, 0x53, 0xB8, 0x18, 0xA9, 0x00, 0xA7, 0x68, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08, 0xE0, 0x32,
+    0xD0, 0x04, 0xC0, 0x53, 0xF0, 0x04, 0xA9, 0x7F, 0x85, 0x00, 0xA9, 0x87, 0x8D, 0x77, 0x05, 0xA9,
+    0x32, 0x8D, 0x78, 0x05, 0xA0, 0x57, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xAF, 0x77, 0x05, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x12, 0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87,
+    0xD0, 0x04, 0xC0, 0x57, 0xF0, 0x04, 0xA9, 0x80, 0x85, 0x00, 0xA0, 0x53, 0xB8, 0x18, 0xA9, 0x00,
+    0xAF, 0x78, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9,
+    0x32, 0xD0, 0x08, 0xE0, 0x32, 0xD0, 0x04, 0xC0, 0x53, 0xF0, 0x04, 0xA9, 0x81, 0x85, 0x00, 0xA9,
+    0xFF, 0x85, 0x43, 0xA9, 0x04, 0x85, 0x44, 0xA9, 0x32, 0x85, 0x45, 0xA9, 0x04, 0x85, 0x46, 0xA9,
+    0x55, 0x8D, 0x80, 0x05, 0xA9, 0xAA, 0x8D, 0x32, 0x04, 0xA2, 0x03, 0xA0, 0x81, 0x24, 0x01, 0x38,
+    0xA9, 0x00, 0xB3, 0x43, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x50, 0x0E, 0x90, 0x0C,
+    0xC9, 0x55, 0xD0, 0x08, 0xE0, 0x55, 0xD0, 0x04, 0xC0, 0x81, 0xF0, 0x04, 0xA9, 0x82, 0x85, 0x00,
+    0xA2, 0x05, 0xA0, 0x00, 0xB8, 0x18, 0xA9, 0x00, 0xB3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12,
+    0x10, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0xAA, 0xD0, 0x08, 0xE0, 0xAA, 0xD0, 0x04, 0xC0, 0x00,
+    0xF0, 0x04, 0xA9, 0x83, 0x85, 0x00, 0xA9, 0x87, 0x85, 0x67, 0xA9, 0x32, 0x85, 0x68, 0xA0, 0x57,
+    0x24, 0x01, 0x38, 0xA9, 0x00, 0xB7, 0x10, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x10, 0x10, 0x50,
+    0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0, 0x57, 0xF0, 0x04, 0xA9,
+    0x84, 0x85, 0x00, 0xA0, 0xFF, 0xB8, 0x18, 0xA9, 0x00, 0xB7, 0x69, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08, 0xE0, 0x32, 0xD0, 0x04, 0xC0,
+    0xFF, 0xF0, 0x04, 0xA9, 0x85, 0x85, 0x00, 0xA9, 0x87, 0x8D, 0x87, 0x05, 0xA9, 0x32, 0x8D, 0x88,
+    0x05, 0xA0, 0x30, 0x24, 0x01, 0x38, 0xA9, 0x00, 0xBF, 0x57, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x12, 0x10, 0x10, 0x50, 0x0E, 0x90, 0x0C, 0xC9, 0x87, 0xD0, 0x08, 0xE0, 0x87, 0xD0, 0x04, 0xC0,
+    0x30, 0xF0, 0x04, 0xA9, 0x86, 0x85, 0x00, 0xA0, 0x40, 0xB8, 0x18, 0xA9, 0x00, 0xBF, 0x48, 0x05,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x12, 0x30, 0x10, 0x70, 0x0E, 0xB0, 0x0C, 0xC9, 0x32, 0xD0, 0x08,
+    0xE0, 0x32, 0xD0, 0x04, 0xC0, 0x40, 0xF0, 0x04, 0xA9, 0x87, 0x85, 0x00, 0x60, 0xA9, 0xC0, 0x85,
+    0x01, 0xA9, 0x00, 0x8D, 0x89, 0x04, 0xA9, 0x89, 0x85, 0x60, 0xA9, 0x04, 0x85, 0x61, 0xA0, 0x44,
+    0xA2, 0x17, 0xA9, 0x3E, 0x24, 0x01, 0x18, 0x83, 0x49, 0xEA, 0xEA, 0xEA, 0xEA, 0xD0, 0x19, 0xB0,
+    0x17, 0x50, 0x15, 0x10, 0x13, 0xC9, 0x3E, 0xD0, 0x0F, 0xC0, 0x44, 0xD0, 0x0B, 0xE0, 0x17, 0xD0,
+    0x07, 0xAD, 0x89, 0x04, 0xC9, 0x16, 0xF0, 0x04, 0xA9, 0x88, 0x85, 0x00, 0xA0, 0x44, 0xA2, 0x7A,
+    0xA9, 0x66, 0x38, 0xB8, 0x83, 0xE6, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x19, 0x90, 0x17, 0x70, 0x15,
+    0x30, 0x13, 0xC9, 0x66, 0xD0, 0x0F, 0xC0, 0x44, 0xD0, 0x0B, 0xE0, 0x7A, 0xD0, 0x07, 0xAD, 0x89,
+    0x04, 0xC9, 0x62, 0xF0, 0x04, 0xA9, 0x89, 0x85, 0x00, 0xA9, 0xFF, 0x85, 0x49, 0xA0, 0x44, 0xA2,
+    0xAA, 0xA9, 0x55, 0x24, 0x01, 0x18, 0x87, 0x49, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0xB0, 0x16,
+    0x50, 0x14, 0x10, 0x12, 0xC9, 0x55, 0xD0, 0x0E, 0xC0, 0x44, 0xD0, 0x0A, 0xE0, 0xAA, 0xD0, 0x06,
+    0xA5, 0x49, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x8A, 0x85, 0x00, 0xA9, 0x00, 0x85, 0x56, 0xA0, 0x58,
+    0xA2, 0xEF, 0xA9, 0x66, 0x38, 0xB8, 0x87, 0x56, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0x90, 0x16,
+    0x70, 0x14, 0x30, 0x12, 0xC9, 0x66, 0xD0, 0x0E, 0xC0, 0x58, 0xD0, 0x0A, 0xE0, 0xEF, 0xD0, 0x06,
+    0xA5, 0x56, 0xC9, 0x66, 0xF0, 0x04, 0xA9, 0x8B, 0x85, 0x00, 0xA9, 0xFF, 0x8D, 0x49, 0x05, 0xA0,
+    0xE5, 0xA2, 0xAF, 0xA9, 0xF5, 0x24, 0x01, 0x18, 0x8F, 0x49, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0xF0,
+    0x19, 0xB0, 0x17, 0x50, 0x15, 0x10, 0x13, 0xC9, 0xF5, 0xD0, 0x0F, 0xC0, 0xE5, 0xD0, 0x0B, 0xE0,
+    0xAF, 0xD0, 0x07, 0xAD, 0x49, 0x05, 0xC9, 0xA5, 0xF0, 0x04, 0xA9, 0x8C, 0x85, 0x00, 0xA9, 0x00,
+    0x8D, 0x56, 0x05, 0xA0, 0x58, 0xA2, 0xB3, 0xA9, 0x97, 0x38, 0xB8, 0x8F, 0x56, 0x05, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xF0, 0x19, 0x90, 0x17, 0x70, 0x15, 0x10, 0x13, 0xC9, 0x97, 0xD0, 0x0F, 0xC0, 0x58,
+    0xD0, 0x0B, 0xE0, 0xB3, 0xD0, 0x07, 0xAD, 0x56, 0x05, 0xC9, 0x93, 0xF0, 0x04, 0xA9, 0x8D, 0x85,
+    0x00, 0xA9, 0xFF, 0x85, 0x49, 0xA0, 0xFF, 0xA2, 0xAA, 0xA9, 0x55, 0x24, 0x01, 0x18, 0x97, 0x4A,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0xB0, 0x16, 0x50, 0x14, 0x10, 0x12, 0xC9, 0x55, 0xD0, 0x0E,
+    0xC0, 0xFF, 0xD0, 0x0A, 0xE0, 0xAA, 0xD0, 0x06, 0xA5, 0x49, 0xC9, 0x00, 0xF0, 0x04, 0xA9, 0x8E,
+    0x85, 0x00, 0xA9, 0x00, 0x85, 0x56, 0xA0, 0x06, 0xA2, 0xEF, 0xA9, 0x66, 0x38, 0xB8, 0x97, 0x50,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xF0, 0x18, 0x90, 0x16, 0x70, 0x14, 0x30, 0x12, 0xC9, 0x66, 0xD0, 0x0E,
+    0xC0, 0x06, 0xD0, 0x0A, 0xE0, 0xEF, 0xD0, 0x06, 0xA5, 0x56, 0xC9, 0x66, 0xF0, 0x04, 0xA9, 0x8F,
+    0x85, 0x00, 0x60, 0xA0, 0x90, 0x20, 0x31, 0xF9, 0xEB, 0x40, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37,
+    0xF9, 0xC8, 0x20, 0x47, 0xF9, 0xEB, 0x3F, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x4C, 0xF9, 0xC8, 0x20,
+    0x5C, 0xF9, 0xEB, 0x41, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x62, 0xF9, 0xC8, 0x20, 0x72, 0xF9, 0xEB,
+    0x00, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x76, 0xF9, 0xC8, 0x20, 0x80, 0xF9, 0xEB, 0x7F, 0xEA, 0xEA,
+    0xEA, 0xEA, 0x20, 0x84, 0xF9, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0x95, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xC3, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x00, 0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xC3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x54, 0xFA, 0xC3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0x31, 0xFA, 0xC7, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37, 0xFA, 0xA5, 0x47, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x00, 0x85, 0x47, 0x20, 0x42, 0xFA, 0xC7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xA5, 0x47, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xFA,
+    0xC7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xA5, 0x47, 0xC9, 0x36, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x54, 0xFA, 0xCF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x36, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x31, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x9E, 0x68,
+    0x28, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x00, 0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x9F, 0x68,
+    0x28, 0x20, 0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x54, 0xFA, 0xD3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA0, 0x68,
+    0x28, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xA1, 0xA2,
+    0xFF, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0x31, 0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x37,
+    0xFA, 0xA5, 0x47, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00, 0x85, 0x47, 0x20, 0x42,
+    0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA, 0xA5, 0x47, 0xC9, 0xFF, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x54, 0xFA, 0xD7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x59, 0xFA, 0xA5, 0x47, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x31, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA4, 0x68, 0x28,
+    0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA5, 0x68,
+    0x28, 0x20, 0x47, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x54, 0xFA, 0xDB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xA6,
+    0x68, 0x28, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x36, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xA7,
+    0xA2, 0xFF, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0x31, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x37, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEA, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x00,
+    0x8D, 0x47, 0x06, 0x20, 0x42, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x47, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0xFF, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x54, 0xFA, 0xDF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x36, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xAA, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xE3, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0xFF, 0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xE3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0xD4, 0xFA, 0xE3, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0xB1, 0xFA, 0xE7, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7, 0xFA, 0xA5, 0x47, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0xFF, 0x85, 0x47, 0x20, 0xC2, 0xFA, 0xE7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xA5, 0x47, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0xD4, 0xFA,
+    0xE7, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xA5, 0x47, 0xC9, 0x38, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0xD4, 0xFA, 0xEF, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x38, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0xB1, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB3, 0x68,
+    0x28, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0xFF, 0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB4, 0x68,
+    0x28, 0x20, 0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0xD4, 0xFA, 0xF3, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB5, 0x68,
+    0x28, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xB6, 0xA2,
+    0xFF, 0xA9, 0xEB, 0x85, 0x47, 0x20, 0xB1, 0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xB7,
+    0xFA, 0xA5, 0x47, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF, 0x85, 0x47, 0x20, 0xC2,
+    0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA, 0xA5, 0x47, 0xC9, 0x00, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0xD4, 0xFA, 0xF7, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0xDA, 0xFA, 0xA5, 0x47, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xEB, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0xB1, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xB9, 0x68, 0x28,
+    0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xBA, 0x68,
+    0x28, 0x20, 0xC7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0xD4, 0xFA, 0xFB, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xBB,
+    0x68, 0x28, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x38, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xBC,
+    0xA2, 0xFF, 0xA9, 0xEB, 0x8D, 0x47, 0x06, 0x20, 0xB1, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xB7, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0xEC, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xFF,
+    0x8D, 0x47, 0x06, 0x20, 0xC2, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xC7, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x00, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0xD4, 0xFA, 0xFF, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xDA, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x38, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xBF, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x03, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x03, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x9E, 0xFA, 0x03, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x7B, 0xFA, 0x07, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81, 0xFA, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x8C, 0xFA, 0x07, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x9E, 0xFA,
+    0x07, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xA5, 0x47, 0xC9, 0x6E, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x9E, 0xFA, 0x0F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x7B, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xC8, 0x68,
+    0x28, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xC9, 0x68,
+    0x28, 0x20, 0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x9E, 0xFA, 0x13, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCA, 0x68,
+    0x28, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xCB, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x7B, 0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x81,
+    0xFA, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x8C,
+    0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x9E, 0xFA, 0x17, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0xA4, 0xFA, 0xA5, 0x47, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x7B, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCE, 0x68, 0x28,
+    0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xCF, 0x68,
+    0x28, 0x20, 0x91, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x9E, 0xFA, 0x1B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xD0,
+    0x68, 0x28, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6E, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xD1,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x7B, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x81, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x8C, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x91, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x9E, 0xFA, 0x1F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xA4, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6E, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xD4, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x23, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x23, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x68, 0xFA, 0x23, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06,
+    0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x53, 0xFB, 0x27, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59, 0xFB, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x64, 0xFB, 0x27, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xFA,
+    0x27, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xA5, 0x47, 0xC9, 0x6F, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x68, 0xFA, 0x2F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x53, 0xFB, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDD, 0x68,
+    0x28, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDE, 0x68,
+    0x28, 0x20, 0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x68, 0xFA, 0x33, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xDF, 0x68,
+    0x28, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xE0, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x53, 0xFB, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x59,
+    0xFB, 0xA5, 0x47, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x64,
+    0xFB, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x68, 0xFA, 0x37, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x6E, 0xFA, 0xA5, 0x47, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x53, 0xFB, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE3, 0x68, 0x28,
+    0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE4, 0x68,
+    0x28, 0x20, 0x69, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x68, 0xFA, 0x3B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xE5,
+    0x68, 0x28, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x6F, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xE6,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x53, 0xFB, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x59, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x4A, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x64, 0xFB, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x69, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x68, 0xFA, 0x3F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x6E, 0xFA, 0xAD, 0x47, 0x06, 0xC9,
+    0x6F, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0xE9, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x43, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x43, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x40, 0xFB, 0x43, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06,
+    0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x1D, 0xFB, 0x47, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23, 0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0x2E, 0xFB, 0x47, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xFB,
+    0x47, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xA5, 0x47, 0xC9, 0x1B, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x40, 0xFB, 0x4F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0x1D, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF2, 0x68,
+    0x28, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF3, 0x68,
+    0x28, 0x20, 0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x40, 0xFB, 0x53, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF4, 0x68,
+    0x28, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xF5, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0x1D, 0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x23,
+    0xFB, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0x2E,
+    0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB, 0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x40, 0xFB, 0x57, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x46, 0xFB, 0xA5, 0x47, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0x1D, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF8, 0x68, 0x28,
+    0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xF9, 0x68,
+    0x28, 0x20, 0x33, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x40, 0xFB, 0x5B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0xFA,
+    0x68, 0x28, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x1B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFB,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0x1D, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0x23, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0x2E, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x33, 0xFB,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x40, 0xFB, 0x5F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x46, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x1B, 0xF0, 0x02, 0x84, 0x00, 0x60, 0xA9, 0xFF, 0x85, 0x01, 0xA0, 0x01, 0xA2, 0x02, 0xA9, 0x47,
+    0x85, 0x47, 0xA9, 0x06, 0x85, 0x48, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x63, 0x45,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00,
+    0xC8, 0xA9, 0x29, 0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x63, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20,
+    0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47,
+    0x06, 0x20, 0x0A, 0xFB, 0x63, 0x45, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06,
+    0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0xE9, 0xFA, 0x67, 0x47,
+    0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF, 0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8,
+    0xA9, 0x29, 0x85, 0x47, 0x20, 0xFA, 0xFA, 0x67, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x0A, 0xFB,
+    0x67, 0x47, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xA5, 0x47, 0xC9, 0x9B, 0xF0, 0x02, 0x84,
+    0x00, 0xC8, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x0A, 0xFB, 0x6F, 0x47, 0x06, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0xA9, 0x48, 0x85, 0x45, 0xA9, 0x05,
+    0x85, 0x46, 0xA0, 0xFF, 0x20, 0xE9, 0xFA, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0A, 0x68,
+    0x28, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x29, 0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0B, 0x68,
+    0x28, 0x20, 0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x0A, 0xFB, 0x73, 0x45, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x0C, 0x68,
+    0x28, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0x0D, 0xA2,
+    0xFF, 0xA9, 0xA5, 0x85, 0x47, 0x20, 0xE9, 0xFA, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xEF,
+    0xFA, 0xA5, 0x47, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29, 0x85, 0x47, 0x20, 0xFA,
+    0xFA, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA, 0xA5, 0x47, 0xC9, 0x14, 0xF0, 0x02,
+    0x84, 0x00, 0xC8, 0xA9, 0x37, 0x85, 0x47, 0x20, 0x0A, 0xFB, 0x77, 0x48, 0xEA, 0xEA, 0xEA, 0xEA,
+    0x20, 0x10, 0xFB, 0xA5, 0x47, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA9, 0xA5, 0x8D, 0x47, 0x06,
+    0xA0, 0xFF, 0x20, 0xE9, 0xFA, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x10, 0x68, 0x28,
+    0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x11, 0x68,
+    0x28, 0x20, 0xFF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0xFF, 0xA9,
+    0x37, 0x8D, 0x47, 0x06, 0x20, 0x0A, 0xFB, 0x7B, 0x48, 0x05, 0xEA, 0xEA, 0x08, 0x48, 0xA0, 0x12,
+    0x68, 0x28, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9, 0x9B, 0xF0, 0x02, 0x84, 0x00, 0xA0, 0x13,
+    0xA2, 0xFF, 0xA9, 0xA5, 0x8D, 0x47, 0x06, 0x20, 0xE9, 0xFA, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA,
+    0xEA, 0x20, 0xEF, 0xFA, 0xAD, 0x47, 0x06, 0xC9, 0x52, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x29,
+    0x8D, 0x47, 0x06, 0x20, 0xFA, 0xFA, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0xFF, 0xFA,
+    0xAD, 0x47, 0x06, 0xC9, 0x14, 0xF0, 0x02, 0x84, 0x00, 0xC8, 0xA9, 0x37, 0x8D, 0x47, 0x06, 0x20,
+    0x0A, 0xFB, 0x7F, 0x48, 0x05, 0xEA, 0xEA, 0xEA, 0xEA, 0x20, 0x10, 0xFB, 0xAD, 0x47, 0x06, 0xC9,
+    0x9B, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x18, 0xA9, 0xFF, 0x85, 0x01, 0x24, 0x01, 0xA9, 0x55, 0x60,
+    0xB0, 0x09, 0x10, 0x07, 0xC9, 0xFF, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8,
+    0xA9, 0x00, 0x60, 0xD0, 0x07, 0x70, 0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18,
+    0x24, 0x01, 0xA9, 0x55, 0x60, 0xD0, 0x07, 0x50, 0x05, 0xB0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x38, 0xB8, 0xA9, 0xF8, 0x60, 0x90, 0x09, 0x10, 0x07, 0xC9, 0xE8, 0xD0, 0x03, 0x70, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x5F, 0x60, 0xB0, 0x09, 0x10, 0x07, 0xC9, 0xF5,
+    0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8, 0xA9, 0x70, 0x60, 0xD0, 0x07, 0x70,
+    0x05, 0x90, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x00, 0x60, 0x30,
+    0x09, 0xB0, 0x07, 0xC9, 0x69, 0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0x24, 0x01,
+    0xA9, 0x00, 0x60, 0x30, 0x09, 0xB0, 0x07, 0xC9, 0x6A, 0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x38, 0xB8, 0xA9, 0x7F, 0x60, 0x10, 0x09, 0xB0, 0x07, 0xC9, 0xFF, 0xD0, 0x03, 0x50, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x18, 0x24, 0x01, 0xA9, 0x7F, 0x60, 0x10, 0x09, 0xB0, 0x07, 0xC9, 0xFF,
+    0xD0, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0x38, 0xB8, 0xA9, 0x7F, 0x60, 0xD0, 0x07, 0x30,
+    0x05, 0x70, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xA9, 0x40, 0x60, 0x30, 0x07,
+    0x90, 0x05, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB8, 0x60, 0xF0, 0x07, 0x30, 0x05,
+    0x90, 0x03, 0x70, 0x01, 0x60, 0x84, 0x00, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x10, 0x01, 0x60, 0x84,
+    0x00, 0x60, 0xA9, 0x80, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xD0,
+    0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB0, 0x05, 0xF0, 0x03, 0x10, 0x01, 0x60,
+    0x84, 0x00, 0x60, 0x90, 0x05, 0xF0, 0x03, 0x30, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0xA0,
+    0x40, 0x60, 0x30, 0x07, 0x90, 0x05, 0xD0, 0x03, 0x50, 0x01, 0x60, 0x86, 0x00, 0x60, 0xB8, 0x60,
+    0xF0, 0x07, 0x30, 0x05, 0x90, 0x03, 0x70, 0x01, 0x60, 0x86, 0x00, 0x60, 0xF0, 0x05, 0x10, 0x03,
+    0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0xA0, 0x80, 0x60, 0xF0, 0x05, 0x10, 0x03, 0x90, 0x01, 0x60,
+    0x86, 0x00, 0x60, 0xD0, 0x05, 0x30, 0x03, 0x90, 0x01, 0x60, 0x86, 0x00, 0x60, 0xB0, 0x05, 0xF0,
+    0x03, 0x10, 0x01, 0x60, 0x86, 0x00, 0x60, 0x90, 0x05, 0xF0, 0x03, 0x30, 0x01, 0x60, 0x86, 0x00,
+    0x60, 0x24, 0x01, 0xA9, 0x40, 0x38, 0x60, 0x30, 0x0B, 0x90, 0x09, 0xD0, 0x07, 0x70, 0x05, 0xC9,
+    0x00, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xB8, 0x38, 0xA9, 0x40, 0x60, 0xF0, 0x0B, 0x30, 0x09,
+    0x90, 0x07, 0x70, 0x05, 0xC9, 0x01, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0xA9, 0x40, 0x38, 0x24,
+    0x01, 0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xFF, 0xD0, 0x01, 0x60, 0x84,
+    0x00, 0x60, 0x18, 0xA9, 0x80, 0x60, 0x90, 0x05, 0xC9, 0x7F, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60,
+    0x38, 0xA9, 0x81, 0x60, 0x50, 0x07, 0x90, 0x05, 0xC9, 0x02, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60,
+    0xA2, 0x55, 0xA9, 0xFF, 0x85, 0x01, 0xEA, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x60, 0x90, 0x1B, 0xD0,
+    0x19, 0x30, 0x17, 0x50, 0x15, 0xC9, 0x00, 0xD0, 0x11, 0xB8, 0xA9, 0xAA, 0x60, 0xB0, 0x0B, 0xF0,
+    0x09, 0x30, 0x07, 0x70, 0x05, 0xC9, 0x55, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38,
+    0xA9, 0x80, 0x60, 0x90, 0x1C, 0xD0, 0x1A, 0x30, 0x18, 0x50, 0x16, 0xC9, 0x00, 0xD0, 0x12, 0xB8,
+    0xA9, 0x55, 0x38, 0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xAA, 0xD0, 0x01,
+    0x60, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x01, 0x60, 0x90, 0x1C, 0xF0, 0x1A, 0x10, 0x18,
+    0x50, 0x16, 0xC9, 0x80, 0xD0, 0x12, 0xB8, 0x18, 0xA9, 0x55, 0x60, 0x90, 0x0B, 0xF0, 0x09, 0x30,
+    0x07, 0x70, 0x05, 0xC9, 0x2A, 0xD0, 0x01, 0x60, 0x84, 0x00, 0x24, 0x01, 0x38, 0xA9, 0x80, 0x60,
+    0x90, 0x1C, 0xF0, 0x1A, 0x30, 0x18, 0x50, 0x16, 0xC9, 0x01, 0xD0, 0x12, 0xB8, 0x18, 0xA9, 0x55,
+    0x60, 0xB0, 0x0B, 0xF0, 0x09, 0x10, 0x07, 0x70, 0x05, 0xC9, 0xAA, 0xD0, 0x01, 0x60, 0x84, 0x00,
+    0x60, 0x24, 0x01, 0x18, 0xA9, 0x40, 0x60, 0x50, 0x2C, 0xB0, 0x2A, 0x30, 0x28, 0xC9, 0x40, 0xD0,
+    0x24, 0x60, 0xB8, 0x38, 0xA9, 0xFF, 0x60, 0x70, 0x1C, 0xD0, 0x1A, 0x30, 0x18, 0x90, 0x16, 0xC9,
+    0xFF, 0xD0, 0x12, 0x60, 0x24, 0x01, 0xA9, 0xF0, 0x60, 0x50, 0x0A, 0xF0, 0x08, 0x10, 0x06, 0x90,
+    0x04, 0xC9, 0xF0, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x75, 0x60, 0x50, 0x76,
+    0xF0, 0x74, 0x30, 0x72, 0xB0, 0x70, 0xC9, 0x65, 0xD0, 0x6C, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB3,
+    0x60, 0x50, 0x63, 0x90, 0x61, 0x10, 0x5F, 0xC9, 0xFB, 0xD0, 0x5B, 0x60, 0xB8, 0x18, 0xA9, 0xC3,
+    0x60, 0x70, 0x53, 0xF0, 0x51, 0x10, 0x4F, 0xB0, 0x4D, 0xC9, 0xD3, 0xD0, 0x49, 0x60, 0x24, 0x01,
+    0x38, 0xA9, 0x10, 0x60, 0x50, 0x40, 0xF0, 0x3E, 0x30, 0x3C, 0xB0, 0x3A, 0xC9, 0x7E, 0xD0, 0x36,
+    0x60, 0x24, 0x01, 0x18, 0xA9, 0x40, 0x60, 0x70, 0x2D, 0xB0, 0x2B, 0x30, 0x29, 0xC9, 0x53, 0xD0,
+    0x25, 0x60, 0xB8, 0x38, 0xA9, 0xFF, 0x60, 0x70, 0x1D, 0xF0, 0x1B, 0x10, 0x19, 0x90, 0x17, 0xC9,
+    0xFF, 0xD0, 0x13, 0x60, 0x24, 0x01, 0x38, 0xA9, 0xF0, 0x60, 0x70, 0x0A, 0xF0, 0x08, 0x10, 0x06,
+    0x90, 0x04, 0xC9, 0xB8, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB2, 0x60, 0x70,
+    0x2A, 0x90, 0x28, 0x30, 0x26, 0xC9, 0x05, 0xD0, 0x22, 0x60, 0xB8, 0x18, 0xA9, 0x42, 0x60, 0x70,
+    0x1A, 0x30, 0x18, 0xB0, 0x16, 0xC9, 0x57, 0xD0, 0x12, 0x60, 0x24, 0x01, 0x38, 0xA9, 0x75, 0x60,
+    0x70, 0x09, 0x30, 0x07, 0x90, 0x05, 0xC9, 0x11, 0xD0, 0x01, 0x60, 0x85, 0x00, 0x24, 0x01, 0x18,
+    0xA9, 0xB3, 0x60, 0x50, 0x50, 0x90, 0x4E, 0x10, 0x4C, 0xC9, 0xE1, 0xD0, 0x48, 0x60, 0xB8, 0x18,
+    0xA9, 0x42, 0x60, 0x70, 0x40, 0xF0, 0x3E, 0x30, 0x3C, 0x90, 0x3A, 0xC9, 0x56, 0xD0, 0x36, 0x60,
+    0x24, 0x01, 0x38, 0xA9, 0x75, 0x60, 0x50, 0x2D, 0xF0, 0x2B, 0x30, 0x29, 0x90, 0x27, 0xC9, 0x6E,
+    0xD0, 0x23, 0x60, 0x24, 0x01, 0x18, 0xA9, 0xB3, 0x60, 0x50, 0x1A, 0x90, 0x18, 0x30, 0x16, 0xC9,
+    0x02, 0xD0, 0x12, 0x60, 0xB8, 0x18, 0xA9, 0x42, 0x60, 0x70, 0x0A, 0xF0, 0x08, 0x30, 0x06, 0xB0,
+    0x04, 0xC9, 0x42, 0xF0, 0x02, 0x84, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0x00, 0xC0, 0xC0, 0xFE, 0x7C, 0x00,
+    0xFE, 0xFE, 0x00, 0xF0, 0xC0, 0xFE, 0xFE, 0x00, 0xC6, 0xC6, 0x02, 0xFE, 0xC6, 0xC6, 0xC6, 0x00,
+    0xCC, 0xD8, 0x00, 0xF0, 0xD8, 0xCC, 0xC6, 0x00, 0xC6, 0xEE, 0x02, 0xD6, 0xC6, 0xC6, 0xC6, 0x00,
+    0xC6, 0xC6, 0x02, 0xD6, 0xCE, 0xC6, 0xC6, 0x00, 0x7C, 0xFE, 0x02, 0xC6, 0xC6, 0xFE, 0x7C, 0x00,
+    0xFC, 0xFE, 0x02, 0xFC, 0xC0, 0xC0, 0xC0, 0x00, 0xCC, 0xCC, 0x00, 0x78, 0x30, 0x30, 0x30, 0x00,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xFC, 0xFE, 0x02, 0x06, 0x1C, 0x70, 0xFE, 0x00,
+    0xFC, 0xFE, 0x02, 0x3C, 0x3C, 0x02, 0xFE, 0x00, 0x18, 0x18, 0xD8, 0xD8, 0xFE, 0x18, 0x18, 0x00,
+    0xFE, 0xFE, 0x00, 0x80, 0xFC, 0x06, 0xFE, 0x00, 0x7C, 0xFE, 0x00, 0xC0, 0xFC, 0xC6, 0xFE, 0x00,
+    0xFE, 0xFE, 0x06, 0x0C, 0x18, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x33, 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0xFF, 0x66, 0xFF, 0x66, 0x66, 0x00, 0x18, 0x3E, 0x60, 0x3C, 0x06, 0x7C, 0x18, 0x00,
+    0x62, 0x66, 0x0C, 0x18, 0x30, 0x66, 0x46, 0x00, 0x3C, 0x66, 0x3C, 0x38, 0x67, 0x66, 0x3F, 0x00,
+    0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00,
+    0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30,
+    0x00, 0x00, 0x00, 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
+    0x00, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x3E, 0x63, 0x67, 0x6B, 0x73, 0x63, 0x3E, 0x00,
+    0x0C, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00, 0x3E, 0x63, 0x63, 0x0E, 0x38, 0x63, 0x7F, 0x00,
+    0x3E, 0x63, 0x63, 0x0E, 0x63, 0x63, 0x3E, 0x00, 0x06, 0x0E, 0x1E, 0x26, 0x7F, 0x06, 0x06, 0x00,
+    0x7F, 0x63, 0x60, 0x7E, 0x03, 0x63, 0x3E, 0x00, 0x3E, 0x63, 0x60, 0x7E, 0x63, 0x63, 0x3E, 0x00,
+    0x7F, 0x63, 0x06, 0x0C, 0x18, 0x18, 0x3C, 0x00, 0x3E, 0x63, 0x63, 0x3E, 0x63, 0x63, 0x3E, 0x00,
+    0x3E, 0x63, 0x63, 0x3F, 0x03, 0x63, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00,
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30, 0x0E, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0E, 0x00,
+    0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x70, 0x18, 0x0C, 0x06, 0x0C, 0x18, 0x70, 0x00,
+    0x7E, 0x63, 0x03, 0x06, 0x1C, 0x00, 0x18, 0x18, 0x7C, 0xC6, 0xCE, 0xEE, 0xE0, 0xE6, 0x7C, 0x00,
+    0x1C, 0x36, 0x63, 0x7F, 0x63, 0x63, 0x63, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x63, 0x63, 0x7E, 0x00,
+    0x1E, 0x33, 0x60, 0x60, 0x60, 0x33, 0x1E, 0x00, 0x6C, 0x76, 0x63, 0x63, 0x63, 0x66, 0x7C, 0x00,
+    0x7F, 0x31, 0x30, 0x3C, 0x30, 0x31, 0x7F, 0x00, 0x7F, 0x31, 0x30, 0x3C, 0x30, 0x30, 0x78, 0x00,
+    0x1E, 0x33, 0x60, 0x67, 0x63, 0x37, 0x1D, 0x00, 0x63, 0x63, 0x63, 0x7F, 0x63, 0x63, 0x63, 0x00,
+    0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00, 0x1F, 0x06, 0x06, 0x06, 0x06, 0x66, 0x3C, 0x00,
+    0x66, 0x66, 0x6C, 0x78, 0x6C, 0x67, 0x63, 0x00, 0x78, 0x30, 0x60, 0x60, 0x63, 0x63, 0x7E, 0x00,
+    0x63, 0x77, 0x7F, 0x6B, 0x63, 0x63, 0x63, 0x00, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x63, 0x63, 0x00,
+    0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x60, 0x60, 0x60, 0x00,
+    0x1C, 0x36, 0x63, 0x6B, 0x67, 0x36, 0x1D, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x6C, 0x67, 0x63, 0x00,
+    0x3E, 0x63, 0x60, 0x3E, 0x03, 0x63, 0x3E, 0x00, 0x7E, 0x5A, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00,
+    0x73, 0x33, 0x63, 0x63, 0x63, 0x76, 0x3C, 0x00, 0x73, 0x33, 0x63, 0x63, 0x66, 0x3C, 0x18, 0x00,
+    0x73, 0x33, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00, 0x63, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x63, 0x00,
+    0x33, 0x63, 0x63, 0x36, 0x1C, 0x78, 0x70, 0x00, 0x7F, 0x63, 0x06, 0x1C, 0x33, 0x63, 0x7E, 0x00,
+    0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x00, 0x40, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00,
+    0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3C, 0x00, 0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x63, 0x63, 0x67, 0x3B, 0x00, 0x60, 0x60, 0x6E, 0x73, 0x63, 0x63, 0x3E, 0x00,
+    0x00, 0x00, 0x3E, 0x63, 0x60, 0x63, 0x3E, 0x00, 0x03, 0x03, 0x3B, 0x67, 0x63, 0x63, 0x3E, 0x00,
+    0x00, 0x00, 0x3E, 0x61, 0x7F, 0x60, 0x3E, 0x00, 0x0E, 0x18, 0x18, 0x3C, 0x18, 0x18, 0x3C, 0x00,
+    0x00, 0x00, 0x3E, 0x60, 0x63, 0x63, 0x3D, 0x00, 0x60, 0x60, 0x6E, 0x73, 0x63, 0x66, 0x67, 0x00,
+    0x00, 0x00, 0x1E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x06, 0x06, 0x66, 0x3C,
+    0x60, 0x60, 0x66, 0x6E, 0x7C, 0x67, 0x63, 0x00, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00,
+    0x00, 0x00, 0x6E, 0x7F, 0x6B, 0x62, 0x67, 0x00, 0x00, 0x00, 0x6E, 0x73, 0x63, 0x66, 0x67, 0x00,
+    0x00, 0x00, 0x3E, 0x63, 0x63, 0x63, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x63, 0x73, 0x6E, 0x60, 0x60,
+    0x00, 0x00, 0x3E, 0x63, 0x67, 0x3B, 0x03, 0x03, 0x00, 0x00, 0x6E, 0x73, 0x63, 0x7E, 0x63, 0x00,
+    0x00, 0x00, 0x3E, 0x71, 0x1C, 0x47, 0x3E, 0x00, 0x06, 0x0C, 0x3F, 0x18, 0x18, 0x1B, 0x0E, 0x00,
+    0x00, 0x00, 0x73, 0x33, 0x63, 0x67, 0x3B, 0x00, 0x00, 0x00, 0x73, 0x33, 0x63, 0x66, 0x3C, 0x00,
+    0x00, 0x00, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00, 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00,
+    0x00, 0x00, 0x33, 0x63, 0x63, 0x3F, 0x03, 0x3E, 0x00, 0x00, 0x7F, 0x0E, 0x1C, 0x38, 0x7F, 0x00,
+    0x3C, 0x42, 0x99, 0xA1, 0xA1, 0x99, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33,
+    0x38, 0x06, 0x12, 0x33, 0x3A, 0x06, 0x12, 0x33, 0x0F, 0x06, 0x12, 0x33, 0x33, 0x06, 0x12, 0x33,
+    0x38, 0x06, 0x12, 0x33, 0x3A, 0x06, 0x12, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC5, 0x04, 0xC0, 0xF4, 0xC5
+};
+
+/*****************************************************************************/
+uint32_t block_C5AF(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C5AF: PHA
+    cycles += 9;
+    s.push(s.a);
+    // C5B0: TXA
+    cycles += 6;
+    s.a = s.zeroSign(s.x);
+    // C5B1: PHA
+    cycles += 9;
+    s.push(s.a);
+    return s.exit(0xC5B2, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C004(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C004: SEI
+    cycles += 6;
+    s.setFlag(INTERRUPT, true);
+    // C005: CLD
+    cycles += 6;
+    s.setFlag(DECIMAL, false);
+    // C006: LDX FF
+    cycles += 6;
+    s.x = s.zeroSign(0xFF);
+    // C008: TXS
+    cycles += 6;
+    s.s = s.x;
+    return s.exit(0xC009, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C5E5(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C5E5: LDA D4
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD4));
+    // C5E7: TAX
+    cycles += 6;
+    s.x = s.zeroSign(s.a);
+    // C5E8: EOR D6
+    cycles += 9;
+    s.a = s.zeroSign(s.a ^ s.read(0xD6));
+    // C5EA: AND D4
+    cycles += 9;
+    s.a = s.zeroSign(s.a & s.read(0xD4));
+    // C5EC: STA D5
+    cycles += 9;
+    s.write(0xD5, s.a);
+    // C5EE: STX D6
+    cycles += 9;
+    s.write(0xD6, s.x);
+    // C5F0: PLA
+    cycles += 12;
+    s.a = s.zeroSign(s.pop());
+    // C5F1: TAX
+    cycles += 6;
+    s.x = s.zeroSign(s.a);
+    // C5F2: PLA
+    cycles += 12;
+    s.a = s.zeroSign(s.pop());
+    return s.exit(0xC5F3, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C013(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C013: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    return s.exit(0xC015, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C03A(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C03A: DEY
+    cycles += 6;
+    s.y = s.zeroSign(static_cast<uint8_t>(s.y - 1));
+    // C03B: BNE F7
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC034, cycles);
+    }
+    return s.exit(0xC03D, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C03D(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C03D: LDA 3F
+    cycles += 6;
+    s.a = s.zeroSign(0x3F);
+    return s.exit(0xC03F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C054(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C054: LDA C0
+    cycles += 6;
+    s.a = s.zeroSign(0xC0);
+    return s.exit(0xC056, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2A7(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2A7: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    return s.exit(0xC2A9, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C081(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C081: JSR 8D C2
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0x83);
+    return s.exit(0xC28D, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2ED(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2ED: LDA 20
+    cycles += 6;
+    s.a = s.zeroSign(0x20);
+    return s.exit(0xC2EF, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2B2(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2B2: LDA 20
+    cycles += 6;
+    s.a = s.zeroSign(0x20);
+    return s.exit(0xC2B4, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C28D(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C28D: LDA D2
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD2));
+    // C28F: CMP D2
+    cycles += 9;
+    s.compare(s.a, s.read(0xD2));
+    // C291: BEQ FC
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC28F, cycles);
+    }
+    return s.exit(0xC293, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C084(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C084: LDX 12
+    cycles += 6;
+    s.x = s.zeroSign(0x12);
+    // C086: JSR 61 C2
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0x88);
+    return s.exit(0xC261, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C300(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C300: DEY
+    cycles += 6;
+    s.y = s.zeroSign(static_cast<uint8_t>(s.y - 1));
+    // C301: BNE FA
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2FD, cycles);
+    }
+    return s.exit(0xC303, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2E2(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2E2: LDA 80
+    cycles += 6;
+    s.a = s.zeroSign(0x80);
+    return s.exit(0xC2E4, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2C2(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2C2: CMP FF
+    cycles += 6;
+    s.compare(s.a, 0xFF);
+    // C2C4: BEQ 0D
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2D3, cycles);
+    }
+    return s.exit(0xC2C6, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C28F(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+loop:
+    // C28F: CMP D2
+    cycles += 9;
+    s.compare(s.a, s.read(0xD2));
+    // C291: BEQ FC
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        if (cycles + 12 < context->remaining)
+        {
+            goto loop;
+        }
+        return s.exit(0xC28F, cycles);
+    }
+    return s.exit(0xC293, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C293(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C293: RTS
+    cycles += 18;
+    {
+        const uint16_t low = s.pop();
+        const uint16_t high = s.pop();
+        return s.exit(((high << 8) | low) + 1, cycles);
+    }
+}
+
+/*****************************************************************************/
+uint32_t block_C261(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C261: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C263: CLC
+    cycles += 6;
+    s.setFlag(CARRY, false);
+    // C264: ADC 04
+    cycles += 6;
+    s.adc(0x04);
+    // C266: TAY
+    cycles += 6;
+    s.y = s.zeroSign(s.a);
+    // C267: LDA 84
+    cycles += 6;
+    s.a = s.zeroSign(0x84);
+    return s.exit(0xC269, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C089(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C089: LDA D5
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD5));
+    // C08B: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C08C: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C08D: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C08E: BCS 1C
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC0AC, cycles);
+    }
+    return s.exit(0xC090, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C303(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C303: DEX
+    cycles += 6;
+    s.x = s.zeroSign(static_cast<uint8_t>(s.x - 1));
+    // C304: BNE F5
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2FB, cycles);
+    }
+    return s.exit(0xC306, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2D3(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2D3: INY
+    cycles += 6;
+    s.y = s.zeroSign(static_cast<uint8_t>(s.y + 1));
+    // C2D4: BNE 02
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2D8, cycles);
+    }
+    return s.exit(0xC2D6, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C27C(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C27C: LDA 2A
+    cycles += 6;
+    s.a = s.zeroSign(0x2A);
+    return s.exit(0xC27E, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0AC(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0AC: JSR 6F C6
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xAE);
+    return s.exit(0xC66F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C090(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C090: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C091: BCS 0C
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC09F, cycles);
+    }
+    return s.exit(0xC093, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2FB(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2FB: LDY 20
+    cycles += 6;
+    s.y = s.zeroSign(0x20);
+    return s.exit(0xC2FD, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C306(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C306: RTS
+    cycles += 18;
+    {
+        const uint16_t low = s.pop();
+        const uint16_t high = s.pop();
+        return s.exit(((high << 8) | low) + 1, cycles);
+    }
+}
+
+/*****************************************************************************/
+uint32_t block_C2D8(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2D8: LDA 20
+    cycles += 6;
+    s.a = s.zeroSign(0x20);
+    return s.exit(0xC2DA, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2D6(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2D6: INC D1
+    cycles += 15;
+    {
+        const uint16_t address = 0xD1;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C2D8: LDA 20
+    cycles += 6;
+    s.a = s.zeroSign(0x20);
+    return s.exit(0xC2DA, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2CE(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2CE: DEX
+    cycles += 6;
+    s.x = s.zeroSign(static_cast<uint8_t>(s.x - 1));
+    // C2CF: BNE ED
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2BE, cycles);
+    }
+    return s.exit(0xC2D1, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2CC(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2CC: INC D1
+    cycles += 15;
+    {
+        const uint16_t address = 0xD1;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C2CE: DEX
+    cycles += 6;
+    s.x = s.zeroSign(static_cast<uint8_t>(s.x - 1));
+    // C2CF: BNE ED
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2BE, cycles);
+    }
+    return s.exit(0xC2D1, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C276(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C276: LDA 20
+    cycles += 6;
+    s.a = s.zeroSign(0x20);
+    // C278: DEY
+    cycles += 6;
+    s.y = s.zeroSign(static_cast<uint8_t>(s.y - 1));
+    // C279: INY
+    cycles += 6;
+    s.y = s.zeroSign(static_cast<uint8_t>(s.y + 1));
+    // C27A: BNE 02
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC27E, cycles);
+    }
+    return s.exit(0xC27C, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C285(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C285: LDA 80
+    cycles += 6;
+    s.a = s.zeroSign(0x80);
+    return s.exit(0xC287, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C66F(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C66F: LDA 03
+    cycles += 6;
+    s.a = s.zeroSign(0x03);
+    return s.exit(0xC671, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0AF(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0AF: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C0B1: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C0B3: CMP 0E
+    cycles += 6;
+    s.compare(s.a, 0x0E);
+    // C0B5: BCC CA
+    cycles += 6;
+    if (!s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC081, cycles);
+    }
+    return s.exit(0xC0B7, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C09F(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C09F: JSR 6F C6
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xA1);
+    return s.exit(0xC66F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C093(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C093: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C094: BCS 27
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC0BD, cycles);
+    }
+    return s.exit(0xC096, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2E0(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2E0: BEQ DA
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2BC, cycles);
+    }
+    return s.exit(0xC2E2, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2D1(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2D1: BEQ E9
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC2BC, cycles);
+    }
+    return s.exit(0xC2D3, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C294(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C294: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    return s.exit(0xC296, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0B7(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0B7: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C0B9: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C0BB: BEQ C4
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC081, cycles);
+    }
+    return s.exit(0xC0BD, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0A2(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0A2: DEC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) - 1)));
+    }
+    // C0A4: BPL DB
+    cycles += 6;
+    if (!s.flag(SIGN))
+    {
+        cycles += 3;
+        return s.exit(0xC081, cycles);
+    }
+    return s.exit(0xC0A6, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0BD(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0BD: JSR 89 C6
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xBF);
+    return s.exit(0xC689, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C096(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C096: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C097: BCS 03
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC09C, cycles);
+    }
+    return s.exit(0xC099, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C2BC(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C2BC: LDX 20
+    cycles += 6;
+    s.x = s.zeroSign(0x20);
+    return s.exit(0xC2BE, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0A6(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0A6: LDA 0D
+    cycles += 6;
+    s.a = s.zeroSign(0x0D);
+    // C0A8: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C0AA: BNE D5
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC081, cycles);
+    }
+    return s.exit(0xC0AC, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C689(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C689: LDA 02
+    cycles += 6;
+    s.a = s.zeroSign(0x02);
+    return s.exit(0xC68B, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0C0(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0C0: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C0C2: BEQ 06
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC0CA, cycles);
+    }
+    return s.exit(0xC0C4, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C09C(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C09C: JMP 26 C1
+    cycles += 9;
+    return s.exit(0xC126, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C099(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C099: JMP 81 C0
+    cycles += 9;
+    return s.exit(0xC081, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0CA(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0CA: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C0CC: STA D8
+    cycles += 9;
+    s.write(0xD8, s.a);
+    // C0CE: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C0D0: JSR ED C0
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xD2);
+    return s.exit(0xC0ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0C4(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0C4: JSR ED C0
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xC6);
+    return s.exit(0xC0ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C126(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C126: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C128: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C12A: LDA 92
+    cycles += 6;
+    s.a = s.zeroSign(0x92);
+    // C12C: STA D0
+    cycles += 9;
+    s.write(0xD0, s.a);
+    // C12E: LDA C4
+    cycles += 6;
+    s.a = s.zeroSign(0xC4);
+    // C130: STA D1
+    cycles += 9;
+    s.write(0xD1, s.a);
+    // C132: JSR A7 C2
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x34);
+    return s.exit(0xC2A7, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0ED(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0ED: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C0EF: ASL
+    cycles += 6;
+    s.a = s.asl(s.a);
+    // C0F0: TAX
+    cycles += 6;
+    s.x = s.zeroSign(s.a);
+    // C0F1: LDA 0A C1
+    cycles += 12;
+    cycles += ((0x0A + s.x) >> 8) * 3;
+    s.a = s.zeroSign(PRG[0x410A + s.x]);
+    // C0F4: STA 00 02
+    cycles += 12;
+    s.write(0x0200, s.a);
+    // C0F7: LDA 0B C1
+    cycles += 12;
+    cycles += ((0x0B + s.x) >> 8) * 3;
+    s.a = s.zeroSign(PRG[0x410B + s.x]);
+    // C0FA: STA 01 02
+    cycles += 12;
+    s.write(0x0201, s.a);
+    // C0FD: LDA C1
+    cycles += 6;
+    s.a = s.zeroSign(0xC1);
+    return s.exit(0xC0FF, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0D3(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0D3: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C0D5: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C0D7: CMP 0E
+    cycles += 6;
+    s.compare(s.a, 0x0E);
+    // C0D9: BNE F5
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC0D0, cycles);
+    }
+    return s.exit(0xC0DB, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0C7(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0C7: JMP 81 C0
+    cycles += 9;
+    return s.exit(0xC081, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C135(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C135: JSR 8D C2
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x37);
+    return s.exit(0xC28D, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0D0(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0D0: JSR ED C0
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xD2);
+    return s.exit(0xC0ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0DB(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0DB: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C0DD: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C0DF: LDA D8
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD8));
+    // C0E1: BEQ 02
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC0E5, cycles);
+    }
+    return s.exit(0xC0E3, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C138(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C138: LDX 0F
+    cycles += 6;
+    s.x = s.zeroSign(0x0F);
+    // C13A: JSR 61 C2
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x3C);
+    return s.exit(0xC261, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0E5(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0E5: STA 00
+    cycles += 9;
+    s.write(0x00, s.a);
+    // C0E7: JSR ED C1
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xE9);
+    return s.exit(0xC1ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0E3(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0E3: LDA FF
+    cycles += 6;
+    s.a = s.zeroSign(0xFF);
+    // C0E5: STA 00
+    cycles += 9;
+    s.write(0x00, s.a);
+    // C0E7: JSR ED C1
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0xE9);
+    return s.exit(0xC1ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C13D(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C13D: LDA D5
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD5));
+    // C13F: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C140: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C141: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C142: BCS 1C
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC160, cycles);
+    }
+    return s.exit(0xC144, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C1ED(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C1ED: JSR 8D C2
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0xEF);
+    return s.exit(0xC28D, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C0EA(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C0EA: JMP 81 C0
+    cycles += 9;
+    return s.exit(0xC081, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C160(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C160: JSR 6F C6
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x62);
+    return s.exit(0xC66F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C144(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C144: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C145: BCS 0C
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC153, cycles);
+    }
+    return s.exit(0xC147, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C1F0(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C1F0: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C1F2: STA D3
+    cycles += 9;
+    s.write(0xD3, s.a);
+    // C1F4: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C1F6: CLC
+    cycles += 6;
+    s.setFlag(CARRY, false);
+    // C1F7: ADC 04
+    cycles += 6;
+    s.adc(0x04);
+    // C1F9: ASL
+    cycles += 6;
+    s.a = s.asl(s.a);
+    // C1FA: ROL D3
+    cycles += 15;
+    {
+        const uint16_t address = 0xD3;
+        s.write(address, s.rol(s.read(address)));
+    }
+    // C1FC: ASL
+    cycles += 6;
+    s.a = s.asl(s.a);
+    // C1FD: ROL D3
+    cycles += 15;
+    {
+        const uint16_t address = 0xD3;
+        s.write(address, s.rol(s.read(address)));
+    }
+    return s.exit(0xC1FF, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C163(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C163: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C165: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C167: CMP 0B
+    cycles += 6;
+    s.compare(s.a, 0x0B);
+    // C169: BCC CA
+    cycles += 6;
+    if (!s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC135, cycles);
+    }
+    return s.exit(0xC16B, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C153(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C153: JSR 6F C6
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x55);
+    return s.exit(0xC66F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C147(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C147: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C148: BCS 27
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC171, cycles);
+    }
+    return s.exit(0xC14A, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C16B(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C16B: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C16D: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C16F: BEQ C4
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC135, cycles);
+    }
+    return s.exit(0xC171, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C156(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C156: DEC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) - 1)));
+    }
+    // C158: BPL DB
+    cycles += 6;
+    if (!s.flag(SIGN))
+    {
+        cycles += 3;
+        return s.exit(0xC135, cycles);
+    }
+    return s.exit(0xC15A, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C171(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C171: JSR 89 C6
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x73);
+    return s.exit(0xC689, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C14A(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C14A: LSR
+    cycles += 6;
+    s.a = s.lsr(s.a);
+    // C14B: BCS 03
+    cycles += 6;
+    if (s.flag(CARRY))
+    {
+        cycles += 3;
+        return s.exit(0xC150, cycles);
+    }
+    return s.exit(0xC14D, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C15A(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C15A: LDA 0A
+    cycles += 6;
+    s.a = s.zeroSign(0x0A);
+    // C15C: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C15E: BNE D5
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC135, cycles);
+    }
+    return s.exit(0xC160, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C174(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C174: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C176: BEQ 06
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC17E, cycles);
+    }
+    return s.exit(0xC178, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C150(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C150: JMP 72 C0
+    cycles += 9;
+    return s.exit(0xC072, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C14D(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C14D: JMP 35 C1
+    cycles += 9;
+    return s.exit(0xC135, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C17E(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C17E: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C180: STA D8
+    cycles += 9;
+    s.write(0xD8, s.a);
+    // C182: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C184: JSR A1 C1
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x86);
+    return s.exit(0xC1A1, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C178(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C178: JSR A1 C1
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x7A);
+    return s.exit(0xC1A1, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C072(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C072: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C074: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C076: LDA 07
+    cycles += 6;
+    s.a = s.zeroSign(0x07);
+    // C078: STA D0
+    cycles += 9;
+    s.write(0xD0, s.a);
+    // C07A: LDA C3
+    cycles += 6;
+    s.a = s.zeroSign(0xC3);
+    // C07C: STA D1
+    cycles += 9;
+    s.write(0xD1, s.a);
+    // C07E: JSR A7 C2
+    cycles += 18;
+    s.push(0xC0);
+    s.push(0x80);
+    return s.exit(0xC2A7, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C1A1(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C1A1: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C1A3: ASL
+    cycles += 6;
+    s.a = s.asl(s.a);
+    // C1A4: TAX
+    cycles += 6;
+    s.x = s.zeroSign(s.a);
+    // C1A5: LDA BE C1
+    cycles += 12;
+    cycles += ((0xBE + s.x) >> 8) * 3;
+    s.a = s.zeroSign(PRG[0x41BE + s.x]);
+    // C1A8: STA 00 02
+    cycles += 12;
+    s.write(0x0200, s.a);
+    // C1AB: LDA BF C1
+    cycles += 12;
+    cycles += ((0xBF + s.x) >> 8) * 3;
+    s.a = s.zeroSign(PRG[0x41BF + s.x]);
+    // C1AE: STA 01 02
+    cycles += 12;
+    s.write(0x0201, s.a);
+    // C1B1: LDA C1
+    cycles += 6;
+    s.a = s.zeroSign(0xC1);
+    // C1B3: PHA
+    cycles += 9;
+    s.push(s.a);
+    // C1B4: LDA DE
+    cycles += 6;
+    s.a = s.zeroSign(0xDE);
+    // C1B6: PHA
+    cycles += 9;
+    s.push(s.a);
+    // C1B7: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C1B9: STA 00
+    cycles += 9;
+    s.write(0x00, s.a);
+    return s.exit(0xC1BB, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C187(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C187: INC D7
+    cycles += 15;
+    {
+        const uint16_t address = 0xD7;
+        s.write(address, s.zeroSign(static_cast<uint8_t>(s.read(address) + 1)));
+    }
+    // C189: LDA D7
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD7));
+    // C18B: CMP 0B
+    cycles += 6;
+    s.compare(s.a, 0x0B);
+    // C18D: BNE F5
+    cycles += 6;
+    if (!s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC184, cycles);
+    }
+    return s.exit(0xC18F, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C17B(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C17B: JMP 35 C1
+    cycles += 9;
+    return s.exit(0xC135, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C184(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C184: JSR A1 C1
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x86);
+    return s.exit(0xC1A1, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C18F(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C18F: LDA 00
+    cycles += 6;
+    s.a = s.zeroSign(0x00);
+    // C191: STA D7
+    cycles += 9;
+    s.write(0xD7, s.a);
+    // C193: LDA D8
+    cycles += 9;
+    s.a = s.zeroSign(s.read(0xD8));
+    // C195: BEQ 02
+    cycles += 6;
+    if (s.flag(ZERO))
+    {
+        cycles += 3;
+        return s.exit(0xC199, cycles);
+    }
+    return s.exit(0xC197, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C199(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C199: STA 00
+    cycles += 9;
+    s.write(0x00, s.a);
+    // C19B: JSR ED C1
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x9D);
+    return s.exit(0xC1ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C197(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C197: LDA FF
+    cycles += 6;
+    s.a = s.zeroSign(0xFF);
+    // C199: STA 00
+    cycles += 9;
+    s.write(0x00, s.a);
+    // C19B: JSR ED C1
+    cycles += 18;
+    s.push(0xC1);
+    s.push(0x9D);
+    return s.exit(0xC1ED, cycles);
+}
+
+/*****************************************************************************/
+uint32_t block_C19E(NativeContext* context)
+{
+    RecompiledState s(context);
+    uint32_t cycles = 0;
+    // C19E: JMP 35 C1
+    cycles += 9;
+    return s.exit(0xC135, cycles);
+}
+
+/*****************************************************************************/
+static const RecompiledBlock BLOCKS[] =
+{
+    {0xC5AF, 3, 21, block_C5AF},
+    {0xC004, 4, 27, block_C004},
+    {0xC5E5, 9, 93, block_C5E5},
+    {0xC013, 1, 0, block_C013},
+    {0xC03A, 2, 9, block_C03A},
+    {0xC03D, 1, 0, block_C03D},
+    {0xC054, 1, 0, block_C054},
+    {0xC2A7, 1, 0, block_C2A7},
+    {0xC081, 1, 0, block_C081},
+    {0xC2ED, 1, 0, block_C2ED},
+    {0xC2B2, 1, 0, block_C2B2},
+    {0xC28D, 3, 24, block_C28D},
+    {0xC084, 2, 9, block_C084},
+    {0xC300, 2, 9, block_C300},
+    {0xC2E2, 1, 0, block_C2E2},
+    {0xC2C2, 2, 9, block_C2C2},
+    {0xC28F, 2, 12, block_C28F},
+    {0xC293, 1, 0, block_C293},
+    {0xC261, 5, 39, block_C261},
+    {0xC089, 5, 39, block_C089},
+    {0xC303, 2, 9, block_C303},
+    {0xC2D3, 2, 9, block_C2D3},
+    {0xC27C, 1, 0, block_C27C},
+    {0xC0AC, 1, 0, block_C0AC},
+    {0xC090, 2, 9, block_C090},
+    {0xC2FB, 1, 0, block_C2FB},
+    {0xC306, 1, 0, block_C306},
+    {0xC2D8, 1, 0, block_C2D8},
+    {0xC2D6, 2, 18, block_C2D6},
+    {0xC2CE, 2, 9, block_C2CE},
+    {0xC2CC, 3, 27, block_C2CC},
+    {0xC276, 4, 27, block_C276},
+    {0xC285, 1, 0, block_C285},
+    {0xC66F, 1, 0, block_C66F},
+    {0xC0AF, 4, 39, block_C0AF},
+    {0xC09F, 1, 0, block_C09F},
+    {0xC093, 2, 9, block_C093},
+    {0xC2E0, 1, 0, block_C2E0},
+    {0xC2D1, 1, 0, block_C2D1},
+    {0xC294, 1, 0, block_C294},
+    {0xC0B7, 3, 21, block_C0B7},
+    {0xC0A2, 2, 18, block_C0A2},
+    {0xC0BD, 1, 0, block_C0BD},
+    {0xC096, 2, 9, block_C096},
+    {0xC2BC, 1, 0, block_C2BC},
+    {0xC0A6, 3, 21, block_C0A6},
+    {0xC689, 1, 0, block_C689},
+    {0xC0C0, 2, 12, block_C0C0},
+    {0xC09C, 1, 0, block_C09C},
+    {0xC099, 1, 0, block_C099},
+    {0xC0CA, 4, 39, block_C0CA},
+    {0xC0C4, 1, 0, block_C0C4},
+    {0xC126, 7, 63, block_C126},
+    {0xC0ED, 8, 90, block_C0ED},
+    {0xC0D3, 4, 39, block_C0D3},
+    {0xC0C7, 1, 0, block_C0C7},
+    {0xC135, 1, 0, block_C135},
+    {0xC0D0, 1, 0, block_C0D0},
+    {0xC0DB, 4, 33, block_C0DB},
+    {0xC138, 2, 9, block_C138},
+    {0xC0E5, 2, 12, block_C0E5},
+    {0xC0E3, 3, 21, block_C0E3},
+    {0xC13D, 5, 39, block_C13D},
+    {0xC1ED, 1, 0, block_C1ED},
+    {0xC0EA, 1, 0, block_C0EA},
+    {0xC160, 1, 0, block_C160},
+    {0xC144, 2, 9, block_C144},
+    {0xC1F0, 9, 87, block_C1F0},
+    {0xC163, 4, 39, block_C163},
+    {0xC153, 1, 0, block_C153},
+    {0xC147, 2, 9, block_C147},
+    {0xC16B, 3, 21, block_C16B},
+    {0xC156, 2, 18, block_C156},
+    {0xC171, 1, 0, block_C171},
+    {0xC14A, 2, 9, block_C14A},
+    {0xC15A, 3, 21, block_C15A},
+    {0xC174, 2, 12, block_C174},
+    {0xC150, 1, 0, block_C150},
+    {0xC14D, 1, 0, block_C14D},
+    {0xC17E, 4, 39, block_C17E},
+    {0xC178, 1, 0, block_C178},
+    {0xC072, 7, 63, block_C072},
+    {0xC1A1, 13, 141, block_C1A1},
+    {0xC187, 4, 39, block_C187},
+    {0xC17B, 1, 0, block_C17B},
+    {0xC184, 1, 0, block_C184},
+    {0xC18F, 4, 33, block_C18F},
+    {0xC199, 2, 12, block_C199},
+    {0xC197, 3, 21, block_C197},
+    {0xC19E, 1, 0, block_C19E},
+};
+}
+
+/*****************************************************************************/
+extern "C" const RecompiledModule NYRA_NES_RECOMPILED_SYMBOL =
+{
+    RECOMPILED_ABI_VERSION,
+    0x5999D1C3BB85BC49ULL,
+    BLOCKS,
+    sizeof(BLOCKS) / sizeof(BLOCKS[0])
+};
@@ -0,0 +1,591 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include "StaticRecompiler.h"
+#include <cstdio>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+/*****************************************************************************/
+static const uint16_t VECTORS[] = {0xFFFA, 0xFFFC, 0xFFFE};
+static const size_t RAM_END = 0x2000;
+static const size_t ROM_START = 0x8000;
+static const size_t ADDRESS_END = 0x10000;
+static const size_t MAX_INDEX = 0xFF;
+static const size_t PPU_CYCLES_PER_CYCLE = 3;
+
+/*****************************************************************************/
+std::string toHex(size_t value, size_t digits)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "0x%0*zX",
+                  static_cast<int>(digits), value);
+    return buffer;
+}
+
+/*****************************************************************************/
+bool isBranch(uint8_t opcode)
+{
+    return (opcode & 0x1F) == 0x10;
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+namespace aot
+{
+/*****************************************************************************/
+StaticRecompiler::StaticRecompiler(const std::string& pathname) :
+    mPathname(pathname),
+    mEmulator(pathname, CPU::OPCODE_CORE),
+    mMemory(mEmulator.getMemoryMap()),
+    mStart(0),
+    mLoops(false),
+    mUsesPRG(false),
+    mNumBlocks(0),
+    mNumInstructions(0)
+{
+    // The generated code assumes ROM never moves.
+    if (mEmulator.getCartridge().getHeader().getMapperNumber() != 0)
+    {
+        throw std::runtime_error(
+                "Only NROM (mapper 0) cartridges can be recompiled");
+    }
+}
+
+/*****************************************************************************/
+void StaticRecompiler::generate(std::ostream& stream)
+{
+    mFunctions.str("");
+    mBlocks.str("");
+    mUsesPRG = false;
+    mNumBlocks = 0;
+    mNumInstructions = 0;
+
+    std::vector<bool> visited(ADDRESS_END, false);
+    std::deque<uint16_t> pending;
+    for (size_t ii = 0; ii < sizeof(VECTORS) / sizeof(VECTORS[0]); ++ii)
+    {
+        pending.push_back(mMemory.readShort(VECTORS[ii]));
+    }
+
+    BlockCache::Block block;
+    while (!pending.empty())
+    {
+        const uint16_t address = pending.front();
+        pending.pop_front();
+        if (address < ROM_START || visited[address] ||
+            !mBlockCache.lookUp(address, mMemory, block))
+        {
+            continue;
+        }
+        visited[address] = true;
+
+        if (compileBlock(address, block))
+        {
+            ++mNumBlocks;
+        }
+
+        // Follow everything the last instruction can reach. Blocks that
+        // were cut short by their size or a page end carry on in the next
+        // block.
+        uint16_t next = address;
+        for (size_t ii = 0; ii < block.size; ++ii)
+        {
+            next += block.instructions[ii].length;
+        }
+        const CPUArgs& last = block.instructions[block.size - 1].args;
+        if (isBranch(last.opcode))
+        {
+            pending.push_back(next + static_cast<int8_t>(last.arg1));
+            pending.push_back(next);
+        }
+        else if (last.opcode == 0x20)
+        {
+            pending.push_back(last.darg);
+            pending.push_back(next);
+        }
+        else if (last.opcode == 0x4C)
+        {
+            pending.push_back(last.darg);
+        }
+        else if (last.opcode != 0x40 && last.opcode != 0x60 &&
+                 last.opcode != 0x6C)
+        {
+            pending.push_back(next);
+        }
+    }
+
+    if (mNumBlocks == 0)
+    {
+        throw std::runtime_error("No code could be recompiled: " +
+                                 mPathname);
+    }
+
+    stream << "// Generated by nes_aot from " << mPathname << "\n"
+           << "// Do not edit.\n"
+           << "#include <nes/Recompiled6502.hpp>\n\n"
+           << "using namespace nyra::nes;\n\n"
+           << "namespace\n{\n";
+    if (mUsesPRG)
+    {
+        stream << "/*****************************************************"
+                  "************************/\n"
+               << "static const uint8_t PRG[] =\n{";
+        for (size_t address = ROM_START; address < ADDRESS_END; ++address)
+        {
+            stream << ((address % 16) ? " " : "\n    ")
+                   << toHex(mMemory.readByte(address), 2)
+                   << (address + 1 < ADDRESS_END ? "," : "");
+        }
+        stream << "\n};\n\n";
+    }
+    stream << mFunctions.str()
+           << "/*****************************************************"
+              "************************/\n"
+           << "static const RecompiledBlock BLOCKS[] =\n{\n"
+           << mBlocks.str()
+           << "};\n}\n\n"
+           << "/*****************************************************"
+              "************************/\n"
+           << "extern \"C\" const RecompiledModule "
+              "NYRA_NES_RECOMPILED_SYMBOL =\n{\n"
+           << "    RECOMPILED_ABI_VERSION,\n"
+           << "    " << toHex(mEmulator.getCartridge().getHash(), 16)
+           << "ULL,\n"
+           << "    BLOCKS,\n"
+           << "    sizeof(BLOCKS) / sizeof(BLOCKS[0])\n"
+           << "};\n";
+}
+
+/*****************************************************************************/
+bool StaticRecompiler::compileBlock(uint16_t address,
+                                    const BlockCache::Block& block)
+{
+    mBody.str("");
+    mStart = address;
+    mLoops = false;
+
+    // The budget is the worst case time of everything but the last
+    // instruction, the same as the JIT.
+    size_t size = 0;
+    uint64_t budget = 0;
+    uint64_t lastTime = 0;
+    uint16_t programCounter = address;
+    bool exited = false;
+    while (size < block.size && !exited)
+    {
+        const BlockCache::Instruction& instruction =
+                block.instructions[size];
+        if (!compileInstruction(instruction, programCounter,
+                                budget + lastTime, exited))
+        {
+            break;
+        }
+
+        budget += lastTime;
+        lastTime = (instruction.cycles + 1) * PPU_CYCLES_PER_CYCLE;
+        programCounter += instruction.length;
+        ++size;
+    }
+
+    if (size == 0)
+    {
+        return false;
+    }
+    if (!exited)
+    {
+        mBody << "    return s.exit(" << toHex(programCounter, 4)
+              << ", cycles);\n";
+    }
+
+    const std::string name = "block_" + toHex(address, 4).substr(2);
+    mFunctions << "/*****************************************************"
+                  "************************/\n"
+               << "uint32_t " << name << "(NativeContext* context)\n"
+               << "{\n"
+               << "    RecompiledState s(context);\n"
+               << "    uint32_t cycles = 0;\n"
+               << (mLoops ? "loop:\n" : "")
+               << mBody.str()
+               << "}\n\n";
+    mBlocks << "    {" << toHex(address, 4) << ", " << size << ", "
+            << budget << ", " << name << "},\n";
+    mNumInstructions += size;
+    return true;
+}
+
+/*****************************************************************************/
+bool StaticRecompiler::compileInstruction(
+        const BlockCache::Instruction& instruction,
+        uint16_t address,
+        uint64_t budget,
+        bool& exited)
+{
+    const CPUArgs& args = instruction.args;
+    const Encoding* encoding = findEncoding(args.opcode);
+    if (!encoding)
+    {
+        return false;
+    }
+
+    // Check everything that can fail before writing anything.
+    const AddressMode mode = encoding->mode;
+    const Operation operation = encoding->operation;
+    const bool stores = operation == OP_STA || operation == OP_STX ||
+                        operation == OP_STY;
+    const bool modifies = (operation >= OP_ASL && operation <= OP_DEC) &&
+                          mode != MODE_IMPLIED;
+    if (mode != MODE_IMPLIED && mode != MODE_IMMEDIATE &&
+        operation != OP_JSR && operation != OP_JMP &&
+        !((stores || modifies) ? canWrite(args, mode) : canRead(args, mode)))
+    {
+        return false;
+    }
+
+    mBody << "    // " << toHex(address, 4).substr(2) << ": "
+          << OP_CODE_INFO[args.opcode].name;
+    for (size_t ii = 1; ii < instruction.length; ++ii)
+    {
+        mBody << " " << toHex(ii == 1 ? args.arg1 : args.arg2, 2).substr(2);
+    }
+    mBody << "\n    cycles += "
+          << instruction.cycles * PPU_CYCLES_PER_CYCLE << ";\n";
+
+    // Fetch the operand first, it can add a page crossing cycle.
+    std::string operand;
+    if (operation <= OP_BIT && !stores)
+    {
+        operand = getOperand(args, mode);
+    }
+
+    static const char* const REGISTERS[] = {"s.a", "s.x", "s.y"};
+    switch (operation)
+    {
+    case OP_LDA:
+    case OP_LDX:
+    case OP_LDY:
+        mBody << "    " << REGISTERS[operation - OP_LDA] << " = s.zeroSign("
+              << operand << ");\n";
+        break;
+    case OP_STA:
+    case OP_STX:
+    case OP_STY:
+        mBody << "    s.write(" << getAddress(args, mode) << ", "
+              << REGISTERS[operation - OP_STA] << ");\n";
+        break;
+    case OP_ORA:
+    case OP_AND:
+    case OP_EOR:
+    {
+        static const char* const OPERATORS[] = {" | ", " & ", " ^ "};
+        mBody << "    s.a = s.zeroSign(s.a" << OPERATORS[operation - OP_ORA]
+              << operand << ");\n";
+        break;
+    }
+    case OP_ADC:
+        mBody << "    s.adc(" << operand << ");\n";
+        break;
+    case OP_SBC:
+        mBody << "    s.adc(" << operand << " ^ 0xFF);\n";
+        break;
+    case OP_CMP:
+    case OP_CPX:
+    case OP_CPY:
+        mBody << "    s.compare(" << REGISTERS[operation - OP_CMP] << ", "
+              << operand << ");\n";
+        break;
+    case OP_BIT:
+        mBody << "    s.bit(" << operand << ");\n";
+        break;
+    case OP_ASL:
+    case OP_LSR:
+    case OP_ROL:
+    case OP_ROR:
+    case OP_INC:
+    case OP_DEC:
+    {
+        static const char* const MODIFIERS[] =
+        {
+            "s.asl(", "s.lsr(", "s.rol(", "s.ror(",
+            "s.zeroSign(static_cast<uint8_t>(",
+            "s.zeroSign(static_cast<uint8_t>("
+        };
+        static const char* const SUFFIXES[] =
+        {
+            ")", ")", ")", ")", " + 1))", " - 1))"
+        };
+        const size_t index = operation - OP_ASL;
+        if (mode == MODE_IMPLIED)
+        {
+            mBody << "    s.a = " << MODIFIERS[index] << "s.a"
+                  << SUFFIXES[index] << ";\n";
+        }
+        else
+        {
+            mBody << "    {\n"
+                  << "        const uint16_t address = "
+                  << getAddress(args, mode) << ";\n"
+                  << "        s.write(address, " << MODIFIERS[index]
+                  << "s.read(address)" << SUFFIXES[index] << ");\n"
+                  << "    }\n";
+        }
+        break;
+    }
+    case OP_INX:
+    case OP_INY:
+    case OP_DEX:
+    case OP_DEY:
+    {
+        const char* reg = (operation == OP_INX || operation == OP_DEX) ?
+                "s.x" : "s.y";
+        const char* step = (operation == OP_INX || operation == OP_INY) ?
+                " + 1" : " - 1";
+        mBody << "    " << reg << " = s.zeroSign(static_cast<uint8_t>("
+              << reg << step << "));\n";
+        break;
+    }
+    case OP_TAX:
+        mBody << "    s.x = s.zeroSign(s.a);\n";
+        break;
+    case OP_TAY:
+        mBody << "    s.y = s.zeroSign(s.a);\n";
+        break;
+    case OP_TXA:
+        mBody << "    s.a = s.zeroSign(s.x);\n";
+        break;
+    case OP_TYA:
+        mBody << "    s.a = s.zeroSign(s.y);\n";
+        break;
+    case OP_TSX:
+        mBody << "    s.x = s.zeroSign(s.s);\n";
+        break;
+    case OP_TXS:
+        mBody << "    s.s = s.x;\n";
+        break;
+    case OP_CLC:
+        mBody << "    s.setFlag(CARRY, false);\n";
+        break;
+    case OP_SEC:
+        mBody << "    s.setFlag(CARRY, true);\n";
+        break;
+    case OP_SEI:
+        mBody << "    s.setFlag(INTERRUPT, true);\n";
+        break;
+    case OP_CLV:
+        mBody << "    s.setFlag(OFLOW, false);\n";
+        break;
+    case OP_CLD:
+        mBody << "    s.setFlag(DECIMAL, false);\n";
+        break;
+    case OP_SED:
+        mBody << "    s.setFlag(DECIMAL, true);\n";
+        break;
+    case OP_PHA:
+        mBody << "    s.push(s.a);\n";
+        break;
+    case OP_PHP:
+        mBody << "    s.push(s.p | (1 << STACK));\n";
+        break;
+    case OP_PLA:
+        mBody << "    s.a = s.zeroSign(s.pop());\n";
+        break;
+    case OP_PLP:
+        mBody << "    s.p = (s.pop() | (1 << IGNORE)) & ~(1 << STACK);\n";
+        break;
+    case OP_JSR:
+    {
+        const uint16_t returnAddress = address + 2;
+        mBody << "    s.push(" << toHex(returnAddress >> 8, 2) << ");\n"
+              << "    s.push(" << toHex(returnAddress & 0xFF, 2) << ");\n"
+              << "    return s.exit(" << toHex(args.darg, 4)
+              << ", cycles);\n";
+        exited = true;
+        break;
+    }
+    case OP_RTS:
+        mBody << "    {\n"
+              << "        const uint16_t low = s.pop();\n"
+              << "        const uint16_t high = s.pop();\n"
+              << "        return s.exit(((high << 8) | low) + 1, cycles);\n"
+              << "    }\n";
+        exited = true;
+        break;
+    case OP_JMP:
+        writeBranch(args.darg, budget, "    ");
+        exited = true;
+        break;
+    case OP_BPL:
+    case OP_BMI:
+    case OP_BVC:
+    case OP_BVS:
+    case OP_BCC:
+    case OP_BCS:
+    case OP_BNE:
+    case OP_BEQ:
+    {
+        // The branches come in pairs, clear then set, for each flag.
+        static const char* const FLAGS[] = {"SIGN", "OFLOW", "CARRY", "ZERO"};
+        const size_t branch = operation - OP_BPL;
+        mBody << "    if (" << ((branch & 1) ? "" : "!") << "s.flag("
+              << FLAGS[branch >> 1] << "))\n"
+              << "    {\n"
+              << "        cycles += " << PPU_CYCLES_PER_CYCLE << ";\n";
+        writeBranch(address + 2 + static_cast<int8_t>(args.arg1), budget,
+                    "        ");
+        mBody << "    }\n"
+              << "    return s.exit(" << toHex(address + 2, 4)
+              << ", cycles);\n";
+        exited = true;
+        break;
+    }
+    case OP_NOP:
+        break;
+    }
+    return true;
+}
+
+/*****************************************************************************/
+bool StaticRecompiler::canRead(const CPUArgs& args, AddressMode mode) const
+{
+    switch (mode)
+    {
+    case MODE_ZERO_PAGE:
+    case MODE_ZERO_PAGE_X:
+    case MODE_ZERO_PAGE_Y:
+        return true;
+    case MODE_ABSOLUTE:
+        return args.darg < RAM_END || args.darg >= ROM_START;
+    case MODE_ABSOLUTE_X:
+    case MODE_ABSOLUTE_Y:
+        // Any index has to stay in RAM or in ROM.
+        return args.darg + MAX_INDEX < RAM_END ||
+                (args.darg >= ROM_START &&
+                 args.darg + MAX_INDEX < ADDRESS_END);
+    default:
+        return false;
+    }
+}
+
+/*****************************************************************************/
+bool StaticRecompiler::canWrite(const CPUArgs& args, AddressMode mode) const
+{
+    switch (mode)
+    {
+    case MODE_ZERO_PAGE:
+    case MODE_ZERO_PAGE_X:
+    case MODE_ZERO_PAGE_Y:
+        return true;
+    case MODE_ABSOLUTE:
+        return args.darg < RAM_END;
+    case MODE_ABSOLUTE_X:
+    case MODE_ABSOLUTE_Y:
+        return args.darg + MAX_INDEX < RAM_END;
+    default:
+        return false;
+    }
+}
+
+/*****************************************************************************/
+std::string StaticRecompiler::getAddress(const CPUArgs& args,
+                                         AddressMode mode) const
+{
+    switch (mode)
+    {
+    case MODE_ZERO_PAGE:
+        return toHex(args.arg1, 2);
+    case MODE_ZERO_PAGE_X:
+        // Indexing wraps inside of the zero page
+        return "static_cast<uint8_t>(" + toHex(args.arg1, 2) + " + s.x)";
+    case MODE_ZERO_PAGE_Y:
+        return "static_cast<uint8_t>(" + toHex(args.arg1, 2) + " + s.y)";
+    case MODE_ABSOLUTE:
+        return toHex(args.darg, 4);
+    case MODE_ABSOLUTE_X:
+        return toHex(args.darg, 4) + " + s.x";
+    case MODE_ABSOLUTE_Y:
+        return toHex(args.darg, 4) + " + s.y";
+    default:
+        throw std::runtime_error("Address mode has no address");
+    }
+}
+
+/*****************************************************************************/
+std::string StaticRecompiler::getOperand(const CPUArgs& args,
+                                         AddressMode mode)
+{
+    if (mode == MODE_IMMEDIATE)
+    {
+        return toHex(args.arg1, 2);
+    }
+
+    // Reads take an extra cycle when the index crosses a page.
+    if (mode == MODE_ABSOLUTE_X || mode == MODE_ABSOLUTE_Y)
+    {
+        mBody << "    cycles += ((" << toHex(args.arg1, 2) << " + "
+              << (mode == MODE_ABSOLUTE_X ? "s.x" : "s.y") << ") >> 8) * "
+              << PPU_CYCLES_PER_CYCLE << ";\n";
+    }
+
+    if ((mode == MODE_ABSOLUTE || mode == MODE_ABSOLUTE_X ||
+         mode == MODE_ABSOLUTE_Y) && args.darg >= ROM_START)
+    {
+        // ROM cannot change, so a fixed address is folded away.
+        if (mode == MODE_ABSOLUTE)
+        {
+            return toHex(mMemory.readByte(args.darg), 2);
+        }
+        mUsesPRG = true;
+        return "PRG[" + toHex(args.darg - ROM_START, 4) +
+                (mode == MODE_ABSOLUTE_X ? " + s.x]" : " + s.y]");
+    }
+    return "s.read(" + getAddress(args, mode) + ")";
+}
+
+/*****************************************************************************/
+void StaticRecompiler::writeBranch(uint16_t target,
+                                   uint64_t budget,
+                                   const std::string& indent)
+{
+    // The block loops on itself. Go around again if the interpreter
+    // would have run the whole block before reaching the target clock.
+    if (target == mStart)
+    {
+        mBody << indent << "if (cycles + " << budget
+              << " < context->remaining)\n"
+              << indent << "{\n"
+              << indent << "    goto loop;\n"
+              << indent << "}\n";
+        mLoops = true;
+    }
+    mBody << indent << "return s.exit(" << toHex(target, 4)
+          << ", cycles);\n";
+}
+}
+}
+}
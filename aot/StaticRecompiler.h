@@ -0,0 +1,133 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_AOT_STATIC_RECOMPILER_H__
+#define __NYRA_NES_AOT_STATIC_RECOMPILER_H__
+
+#include <stdint.h>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <nes/BlockCache.h>
+#include <nes/Emulator.h>
+#include <nes/Encoding6502.h>
+#include <nes/OpCode.h>
+
+namespace nyra
+{
+namespace nes
+{
+namespace aot
+{
+/*
+ *  \class - StaticRecompiler
+ *  \brief - Translates the code of an NROM cartridge into C++ ahead of
+ *           time. Code is found by following every branch, jump and call
+ *           from the reset, NMI and IRQ vectors. Each block, as decoded by
+ *           the BlockCache, becomes a function with the same contract as
+ *           the JIT: it covers the block up to the first instruction it
+ *           cannot handle and loops on itself while the clock allows it.
+ *
+ *           Reads from ROM are resolved at generation time. RAM is
+ *           reached through the NativeContext. Anything touching
+ *           registers, indirect addresses and code reached through jump
+ *           tables or RTI is left to the interpreter.
+ */
+class StaticRecompiler
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Loads the cartridge to recompile.
+     *
+     *  \param pathname - The full path of the ROM file on disk.
+     *  \throw - If the cartridge does not use mapper 0.
+     */
+    StaticRecompiler(const std::string& pathname);
+
+    /*
+     *  \func - generate
+     *  \brief - Writes the C++ source of the module. It only depends on
+     *           the Recompiled6502.hpp header.
+     *
+     *  \throw - If no code could be recompiled.
+     */
+    void generate(std::ostream& stream);
+
+    /*
+     *  \func - getNumBlocks
+     *  \brief - Returns the number of blocks written by generate.
+     */
+    inline size_t getNumBlocks() const
+    {
+        return mNumBlocks;
+    }
+
+    /*
+     *  \func - getNumInstructions
+     *  \brief - Returns the number of instructions written by generate.
+     */
+    inline size_t getNumInstructions() const
+    {
+        return mNumInstructions;
+    }
+
+private:
+    bool compileBlock(uint16_t address,
+                      const BlockCache::Block& block);
+
+    bool compileInstruction(const BlockCache::Instruction& instruction,
+                            uint16_t address,
+                            uint64_t budget,
+                            bool& exited);
+
+    bool canRead(const CPUArgs& args, AddressMode mode) const;
+
+    bool canWrite(const CPUArgs& args, AddressMode mode) const;
+
+    std::string getAddress(const CPUArgs& args, AddressMode mode) const;
+
+    std::string getOperand(const CPUArgs& args, AddressMode mode);
+
+    void writeBranch(uint16_t target,
+                     uint64_t budget,
+                     const std::string& indent);
+
+    const std::string mPathname;
+    Emulator mEmulator;
+    MemoryMap& mMemory;
+    BlockCache mBlockCache;
+    std::ostringstream mFunctions;
+    std::ostringstream mBlocks;
+    std::ostringstream mBody;
+    uint16_t mStart;
+    bool mLoops;
+    bool mUsesPRG;
+    size_t mNumBlocks;
+    size_t mNumInstructions;
+};
+}
+}
+}
+
+#endif
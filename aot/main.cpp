@@ -0,0 +1,73 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include "StaticRecompiler.h"
+
+using namespace nyra::nes::aot;
+
+namespace
+{
+/*****************************************************************************/
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " ROM OUTPUT\n"
+              << "Writes C++ for the code in an NROM cartridge. Build it as "
+                 "a shared library and\n"
+              << "put it in a directory listed in NYRA_NES_AOT_PATH.\n";
+}
+}
+
+/*****************************************************************************/
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        StaticRecompiler recompiler(argv[1]);
+        std::ofstream stream(argv[2]);
+        if (!stream.good())
+        {
+            throw std::runtime_error(std::string("Failed to open file: ") +
+                                     argv[2]);
+        }
+        recompiler.generate(stream);
+        std::cerr << "Recompiled " << recompiler.getNumInstructions()
+                  << " instructions in " << recompiler.getNumBlocks()
+                  << " blocks" << std::endl;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Recompile failed: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
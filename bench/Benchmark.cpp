@@ -0,0 +1,126 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+/*****************************************************************************/
+static const size_t WARMUP_BATCHES = 3;
+
+/*****************************************************************************/
+volatile uint64_t gSink = 0;
+
+/*****************************************************************************/
+double percentile(const std::vector<double>& sorted,
+                  double fraction)
+{
+    const size_t index = static_cast<size_t>(
+            std::ceil(fraction * sorted.size())) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+namespace bench
+{
+/*****************************************************************************/
+void doNotOptimize(uint64_t value)
+{
+    gSink = gSink + value;
+}
+
+/*****************************************************************************/
+BenchmarkRunner::BenchmarkRunner(size_t samples,
+                                 const std::string& filter) :
+    mSamples(std::max(samples, static_cast<size_t>(1))),
+    mFilter(filter)
+{
+}
+
+/*****************************************************************************/
+void BenchmarkRunner::run(const std::string& name,
+                          const std::string& unit,
+                          size_t itemsPerBatch,
+                          const std::function<void()>& batch)
+{
+    if (name.find(mFilter) == std::string::npos)
+    {
+        return;
+    }
+
+    for (size_t ii = 0; ii < WARMUP_BATCHES; ++ii)
+    {
+        batch();
+    }
+
+    std::vector<double> times(mSamples);
+    for (size_t ii = 0; ii < mSamples; ++ii)
+    {
+        const std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+        batch();
+        const std::chrono::steady_clock::time_point end =
+                std::chrono::steady_clock::now();
+        times[ii] = std::chrono::duration<double, std::nano>(
+                end - start).count() / itemsPerBatch;
+    }
+    std::sort(times.begin(), times.end());
+
+    Result result;
+    result.name = name;
+    result.unit = unit;
+    result.itemsPerBatch = itemsPerBatch;
+    result.minNs = times.front();
+    result.medianNs = percentile(times, 0.5);
+    result.p99Ns = percentile(times, 0.99);
+    mResults.push_back(result);
+}
+
+/*****************************************************************************/
+void BenchmarkRunner::writeJSON(std::ostream& stream) const
+{
+    stream << "{\n  \"samples\": " << mSamples
+           << ",\n  \"benchmarks\": [";
+    for (size_t ii = 0; ii < mResults.size(); ++ii)
+    {
+        const Result& result = mResults[ii];
+        stream << (ii ? ",\n" : "\n")
+               << "    {\"name\": \"" << result.name << "\""
+               << ", \"unit\": \"" << result.unit << "\""
+               << ", \"items_per_batch\": " << result.itemsPerBatch
+               << ", \"min_ns\": " << result.minNs
+               << ", \"median_ns\": " << result.medianNs
+               << ", \"p99_ns\": " << result.p99Ns << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+}
+}
+}
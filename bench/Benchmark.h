@@ -0,0 +1,105 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_BENCH_BENCHMARK_H__
+#define __NYRA_NES_BENCH_BENCHMARK_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+
+namespace nyra
+{
+namespace nes
+{
+namespace bench
+{
+/*
+ *  \class - BenchmarkRunner
+ *  \brief - Times small pieces of the emulator and reports the results as
+ *           JSON. Each benchmark is a function that runs one batch of work.
+ *           The batch is timed many times and the min, median and 99th
+ *           percentile time per item are reported.
+ */
+class BenchmarkRunner
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Sets up how every benchmark is sampled.
+     *
+     *  \param samples - The number of timed batches per benchmark.
+     *  \param filter - Only benchmarks with this text in their name are
+     *         run. An empty filter runs everything.
+     */
+    BenchmarkRunner(size_t samples,
+                    const std::string& filter);
+
+    /*
+     *  \func - run
+     *  \brief - Times a benchmark and stores the result.
+     *
+     *  \param name - The name of the benchmark, "group/name".
+     *  \param unit - What a single item is (instruction, byte, frame).
+     *  \param itemsPerBatch - The number of items one call to batch does.
+     *  \param batch - The work to time.
+     */
+    void run(const std::string& name,
+             const std::string& unit,
+             size_t itemsPerBatch,
+             const std::function<void()>& batch);
+
+    /*
+     *  \func - writeJSON
+     *  \brief - Writes every result as a JSON document.
+     */
+    void writeJSON(std::ostream& stream) const;
+
+private:
+    struct Result
+    {
+        std::string name;
+        std::string unit;
+        size_t itemsPerBatch;
+        double minNs;
+        double medianNs;
+        double p99Ns;
+    };
+
+    const size_t mSamples;
+    const std::string mFilter;
+    std::vector<Result> mResults;
+};
+
+/*
+ *  \func - doNotOptimize
+ *  \brief - Keeps the compiler from throwing away a computed value.
+ */
+void doNotOptimize(uint64_t value);
+}
+}
+}
+
+#endif
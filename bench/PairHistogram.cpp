@@ -0,0 +1,137 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include "PairHistogram.h"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <nes/Interpreter6502.hpp>
+#include <nes/OpCode.h>
+
+namespace
+{
+/*****************************************************************************/
+static const size_t NUM_PAIRS = 256 * 256;
+
+/*****************************************************************************/
+// Jumps and branches have no length in OP_CODE_INFO because they set the
+// program counter themselves, so use the bytes the instruction takes.
+size_t getLength(uint8_t opcode)
+{
+    const nyra::nes::OpCodeInfo& info = nyra::nes::OP_CODE_INFO[opcode];
+    return 1 + info.usesArg1 + info.usesArg2;
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+namespace bench
+{
+/*****************************************************************************/
+PairHistogram::PairHistogram() :
+    mCounts(NUM_PAIRS),
+    mInstructions(0),
+    mPairs(0),
+    mLast()
+{
+}
+
+/*****************************************************************************/
+void PairHistogram::add(const TraceBuffer& trace)
+{
+    if (trace.getTotal() > trace.getCapacity())
+    {
+        throw std::runtime_error("Trace buffer dropped records");
+    }
+
+    for (size_t ii = 0; ii < trace.getSize(); ++ii)
+    {
+        const TraceRecord& record = trace.get(ii);
+        const size_t next = (mLast.programCounter +
+                getLength(mLast.opcode)) & 0xFFFF;
+        if (mInstructions && record.programCounter == next)
+        {
+            ++mCounts[(mLast.opcode << 8) | record.opcode];
+            ++mPairs;
+        }
+        mLast = record;
+        ++mInstructions;
+    }
+}
+
+/*****************************************************************************/
+void PairHistogram::writeJSON(std::ostream& stream,
+                              size_t limit) const
+{
+    std::vector<size_t> pairs;
+    for (size_t ii = 0; ii < NUM_PAIRS; ++ii)
+    {
+        if (mCounts[ii])
+        {
+            pairs.push_back(ii);
+        }
+    }
+
+    // Ties keep opcode order so the output is the same on every run.
+    std::stable_sort(pairs.begin(), pairs.end(),
+                     [this](size_t first, size_t second)
+                     {
+                         return mCounts[first] > mCounts[second];
+                     });
+    pairs.resize(std::min(limit, pairs.size()));
+
+    stream << "{\n  \"instructions\": " << mInstructions
+           << ",\n  \"straight_line_pairs\": " << mPairs
+           << ",\n  \"pairs\": [";
+    for (size_t ii = 0; ii < pairs.size(); ++ii)
+    {
+        const uint8_t first = static_cast<uint8_t>(pairs[ii] >> 8);
+        const uint8_t second = static_cast<uint8_t>(pairs[ii]);
+        const uint64_t count = mCounts[pairs[ii]];
+
+        char text[64];
+        std::snprintf(text, sizeof(text),
+                      "\"first\": \"%02X\", \"second\": \"%02X\"",
+                      first, second);
+        char percent[16];
+        std::snprintf(percent, sizeof(percent), "%.2f",
+                      100.0 * count / mPairs);
+
+        stream << (ii ? ",\n" : "\n")
+               << "    {" << text
+               << ", \"names\": \"" << OP_CODE_INFO[first].name << " "
+               << OP_CODE_INFO[second].name << "\""
+               << ", \"count\": " << count
+               << ", \"percent\": " << percent
+               << ", \"fused\": "
+               << (Interpreter6502::findFusion(first, second) !=
+                       Interpreter6502::FUSE_NONE ? "true" : "false")
+               << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+}
+}
+}
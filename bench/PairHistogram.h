@@ -0,0 +1,87 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_BENCH_PAIR_HISTOGRAM_H__
+#define __NYRA_NES_BENCH_PAIR_HISTOGRAM_H__
+
+#include <stdint.h>
+#include <vector>
+#include <ostream>
+#include <nes/Trace.h>
+
+namespace nyra
+{
+namespace nes
+{
+namespace bench
+{
+/*
+ *  \class - PairHistogram
+ *  \brief - Counts how often each opcode runs straight after another,
+ *           which is what the superinstructions in Interpreter6502 are
+ *           picked from. Only straight line pairs are counted, where the
+ *           second instruction directly follows the first in memory.
+ *           Those are the only pairs the block decoder can fuse.
+ */
+class PairHistogram
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Starts with every count at zero.
+     */
+    PairHistogram();
+
+    /*
+     *  \func - add
+     *  \brief - Counts the records held in a trace buffer, oldest first.
+     *           The last record is kept, so a pair split across two
+     *           buffers is still counted.
+     *
+     *  \param trace - The instructions that ran.
+     *  \throw - If the buffer dropped records because it was full.
+     */
+    void add(const TraceBuffer& trace);
+
+    /*
+     *  \func - writeJSON
+     *  \brief - Writes the most common pairs as a JSON document, most
+     *           common first. Each pair says if it is already fused.
+     *
+     *  \param stream - The stream to write to.
+     *  \param limit - The number of pairs to write.
+     */
+    void writeJSON(std::ostream& stream,
+                   size_t limit) const;
+
+private:
+    std::vector<uint64_t> mCounts;
+    uint64_t mInstructions;
+    uint64_t mPairs;
+    TraceRecord mLast;
+};
+}
+}
+}
+
+#endif
@@ -0,0 +1,402 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <nes/Emulator.h>
+#include <nes/CPU.h>
+#include <nes/Trace.h>
+#include "Benchmark.h"
+#include "PairHistogram.h"
+
+#ifndef NES_BENCH_ROM
+#define NES_BENCH_ROM "python/test/nestest.nes"
+#endif
+
+#ifndef NES_BENCH_AOT
+#define NES_BENCH_AOT ""
+#endif
+
+using namespace nyra::nes;
+using namespace nyra::nes::bench;
+
+namespace
+{
+/*****************************************************************************/
+static const size_t DEFAULT_SAMPLES = 200;
+static const size_t WARMUP_FRAMES = 60;
+static const size_t DEFAULT_PAIR_FRAMES = 600;
+static const size_t PAIR_LIMIT = 40;
+
+// Start is held for a few frames so test ROMs get past their menu.
+static const size_t START_FIRST_FRAME = 5;
+static const size_t START_LAST_FRAME = 10;
+
+// More than the instructions a frame can run.
+static const size_t TRACE_CAPACITY = 32 * 1024;
+
+/*****************************************************************************/
+// Each program repeats one instruction then jumps back to the start, so a
+// batch is an exact number of clock cycles.
+struct ModeProgram
+{
+    const char* name;
+    uint8_t bytes[3];
+    size_t length;
+    size_t cycles;
+};
+
+static const ModeProgram MODE_PROGRAMS[] =
+{
+    {"implied",        {0xE8},             1, 2}, // INX
+    {"accumulator",    {0x0A},             1, 2}, // ASL A
+    {"immediate",      {0xA9, 0x01},       2, 2}, // LDA #$01
+    {"zero_page",      {0xA5, 0x10},       2, 3}, // LDA $10
+    {"zero_page_x",    {0xB5, 0x10},       2, 4}, // LDA $10,X
+    {"zero_page_y",    {0xB6, 0x10},       2, 4}, // LDX $10,Y
+    {"absolute",       {0xAD, 0x00, 0x03}, 3, 4}, // LDA $0300
+    {"absolute_x",     {0xBD, 0x00, 0x03}, 3, 4}, // LDA $0300,X
+    {"absolute_y",     {0xB9, 0x00, 0x03}, 3, 4}, // LDA $0300,Y
+    {"indirect_x",     {0xA1, 0x10},       2, 6}, // LDA ($10,X)
+    {"indirect_y",     {0xB1, 0x10},       2, 5}, // LDA ($10),Y
+    {"relative",       {0xF0, 0x00},       2, 2}, // BEQ (not taken)
+    {"store_absolute", {0x8D, 0x00, 0x03}, 3, 4}  // STA $0300
+};
+
+static const uint16_t PROGRAM_ADDRESS = 0x0400;
+static const size_t INSTRUCTIONS_PER_LOOP = 128;
+static const size_t LOOPS_PER_BATCH = 16;
+static const size_t JMP_CYCLES = 3;
+static const size_t PPU_CYCLES_PER_CPU_CYCLE = 3;
+
+/*****************************************************************************/
+void benchmarkCPU(BenchmarkRunner& runner,
+                  const std::string& rom,
+                  CPU::Core core,
+                  const std::string& coreName)
+{
+    for (size_t ii = 0;
+         ii < sizeof(MODE_PROGRAMS) / sizeof(MODE_PROGRAMS[0]);
+         ++ii)
+    {
+        const ModeProgram& program = MODE_PROGRAMS[ii];
+        Emulator emulator(rom, core);
+        MemoryMap& memory = emulator.getMemoryMap();
+
+        // ($10) points at $0300 for the indirect modes.
+        memory.writeByte(0x0010, 0x00);
+        memory.writeByte(0x0011, 0x03);
+
+        uint16_t address = PROGRAM_ADDRESS;
+        for (size_t jj = 0; jj < INSTRUCTIONS_PER_LOOP; ++jj)
+        {
+            for (size_t kk = 0; kk < program.length; ++kk)
+            {
+                memory.writeByte(address++, program.bytes[kk]);
+            }
+        }
+        memory.writeByte(address++, 0x4C);
+        memory.writeByte(address++, PROGRAM_ADDRESS & 0xFF);
+        memory.writeByte(address++, PROGRAM_ADDRESS >> 8);
+
+        CPU cpu(PROGRAM_ADDRESS, core);
+        const uint64_t budget = LOOPS_PER_BATCH * PPU_CYCLES_PER_CPU_CYCLE *
+                ((INSTRUCTIONS_PER_LOOP * program.cycles) + JMP_CYCLES);
+        runner.run("cpu/" + coreName + "/" + program.name,
+                   "instruction",
+                   LOOPS_PER_BATCH * (INSTRUCTIONS_PER_LOOP + 1),
+                   [&]()
+                   {
+                       cpu.run(memory, cpu.getInfo().clock + budget);
+                   });
+    }
+}
+
+/*****************************************************************************/
+void benchmarkMemory(BenchmarkRunner& runner,
+                     const std::string& rom)
+{
+    Emulator emulator(rom);
+    emulator.runFrames(WARMUP_FRAMES);
+    MemoryMap& memory = emulator.getMemoryMap();
+
+    struct Range
+    {
+        const char* name;
+        size_t begin;
+        size_t end;
+    };
+    static const Range READS[] =
+    {
+        {"memory/read_ram", 0x0000, 0x0800},
+        {"memory/read_rom", 0x8000, 0x10000},
+        {"memory/read_ppu_registers", 0x2000, 0x2100},
+        {"memory/read_shared_page", 0x4000, 0x4100}
+    };
+
+    for (size_t ii = 0; ii < sizeof(READS) / sizeof(READS[0]); ++ii)
+    {
+        const Range& range = READS[ii];
+        runner.run(range.name, "byte", range.end - range.begin, [&]()
+        {
+            uint64_t sum = 0;
+            for (size_t address = range.begin; address < range.end;
+                 ++address)
+            {
+                sum += memory.readByte(address);
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    // Write above the stack so the RAM the game uses is left alone.
+    runner.run("memory/write_ram", "byte", 0x0600, [&]()
+    {
+        for (size_t address = 0x0200; address < 0x0800; ++address)
+        {
+            memory.writeByte(address, static_cast<uint8_t>(address));
+        }
+    });
+}
+
+/*****************************************************************************/
+void benchmarkPPU(BenchmarkRunner& runner,
+                  const std::string& rom)
+{
+    Emulator emulator(rom);
+    emulator.runFrames(WARMUP_FRAMES);
+    MemoryMap& memory = emulator.getMemoryMap();
+    PPU& ppu = emulator.getPPU();
+    std::vector<uint32_t> buffer(NUM_PIXELS);
+
+    // Spread 64 sprites over the screen and DMA them into OAM.
+    srand(1);
+    for (size_t ii = 0; ii < 256; ii += 4)
+    {
+        memory.writeByte(0x0300 + ii, rand() % SCREEN_HEIGHT);
+        memory.writeByte(0x0301 + ii, rand() & 0xFF);
+        memory.writeByte(0x0302 + ii, rand() & 0xE3);
+        memory.writeByte(0x0303 + ii, rand() & 0xFF);
+    }
+
+    // DMA happens on the next scanline. Run it in vertical blank so
+    // nothing is drawn.
+    CPUInfo blank(0);
+    blank.scanLine = 250;
+    memory.writeByte(0x4014, 0x03);
+    ppu.processScanline(blank, memory, nullptr);
+
+    struct Layers
+    {
+        const char* name;
+        bool background;
+        bool sprites;
+    };
+    static const Layers LAYERS[] =
+    {
+        {"ppu/render_background", true, false},
+        {"ppu/render_sprites", false, true},
+        {"ppu/render_both", true, true}
+    };
+
+    std::bitset<FLAG_SIZE>& mask =
+            ppu.getRegisers().getRegister(PPURegisters::PPUMASK);
+    const std::bitset<FLAG_SIZE> originalMask = mask;
+    for (size_t ii = 0; ii < sizeof(LAYERS) / sizeof(LAYERS[0]); ++ii)
+    {
+        mask[PPURegisters::SHOW_BACKGROUND] = LAYERS[ii].background;
+        mask[PPURegisters::SHOW_SPRITES] = LAYERS[ii].sprites;
+        runner.run(LAYERS[ii].name, "scanline", SCREEN_HEIGHT, [&]()
+        {
+            CPUInfo info(0);
+            for (size_t line = 0; line < SCREEN_HEIGHT; ++line)
+            {
+                info.scanLine = static_cast<int16_t>(line);
+                ppu.processScanline(info, memory, &buffer[0]);
+            }
+        });
+    }
+    mask = originalMask;
+
+    runner.run("ppu/oam_dma", "dma", 1, [&]()
+    {
+        memory.writeByte(0x4014, 0x03);
+        ppu.processScanline(blank, memory, nullptr);
+    });
+}
+
+/*****************************************************************************/
+void benchmarkFrames(BenchmarkRunner& runner,
+                     const std::string& rom,
+                     const std::string& recompiled)
+{
+    std::vector<uint32_t> buffer(NUM_PIXELS);
+
+    Emulator interpreter(rom, CPU::INTERPRETER_CORE);
+    interpreter.runFrames(WARMUP_FRAMES);
+    runner.run("frame/interpreter/headless", "frame", 1, [&]()
+    {
+        interpreter.runFrame();
+    });
+    runner.run("frame/interpreter/rendered", "frame", 1, [&]()
+    {
+        interpreter.runFrame(&buffer[0]);
+    });
+
+    // The CPU programs run from RAM which the JIT never compiles, so it
+    // is only measured on whole frames.
+    Emulator jit(rom, CPU::JIT_CORE);
+    jit.runFrames(WARMUP_FRAMES);
+    runner.run("frame/jit/headless", "frame", 1, [&]()
+    {
+        jit.runFrame();
+    });
+
+    if (!recompiled.empty())
+    {
+        Emulator aot(rom, CPU::INTERPRETER_CORE);
+        aot.loadRecompiled(recompiled);
+        aot.runFrames(WARMUP_FRAMES);
+        runner.run("frame/aot/headless", "frame", 1, [&]()
+        {
+            aot.runFrame();
+        });
+    }
+
+    Emulator opcodes(rom, CPU::OPCODE_CORE);
+    opcodes.runFrames(WARMUP_FRAMES);
+    runner.run("frame/opcode/headless", "frame", 1, [&]()
+    {
+        opcodes.runFrame();
+    });
+}
+
+/*****************************************************************************/
+void countPairs(const std::string& rom,
+                size_t frames)
+{
+    Emulator emulator(rom, CPU::INTERPRETER_CORE);
+    TraceBuffer trace(TRACE_CAPACITY);
+    emulator.getCPU().setTrace(&trace);
+
+    PairHistogram histogram;
+    for (size_t ii = 0; ii < frames; ++ii)
+    {
+        emulator.getController(0).setKey(
+                Controller::BUTTON_START,
+                START_FIRST_FRAME <= ii && ii < START_LAST_FRAME);
+        emulator.runFrame();
+        histogram.add(trace);
+        trace.clear();
+    }
+    histogram.writeJSON(std::cout, PAIR_LIMIT);
+}
+
+/*****************************************************************************/
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program
+              << " [--rom PATH] [--aot PATH] [--samples N]"
+                 " [--filter TEXT]\n"
+              << "       " << program
+              << " --pairs [--rom PATH] [--frames N]\n";
+}
+}
+
+/*****************************************************************************/
+int main(int argc, char** argv)
+{
+    std::string rom = NES_BENCH_ROM;
+    std::string recompiled = NES_BENCH_AOT;
+    bool hasRecompiled = false;
+    size_t samples = DEFAULT_SAMPLES;
+    std::string filter;
+    bool pairs = false;
+    size_t frames = DEFAULT_PAIR_FRAMES;
+
+    for (int ii = 1; ii < argc; ++ii)
+    {
+        const bool hasValue = ii + 1 < argc;
+        if (!std::strcmp(argv[ii], "--rom") && hasValue)
+        {
+            rom = argv[++ii];
+        }
+        else if (!std::strcmp(argv[ii], "--aot") && hasValue)
+        {
+            recompiled = argv[++ii];
+            hasRecompiled = true;
+        }
+        else if (!std::strcmp(argv[ii], "--samples") && hasValue)
+        {
+            samples = std::strtoul(argv[++ii], nullptr, 10);
+        }
+        else if (!std::strcmp(argv[ii], "--filter") && hasValue)
+        {
+            filter = argv[++ii];
+        }
+        else if (!std::strcmp(argv[ii], "--pairs"))
+        {
+            pairs = true;
+        }
+        else if (!std::strcmp(argv[ii], "--frames") && hasValue)
+        {
+            frames = std::strtoul(argv[++ii], nullptr, 10);
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // The default module only matches the default ROM.
+    if (rom != NES_BENCH_ROM && !hasRecompiled)
+    {
+        recompiled.clear();
+    }
+
+    try
+    {
+        if (pairs)
+        {
+            countPairs(rom, frames);
+            return 0;
+        }
+
+        BenchmarkRunner runner(samples, filter);
+        benchmarkCPU(runner, rom, CPU::INTERPRETER_CORE, "interpreter");
+        benchmarkCPU(runner, rom, CPU::OPCODE_CORE, "opcode");
+        benchmarkMemory(runner, rom);
+        benchmarkPPU(runner, rom);
+        benchmarkFrames(runner, rom, recompiled);
+        runner.writeJSON(std::cout);
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Benchmark failed: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
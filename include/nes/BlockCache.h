@@ -0,0 +1,233 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_BLOCK_CACHE_H__
+#define __NYRA_NES_BLOCK_CACHE_H__
+
+#include <stdint.h>
+#include <vector>
+#include <nes/CPUHelper.h>
+#include <nes/MemoryMap.h>
+#include <nes/OpCode.h>
+
+namespace nyra
+{
+namespace nes
+{
+struct NativeBlock;
+
+/*
+ *  \class - BlockCache
+ *  \brief - Holds decoded basic blocks keyed by the address of their first
+ *           instruction. A block is a run of instructions that ends at the
+ *           first branch, jump, call or return, or at the end of a page.
+ *           Each instruction keeps the operands that were fetched for it,
+ *           so running a cached block skips the fetch entirely.
+ *
+ *           Blocks are stored per page of the MemoryMap along with the
+ *           page version they were decoded from. Code decoded from RAM
+ *           marks its page as watched, so writing to the page (or
+ *           switching a bank into it) bumps the version and the page is
+ *           decoded again the next time it runs.
+ */
+class BlockCache
+{
+public:
+    /*
+     *  \struct - Instruction
+     *  \brief - A single decoded instruction. The opcode in args selects
+     *           the handler in the interpreter.
+     */
+    struct Instruction
+    {
+        CPUArgs args;
+        uint8_t length;
+        uint8_t cycles;
+
+        // The Interpreter6502 superinstruction this runs as along with
+        // the next instruction in the block, or FUSE_NONE.
+        uint8_t fusion;
+    };
+
+    /*
+     *  \struct - Block
+     *  \brief - A view of a cached block. It is only good until the next
+     *           call to lookUp. The block must stop running as soon as
+     *           the value at version no longer matches expected.
+     */
+    struct Block
+    {
+        const Instruction* instructions;
+        size_t size;
+        const uint32_t* version;
+        uint32_t expected;
+        const NativeBlock* native;
+        uint8_t* hits;
+
+        // True if the block is a loop that only reads memory and branches
+        // back to its own start, for example polling PPUSTATUS for
+        // VBLANK. It keeps reading the same values until something
+        // outside the CPU changes them.
+        bool poll;
+
+        // True if the block is a loop that stores A through an index
+        // register, steps the register and branches back while it is not
+        // zero, for example clearing RAM with STA $0200,X INX BNE.
+        bool fill;
+    };
+
+    /*
+     *  \func - Constructor
+     *  \brief - Creates an empty cache. The length and base cycles of
+     *           each opcode are taken from OP_CODE_INFO.
+     */
+    BlockCache();
+
+    /*
+     *  \func - lookUp
+     *  \brief - Finds the block starting at an address, decoding it if it
+     *           is not cached yet.
+     *
+     *  \param address - The address of the first instruction.
+     *  \param memory - The memory the code is read from.
+     *  \param block[OUTPUT] - The cached block.
+     *  \return - False if the address cannot be cached. The instruction
+     *            should be fetched and run normally.
+     */
+    inline bool lookUp(uint16_t address,
+                       MemoryMap& memory,
+                       Block& block)
+    {
+        Page& page = mPages[address >> PAGE_SHIFT];
+        const uint32_t* version = memory.getPageVersion(address);
+        if (page.version != version || page.expected != *version)
+        {
+            resetPage(address, memory);
+        }
+
+        const size_t index = address & PAGE_MASK;
+        if (page.starts.empty())
+        {
+            return false;
+        }
+        if (page.starts[index] == NOT_DECODED)
+        {
+            decode(address, memory);
+        }
+        const uint16_t start = page.starts[index];
+        if (start == UNCACHEABLE)
+        {
+            return false;
+        }
+
+        block.instructions = &page.instructions[start];
+        block.size = page.sizes[index];
+        block.version = page.version;
+        block.expected = page.expected;
+        block.native = page.natives[index];
+        block.hits = &page.hits[index];
+        block.poll = page.polls[index] != 0;
+        block.fill = page.fills[index] != 0;
+        return true;
+    }
+
+    /*
+     *  \func - setNative
+     *  \brief - Attaches native code to the block at an address and
+     *           resets its hit count. The address must have been looked
+     *           up successfully since the page was last decoded.
+     *
+     *  \param address - The address of the first instruction.
+     *  \param native - The native code, or nullptr to drop it.
+     */
+    void setNative(uint16_t address, const NativeBlock* native);
+
+    /*
+     *  \func - clearPoll
+     *  \brief - Marks the block at an address as not polling, for example
+     *           a delay loop that counts a register down. The address must
+     *           have been looked up successfully since the page was last
+     *           decoded.
+     */
+    inline void clearPoll(uint16_t address)
+    {
+        mPages[address >> PAGE_SHIFT].polls[address & PAGE_MASK] = 0;
+    }
+
+    /*
+     *  \func - clearNative
+     *  \brief - Drops the native code from every block. This must be
+     *           called before the code they point to is released.
+     */
+    void clearNative();
+
+private:
+    struct Page
+    {
+        Page();
+
+        // The page version the blocks were decoded from. If version is
+        // nullptr nothing has been decoded.
+        const uint32_t* version;
+        uint32_t expected;
+
+        // Index into instructions and number of instructions for the
+        // block at each address. These are empty if the page cannot
+        // hold code.
+        std::vector<uint16_t> starts;
+        std::vector<uint8_t> sizes;
+        std::vector<Instruction> instructions;
+        std::vector<const NativeBlock*> natives;
+        std::vector<uint8_t> hits;
+        std::vector<uint8_t> polls;
+        std::vector<uint8_t> fills;
+    };
+
+    void resetPage(uint16_t address, MemoryMap& memory);
+
+    void decode(uint16_t address, const MemoryMap& memory);
+
+    bool isFill(uint16_t address,
+                const Instruction* instructions,
+                size_t size) const;
+
+    bool isPoll(uint16_t address,
+                const Instruction* instructions,
+                size_t size,
+                const MemoryMap& memory) const;
+
+    static const size_t PAGE_SHIFT = 8;
+    static const size_t PAGE_SIZE = 1 << PAGE_SHIFT;
+    static const size_t PAGE_MASK = PAGE_SIZE - 1;
+    static const size_t NUM_PAGES = 0x10000 >> PAGE_SHIFT;
+    static const size_t MAX_BLOCK_SIZE = 32;
+    static const uint16_t NOT_DECODED = 0xFFFF;
+    static const uint16_t UNCACHEABLE = 0xFFFE;
+
+    bool mEndsBlock[256];
+    std::vector<Page> mPages;
+};
+}
+}
+
+#endif
@@ -27,7 +27,16 @@
 #include <stdint.h>
 #include <nes/MemoryMap.h>
 #include <nes/CPUHelper.h>
+#include <nes/Condition.h>
 #include <nes/OpCode.h>
+#include <memory>
+#include <nes/BlockCache.h>
+#include <nes/Jit6502.h>
+#include <nes/NativeBlock.h>
+#include <nes/RecompiledROM.h>
+#include <nes/SaveState.h>
+#include <nes/Trace.h>
+#include <nes/TracePolicy.h>
 
 namespace nyra
 {
@@ -43,25 +52,174 @@ namespace nes
 class CPU
 {
 public:
+    /*
+     *  \enum - Core
+     *  \brief - The available execution cores. The OpCode core runs each
+     *           instruction through the OpCode and Mode objects and keeps
+     *           their disassembly information up to date. The interpreter
+     *           core decodes and runs each instruction in a single switch
+     *           and is considerably faster. It also caches decoded basic
+     *           blocks so hot loops skip the fetch, and skips ahead to the
+     *           next event when a loop is only polling memory that cannot
+     *           change until then. Loops that clear RAM or fill VRAM are
+     *           run as bulk writes. When the map has a concrete bus,
+     *           such as NROMBus, instructions run against it directly.
+     *           The JIT core is the interpreter core with hot blocks
+     *           recompiled to x86-64. On other hosts it behaves like the
+     *           interpreter core.
+     */
+    enum Core
+    {
+        OPCODE_CORE,
+        INTERPRETER_CORE,
+        JIT_CORE
+    };
+
+    /*
+     *  \enum - Trace
+     *  \brief - Picks the TracePolicy the OpCode core is built with. With
+     *           TRACE_FULL the modes keep everything the disassembly
+     *           shows up to date, which costs extra memory reads. The other
+     *           cores never do that work.
+     */
+    enum Trace
+    {
+        TRACE_NONE,
+        TRACE_FULL
+    };
+
+    /*
+     *  \struct - Stop
+     *  \brief - Where a stepped run stops before its target clock. Every
+     *           instruction is checked, so the run ends on the exact
+     *           instruction that satisfied it.
+     */
+    struct Stop
+    {
+        /*
+         *  \func - Constructor
+         *  \brief - Creates a stop with no limit on instructions and no
+         *           conditions.
+         */
+        Stop();
+
+        // The number of instructions left to run.
+        size_t instructions;
+
+        // Stop once every condition holds. This is not owned.
+        const std::vector<Condition>* conditions;
+
+        // Set when the run ended because of the stop.
+        bool reached;
+    };
+
     /*
      *  \func - Constructor (address)
      *  \brief - Creates a CPU object with a starting memory address.
      *
      *  \param startAddress - The location to start reading opcodes from.
+     *  \param core - The execution core used to run instructions.
+     *  \param trace - What the OpCode core records for disassembly.
      *  TODO: Should this also have a version that takes in a MemoryMap and
      *        resolves the startAddress itself?
      */
-    CPU(uint16_t startAddress);
+    CPU(uint16_t startAddress,
+        Core core = INTERPRETER_CORE,
+        Trace trace = TRACE_NONE);
+
+    /*
+     *  \func - run
+     *  \brief - Services a pending NMI, then runs instructions until the
+     *           master clock reaches the target. The last instruction may
+     *           go past the target, the overshoot is left on the clock.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param targetClock - The master clock time to run to. This is
+     *         normally the time of the next scheduled event.
+     */
+    void run(MemoryMap& memory,
+             uint64_t targetClock);
+
+    /*
+     *  \func - run (stop)
+     *  \brief - Runs like run, but checks the stop after every
+     *           instruction. This single steps, so blocks, native code
+     *           and idle loop skipping are not used.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param targetClock - The master clock time to run to.
+     *  \param stop - Where to stop early. The instruction count is
+     *         reduced by the instructions that ran.
+     *  \return - True if the run stopped before the target.
+     */
+    bool run(MemoryMap& memory,
+             uint64_t targetClock,
+             Stop& stop);
 
     /*
-     *  \func - tick
-     *  \brief - Processes a single opcode.
+     *  \func - runCycles
+     *  \brief - Runs for a number of CPU cycles, moving on through
+     *           scanlines the same way as processScanline. It stops on the
+     *           first instruction boundary at or after the budget. This is
+     *           for driving the CPU without a Scheduler.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param cycles - The number of CPU cycles to run.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runCycles(MemoryMap& memory,
+                       uint64_t cycles);
+
+    /*
+     *  \func - runInstructions
+     *  \brief - Runs an exact number of instructions. Servicing an NMI
+     *           does not count as one.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param count - The number of instructions to run.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runInstructions(MemoryMap& memory,
+                             size_t count);
+
+    /*
+     *  \func - runUntilPC
+     *  \brief - Runs until the next instruction is at an address. At
+     *           least one instruction runs, so this can be called again to
+     *           find the next time the address is reached.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param address - The address to stop at.
+     *  \param maxCycles - Stop after this many CPU cycles if the address
+     *         is not reached.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runUntilPC(MemoryMap& memory,
+                        uint16_t address,
+                        uint64_t maxCycles);
+
+    /*
+     *  \func - runUntil
+     *  \brief - Runs until every condition holds after an instruction.
+     *
+     *  \param memory - All the available memory as swappable banks.
+     *  \param conditions - The conditions to stop on.
+     *  \param maxCycles - Stop after this many CPU cycles if the
+     *         conditions are not met.
+     *  \return - The CPU cycles that ran.
+     *  \throw - If a condition reads memory that is not RAM or ROM.
+     */
+    uint64_t runUntil(MemoryMap& memory,
+                      const std::vector<Condition>& conditions,
+                      uint64_t maxCycles);
+
+    /*
+     *  \func - processScanline
+     *  \brief - Runs the rest of the current scanline and moves on to
+     *           the next one. This is for driving the CPU without a
+     *           Scheduler.
      *
      *  \param memory - All the available memory as swappable banks.
-     *  \param disassembly [OPTIONAL] - Allows you pass in a disassembly
-     *         object which can then be used to view information about
-     *         the processed opcode.
-     *         Remove this to increase performance.
      */
     void processScanline(MemoryMap& memory);
 
@@ -84,12 +242,128 @@ public:
         return mInfo;
     }
 
+    /*
+     *  \func - getRegisters
+     *  \brief - Returns the CPU registers.
+     */
+    inline const CPURegisters& getRegisters() const
+    {
+        return mRegisters;
+    }
+
+    /*
+     *  \func - getCore
+     *  \brief - Returns the execution core this CPU runs with.
+     */
+    inline Core getCore() const
+    {
+        return mCore;
+    }
+
+    /*
+     *  \func - setRecompiled
+     *  \brief - Runs code recompiled ahead of time for the ROM wherever
+     *           it is available. This is ignored by the OpCode core.
+     *
+     *  \param recompiled - The module for the ROM, or nullptr to stop
+     *         using one.
+     */
+    void setRecompiled(
+            const std::shared_ptr<const RecompiledROM>& recompiled);
+
+    /*
+     *  \func - setTrace
+     *  \brief - Records every instruction into a trace buffer before it
+     *           runs. While tracing, the interpreter and JIT cores run
+     *           one instruction at a time without native code or idle
+     *           loop skipping. With no trace buffer none of the tracing
+     *           is compiled into the loops that run.
+     *
+     *  \param trace - The buffer to fill, or nullptr to stop tracing. It
+     *         is not owned and must outlive its use by the CPU.
+     */
+    inline void setTrace(TraceBuffer* trace)
+    {
+        mTrace = trace;
+    }
+
+    /*
+     *  \func - saveState
+     *  \brief - Writes the registers, timing info and the current
+     *           argument latch into a save state.
+     */
+    void saveState(StateWriter& state) const;
+
+    /*
+     *  \func - loadState
+     *  \brief - Restores the CPU from a save state.
+     */
+    void loadState(StateReader& state);
+
 private:
+    template <typename TraceT, bool StepT>
+    void runCore(MemoryMap& memory,
+                 uint64_t targetClock);
+
+    template <typename TraceT, bool StepT>
+    void runOpCodes(MemoryMap& memory,
+                    uint64_t targetClock);
+
+    template <typename TraceT, bool StepT, typename BusT>
+    void runInterpreter(MemoryMap& memory,
+                        BusT& bus,
+                        uint64_t targetClock);
+
+    inline bool isStopped(const MemoryMap& memory,
+                          size_t instructions)
+    {
+        mStop->instructions -= instructions;
+        if (mStop->instructions == 0 ||
+            (mStop->conditions &&
+             testAll(*mStop->conditions, mRegisters, mInfo, memory)))
+        {
+            mStop->reached = true;
+        }
+        return mStop->reached;
+    }
+
+    uint64_t runLines(MemoryMap& memory,
+                      uint64_t targetClock,
+                      Stop* stop);
+
+    void endScanline(uint64_t lineEnd);
+
+    uint64_t runPoll(const BlockCache::Block& block,
+                     MemoryMap& memory,
+                     uint64_t clock,
+                     uint64_t targetClock);
+
+    uint64_t runFill(const BlockCache::Block& block,
+                     MemoryMap& memory,
+                     uint64_t clock,
+                     uint64_t targetClock);
+
+    const NativeBlock* findNative(uint16_t address,
+                                  const BlockCache::Block& block,
+                                  const MemoryMap& memory);
+
     static const size_t INTERRUPT_OPCODE;
+    static const uint16_t NMI_VECTOR;
+    static const uint8_t HOT_BLOCK;
+    const Core mCore;
     CPURegisters mRegisters;
     CPUInfo mInfo;
     CPUArgs mArgs;
-    OpCodeArray mOpCodes;
+    const OpCodeArray& mOpCodes;
+    BlockCache mBlockCache;
+    std::unique_ptr<Jit6502> mJit;
+    std::shared_ptr<const RecompiledROM> mRecompiled;
+    NativeContext mNative;
+    bool mNativeRAM;
+    TraceBuffer* mTrace;
+
+    // Only used while a stepped run is going.
+    Stop* mStop;
 };
 }
 }
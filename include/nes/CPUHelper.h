@@ -25,7 +25,7 @@
 #define __NYRA_NES_CPU_HELPER_H__
 
 #include <stdint.h>
-#include <bitset>
+#include <stddef.h>
 
 namespace nyra
 {
@@ -60,11 +60,89 @@ struct CPURegisters
      */
     CPURegisters();
 
+    /*
+     *  \func - getStatus
+     *  \brief - Builds the status register byte. Z and N are worked out
+     *           from the results they were last set from.
+     */
+    inline uint8_t getStatus() const
+    {
+        return status |
+               (zeroResult == 0 ? (1 << ZERO) : 0) |
+               (signResult & (1 << SIGN));
+    }
+
+    /*
+     *  \func - setStatus
+     *  \brief - Sets every flag from a status register byte, as PLP and
+     *           RTI do.
+     */
+    inline void setStatus(uint8_t value)
+    {
+        status = value & ~((1 << ZERO) | (1 << SIGN));
+        zeroResult = (value & (1 << ZERO)) ? 0 : 1;
+        signResult = value;
+    }
+
+    /*
+     *  \func - getFlag
+     *  \brief - Returns a single flag from the status register.
+     */
+    inline bool getFlag(size_t flag) const
+    {
+        if (flag == ZERO)
+        {
+            return zeroResult == 0;
+        }
+        if (flag == SIGN)
+        {
+            return (signResult & (1 << SIGN)) != 0;
+        }
+        return (status & (1 << flag)) != 0;
+    }
+
+    /*
+     *  \func - setFlag
+     *  \brief - Sets a single flag in the status register.
+     */
+    inline void setFlag(size_t flag, bool value)
+    {
+        if (flag == ZERO)
+        {
+            zeroResult = value ? 0 : 1;
+        }
+        else if (flag == SIGN)
+        {
+            signResult = value ? (1 << SIGN) : 0;
+        }
+        else
+        {
+            status = (status & ~(1 << flag)) | (value << flag);
+        }
+    }
+
+    /*
+     *  \func - setResult
+     *  \brief - Sets Z and N from the result of an operation. Nothing is
+     *           worked out until the flags are read.
+     */
+    inline void setResult(uint8_t value)
+    {
+        zeroResult = value;
+        signResult = value;
+    }
+
     uint8_t accumulator;
     uint8_t xIndex;
     uint8_t yIndex;
     uint8_t stackPointer;
-    std::bitset<8> statusRegister;
+
+    // Every flag but Z and N, their bits are always clear here. Z is set
+    // when zeroResult is zero and N is the top bit of signResult. They are
+    // normally the same byte, BIT and PLP can set the two apart.
+    uint8_t status;
+    uint8_t zeroResult;
+    uint8_t signResult;
 };
 
 /*
@@ -89,9 +167,16 @@ struct CPUInfo
     CPUInfo(uint16_t programCounter);
 
     uint16_t programCounter;
+
+    // The PPU cycle within the current scanline. The OpCode core keeps
+    // this current after every instruction, the interpreter core only
+    // brings it up to date when a run returns.
     uint16_t cycles;
     int16_t scanLine;
     bool generateNMI;
+
+    // The master clock in PPU cycles since power on.
+    uint64_t clock;
 };
 
 /*
@@ -24,12 +24,14 @@
 #ifndef __NYRA_NES_CARTRIDGE_H__
 #define __NYRA_NES_CARTRIDGE_H__
 
+#include <stdint.h>
 #include <string>
 #include <vector>
 #include <memory>
 #include <nes/Header.h>
 #include <nes/Memory.h>
 #include <nes/Constants.h>
+#include <nes/ROMImage.h>
 
 namespace nyra
 {
@@ -45,12 +47,31 @@ class Cartridge
 public:
     /*
      *  \func - Constructor (pathname)
-     *  \brief - Creates a cartridge object from a file pathname.
+     *  \brief - Creates a cartridge object from a file pathname. The file
+     *           is mapped into memory and the banks point straight into
+     *           it, nothing is copied. Cartridges of the same game share
+     *           one ROMImage.
      *
      *  \param pathname - The full path of the file on disk.
+     *  \throw - If the file cannot be read or is not a NES file.
      */
     Cartridge(const std::string& pathname);
 
+    /*
+     *  \func - Constructor (buffer)
+     *  \brief - Creates a cartridge object from a file already in memory.
+     *           The banks point straight into the buffer, nothing is
+     *           copied. If the same game is already loaded its ROMImage
+     *           is used instead.
+     *
+     *  \param buffer - The contents of the ROM file. This is not owned and
+     *         must outlive the cartridge and everything built from it.
+     *  \param size - The size of the buffer in bytes.
+     *  \throw - If the buffer is not a NES file.
+     */
+    Cartridge(const uint8_t* buffer,
+              size_t size);
+
     /*
      *  \func - getHeader
      *  \brief - Returns the information about the header in the cartridge.
@@ -74,8 +95,31 @@ public:
         return mChrROM;
     }
 
+    /*
+     *  \func - getHash
+     *  \brief - Returns a 64 bit FNV-1a hash of the whole ROM file. This
+     *           identifies the game, for example to find code that was
+     *           recompiled ahead of time for it.
+     */
+    inline uint64_t getHash() const
+    {
+        return mImage->getHash();
+    }
+
+    /*
+     *  \func - getTileRows
+     *  \brief - Returns the CHR ROM decoded for the TileCache. This is
+     *           decoded once and shared by every cartridge of the game.
+     */
+    inline const uint16_t* getTileRows() const
+    {
+        return mImage->getTileRows(mChrROM);
+    }
+
 private:
-    const std::vector<uint8_t> mFile;
+    void assignBanks();
+
+    const std::shared_ptr<const ROMImage> mImage;
     const Header mHeader;
     ROMBanks mProgROM;
     ROMBanks mChrROM;
@@ -0,0 +1,187 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_CONDITION_H__
+#define __NYRA_NES_CONDITION_H__
+
+#include <stdint.h>
+#include <vector>
+#include <nes/CPUHelper.h>
+#include <nes/MemoryMap.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - Condition
+ *  \brief - A test on a register or a byte of memory that a run can stop
+ *           on. It is checked after every instruction in native code, so
+ *           stopping on it costs no more than single stepping.
+ */
+class Condition
+{
+public:
+    /*
+     *  \enum - Source
+     *  \brief - What the condition looks at. Memory is a single byte and
+     *           must be plain RAM or ROM, so checking it never has a side
+     *           effect on the registers.
+     */
+    enum Source
+    {
+        PROGRAM_COUNTER,
+        ACCUMULATOR,
+        X_INDEX,
+        Y_INDEX,
+        STACK_POINTER,
+        STATUS,
+        MEMORY
+    };
+
+    /*
+     *  \enum - Compare
+     *  \brief - How the masked source is compared to the value.
+     */
+    enum Compare
+    {
+        EQUAL,
+        NOT_EQUAL,
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL
+    };
+
+    /*
+     *  \func - Constructor
+     *  \brief - Creates a condition that holds when
+     *           (source & mask) compare value.
+     *
+     *  \param source - What to look at.
+     *  \param compare - How to compare it.
+     *  \param value - The value to compare against.
+     *  \param address - The address to read for MEMORY.
+     *  \param mask - Applied to the source before comparing, for example
+     *         to test a single flag or bit.
+     */
+    Condition(Source source,
+              Compare compare,
+              uint16_t value,
+              uint16_t address = 0,
+              uint16_t mask = 0xFFFF);
+
+    /*
+     *  \func - check
+     *  \brief - Makes sure the condition can be tested against a memory
+     *           map.
+     *
+     *  \throw - If the condition reads memory that is not plain RAM or
+     *           ROM.
+     */
+    void check(const MemoryMap& memory) const;
+
+    /*
+     *  \func - test
+     *  \brief - Returns true if the condition holds.
+     */
+    inline bool test(const CPURegisters& registers,
+                     const CPUInfo& info,
+                     const MemoryMap& memory) const
+    {
+        uint16_t source = 0;
+        switch (mSource)
+        {
+        case PROGRAM_COUNTER:
+            source = info.programCounter;
+            break;
+        case ACCUMULATOR:
+            source = registers.accumulator;
+            break;
+        case X_INDEX:
+            source = registers.xIndex;
+            break;
+        case Y_INDEX:
+            source = registers.yIndex;
+            break;
+        case STACK_POINTER:
+            source = registers.stackPointer;
+            break;
+        case STATUS:
+            source = registers.getStatus();
+            break;
+        case MEMORY:
+            source = memory.readByte(mAddress);
+            break;
+        }
+        source &= mMask;
+
+        switch (mCompare)
+        {
+        case EQUAL:
+            return source == mValue;
+        case NOT_EQUAL:
+            return source != mValue;
+        case LESS:
+            return source < mValue;
+        case LESS_EQUAL:
+            return source <= mValue;
+        case GREATER:
+            return source > mValue;
+        case GREATER_EQUAL:
+            return source >= mValue;
+        }
+        return false;
+    }
+
+private:
+    Source mSource;
+    Compare mCompare;
+    uint16_t mValue;
+    uint16_t mAddress;
+    uint16_t mMask;
+};
+
+/*
+ *  \func - testAll
+ *  \brief - Returns true if every condition holds. An empty list never
+ *           holds.
+ */
+inline bool testAll(const std::vector<Condition>& conditions,
+                    const CPURegisters& registers,
+                    const CPUInfo& info,
+                    const MemoryMap& memory)
+{
+    for (size_t ii = 0; ii < conditions.size(); ++ii)
+    {
+        if (!conditions[ii].test(registers, info, memory))
+        {
+            return false;
+        }
+    }
+    return !conditions.empty();
+}
+}
+}
+
+#endif
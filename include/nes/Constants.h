@@ -24,6 +24,7 @@
 #ifndef __NYRA_NES_CONSTANTS_H__
 #define __NYRA_NES_CONSTANTS_H__
 
+#include <stdint.h>
 #include <vector>
 #include <memory>
 
@@ -43,6 +44,30 @@ static const size_t SCREEN_WIDTH = 256;
 static const size_t SCREEN_HEIGHT = 240;
 static const size_t NUM_PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
 
+/*
+ *  \Constant - CYCLES_PER_SCANLINE
+ *  \brief - The number of PPU cycles in a single scanline. CPU cycles are
+ *           tracked in PPU cycles, so every CPU cycle counts as three.
+ */
+static const uint16_t CYCLES_PER_SCANLINE = 341;
+
+/*
+ *  \Constant - MAX_SCANLINES
+ *  \brief - The last scanline before the counter wraps to the pre-render
+ *           line (-1).
+ */
+static const int16_t MAX_SCANLINES = 260;
+
+/*
+ *  \Constant - PPU_START
+ *  \brief - The PPU registers are mirrored every eight bytes from
+ *           PPU_START up to PPU_END. PPU_MASK gives the register an
+ *           address in that range maps to.
+ */
+static const size_t PPU_START = 0x2000;
+static const size_t PPU_END = 0x4000;
+static const size_t PPU_MASK = 0x07;
+
 //! NTSC CPU clock in MHz
 static const double CPU_CLOCK = 1.789773;
 
@@ -60,12 +85,15 @@ typedef std::vector<std::unique_ptr<RAM> > RAMBanks;
 /*
  *  \enum - Mirroring
  *  \brief - Describes how the nametables should be presented to
- *           the player.
+ *           the player. The single screen modes show one nametable at
+ *           every address and can only be picked by a mapper.
  */
 enum Mirroring
 {
     HORIZONTAL,
-    VERTICAL
+    VERTICAL,
+    SINGLE_SCREEN_LOWER,
+    SINGLE_SCREEN_UPPER
 };
 }
 }
@@ -25,6 +25,7 @@
 #define __NYRA_NES_CONTROLLER_H__
 
 #include <nes/Memory.h>
+#include <nes/SaveState.h>
 
 namespace nyra
 {
@@ -61,6 +62,10 @@ public:
         }
     }
 
+    void saveState(StateWriter& state) const;
+
+    void loadState(StateReader& state);
+
 private:
     bool mStrobe;
     ControllerBit mIndex;
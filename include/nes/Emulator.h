@@ -0,0 +1,259 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_EMULATOR_H__
+#define __NYRA_NES_EMULATOR_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <nes/Cartridge.h>
+#include <nes/PPU.h>
+#include <nes/APU.h>
+#include <nes/Controller.h>
+#include <nes/MemoryMap.h>
+#include <nes/CPU.h>
+#include <nes/SaveState.h>
+#include <nes/Scheduler.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - Emulator
+ *  \brief - Owns every piece of the system (cartridge, PPU, APU,
+ *           controllers, memory map and CPU) and runs whole frames
+ *           natively. Scripting layers should drive the emulator through
+ *           this class so they only cross into C++ once per frame.
+ */
+class Emulator
+{
+public:
+    /*
+     *  \func - Constructor (pathname)
+     *  \brief - Loads a cartridge from disk and wires up the system. The
+     *           CPU starts at the address stored in the reset vector.
+     *
+     *  \param pathname - The full path of the ROM file on disk.
+     *  \param core - The execution core used to run the CPU.
+     */
+    Emulator(const std::string& pathname,
+             CPU::Core core = CPU::INTERPRETER_CORE);
+
+    /*
+     *  \func - runFrame
+     *  \brief - Runs scanlines until the PPU enters vertical blank, which
+     *           completes a single frame.
+     *
+     *  \param buffer [OPTIONAL] - A SCREEN_WIDTH * SCREEN_HEIGHT pixel
+     *         buffer to render into. Pass nullptr to skip rendering.
+     */
+    void runFrame(uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - runFrames
+     *  \brief - Runs several frames back to back. Every frame is rendered
+     *           into the same buffer, so only the last one is kept.
+     *
+     *  \param numFrames - The number of frames to run.
+     *  \param buffer [OPTIONAL] - The pixel buffer to render into.
+     */
+    void runFrames(size_t numFrames,
+                   uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - runCycles
+     *  \brief - Runs the system for a number of CPU cycles. It stops on
+     *           the first instruction boundary at or after the budget,
+     *           which can be in the middle of a scanline or frame.
+     *
+     *  \param cycles - The number of CPU cycles to run.
+     *  \param buffer [OPTIONAL] - The pixel buffer to render into.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runCycles(uint64_t cycles,
+                       uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - runInstructions
+     *  \brief - Runs the system for an exact number of CPU instructions.
+     *
+     *  \param count - The number of instructions to run.
+     *  \param buffer [OPTIONAL] - The pixel buffer to render into.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runInstructions(size_t count,
+                             uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - runUntilPC
+     *  \brief - Runs the system until the next instruction is at an
+     *           address. At least one instruction runs.
+     *
+     *  \param address - The address to stop at.
+     *  \param maxCycles - Stop after this many CPU cycles if the address
+     *         is not reached.
+     *  \param buffer [OPTIONAL] - The pixel buffer to render into.
+     *  \return - The CPU cycles that ran.
+     */
+    uint64_t runUntilPC(uint16_t address,
+                        uint64_t maxCycles,
+                        uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - runUntil
+     *  \brief - Runs the system until every condition holds after an
+     *           instruction. The conditions are tested natively, so this
+     *           runs at single stepping speed.
+     *
+     *  \param conditions - The conditions to stop on.
+     *  \param maxCycles - Stop after this many CPU cycles if the
+     *         conditions are not met.
+     *  \param buffer [OPTIONAL] - The pixel buffer to render into.
+     *  \return - The CPU cycles that ran.
+     *  \throw - If a condition reads memory that is not RAM or ROM.
+     */
+    uint64_t runUntil(const std::vector<Condition>& conditions,
+                      uint64_t maxCycles,
+                      uint32_t* buffer = nullptr);
+
+    /*
+     *  \func - loadRecompiled
+     *  \brief - Runs code recompiled ahead of time by nes_aot from a
+     *           shared library. At construction the emulator already
+     *           searches NYRA_NES_AOT_PATH, this loads one explicitly.
+     *           This has no effect on the OpCode core.
+     *
+     *  \param pathname - The full path of the shared library.
+     *  \throw - If the library was not built from this ROM.
+     */
+    void loadRecompiled(const std::string& pathname);
+
+    /*
+     *  \func - getController
+     *  \brief - Returns one of the two controller ports.
+     *
+     *  \param index - The port number, 0 or 1.
+     */
+    Controller& getController(size_t index);
+
+    /*
+     *  \func - getStateSize
+     *  \brief - Returns the size in bytes of a save state for this
+     *           emulator. This does not change while the emulator runs.
+     */
+    size_t getStateSize() const;
+
+    /*
+     *  \func - saveState
+     *  \brief - Captures the full machine state into a flat, versioned
+     *           binary buffer. Cartridge ROM is not included.
+     *
+     *  \param buffer - The output buffer.
+     *  \param size - The size of the buffer. This must be at least
+     *         getStateSize() bytes.
+     *  \throw - If the buffer is too small.
+     */
+    void saveState(uint8_t* buffer,
+                   size_t size) const;
+
+    /*
+     *  \func - saveState
+     *  \brief - Captures the full machine state into a new buffer.
+     */
+    std::vector<uint8_t> saveState() const;
+
+    /*
+     *  \func - loadState
+     *  \brief - Restores the full machine state. This does not allocate,
+     *           so it can be used to reset to a checkpoint in a tight loop.
+     *
+     *  \param buffer - A state created by saveState.
+     *  \param size - The size of the state in bytes.
+     *  \throw - If the state is from a different version or does not
+     *          match this emulator.
+     */
+    void loadState(const uint8_t* buffer,
+                   size_t size);
+
+    void loadState(const std::vector<uint8_t>& state)
+    {
+        loadState(state.data(), state.size());
+    }
+
+    inline const Cartridge& getCartridge() const
+    {
+        return mCartridge;
+    }
+
+    inline PPU& getPPU()
+    {
+        return mPPU;
+    }
+
+    inline APU& getAPU()
+    {
+        return mAPU;
+    }
+
+    inline MemoryMap& getMemoryMap()
+    {
+        return *mMemoryMap;
+    }
+
+    inline CPU& getCPU()
+    {
+        return mCPU;
+    }
+
+private:
+    /*
+     *  \func - handleEvent
+     *  \brief - Handles an event that came due on the scheduler.
+     *
+     *  \return - True if the event completed a frame.
+     */
+    bool handleEvent(Scheduler::Event event,
+                     uint64_t time,
+                     uint32_t* buffer);
+
+    uint64_t runTo(uint64_t targetClock,
+                   CPU::Stop* stop,
+                   uint32_t* buffer);
+
+    void saveState(StateWriter& state) const;
+
+    static const size_t NUM_CONTROLLERS = 2;
+    const Cartridge mCartridge;
+    PPU mPPU;
+    APU mAPU;
+    Controller mControllers[NUM_CONTROLLERS];
+    const std::shared_ptr<MemoryMap> mMemoryMap;
+    CPU mCPU;
+    Scheduler mScheduler;
+};
+}
+}
+
+#endif
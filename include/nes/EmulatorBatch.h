@@ -0,0 +1,148 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_EMULATOR_BATCH_H__
+#define __NYRA_NES_EMULATOR_BATCH_H__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <nes/Emulator.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - EmulatorBatch
+ *  \brief - Owns several independent emulators and steps all of them one
+ *           frame at a time across a fixed pool of worker threads. Every
+ *           frame is rendered into a single contiguous buffer of
+ *           size() * SCREEN_HEIGHT * SCREEN_WIDTH pixels, so the frames
+ *           can be viewed as one array without copying.
+ */
+class EmulatorBatch
+{
+public:
+    /*
+     *  \func - Constructor (pathnames)
+     *  \brief - Creates one emulator per ROM. The same ROM can be listed
+     *           more than once.
+     *
+     *  \param pathnames - The ROM for each emulator.
+     *  \param numThreads - The number of worker threads. Zero uses one
+     *         thread per hardware core.
+     */
+    EmulatorBatch(const std::vector<std::string>& pathnames,
+                  size_t numThreads = 0);
+
+    /*
+     *  \func - Destructor
+     *  \brief - Stops and joins the worker threads.
+     */
+    ~EmulatorBatch();
+
+    /*
+     *  \func - step
+     *  \brief - Presses the buttons for each emulator on controller one,
+     *           then runs every emulator for one frame in parallel.
+     *           This returns once all frames are done.
+     *
+     *  \param actions - One byte per emulator. Bit n presses
+     *         Controller::ControllerBit n.
+     *  \throw - If there is not one action per emulator or if any
+     *           emulator fails.
+     */
+    void step(const uint8_t* actions,
+              size_t size);
+
+    void step(const std::vector<uint8_t>& actions)
+    {
+        step(actions.data(), actions.size());
+    }
+
+    /*
+     *  \func - size
+     *  \brief - Returns the number of emulators in the batch.
+     */
+    inline size_t size() const
+    {
+        return mEmulators.size();
+    }
+
+    /*
+     *  \func - getEmulator
+     *  \brief - Returns a single emulator, for example to save or load
+     *           its state. Do not use this while step is running.
+     */
+    inline Emulator& getEmulator(size_t index)
+    {
+        return *mEmulators.at(index);
+    }
+
+    /*
+     *  \func - getFrameBuffer
+     *  \brief - Returns the frames of every emulator, one after another.
+     */
+    inline uint32_t* getFrameBuffer()
+    {
+        return mFrameBuffer.data();
+    }
+
+    /*
+     *  \func - getNumThreads
+     *  \brief - Returns the number of worker threads.
+     */
+    inline size_t getNumThreads() const
+    {
+        return mThreads.size();
+    }
+
+private:
+    void workerLoop();
+
+    void runJobs();
+
+    std::vector<std::unique_ptr<Emulator> > mEmulators;
+    std::vector<uint32_t> mFrameBuffer;
+    const uint8_t* mActions;
+
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mStart;
+    std::condition_variable mDone;
+    size_t mGeneration;
+    size_t mBusyThreads;
+    bool mStopping;
+    std::atomic<size_t> mNextJob;
+    std::exception_ptr mError;
+};
+}
+}
+
+#endif
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_ENCODING_6502_H__
+#define __NYRA_NES_ENCODING_6502_H__
+
+#include <stdint.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \enum - Operation
+ *  \brief - The operations native code is generated for. Branches are
+ *           ordered in clear then set pairs for each flag.
+ */
+enum Operation
+{
+    OP_LDA, OP_LDX, OP_LDY, OP_STA, OP_STX, OP_STY,
+    OP_ORA, OP_AND, OP_EOR, OP_ADC, OP_SBC,
+    OP_CMP, OP_CPX, OP_CPY, OP_BIT,
+    OP_ASL, OP_LSR, OP_ROL, OP_ROR, OP_INC, OP_DEC,
+    OP_INX, OP_INY, OP_DEX, OP_DEY,
+    OP_TAX, OP_TAY, OP_TXA, OP_TYA, OP_TSX, OP_TXS,
+    OP_CLC, OP_SEC, OP_SEI, OP_CLV, OP_CLD, OP_SED,
+    OP_PHA, OP_PHP, OP_PLA, OP_PLP,
+    OP_JSR, OP_RTS, OP_JMP,
+    OP_BPL, OP_BMI, OP_BVC, OP_BVS, OP_BCC, OP_BCS, OP_BNE, OP_BEQ,
+    OP_NOP
+};
+
+/*
+ *  \enum - AddressMode
+ *  \brief - The address modes native code is generated for. Branches use
+ *           immediate for their offset.
+ */
+enum AddressMode
+{
+    MODE_IMPLIED,
+    MODE_IMMEDIATE,
+    MODE_ZERO_PAGE,
+    MODE_ZERO_PAGE_X,
+    MODE_ZERO_PAGE_Y,
+    MODE_ABSOLUTE,
+    MODE_ABSOLUTE_X,
+    MODE_ABSOLUTE_Y
+};
+
+/*
+ *  \struct - Encoding
+ *  \brief - The operation and address mode behind an opcode.
+ */
+struct Encoding
+{
+    uint8_t opcode;
+    Operation operation;
+    AddressMode mode;
+};
+
+/*
+ *  \func - findEncoding
+ *  \brief - Looks up an opcode for the recompilers. Indirect modes, RTI,
+ *           JMP indirect and the unofficial opcodes are left to the
+ *           interpreter.
+ *
+ *  \return - The encoding, or nullptr if the opcode is not recompiled.
+ */
+const Encoding* findEncoding(uint8_t opcode);
+}
+}
+
+#endif
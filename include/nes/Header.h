@@ -50,6 +50,17 @@ public:
      */
     Header(const std::vector<uint8_t>& binary);
 
+    /*
+     *  \func - Constructor (buffer)
+     *  \brief - Creates a Header from the start of a buffer.
+     *
+     *  \param binary - The file contents of the cartridge.
+     *  \param size - The size of the contents in bytes.
+     *  \throw - If the buffer does not look like a NES header.
+     */
+    Header(const uint8_t* binary,
+           size_t size);
+
     /*
      *  \func - getProgRomSize
      *  \brief - Returns the size of the read only memory that contains the
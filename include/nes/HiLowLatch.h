@@ -26,6 +26,7 @@
 
 #include <stdint.h>
 #include <iostream>
+#include <nes/SaveState.h>
 
 namespace nyra
 {
@@ -70,7 +71,7 @@ public:
         return mValue;
     }
 
-    inline void inc(uint8_t amount)
+    inline void inc(uint16_t amount)
     {
         mValue += amount;
         mValue &= 0x7FFF;
@@ -86,6 +87,18 @@ public:
         return static_cast<uint8_t>(mValue & 0xFF);
     }
 
+    inline void saveState(StateWriter& state) const
+    {
+        state.write(mHighSet);
+        state.write(mValue);
+    }
+
+    inline void loadState(StateReader& state)
+    {
+        state.read(mHighSet);
+        state.read(mValue);
+    }
+
 private:
     bool mHighSet;
     uint16_t mValue;
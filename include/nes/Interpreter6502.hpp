@@ -0,0 +1,1199 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_INTERPRETER_6502_HPP__
+#define __NYRA_NES_INTERPRETER_6502_HPP__
+
+#include <stdint.h>
+#include <stdexcept>
+#include <nes/CPUHelper.h>
+#include <nes/MemoryMap.h>
+#include <nes/Op6502.hpp>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - Interpreter6502
+ *  \brief - Decodes and runs a single 6502 instruction in one function.
+ *           This mirrors the behavior of the OpCode and Mode classes in
+ *           Op6502.hpp and Mode6502.hpp, but everything is resolved through
+ *           a single switch so there is no virtual dispatch and no per mode
+ *           state. The debug only work the modes do to build disassembly
+ *           strings (such as reading the old value for store modes) is not
+ *           done here.
+ *
+ *           Memory is accessed through BusT, which is either a MemoryMap
+ *           or a bus with fixed address decoding such as NROMBus.
+ */
+class Interpreter6502
+{
+public:
+    /*
+     *  \enum - Fusion
+     *  \brief - Pairs of instructions that run as a single
+     *           superinstruction. Counting loops (DEX BNE), compares
+     *           feeding a branch (CMP BEQ) and copies (LDA STA) are the
+     *           pairs expected to be common. The set is provisional. It
+     *           should be checked against games with
+     *           "nes_bench --pairs", which writes an opcode pair
+     *           histogram. bench/opcode_pairs_nestest.json is its output
+     *           for nestest, the only ROM in the tree.
+     */
+    enum Fusion
+    {
+        FUSE_NONE,
+        FUSE_DEX_BNE,
+        FUSE_DEY_BNE,
+        FUSE_INX_BNE,
+        FUSE_INY_BNE,
+        FUSE_INX_CPX_IMMEDIATE,
+        FUSE_INY_CPY_IMMEDIATE,
+        FUSE_CMP_IMMEDIATE_BNE,
+        FUSE_CMP_IMMEDIATE_BEQ,
+        FUSE_CMP_ZERO_PAGE_BNE,
+        FUSE_CMP_ZERO_PAGE_BEQ,
+        FUSE_CPX_IMMEDIATE_BNE,
+        FUSE_CPY_IMMEDIATE_BNE,
+        FUSE_LDA_IMMEDIATE_STA_ZERO_PAGE,
+        FUSE_LDA_IMMEDIATE_STA_ABSOLUTE,
+        FUSE_LDA_ABSOLUTE_STA_ABSOLUTE,
+        FUSE_LDA_ABSOLUTE_X_STA_ABSOLUTE_Y
+    };
+
+    /*
+     *  \func - execute
+     *  \brief - Runs the instruction described by args. The program
+     *           counter is advanced, but the cycle count is left to the
+     *           caller.
+     *
+     *  \param args - The opcode and arguments found at the program counter.
+     *  \param registers - The current CPU registers.
+     *  \param info - The current CPU info.
+     *  \param memory - The current memory banks.
+     *  \return - The number of CPU cycles the instruction took, including
+     *            any page crossing or branch penalties.
+     *  \throw - If the opcode is not a known 6502 opcode.
+     */
+    template <typename BusT>
+    static inline uint8_t execute(const CPUArgs& args,
+                                  CPURegisters& registers,
+                                  CPUInfo& info,
+                                  BusT& memory);
+
+    /*
+     *  \func - findFusion
+     *  \brief - Returns the superinstruction for a pair of opcodes, or
+     *           FUSE_NONE. The first instruction of a pair never writes
+     *           memory.
+     */
+    static inline uint8_t findFusion(uint8_t first, uint8_t second)
+    {
+        switch ((first << 8) | second)
+        {
+        case 0xCAD0:
+            return FUSE_DEX_BNE;
+        case 0x88D0:
+            return FUSE_DEY_BNE;
+        case 0xE8D0:
+            return FUSE_INX_BNE;
+        case 0xC8D0:
+            return FUSE_INY_BNE;
+        case 0xE8E0:
+            return FUSE_INX_CPX_IMMEDIATE;
+        case 0xC8C0:
+            return FUSE_INY_CPY_IMMEDIATE;
+        case 0xC9D0:
+            return FUSE_CMP_IMMEDIATE_BNE;
+        case 0xC9F0:
+            return FUSE_CMP_IMMEDIATE_BEQ;
+        case 0xC5D0:
+            return FUSE_CMP_ZERO_PAGE_BNE;
+        case 0xC5F0:
+            return FUSE_CMP_ZERO_PAGE_BEQ;
+        case 0xE0D0:
+            return FUSE_CPX_IMMEDIATE_BNE;
+        case 0xC0D0:
+            return FUSE_CPY_IMMEDIATE_BNE;
+        case 0xA985:
+            return FUSE_LDA_IMMEDIATE_STA_ZERO_PAGE;
+        case 0xA98D:
+            return FUSE_LDA_IMMEDIATE_STA_ABSOLUTE;
+        case 0xAD8D:
+            return FUSE_LDA_ABSOLUTE_STA_ABSOLUTE;
+        case 0xBD99:
+            return FUSE_LDA_ABSOLUTE_X_STA_ABSOLUTE_Y;
+        default:
+            return FUSE_NONE;
+        }
+    }
+
+    /*
+     *  \func - executeFused
+     *  \brief - Runs a pair of instructions found by findFusion. The
+     *           registers, flags, memory and cycles all end up the same as
+     *           running the two with execute. Flags that the second
+     *           instruction overwrites are never set.
+     *
+     *  \param fusion - The superinstruction.
+     *  \param first - The arguments of the first instruction.
+     *  \param second - The arguments of the second instruction.
+     *  \return - The number of CPU cycles both instructions took.
+     */
+    template <typename BusT>
+    static inline uint8_t executeFused(uint8_t fusion,
+                                       const CPUArgs& first,
+                                       const CPUArgs& second,
+                                       CPURegisters& registers,
+                                       CPUInfo& info,
+                                       BusT& memory);
+
+    /*
+     *  \func - interrupt
+     *  \brief - Pushes the program counter and status register and jumps
+     *           to an interrupt vector. This matches the NYRA JMI opcode.
+     *
+     *  \param vector - The address of the interrupt vector.
+     *  \return - The number of CPU cycles the interrupt took.
+     */
+    template <typename BusT>
+    static inline uint8_t interrupt(uint16_t vector,
+                                    CPURegisters& registers,
+                                    CPUInfo& info,
+                                    BusT& memory)
+    {
+        pushStack((info.programCounter >> 8) & 0xFF,
+                  memory, registers.stackPointer);
+        pushStack(info.programCounter & 0xFF,
+                  memory, registers.stackPointer);
+        pushStack(registers.getStatus(),
+                  memory, registers.stackPointer);
+        info.programCounter = memory.readShort(vector);
+        return 6;
+    }
+
+private:
+    static inline uint16_t zeroPageX(const CPUArgs& args,
+                                     const CPURegisters& registers)
+    {
+        return (args.arg1 + registers.xIndex) & 0xFF;
+    }
+
+    static inline uint16_t zeroPageY(const CPUArgs& args,
+                                     const CPURegisters& registers)
+    {
+        return (args.arg1 + registers.yIndex) & 0xFF;
+    }
+
+    static inline uint16_t absoluteN(const CPUArgs& args,
+                                     uint8_t index,
+                                     uint8_t& cycles)
+    {
+        const uint16_t address = args.darg + index;
+        if ((args.darg & 0xFF00) != (address & 0xFF00))
+        {
+            ++cycles;
+        }
+        return address;
+    }
+
+    template <typename BusT>
+    static inline uint16_t indirectX(const CPUArgs& args,
+                                     const CPURegisters& registers,
+                                     const BusT& memory)
+    {
+        return memory.readShort(zeroPageX(args, registers));
+    }
+
+    template <typename BusT>
+    static inline uint16_t indirectY(const CPUArgs& args,
+                                     const CPURegisters& registers,
+                                     const BusT& memory,
+                                     uint8_t& cycles)
+    {
+        const uint16_t base = memory.readShort(args.arg1);
+        const uint16_t address = base + registers.yIndex;
+        if ((args.arg1 == 0xFF) || ((base & 0xFF00) != (address & 0xFF00)))
+        {
+            ++cycles;
+        }
+        return address;
+    }
+
+    template <typename BusT>
+    static inline uint16_t indirect(const CPUArgs& args,
+                                    const BusT& memory)
+    {
+        // There is a bug in 6502. If we try to get the address at 0xXXFF,
+        // it does not go to the next digit properly.
+        if (args.arg1 == 0xFF)
+        {
+            const uint8_t high = memory.readByte(args.darg);
+            const uint16_t low = memory.readByte(args.arg2 << 8);
+            return (low << 8) | high;
+        }
+        return memory.readShort(args.darg);
+    }
+
+    static inline uint8_t branch(bool condition,
+                                 const CPUArgs& args,
+                                 CPUInfo& info)
+    {
+        if (condition)
+        {
+            info.programCounter += static_cast<int8_t>(args.arg1) + 2;
+            return 3;
+        }
+        info.programCounter += 2;
+        return 2;
+    }
+
+    static inline uint8_t stepBranch(uint8_t step,
+                                     uint8_t& reg,
+                                     const CPUArgs& args,
+                                     CPURegisters& registers,
+                                     CPUInfo& info)
+    {
+        const uint8_t value = reg + step;
+        setRegister(value, reg, registers);
+        info.programCounter += 1;
+        return 2 + branch(value != 0, args, info);
+    }
+
+    static inline uint8_t stepCompare(uint8_t step,
+                                      uint8_t& reg,
+                                      const CPUArgs& args,
+                                      CPURegisters& registers,
+                                      CPUInfo& info)
+    {
+        reg += step;
+        compare(args.arg1, reg, registers);
+        info.programCounter += 3;
+        return 4;
+    }
+
+    static inline uint8_t compareBranch(uint8_t value,
+                                        uint8_t reg,
+                                        bool equal,
+                                        const CPUArgs& args,
+                                        CPURegisters& registers,
+                                        CPUInfo& info)
+    {
+        compare(value, reg, registers);
+        info.programCounter += 2;
+        return branch((reg == value) == equal, args, info);
+    }
+
+    static inline void bit(uint8_t value, CPURegisters& registers)
+    {
+        registers.zeroResult = value & registers.accumulator;
+        registers.signResult = value;
+        registers.setFlag(OFLOW, (value & (1 << OFLOW)) != 0);
+    }
+
+    static inline void flags(uint8_t value, CPURegisters& registers)
+    {
+        registers.setResult(value);
+    }
+
+    template <typename BusT>
+    static inline void asl(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = shiftLeft(memory.readByte(address), false,
+                                        registers);
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    template <typename BusT>
+    static inline void lsr(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = shiftRight(memory.readByte(address), false,
+                                         registers);
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    template <typename BusT>
+    static inline void rol(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = shiftLeft(memory.readByte(address), true,
+                                        registers);
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    template <typename BusT>
+    static inline void ror(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = shiftRight(memory.readByte(address), true,
+                                         registers);
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    template <typename BusT>
+    static inline void inc(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = memory.readByte(address) + 1;
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    template <typename BusT>
+    static inline void dec(uint16_t address,
+                           CPURegisters& registers,
+                           BusT& memory)
+    {
+        const uint8_t value = memory.readByte(address) - 1;
+        flags(value, registers);
+        memory.writeByte(address, value);
+    }
+
+    static inline void ora(uint8_t value, CPURegisters& registers)
+    {
+        setRegister(value | registers.accumulator,
+                    registers.accumulator, registers);
+    }
+
+    static inline void andA(uint8_t value, CPURegisters& registers)
+    {
+        setRegister(value & registers.accumulator,
+                    registers.accumulator, registers);
+    }
+
+    static inline void eor(uint8_t value, CPURegisters& registers)
+    {
+        setRegister(value ^ registers.accumulator,
+                    registers.accumulator, registers);
+    }
+};
+
+/*****************************************************************************/
+template <typename BusT>
+uint8_t Interpreter6502::execute(const CPUArgs& args,
+                                 CPURegisters& registers,
+                                 CPUInfo& info,
+                                 BusT& memory)
+{
+    uint8_t cycles = 0;
+
+    switch (args.opcode)
+    {
+    // ORA
+    case 0x01:
+        ora(memory.readByte(indirectX(args, registers, memory)), registers);
+        info.programCounter += 2;
+        return 6;
+    case 0x05:
+        ora(memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0x09:
+        ora(args.arg1, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0x0D:
+        ora(memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+    case 0x11:
+        ora(memory.readByte(indirectY(args, registers, memory, cycles)),
+            registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0x15:
+        ora(memory.readByte(zeroPageX(args, registers)), registers);
+        info.programCounter += 2;
+        return 4;
+    case 0x19:
+        ora(memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0x1D:
+        ora(memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // AND
+    case 0x21:
+        andA(memory.readByte(indirectX(args, registers, memory)), registers);
+        info.programCounter += 2;
+        return 6;
+    case 0x25:
+        andA(memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0x29:
+        andA(args.arg1, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0x2D:
+        andA(memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+    case 0x31:
+        andA(memory.readByte(indirectY(args, registers, memory, cycles)),
+             registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0x35:
+        andA(memory.readByte(zeroPageX(args, registers)), registers);
+        info.programCounter += 2;
+        return 4;
+    case 0x39:
+        andA(memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+             registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0x3D:
+        andA(memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+             registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // EOR
+    case 0x41:
+        eor(memory.readByte(indirectX(args, registers, memory)), registers);
+        info.programCounter += 2;
+        return 6;
+    case 0x45:
+        eor(memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0x49:
+        eor(args.arg1, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0x4D:
+        eor(memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+    case 0x51:
+        eor(memory.readByte(indirectY(args, registers, memory, cycles)),
+            registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0x55:
+        eor(memory.readByte(zeroPageX(args, registers)), registers);
+        info.programCounter += 2;
+        return 4;
+    case 0x59:
+        eor(memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0x5D:
+        eor(memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // ADC
+    case 0x61:
+        add(memory.readByte(indirectX(args, registers, memory)), registers);
+        info.programCounter += 2;
+        return 6;
+    case 0x65:
+        add(memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0x69:
+        add(args.arg1, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0x6D:
+        add(memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+    case 0x71:
+        add(memory.readByte(indirectY(args, registers, memory, cycles)),
+            registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0x75:
+        add(memory.readByte(zeroPageX(args, registers)), registers);
+        info.programCounter += 2;
+        return 4;
+    case 0x79:
+        add(memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0x7D:
+        add(memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // SBC
+    case 0xE1:
+        add(~memory.readByte(indirectX(args, registers, memory)), registers);
+        info.programCounter += 2;
+        return 6;
+    case 0xE5:
+        add(~memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xE9:
+        add(~args.arg1, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xED:
+        add(~memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+    case 0xF1:
+        add(~memory.readByte(indirectY(args, registers, memory, cycles)),
+            registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0xF5:
+        add(~memory.readByte(zeroPageX(args, registers)), registers);
+        info.programCounter += 2;
+        return 4;
+    case 0xF9:
+        add(~memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0xFD:
+        add(~memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+            registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // CMP
+    case 0xC1:
+        compare(memory.readByte(indirectX(args, registers, memory)),
+                registers.accumulator, registers);
+        info.programCounter += 2;
+        return 6;
+    case 0xC5:
+        compare(memory.readByte(args.arg1), registers.accumulator, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xC9:
+        compare(args.arg1, registers.accumulator, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xCD:
+        compare(memory.readByte(args.darg), registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4;
+    case 0xD1:
+        compare(memory.readByte(indirectY(args, registers, memory, cycles)),
+                registers.accumulator, registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0xD5:
+        compare(memory.readByte(zeroPageX(args, registers)),
+                registers.accumulator, registers);
+        info.programCounter += 2;
+        return 4;
+    case 0xD9:
+        compare(memory.readByte(absoluteN(args, registers.yIndex, cycles)),
+                registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0xDD:
+        compare(memory.readByte(absoluteN(args, registers.xIndex, cycles)),
+                registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // CPX
+    case 0xE0:
+        compare(args.arg1, registers.xIndex, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xE4:
+        compare(memory.readByte(args.arg1), registers.xIndex, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xEC:
+        compare(memory.readByte(args.darg), registers.xIndex, registers);
+        info.programCounter += 3;
+        return 4;
+
+    // CPY
+    case 0xC0:
+        compare(args.arg1, registers.yIndex, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xC4:
+        compare(memory.readByte(args.arg1), registers.yIndex, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xCC:
+        compare(memory.readByte(args.darg), registers.yIndex, registers);
+        info.programCounter += 3;
+        return 4;
+
+    // BIT
+    case 0x24:
+        bit(memory.readByte(args.arg1), registers);
+        info.programCounter += 2;
+        return 3;
+    case 0x2C:
+        bit(memory.readByte(args.darg), registers);
+        info.programCounter += 3;
+        return 4;
+
+    // LDA
+    case 0xA1:
+        setRegister(memory.readByte(indirectX(args, registers, memory)),
+                    registers.accumulator, registers);
+        info.programCounter += 2;
+        return 6;
+    case 0xA5:
+        setRegister(memory.readByte(args.arg1),
+                    registers.accumulator, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xA9:
+        setRegister(args.arg1, registers.accumulator, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xAD:
+        setRegister(memory.readByte(args.darg),
+                    registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4;
+    case 0xB1:
+        setRegister(memory.readByte(
+                            indirectY(args, registers, memory, cycles)),
+                    registers.accumulator, registers);
+        info.programCounter += 2;
+        return 5 + cycles;
+    case 0xB5:
+        setRegister(memory.readByte(zeroPageX(args, registers)),
+                    registers.accumulator, registers);
+        info.programCounter += 2;
+        return 4;
+    case 0xB9:
+        setRegister(memory.readByte(
+                            absoluteN(args, registers.yIndex, cycles)),
+                    registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+    case 0xBD:
+        setRegister(memory.readByte(
+                            absoluteN(args, registers.xIndex, cycles)),
+                    registers.accumulator, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // LDX
+    case 0xA2:
+        setRegister(args.arg1, registers.xIndex, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xA6:
+        setRegister(memory.readByte(args.arg1), registers.xIndex, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xAE:
+        setRegister(memory.readByte(args.darg), registers.xIndex, registers);
+        info.programCounter += 3;
+        return 4;
+    case 0xB6:
+        setRegister(memory.readByte(zeroPageY(args, registers)),
+                    registers.xIndex, registers);
+        info.programCounter += 2;
+        return 4;
+    case 0xBE:
+        setRegister(memory.readByte(
+                            absoluteN(args, registers.yIndex, cycles)),
+                    registers.xIndex, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // LDY
+    case 0xA0:
+        setRegister(args.arg1, registers.yIndex, registers);
+        info.programCounter += 2;
+        return 2;
+    case 0xA4:
+        setRegister(memory.readByte(args.arg1), registers.yIndex, registers);
+        info.programCounter += 2;
+        return 3;
+    case 0xAC:
+        setRegister(memory.readByte(args.darg), registers.yIndex, registers);
+        info.programCounter += 3;
+        return 4;
+    case 0xB4:
+        setRegister(memory.readByte(zeroPageX(args, registers)),
+                    registers.yIndex, registers);
+        info.programCounter += 2;
+        return 4;
+    case 0xBC:
+        setRegister(memory.readByte(
+                            absoluteN(args, registers.xIndex, cycles)),
+                    registers.yIndex, registers);
+        info.programCounter += 3;
+        return 4 + cycles;
+
+    // STA
+    case 0x81:
+        memory.writeByte(indirectX(args, registers, memory),
+                         registers.accumulator);
+        info.programCounter += 2;
+        return 6;
+    case 0x85:
+        memory.writeByte(args.arg1, registers.accumulator);
+        info.programCounter += 2;
+        return 3;
+    case 0x8D:
+        memory.writeByte(args.darg, registers.accumulator);
+        info.programCounter += 3;
+        return 4;
+    case 0x91:
+        memory.writeByte(static_cast<uint16_t>(
+                                 memory.readShort(args.arg1) +
+                                 registers.yIndex),
+                         registers.accumulator);
+        info.programCounter += 2;
+        return 6;
+    case 0x95:
+        memory.writeByte(zeroPageX(args, registers), registers.accumulator);
+        info.programCounter += 2;
+        return 4;
+    case 0x99:
+        memory.writeByte(static_cast<uint16_t>(args.darg + registers.yIndex),
+                         registers.accumulator);
+        info.programCounter += 3;
+        return 5;
+    case 0x9D:
+        memory.writeByte(static_cast<uint16_t>(args.darg + registers.xIndex),
+                         registers.accumulator);
+        info.programCounter += 3;
+        return 5;
+
+    // STX
+    case 0x86:
+        memory.writeByte(args.arg1, registers.xIndex);
+        info.programCounter += 2;
+        return 3;
+    case 0x8E:
+        memory.writeByte(args.darg, registers.xIndex);
+        info.programCounter += 3;
+        return 4;
+    case 0x96:
+        memory.writeByte(zeroPageY(args, registers), registers.xIndex);
+        info.programCounter += 2;
+        return 4;
+
+    // STY
+    case 0x84:
+        memory.writeByte(args.arg1, registers.yIndex);
+        info.programCounter += 2;
+        return 3;
+    case 0x8C:
+        memory.writeByte(args.darg, registers.yIndex);
+        info.programCounter += 3;
+        return 4;
+    case 0x94:
+        memory.writeByte(zeroPageX(args, registers), registers.yIndex);
+        info.programCounter += 2;
+        return 4;
+
+    // ASL
+    case 0x06:
+        asl(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0x0A:
+        setRegister(shiftLeft(registers.accumulator, false, registers),
+                    registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x0E:
+        asl(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0x16:
+        asl(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0x1E:
+        asl(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // LSR
+    case 0x46:
+        lsr(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0x4A:
+        setRegister(shiftRight(registers.accumulator, false, registers),
+                    registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x4E:
+        lsr(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0x56:
+        lsr(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0x5E:
+        lsr(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // ROL
+    case 0x26:
+        rol(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0x2A:
+        setRegister(shiftLeft(registers.accumulator, true, registers),
+                    registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x2E:
+        rol(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0x36:
+        rol(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0x3E:
+        rol(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // ROR
+    case 0x66:
+        ror(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0x6A:
+        setRegister(shiftRight(registers.accumulator, true, registers),
+                    registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x6E:
+        ror(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0x76:
+        ror(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0x7E:
+        ror(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // INC
+    case 0xE6:
+        inc(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0xEE:
+        inc(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0xF6:
+        inc(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0xFE:
+        inc(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // DEC
+    case 0xC6:
+        dec(args.arg1, registers, memory);
+        info.programCounter += 2;
+        return 5;
+    case 0xCE:
+        dec(args.darg, registers, memory);
+        info.programCounter += 3;
+        return 6;
+    case 0xD6:
+        dec(zeroPageX(args, registers), registers, memory);
+        info.programCounter += 2;
+        return 6;
+    case 0xDE:
+        dec(static_cast<uint16_t>(args.darg + registers.xIndex),
+            registers, memory);
+        info.programCounter += 3;
+        return 7;
+
+    // Register increments, decrements and transfers
+    case 0xC8:
+        setRegister(registers.yIndex + 1, registers.yIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0xE8:
+        setRegister(registers.xIndex + 1, registers.xIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x88:
+        setRegister(registers.yIndex - 1, registers.yIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0xCA:
+        setRegister(registers.xIndex - 1, registers.xIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0xAA:
+        setRegister(registers.accumulator, registers.xIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x8A:
+        setRegister(registers.xIndex, registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0xA8:
+        setRegister(registers.accumulator, registers.yIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x98:
+        setRegister(registers.yIndex, registers.accumulator, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0xBA:
+        setRegister(registers.stackPointer, registers.xIndex, registers);
+        info.programCounter += 1;
+        return 2;
+    case 0x9A:
+        registers.stackPointer = registers.xIndex;
+        info.programCounter += 1;
+        return 2;
+
+    // Flags
+    case 0x18:
+        registers.setFlag(CARRY, 0);
+        info.programCounter += 1;
+        return 2;
+    case 0x38:
+        registers.setFlag(CARRY, 1);
+        info.programCounter += 1;
+        return 2;
+    case 0x78:
+        registers.setFlag(INTERRUPT, 1);
+        info.programCounter += 1;
+        return 2;
+    case 0xB8:
+        registers.setFlag(OFLOW, 0);
+        info.programCounter += 1;
+        return 2;
+    case 0xD8:
+        registers.setFlag(DECIMAL, 0);
+        info.programCounter += 1;
+        return 2;
+    case 0xF8:
+        registers.setFlag(DECIMAL, 1);
+        info.programCounter += 1;
+        return 2;
+
+    // Stack
+    case 0x08:
+        pushStack(registers.getStatus() | (1 << STACK),
+                  memory, registers.stackPointer);
+        info.programCounter += 1;
+        return 3;
+    case 0x28:
+        registers.setStatus((popStack(memory, registers.stackPointer) |
+                            (1 << IGNORE)) & ~(1 << STACK));
+        info.programCounter += 1;
+        return 4;
+    case 0x48:
+        pushStack(registers.accumulator, memory, registers.stackPointer);
+        info.programCounter += 1;
+        return 3;
+    case 0x68:
+        setRegister(popStack(memory, registers.stackPointer),
+                    registers.accumulator, registers);
+        info.programCounter += 1;
+        return 4;
+
+    // Jumps and returns
+    case 0x20:
+        pushStack(((info.programCounter + 2) >> 8) & 0xFF,
+                  memory, registers.stackPointer);
+        pushStack((info.programCounter + 2) & 0xFF,
+                  memory, registers.stackPointer);
+        info.programCounter = args.darg;
+        return 6;
+    case 0x40:
+    {
+        // TODO: Make sure this is correct. I don't think the
+        //       stack pointer is manipulated correctly.
+        registers.setStatus(popStack(memory, registers.stackPointer) |
+                            (1 << IGNORE));
+        const uint8_t low = popStack(memory, registers.stackPointer);
+        info.programCounter =
+                low | (popStack(memory, registers.stackPointer) << 8);
+        return 6;
+    }
+    case 0x4C:
+        info.programCounter = args.darg;
+        return 3;
+    case 0x60:
+    {
+        const uint8_t low = popStack(memory, registers.stackPointer);
+        info.programCounter =
+                low | (popStack(memory, registers.stackPointer) << 8);
+        info.programCounter += 1;
+        return 6;
+    }
+    case 0x6C:
+        info.programCounter = indirect(args, memory);
+        return 5;
+
+    // Branches
+    case 0x10:
+        return branch(!registers.getFlag(SIGN), args, info);
+    case 0x30:
+        return branch(registers.getFlag(SIGN), args, info);
+    case 0x50:
+        return branch(!registers.getFlag(OFLOW), args, info);
+    case 0x70:
+        return branch(registers.getFlag(OFLOW), args, info);
+    case 0x90:
+        return branch(!registers.getFlag(CARRY), args, info);
+    case 0xB0:
+        return branch(registers.getFlag(CARRY), args, info);
+    case 0xD0:
+        return branch(!registers.getFlag(ZERO), args, info);
+    case 0xF0:
+        return branch(registers.getFlag(ZERO), args, info);
+
+    case 0xEA:
+        info.programCounter += 1;
+        return 2;
+
+    default:
+        break;
+    }
+
+    throw std::runtime_error("Attempting to run null op");
+}
+
+/*****************************************************************************/
+template <typename BusT>
+uint8_t Interpreter6502::executeFused(uint8_t fusion,
+                                      const CPUArgs& first,
+                                      const CPUArgs& second,
+                                      CPURegisters& registers,
+                                      CPUInfo& info,
+                                      BusT& memory)
+{
+    uint8_t cycles = 0;
+
+    switch (fusion)
+    {
+    case FUSE_DEX_BNE:
+        return stepBranch(-1, registers.xIndex, second, registers, info);
+    case FUSE_DEY_BNE:
+        return stepBranch(-1, registers.yIndex, second, registers, info);
+    case FUSE_INX_BNE:
+        return stepBranch(1, registers.xIndex, second, registers, info);
+    case FUSE_INY_BNE:
+        return stepBranch(1, registers.yIndex, second, registers, info);
+    case FUSE_INX_CPX_IMMEDIATE:
+        return stepCompare(1, registers.xIndex, second, registers, info);
+    case FUSE_INY_CPY_IMMEDIATE:
+        return stepCompare(1, registers.yIndex, second, registers, info);
+    case FUSE_CMP_IMMEDIATE_BNE:
+        return 2 + compareBranch(first.arg1, registers.accumulator, false,
+                                 second, registers, info);
+    case FUSE_CMP_IMMEDIATE_BEQ:
+        return 2 + compareBranch(first.arg1, registers.accumulator, true,
+                                 second, registers, info);
+    case FUSE_CMP_ZERO_PAGE_BNE:
+        return 3 + compareBranch(memory.readByte(first.arg1),
+                                 registers.accumulator, false,
+                                 second, registers, info);
+    case FUSE_CMP_ZERO_PAGE_BEQ:
+        return 3 + compareBranch(memory.readByte(first.arg1),
+                                 registers.accumulator, true,
+                                 second, registers, info);
+    case FUSE_CPX_IMMEDIATE_BNE:
+        return 2 + compareBranch(first.arg1, registers.xIndex, false,
+                                 second, registers, info);
+    case FUSE_CPY_IMMEDIATE_BNE:
+        return 2 + compareBranch(first.arg1, registers.yIndex, false,
+                                 second, registers, info);
+    case FUSE_LDA_IMMEDIATE_STA_ZERO_PAGE:
+        setRegister(first.arg1, registers.accumulator, registers);
+        memory.writeByte(second.arg1, registers.accumulator);
+        info.programCounter += 4;
+        return 5;
+    case FUSE_LDA_IMMEDIATE_STA_ABSOLUTE:
+        setRegister(first.arg1, registers.accumulator, registers);
+        memory.writeByte(second.darg, registers.accumulator);
+        info.programCounter += 5;
+        return 6;
+    case FUSE_LDA_ABSOLUTE_STA_ABSOLUTE:
+        setRegister(memory.readByte(first.darg),
+                    registers.accumulator, registers);
+        memory.writeByte(second.darg, registers.accumulator);
+        info.programCounter += 6;
+        return 8;
+    case FUSE_LDA_ABSOLUTE_X_STA_ABSOLUTE_Y:
+        setRegister(memory.readByte(
+                            absoluteN(first, registers.xIndex, cycles)),
+                    registers.accumulator, registers);
+        memory.writeByte(
+                static_cast<uint16_t>(second.darg + registers.yIndex),
+                registers.accumulator);
+        info.programCounter += 6;
+        return 9 + cycles;
+    default:
+        break;
+    }
+
+    throw std::runtime_error("Attempting to run unknown superinstruction");
+}
+}
+}
+
+#endif
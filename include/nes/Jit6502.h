@@ -0,0 +1,161 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_JIT_6502_H__
+#define __NYRA_NES_JIT_6502_H__
+
+#include <stdint.h>
+#include <deque>
+#include <nes/BlockCache.h>
+#include <nes/CPUHelper.h>
+#include <nes/MemoryMap.h>
+#include <nes/NativeBlock.h>
+#include <nes/X64Emitter.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - Jit6502
+ *  \brief - Recompiles cached blocks into x86-64 code. The 6502
+ *           registers live in host registers and cycles are added up at
+ *           the block exits. A block that branches back to its own start
+ *           keeps looping in native code while the clock allows it.
+ *
+ *           Only instructions that touch plain RAM or ROM at addresses
+ *           known at compile time are compiled. A block is compiled up to
+ *           the first instruction that touches registers or uses an
+ *           indirect address, the interpreter runs the rest. Blocks in
+ *           writable memory are never compiled, so self modifying code
+ *           always runs in the interpreter. Writes to RAM bump the page
+ *           version the same way MemoryMap::writeByte does.
+ */
+class Jit6502
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Reserves memory for the native code. It is only made
+     *           writable while a block is copied in, the rest of the time
+     *           it is executable. If the host does not support it the JIT
+     *           is disabled.
+     */
+    Jit6502();
+
+    ~Jit6502();
+
+    /*
+     *  \func - isEnabled
+     *  \brief - Returns true if native code can be run on this host.
+     */
+    inline bool isEnabled() const
+    {
+        return mCode != nullptr;
+    }
+
+    /*
+     *  \func - isFull
+     *  \brief - Returns true if there may not be room for another block.
+     *           Call clear after dropping every reference to native code.
+     */
+    inline bool isFull() const
+    {
+        return mUsed + MAX_BLOCK_CODE > CODE_SIZE;
+    }
+
+    /*
+     *  \func - clear
+     *  \brief - Releases all native code.
+     */
+    void clear();
+
+    /*
+     *  \func - compile
+     *  \brief - Compiles the start of a block.
+     *
+     *  \param address - The address of the first instruction.
+     *  \param block - The decoded block.
+     *  \param memory - The memory the block runs against.
+     *  \return - The native block, or nullptr if the first instruction
+     *            could not be compiled.
+     *  \throw - If the code cannot be made executable again after it is
+     *           copied in.
+     */
+    const NativeBlock* compile(uint16_t address,
+                               const BlockCache::Block& block,
+                               const MemoryMap& memory);
+
+private:
+    bool compileInstruction(const BlockCache::Instruction& instruction,
+                            uint16_t address,
+                            const MemoryMap& memory,
+                            uint64_t budget,
+                            uint32_t& cycles,
+                            bool& exited);
+
+    bool canAddress(const BlockCache::Instruction& instruction,
+                    const MemoryMap& memory,
+                    bool write) const;
+
+    void emitAddress(const BlockCache::Instruction& instruction,
+                     const MemoryMap& memory,
+                     bool write);
+
+    void emitOperand(const BlockCache::Instruction& instruction,
+                     const MemoryMap& memory);
+
+    void emitWrite(const BlockCache::Instruction& instruction,
+                   const MemoryMap& memory,
+                   X64Emitter::Register value);
+
+    void emitModify(int operation);
+
+    void emitZeroSign(X64Emitter::Register value);
+
+    void emitPush(X64Emitter::Register value);
+
+    void emitPop(X64Emitter::Register value);
+
+    void emitExit(uint32_t cycles);
+
+    void emitExit(uint16_t programCounter, uint32_t cycles);
+
+    void emitBranch(uint16_t target, uint64_t budget, uint32_t cycles);
+
+    static const size_t CODE_SIZE = 4 * 1024 * 1024;
+    static const size_t MAX_BLOCK_CODE = 16 * 1024;
+
+    uint8_t* mCode;
+    size_t mUsed;
+    std::deque<NativeBlock> mBlocks;
+    X64Emitter mEmitter;
+    uint8_t* mStack;
+    const uint32_t* mStackVersion;
+    uint16_t mStart;
+    size_t mLoop;
+};
+}
+}
+
+#endif
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_MAPPED_FILE_H__
+#define __NYRA_NES_MAPPED_FILE_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - MappedFile
+ *  \brief - A whole file mapped read only into memory. The pages are
+ *           shared with the OS file cache, so loading the same file in
+ *           many processes does not copy it. Hosts without mmap read the
+ *           file into a buffer instead.
+ */
+class MappedFile
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Maps a file into memory.
+     *
+     *  \param pathname - The full path of the file on disk.
+     *  \throw - If the file cannot be opened or mapped.
+     */
+    MappedFile(const std::string& pathname);
+
+    /*
+     *  \func - Destructor
+     *  \brief - Unmaps the file.
+     */
+    ~MappedFile();
+
+    /*
+     *  \func - getData
+     *  \brief - Returns the contents of the file. This is nullptr if the
+     *           file is empty.
+     */
+    inline const uint8_t* getData() const
+    {
+        return mData;
+    }
+
+    /*
+     *  \func - getSize
+     *  \brief - Returns the size of the file in bytes.
+     */
+    inline size_t getSize() const
+    {
+        return mSize;
+    }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    const uint8_t* mData;
+    size_t mSize;
+    bool mMapped;
+    std::vector<uint8_t> mBuffer;
+};
+}
+}
+
+#endif
@@ -61,7 +61,21 @@ public:
      */
     virtual void writeByte(size_t address,
                            uint8_t value);
-    
+
+    /*
+     *  \func - writeRepeated
+     *  \brief - Writes the same byte to one address several times, as a
+     *           loop storing to a data port does. Registers can override
+     *           this to skip the per write dispatch.
+     *
+     *  \param address - The address to write to.
+     *  \param value - The 1 byte value to write.
+     *  \param count - The number of writes.
+     */
+    virtual void writeRepeated(size_t address,
+                               uint8_t value,
+                               size_t count);
+
     /*
      *  \func - readByte
      *  \brief - Reads a single byte from the memory structure.
@@ -92,6 +106,28 @@ public:
         return mSize;
     }
 
+    /*
+     *  \func - getReadBuffer
+     *  \brief - Returns the raw buffer behind this memory if it can be read
+     *           directly, without going through readByte. Memory with
+     *           read side effects (registers) returns nullptr.
+     */
+    virtual const uint8_t* getReadBuffer() const
+    {
+        return nullptr;
+    }
+
+    /*
+     *  \func - getWriteBuffer
+     *  \brief - Returns the raw buffer behind this memory if it can be
+     *           written directly, without going through writeByte. Read
+     *           only memory and registers return nullptr.
+     */
+    virtual uint8_t* getWriteBuffer()
+    {
+        return nullptr;
+    }
+
 protected:
     const size_t mSize;
 };
@@ -153,6 +189,15 @@ public:
         return mBuffer[address];
     }
 
+    /*
+     *  \func - getReadBuffer
+     *  \brief - ROM can always be read directly.
+     */
+    virtual const uint8_t* getReadBuffer() const
+    {
+        return mBuffer;
+    }
+
 protected:
     const std::unique_ptr<const uint8_t[]> mBufferInternal;
     const uint8_t* const mBuffer;
@@ -214,6 +259,15 @@ public:
         mRAMBuffer[address] = value;
     }
 
+    /*
+     *  \func - getWriteBuffer
+     *  \brief - RAM can always be written directly.
+     */
+    virtual uint8_t* getWriteBuffer()
+    {
+        return mRAMBuffer;
+    }
+
 private:
     uint8_t* const mRAMBuffer;
 };
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_MEMORY_MMC1_H__
+#define __NYRA_NES_MEMORY_MMC1_H__
+
+#include <nes/MemoryMapper.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - MemoryMMC1
+ *  \brief - The memory map for mapper 1. Registers are loaded one
+ *           bit at a time through a shift register. The fifth write picks
+ *           the register with bits 13 and 14 of its address: control,
+ *           CHR bank 0, CHR bank 1 or the PRG bank. Control selects the
+ *           mirroring, 32KB or 16KB PRG switching and 8KB or 4KB CHR
+ *           switching.
+ */
+class MemoryMMC1 : public MemoryMapper
+{
+public:
+    MemoryMMC1(const ROMBanks& prgROM,
+               PPU& ppu,
+               APU& apu,
+               Controller& controller1,
+               Controller& controller2);
+
+protected:
+    void writeRegister(size_t address,
+                       uint8_t value);
+
+    void applyBanks();
+
+    void saveRegisters(StateWriter& state) const;
+
+    void loadRegisters(StateReader& state);
+
+private:
+    uint8_t mShift;
+    uint8_t mShiftCount;
+    uint8_t mControl;
+    uint8_t mCHRBank0;
+    uint8_t mCHRBank1;
+    uint8_t mPRGBank;
+};
+}
+}
+#endif
@@ -29,6 +29,7 @@
 #include <vector>
 #include <nes/Memory.h>
 #include <nes/CPUHelper.h>
+#include <nes/SaveState.h>
 
 namespace nyra
 {
@@ -38,6 +39,12 @@ namespace nes
  *  \class - MemoryMap
  *  \brief - Holds banks of memory which can then be read as it it was one
  *           contiguous buffer.
+ *
+ *           The address space is split into 256 byte pages. A page backed by
+ *           plain RAM or ROM holds a direct pointer, so an access is a shift
+ *           and a load. Pages backed by registers go through the virtual
+ *           Memory interface. Pages shared by several small banks fall back
+ *           to a per byte table.
  */
 class MemoryMap
 {
@@ -59,7 +66,53 @@ private:
         size_t offset;
     };
 
+    struct Page
+    {
+        Page();
+
+        // Direct pointers for the page. These are offset so they can be
+        // indexed by the low byte of the address. If they are nullptr the
+        // access goes through memory.
+        const uint8_t* read;
+        uint8_t* write;
+
+        // Handler used when there is no direct pointer. The bank address
+        // is ((address - offset) & mask). If memory is nullptr the page is
+        // shared between banks and each byte is found in mByteHandles
+        // starting at byteHandles.
+        Memory* memory;
+        size_t offset;
+        size_t mask;
+        size_t byteHandles;
+
+        // Bumped whenever the page is rebuilt. Once the page holds code
+        // the direct write pointer is moved to codeWrite so writes go
+        // through the handler and bump the version as well. Mirrors of a
+        // code page share one version.
+        uint32_t* version;
+        uint8_t* codeWrite;
+    };
+
 public:
+    /*
+     *  \enum - Bus
+     *  \brief - The concrete bus behind the map. Cores can run against
+     *           it instead of the map so address decoding is resolved at
+     *           compile time.
+     */
+    enum Bus
+    {
+        BUS_MEMORY_MAP,
+        BUS_NROM
+    };
+
+    /*
+     *  \func - Constructor
+     *  \brief - Creates an empty MemoryMap. Every address is unmapped
+     *           until banks are set and the table is locked.
+     */
+    MemoryMap();
+
     virtual ~MemoryMap();
 
     /*
@@ -76,6 +129,21 @@ public:
         mMemory.push_back(MemoryHandle(memoryOffset, memory));
     }
 
+    /*
+     *  \func - switchBank
+     *  \brief - Replaces the bank mapped at an offset with another bank of
+     *           the same size. Only the pages the bank covers are rebuilt,
+     *           so this is cheap enough for mappers to call on every
+     *           register write. Passing the bank that is already there
+     *           rebuilds its pages, for memory that changed its buffer.
+     *           The table must be locked.
+     *
+     *  \param memoryOffset - The starting address of the bank.
+     *  \param memory - The memory object that will go into this address.
+     *  \throw - If no bank of the same size starts at the offset.
+     */
+    void switchBank(size_t memoryOffset, Memory& memory);
+
     /*
      *  \func - writeByte
      *  \brief - Write a single byte into MemoryMap.
@@ -85,9 +153,40 @@ public:
      */
     inline void writeByte(size_t address, uint8_t value)
     {
-        getMemoryBank(address).memory->writeByte(address, value);
+        const Page& page = mPages[address >> PAGE_SHIFT];
+        if (page.write)
+        {
+            page.write[address & PAGE_MASK] = value;
+        }
+        else
+        {
+            writeHandler(address, value);
+        }
     }
 
+    /*
+     *  \func - fillBytes
+     *  \brief - Writes a value to a run of addresses, wrapping at the end
+     *           of the address space. This ends up the same as calling
+     *           writeByte for each address in order.
+     *
+     *  \param address - The global address of the first byte.
+     *  \param value - The value to write.
+     *  \param count - The number of bytes to write.
+     */
+    void fillBytes(size_t address, uint8_t value, size_t count);
+
+    /*
+     *  \func - writeRepeated
+     *  \brief - Writes a value to the same address several times. This
+     *           ends up the same as calling writeByte that many times.
+     *
+     *  \param address - The global address to write to.
+     *  \param value - The value to write.
+     *  \param count - The number of writes.
+     */
+    void writeRepeated(size_t address, uint8_t value, size_t count);
+
     /*
      *  \func - getOpInfo
      *  \brief - Used to get all potential information about an operation
@@ -97,17 +196,23 @@ public:
      *  \param args[OUTPUT] - The output for all op arg information.
      */
     inline void getOpInfo(size_t address,
-                          CPUArgs& args)
+                          CPUArgs& args) const
     {
-        const MemoryHandle& handle = getMemoryBank(address);
-        args.opcode = handle.memory->readByte(address);
-        args.arg1 = handle.memory->readByte(address + 1);
-        args.arg2 = handle.memory->readByte(address + 2);
-
-        // TODO: Is it safe to get the dword in this way? Should we instead
-        //       call MemoryMap::readShort as this has extra statements to
-        //       protect against going out of bounds in a memory bank.
-        args.darg = handle.memory->readShort(address + 1);
+        const Page& page = mPages[address >> PAGE_SHIFT];
+        const size_t index = address & PAGE_MASK;
+        if (page.read && index < PAGE_SIZE - 2)
+        {
+            args.opcode = page.read[index];
+            args.arg1 = page.read[index + 1];
+            args.arg2 = page.read[index + 2];
+        }
+        else
+        {
+            args.opcode = readByte(address);
+            args.arg1 = readByte((address + 1) & ADDRESS_MASK);
+            args.arg2 = readByte((address + 2) & ADDRESS_MASK);
+        }
+        args.darg = (args.arg2 << 8) | args.arg1;
     }
 
     /*
@@ -119,7 +224,27 @@ public:
      */
     inline uint8_t readByte(size_t address) const
     {
-        return getMemoryBank(address).memory->readByte(address);
+        const Page& page = mPages[address >> PAGE_SHIFT];
+        if (page.read)
+        {
+            return page.read[address & PAGE_MASK];
+        }
+        return readHandler(address);
+    }
+
+    /*
+     *  \func peekByte
+     *  \brief - Reads a single byte without side effects. Registers can
+     *           change state when they are read, so they are not read and
+     *           show up as 0xFF instead.
+     *
+     *  \param address - The global adddress to read from.
+     *  \return - The value at that address, or 0xFF for a register.
+     */
+    inline uint8_t peekByte(size_t address) const
+    {
+        const uint8_t* page = mPages[address >> PAGE_SHIFT].read;
+        return page ? page[address & PAGE_MASK] : 0xFF;
     }
 
     /*
@@ -133,13 +258,123 @@ public:
      */
     uint16_t readShort(size_t address) const;
 
-    void lockLookUpTable();
+    /*
+     *  \func getReadPage
+     *  \brief - Returns the direct read pointer of the page holding an
+     *           address. It is indexed by the low byte of the address.
+     *           This is nullptr if the page is not plain RAM or ROM.
+     */
+    inline const uint8_t* getReadPage(size_t address) const
+    {
+        return mPages[address >> PAGE_SHIFT].read;
+    }
+
+    /*
+     *  \func getWritePage
+     *  \brief - Returns the buffer behind a writable page, indexed by the
+     *           low byte of the address. This ignores code watching, so
+     *           anything writing through it must bump the page version.
+     *           This is nullptr if the page is not plain RAM.
+     */
+    inline uint8_t* getWritePage(size_t address) const
+    {
+        const Page& page = mPages[address >> PAGE_SHIFT];
+        return page.write ? page.write : page.codeWrite;
+    }
+
+    /*
+     *  \func getPageVersion
+     *  \brief - Returns the version counter of the page holding an
+     *           address. Anything decoded from the page is stale once the
+     *           counter or the pointer itself changes.
+     */
+    inline const uint32_t* getPageVersion(size_t address) const
+    {
+        return mPages[address >> PAGE_SHIFT].version;
+    }
+
+    inline uint32_t* getPageVersion(size_t address)
+    {
+        return mPages[address >> PAGE_SHIFT].version;
+    }
+
+    /*
+     *  \func watchCode
+     *  \brief - Marks the page holding an address, and every mirror of it,
+     *           as holding code. Writes to the page then bump its version.
+     *           This does nothing for pages that cannot be written.
+     */
+    void watchCode(size_t address);
+
+    /*
+     *  \func getLayoutVersion
+     *  \brief - Returns a counter that is bumped whenever any page is
+     *           rebuilt, for example when a bank is switched in.
+     */
+    inline uint32_t getLayoutVersion() const
+    {
+        return mLayoutVersion;
+    }
+
+    /*
+     *  \func getBus
+     *  \brief - Returns the concrete bus behind the map. This is
+     *           BUS_MEMORY_MAP until a subclass has locked its bus.
+     */
+    inline Bus getBus() const
+    {
+        return mBus;
+    }
+
+    /*
+     *  \func lockLookUpTable
+     *  \brief - Builds the page table from the memory banks. This must be
+     *           called after all banks are set and before the map is used.
+     *           Subclasses build their bus here.
+     */
+    virtual void lockLookUpTable();
+
+    /*
+     *  \func saveState
+     *  \brief - Writes the contents of every writable bank into a save
+     *           state. Mirrored banks are only written once.
+     */
+    virtual void saveState(StateWriter& state) const;
+
+    /*
+     *  \func loadState
+     *  \brief - Restores the writable banks from a save state. The map
+     *           must have the same banks as when the state was saved.
+     */
+    virtual void loadState(StateReader& state);
+
+protected:
+    inline void setBus(Bus bus)
+    {
+        mBus = bus;
+    }
 
 private:
-    const MemoryHandle& getMemoryBank(size_t& address) const;
+    static const size_t PAGE_SHIFT = 8;
+    static const size_t PAGE_SIZE = 1 << PAGE_SHIFT;
+    static const size_t PAGE_MASK = PAGE_SIZE - 1;
+    static const size_t ADDRESS_MASK = 0xFFFF;
+    static const size_t NUM_PAGES = (ADDRESS_MASK + 1) >> PAGE_SHIFT;
+    static const uint16_t UNMAPPED;
+
+    uint8_t readHandler(size_t address) const;
+
+    void writeHandler(size_t address, uint8_t value);
+
+    void buildPage(size_t page);
 
     std::vector<MemoryHandle> mMemory;
-    std::vector<size_t> mLookUpTable;
+    std::vector<Page> mPages;
+    std::vector<uint16_t> mByteHandles;
+    std::vector<Memory*> mStateBanks;
+    std::vector<uint32_t> mVersions;
+    uint32_t mLayoutVersion;
+    Bus mBus;
 };
 }
 }
@@ -0,0 +1,194 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_MEMORY_MAPPER_H__
+#define __NYRA_NES_MEMORY_MAPPER_H__
+
+#include <nes/MemorySystem.h>
+#include <nes/Memory.h>
+#include <nes/PPU.h>
+#include <nes/VRAM.h>
+#include <nes/Constants.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - MemoryMapper
+ *  \brief - The base of memory maps for cartridges that switch banks.
+ *           PRG ROM is seen through two 16KB windows at 0x8000 and
+ *           0xC000 and CHR through the two 4KB pattern tables in VRAM.
+ *           Switching a bank only rebuilds the pages it covers. Writes
+ *           to PRG ROM go to writeRegister.
+ *
+ *           Subclasses keep their own registers and switch banks to
+ *           match them in applyBanks.
+ */
+class MemoryMapper : public MemorySystem
+{
+public:
+    MemoryMapper(const ROMBanks& prgROM,
+                 PPU& ppu,
+                 APU& apu,
+                 Controller& controller1,
+                 Controller& controller2);
+
+    /*
+     *  \func - lockLookUpTable
+     *  \brief - Builds the page table and then switches in the banks
+     *           selected by the registers.
+     */
+    void lockLookUpTable();
+
+    /*
+     *  \func - saveState
+     *  \brief - Writes the writable banks and then the registers.
+     */
+    void saveState(StateWriter& state) const;
+
+    /*
+     *  \func - loadState
+     *  \brief - Restores the writable banks and the registers, then
+     *           switches in the banks they select.
+     */
+    void loadState(StateReader& state);
+
+protected:
+    static const size_t PRG_BANK_SIZE = 0x4000;
+    static const size_t PRG_START = 0x8000;
+
+    /*
+     *  \func - writeRegister
+     *  \brief - Handles a CPU write to PRG ROM.
+     *
+     *  \param address - The CPU address, from 0x8000 to 0xFFFF.
+     *  \param value - The value written.
+     */
+    virtual void writeRegister(size_t address,
+                               uint8_t value) = 0;
+
+    /*
+     *  \func - applyBanks
+     *  \brief - Switches in the banks and mirroring selected by the
+     *           current registers.
+     */
+    virtual void applyBanks() = 0;
+
+    /*
+     *  \func - saveRegisters
+     *  \brief - Writes the registers into a save state.
+     */
+    virtual void saveRegisters(StateWriter& state) const = 0;
+
+    /*
+     *  \func - loadRegisters
+     *  \brief - Restores the registers from a save state.
+     *  \throw - If the state holds values the registers cannot.
+     */
+    virtual void loadRegisters(StateReader& state) = 0;
+
+    /*
+     *  \func - switchPRG
+     *  \brief - Shows a 16KB PRG bank in a window. The bank wraps around
+     *           the number of banks, like the unused high bits of a bank
+     *           register. Nothing is rebuilt if it is already there.
+     *
+     *  \param window - 0 for 0x8000 or 1 for 0xC000.
+     *  \param bank - The index of the 16KB bank.
+     */
+    void switchPRG(size_t window,
+                   size_t bank);
+
+    /*
+     *  \func - switchCHR
+     *  \brief - Shows a 4KB CHR bank in a pattern table. The bank wraps
+     *           around the number of banks.
+     *
+     *  \param table - 0 for 0x0000 or 1 for 0x1000.
+     *  \param bank - The index of the 4KB bank.
+     */
+    void switchCHR(size_t table,
+                   size_t bank);
+
+    /*
+     *  \func - setMirroring
+     *  \brief - Changes the nametable mirroring.
+     */
+    inline void setMirroring(Mirroring mirroring)
+    {
+        mVRAM.setMirroring(mirroring);
+    }
+
+    inline size_t getNumPRGBanks() const
+    {
+        return mPRGROM.size();
+    }
+
+    inline size_t getNumCHRBanks() const
+    {
+        return mVRAM.getNumPatternBanks();
+    }
+
+private:
+    /*
+     *  \class - Window
+     *  \brief - A 16KB window of PRG ROM. Reads come straight from the
+     *           bank it shows, writes go to the mapper registers.
+     */
+    class Window : public Memory
+    {
+    public:
+        Window(MemoryMapper& mapper,
+               size_t address,
+               const ROM& bank);
+
+        virtual uint8_t readByte(size_t address)
+        {
+            return mBank->getReadBuffer()[address];
+        }
+
+        virtual void writeByte(size_t address,
+                               uint8_t value)
+        {
+            mMapper.writeRegister(mAddress + address, value);
+        }
+
+        virtual const uint8_t* getReadBuffer() const
+        {
+            return mBank->getReadBuffer();
+        }
+
+        MemoryMapper& mMapper;
+        const size_t mAddress;
+        const ROM* mBank;
+    };
+
+    const ROMBanks& mPRGROM;
+    VRAM& mVRAM;
+    Window mWindows[2];
+};
+}
+}
+
+#endif
@@ -24,8 +24,10 @@
 #ifndef __NYRA_NES_MEMORY_NROM_H__
 #define __NYRA_NES_MEMORY_NROM_H__
 
+#include <memory>
 #include <nes/MemorySystem.h>
 #include <nes/Memory.h>
+#include <nes/NROMBus.h>
 #include <nes/PPURegisters.h>
 #include <nes/Constants.h>
 
@@ -33,6 +35,11 @@ namespace nyra
 {
 namespace nes
 {
+/*
+ *  \class - MemoryNROM
+ *  \brief - The memory map for mapper 0. The PRG banks never move, so
+ *           once the map is locked it also provides an NROMBus.
+ */
 class MemoryNROM : public MemorySystem
 {
 public:
@@ -41,6 +48,27 @@ public:
                APU& apu,
                Controller& controller1,
                Controller& controller2);
+
+    /*
+     *  \func - lockLookUpTable
+     *  \brief - Builds the page table and then the bus over it.
+     */
+    void lockLookUpTable();
+
+    /*
+     *  \func - getNROMBus
+     *  \brief - Returns the bus. This is only valid once getBus returns
+     *           BUS_NROM.
+     */
+    inline NROMBus& getNROMBus()
+    {
+        return *mBus;
+    }
+
+private:
+    const ROMBanks& mPRGROM;
+    PPURegisters& mPPU;
+    std::unique_ptr<NROMBus> mBus;
 };
 }
 }
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_MEMORY_UXROM_H__
+#define __NYRA_NES_MEMORY_UXROM_H__
+
+#include <nes/MemoryMapper.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - MemoryUxROM
+ *  \brief - The memory map for mapper 2. Any write to PRG ROM picks
+ *           the 16KB bank at 0x8000, the last bank stays at 0xC000.
+ *           Boards without CHR ROM have 8KB of CHR RAM.
+ */
+class MemoryUxROM : public MemoryMapper
+{
+public:
+    MemoryUxROM(const ROMBanks& prgROM,
+                PPU& ppu,
+                APU& apu,
+                Controller& controller1,
+                Controller& controller2);
+
+protected:
+    void writeRegister(size_t address,
+                       uint8_t value);
+
+    void applyBanks();
+
+    void saveRegisters(StateWriter& state) const;
+
+    void loadRegisters(StateReader& state);
+
+private:
+    uint8_t mBank;
+};
+}
+}
+#endif
@@ -32,85 +32,60 @@ namespace nyra
 namespace nes
 {
 /*
- *  \class - Mode
- *  \brief - Used to determine how the arguments are used. Like the OpCode
- *           this is heavily abstracted.
+ *  \struct - Operand
+ *  \brief - What a mode works out for an op. The CPU owns this while an
+ *           instruction runs, so modes and ops hold no state of their own
+ *           and one set of them is shared by every CPU.
  */
-class Mode
+struct Operand
 {
-public:
     /*
      *  \func - Constructor
-     *  \brief - Sets up a Mode object.
-     *
-     *  \param useArg1 - Does this Mode use the first byte argument?
-     *  \param useArg2 - Does this Mode use the second byte argument?
-     *  \NOTE: If the mode uses both arguments as a single 2 byte value,
-     *         pass in true for both parameters.
+     *  \brief - Creates a zeroed operand.
      */
-    Mode(bool usesArg1, bool usesArg2);
-
-    /*
-     *  \func - Destructor
-     *  \brief - Used to create reliable inheritance.
-     */
-    virtual ~Mode();
-
-    /*
-     *  \func - useArg1
-     *  \brief - returns true if this mode uses arg1.
-     */
-    virtual bool usesArg1() const
+    Operand() :
+        arg(0),
+        value(0)
     {
-        return mUsesArg1;
     }
 
-    /*
-     *  \func - useArg2
-     *  \brief - returns true if this mode uses arg2.
-     */
-    virtual bool usesArg2() const
-    {
-        return mUsesArg2;
-    }
+    // The address the op works on, or the value itself for the immediate
+    // and accumulator modes.
+    uint16_t arg;
 
-    /*
-     *  \func - getArg
-     *  \brief - Gets the argument.
-     */
-    inline uint16_t getArg() const
-    {
-        return mArg;
-    }
+    // The value at the address. This is mode independent.
+    uint8_t value;
+};
 
+/*
+ *  \class - Mode
+ *  \brief - Used to determine how the arguments are used. Like the OpCode
+ *           this is heavily abstracted.
+ */
+class Mode
+{
+public:
     /*
-     *  \func - getValue
-     *  \brief - Gets the calculated value. This is mode independent.
+     *  \func - Destructor
+     *  \brief - Used to create reliable inheritance.
      */
-    inline uint8_t getValue() const
-    {
-        return mValue;
-    }
+    virtual ~Mode();
 
     /*
-     *  \func - getValue
+     *  \func - operator(functor)
      *  \brief - Process all mode information
      *
      *  \param args - The input arguments to the mode.
      *  \param registers - The current CPU registers
      *  \param memory - The filled out memory banks
      *  \param info - The current CPU info struct.
+     *  \param operand [OUTPUT] - The address and value for the op.
      */
     virtual void operator()(const CPUArgs& args,
                             const CPURegisters& registers,
                             const MemoryMap& memory,
-                            CPUInfo& info) = 0;
-
-protected:
-    const bool mUsesArg1;
-    const bool mUsesArg2;
-    uint16_t mArg;
-    uint8_t mValue;
+                            CPUInfo& info,
+                            Operand& operand) const = 0;
 };
 }
 }
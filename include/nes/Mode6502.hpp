@@ -25,52 +25,67 @@
 #define __NYRA_NES_MODE_6502_HPP__
 
 #include <nes/OpCode.h>
+#include <nes/TracePolicy.h>
 
-/*****************************************************************************/
-// TODO: Most of the modes have extra unnecessary operations which are used to
-//       match a known debug string output. There needs to be a way to remove
-//       theses. Maybe with a #ifdef DEBUG or something similar.
-/*****************************************************************************/
 namespace nyra
 {
 namespace nes
 {
 /*****************************************************************************/
-class ModeAccumulator : public Mode
+// How an op uses the value at the address a mode works out. Stores only
+// show the old value in the disassembly, so it is only looked at when the
+// trace policy records it. Reading some registers has side effects, so
+// that look never goes through a register. Jumps never read the value.
+enum Access
 {
-public:
-    ModeAccumulator() :
-        Mode(false, false)
+    ACCESS_READ,
+    ACCESS_TRACE,
+    ACCESS_NONE
+};
+
+/*****************************************************************************/
+template <typename TraceT, Access AccessT>
+inline uint8_t readValue(const MemoryMap& memory, size_t address)
+{
+    if (AccessT == ACCESS_READ)
     {
+        return memory.readByte(address);
     }
+    if (AccessT == ACCESS_TRACE && TraceT::RECORD)
+    {
+        return memory.peekByte(address);
+    }
+    return 0;
+}
 
+/*****************************************************************************/
+class ModeAccumulator : public Mode
+{
+public:
     void operator()(const CPUArgs& ,
                     const CPURegisters& registers,
                     const MemoryMap& ,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mValue = registers.accumulator;
-        mArg = mValue;
+        operand.value = registers.accumulator;
+        operand.arg = operand.value;
     }
 };
 
 /*****************************************************************************/
-template <bool OutputT>
+template <typename TraceT, Access AccessT = ACCESS_READ>
 class ModeAbsolute : public Mode
 {
 public:
-    ModeAbsolute() :
-        Mode(true, true)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& ,
                     const MemoryMap& memory,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mArg = args.darg;
-        mValue = OutputT ? memory.readByte(mArg) : 0;
+        operand.arg = args.darg;
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
     }
 };
 
@@ -78,105 +93,69 @@ public:
 class ModeIndirect : public Mode
 {
 public:
-    ModeIndirect() :
-        Mode(true, true),
-        mOrigArg(0),
-        mCorrectArg(0)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& ,
                     const MemoryMap& memory,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mOrigArg = args.darg;
-        mCorrectArg = memory.readShort(mOrigArg);
-
         // There is a bug in 6502. If we try to get the address at 0xXXFF,
         // it does not go to the next digit properly.
         if (args.arg1 == 0xFF)
         {
             const uint8_t high = memory.readByte(args.darg);
             const uint16_t low = memory.readByte(args.arg2 << 8);
-            mArg = (low << 8) | high;
+            operand.arg = (low << 8) | high;
         }
         else
         {
-            mArg = mCorrectArg;
+            operand.arg = memory.readShort(args.darg);
         }
     }
-
-private:
-    uint16_t mOrigArg;
-    uint16_t mCorrectArg;
 };
 
 /*****************************************************************************/
+template <typename TraceT, Access AccessT = ACCESS_READ>
 class ModeIndirectX : public Mode
 {
 public:
-    ModeIndirectX() :
-        Mode(true, false),
-        mOrigArg(0),
-        mModArg(0)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& registers,
                     const MemoryMap& memory,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mOrigArg = args.arg1;
-        mModArg = (args.arg1 + registers.xIndex) & 0xFF;
-        mArg = memory.readShort(mModArg);
-        mValue = memory.readByte(mArg);
+        const uint8_t modArg = (args.arg1 + registers.xIndex) & 0xFF;
+        operand.arg = memory.readShort(modArg);
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
     }
-
-private:
-    uint8_t mOrigArg;
-    uint8_t mModArg;
 };
 
 /*****************************************************************************/
+template <typename TraceT, Access AccessT>
 class ModeZeroPageN : public Mode
 {
 public:
-    ModeZeroPageN(char index) :
-        Mode(true, false),
-        mOrigArg(0),
-        mIndex(index)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& registers,
                     const MemoryMap& memory,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mOrigArg = args.arg1;
-        mArg = (mOrigArg + getIndex(registers)) & 0xFF;
-        mValue = memory.readByte(mArg);
+        operand.arg = (args.arg1 + getIndex(registers)) & 0xFF;
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
     }
 
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const = 0;
-
-    uint8_t mOrigArg;
-    const char mIndex;
 };
 
 /*****************************************************************************/
-class ModeZeroPageX : public ModeZeroPageN
+template <typename TraceT, Access AccessT = ACCESS_READ>
+class ModeZeroPageX : public ModeZeroPageN<TraceT, AccessT>
 {
 public:
-    ModeZeroPageX() :
-        ModeZeroPageN('X')
-    {
-    }
-
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const
@@ -186,14 +165,10 @@ private:
 };
 
 /*****************************************************************************/
-class ModeZeroPageY : public ModeZeroPageN
+template <typename TraceT, Access AccessT = ACCESS_READ>
+class ModeZeroPageY : public ModeZeroPageN<TraceT, AccessT>
 {
 public:
-    ModeZeroPageY() :
-        ModeZeroPageN('Y')
-    {
-    }
-
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const
@@ -203,29 +178,22 @@ private:
 };
 
 /*****************************************************************************/
-template <bool ExtraCycleT>
+template <typename TraceT, bool ExtraCycleT, Access AccessT>
 class ModeAbsoluteN : public Mode
 {
 public:
-    ModeAbsoluteN(char index) :
-        Mode(true, true),
-        mOrigArg(0),
-        mIndex(index)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& registers,
                     const MemoryMap& memory,
-                    CPUInfo& info)
+                    CPUInfo& info,
+                    Operand& operand) const
     {
-        mOrigArg = args.darg;
-        mArg = mOrigArg + getIndex(registers);
-        mValue = memory.readByte(mArg);
+        operand.arg = args.darg + getIndex(registers);
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
 
         if (ExtraCycleT)
         {
-            if ((mOrigArg & 0xFF00) != (mArg & 0xFF00))
+            if ((args.darg & 0xFF00) != (operand.arg & 0xFF00))
             {
                 info.cycles += 3;
             }
@@ -235,21 +203,13 @@ public:
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const = 0;
-
-    uint16_t mOrigArg;
-    const char mIndex;
 };
 
 /*****************************************************************************/
-template <bool ExtraCycleT>
-class ModeAbsoluteY : public ModeAbsoluteN<ExtraCycleT>
+template <typename TraceT, bool ExtraCycleT, Access AccessT = ACCESS_READ>
+class ModeAbsoluteY : public ModeAbsoluteN<TraceT, ExtraCycleT, AccessT>
 {
 public:
-    ModeAbsoluteY() :
-        ModeAbsoluteN<ExtraCycleT>('Y')
-    {
-    }
-
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const
@@ -259,15 +219,10 @@ private:
 };
 
 /*****************************************************************************/
-template <bool ExtraCycleT>
-class ModeAbsoluteX : public ModeAbsoluteN<ExtraCycleT>
+template <typename TraceT, bool ExtraCycleT, Access AccessT = ACCESS_READ>
+class ModeAbsoluteX : public ModeAbsoluteN<TraceT, ExtraCycleT, AccessT>
 {
 public:
-    ModeAbsoluteX() :
-        ModeAbsoluteN<ExtraCycleT>('X')
-    {
-    }
-
 private:
     virtual uint8_t getIndex(
             const CPURegisters& registers) const
@@ -277,77 +232,60 @@ private:
 };
 
 /*****************************************************************************/
-template <bool ExtraCycleT>
+template <typename TraceT, bool ExtraCycleT, Access AccessT = ACCESS_READ>
 class ModeIndirectY : public Mode
 {
 public:
-    ModeIndirectY() :
-        Mode(true, false),
-        mOrigArg(0),
-        mModArg(0)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& registers,
                     const MemoryMap& memory,
-                    CPUInfo& info)
+                    CPUInfo& info,
+                    Operand& operand) const
     {
-        mOrigArg = args.arg1;
-        mModArg = memory.readShort(mOrigArg);
-        mArg = mModArg + registers.yIndex;
-        mValue = memory.readByte(mArg);
+        const uint16_t modArg = memory.readShort(args.arg1);
+        operand.arg = modArg + registers.yIndex;
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
 
         if (ExtraCycleT)
         {
-            if ((mOrigArg == 0xFF) || ((mModArg & 0xFF00) != (mArg & 0xFF00)))
+            if ((args.arg1 == 0xFF) ||
+                ((modArg & 0xFF00) != (operand.arg & 0xFF00)))
             {
                 info.cycles += 3;
             }
         }
     }
-
-private:
-    uint8_t mOrigArg;
-    uint16_t mModArg;
 };
 
 /*****************************************************************************/
 class ModeRelative : public Mode
 {
 public:
-    ModeRelative() :
-        Mode(true, false)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& ,
                     const MemoryMap& ,
-                    CPUInfo& info)
+                    CPUInfo& info,
+                    Operand& operand) const
     {
         // Value is never used for relative mode
-        mArg = info.programCounter + static_cast<int8_t>(args.arg1) + 2;
-
+        operand.arg = info.programCounter +
+                static_cast<int8_t>(args.arg1) + 2;
     }
 };
 
 /*****************************************************************************/
+template <typename TraceT, Access AccessT = ACCESS_READ>
 class ModeZeroPage : public Mode
 {
 public:
-    ModeZeroPage() :
-        Mode(true, false)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& ,
                     const MemoryMap& memory,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mArg = args.arg1;
-        mValue = memory.readByte(mArg);
+        operand.arg = args.arg1;
+        operand.value = readValue<TraceT, AccessT>(memory, operand.arg);
     }
 };
 
@@ -355,18 +293,14 @@ public:
 class ModeImmediate : public Mode
 {
 public:
-    ModeImmediate() :
-        Mode(true, false)
-    {
-    }
-
     void operator()(const CPUArgs& args,
                     const CPURegisters& ,
                     const MemoryMap& ,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& operand) const
     {
-        mValue = args.arg1;
-        mArg = mValue;
+        operand.value = args.arg1;
+        operand.arg = operand.value;
     }
 };
 
@@ -374,11 +308,6 @@ public:
 class ModeImplied : public Mode
 {
 public:
-    ModeImplied() :
-        Mode(false, false)
-    {
-    }
-
     std::string toString() const
     {
         return "";
@@ -387,7 +316,8 @@ public:
     void operator()(const CPUArgs& ,
                     const CPURegisters& ,
                     const MemoryMap& ,
-                    CPUInfo& )
+                    CPUInfo& ,
+                    Operand& ) const
     {
         // Nothing to do here
     }
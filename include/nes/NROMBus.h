@@ -0,0 +1,136 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_NROM_BUS_H__
+#define __NYRA_NES_NROM_BUS_H__
+
+#include <stdint.h>
+#include <nes/Constants.h>
+#include <nes/MemoryMap.h>
+#include <nes/PPURegisters.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - NROMBus
+ *  \brief - The CPU address space of an NROM cartridge with the decoding
+ *           resolved at compile time. RAM is mirrored with & 0x7FF, the
+ *           PPU registers with & 7 and PRG ROM is read through fixed
+ *           pointers. Everything else goes through the MemoryMap. The
+ *           interpreter is instantiated on this type so the whole fetch
+ *           and execute path can be inlined.
+ */
+class NROMBus
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Creates a bus over an NROM memory map. The map must be
+     *           locked, the RAM pages are taken from its page table.
+     *
+     *  \param memory - The locked memory map for the cartridge.
+     *  \param ppu - The PPU registers mapped at 0x2000.
+     *  \param prgROM - One or two 16KB PRG banks.
+     */
+    NROMBus(MemoryMap& memory,
+            PPURegisters& ppu,
+            const ROMBanks& prgROM);
+
+    /*
+     *  \func - readByte
+     *  \brief - Reads a single byte, the same as MemoryMap::readByte.
+     */
+    inline uint8_t readByte(size_t address) const
+    {
+        if (address < PPU_START)
+        {
+            return mRAMPages[(address & RAM_MASK) >> 8][address & 0xFF];
+        }
+        if (address >= PRG_START)
+        {
+            return mPRG[(address >> 14) & 1][address & PRG_MASK];
+        }
+        if (address < PPU_END)
+        {
+            return mPPU.PPURegisters::readByte(address & PPU_MASK);
+        }
+        return mMemory.readByte(address);
+    }
+
+    /*
+     *  \func - readShort
+     *  \brief - Reads a little endian short, the same as
+     *           MemoryMap::readShort. Reads from the zero page wrap
+     *           inside it.
+     */
+    inline uint16_t readShort(size_t address) const
+    {
+        const uint16_t ret = readByte(address);
+        const size_t next = (address >= 0x0100) ?
+                ((address + 1) & 0xFFFF) : ((address + 1) & 0xFF);
+        return (readByte(next) << 8) | ret;
+    }
+
+    /*
+     *  \func - writeByte
+     *  \brief - Writes a single byte, the same as MemoryMap::writeByte.
+     *           RAM writes always bump the page version, so code decoded
+     *           from RAM is invalidated without checking whether the page
+     *           is watched.
+     */
+    inline void writeByte(size_t address, uint8_t value)
+    {
+        if (address < PPU_START)
+        {
+            const size_t page = (address & RAM_MASK) >> 8;
+            mRAMPages[page][address & 0xFF] = value;
+            ++(*mRAMVersions[page]);
+        }
+        else if (address < PPU_END)
+        {
+            mPPU.PPURegisters::writeByte(address & PPU_MASK, value);
+        }
+        else
+        {
+            mMemory.writeByte(address, value);
+        }
+    }
+
+private:
+    static const size_t RAM_PAGES = 8;
+    static const size_t RAM_MASK = 0x07FF;
+    static const size_t PRG_START = 0x8000;
+    static const size_t PRG_MASK = 0x3FFF;
+
+    MemoryMap& mMemory;
+    PPURegisters& mPPU;
+    uint8_t* mRAMPages[RAM_PAGES];
+    uint32_t* mRAMVersions[RAM_PAGES];
+    const uint8_t* mPRG[2];
+};
+}
+}
+
+#endif
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_NATIVE_BLOCK_H__
+#define __NYRA_NES_NATIVE_BLOCK_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <algorithm>
+#include <nes/CPUHelper.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \struct - NativeContext
+ *  \brief - The 6502 state handed to native code. The registers are
+ *           loaded into host registers on entry and written back on exit.
+ *           zeroSign holds the Z and N flags for every byte value.
+ *           remaining is the number of PPU cycles left before the target
+ *           clock, loops inside native code stop before reaching it.
+ *
+ *           Code compiled ahead of time cannot hold host pointers, so it
+ *           reaches each page of the 2KB of internal RAM through ramPages
+ *           and bumps the page versions through ramVersions.
+ */
+struct NativeContext
+{
+    static const size_t RAM_PAGES = 8;
+
+    NativeContext() :
+        accumulator(0),
+        xIndex(0),
+        yIndex(0),
+        stackPointer(0),
+        status(0),
+        programCounter(0),
+        remaining(0)
+    {
+        for (size_t ii = 0; ii < 256; ++ii)
+        {
+            zeroSign[ii] = (ii == 0 ? (1 << ZERO) : 0) | (ii & (1 << SIGN));
+        }
+        std::fill(ramPages, ramPages + RAM_PAGES, nullptr);
+        std::fill(ramVersions, ramVersions + RAM_PAGES, nullptr);
+    }
+
+    uint8_t accumulator;
+    uint8_t xIndex;
+    uint8_t yIndex;
+    uint8_t stackPointer;
+    uint8_t status;
+    uint16_t programCounter;
+    uint32_t remaining;
+    uint8_t zeroSign[256];
+    uint8_t* ramPages[RAM_PAGES];
+    uint32_t* ramVersions[RAM_PAGES];
+};
+
+/*
+ *  \struct - NativeBlock
+ *  \brief - Native code for the start of a cached block.
+ */
+struct NativeBlock
+{
+    typedef uint32_t (*Function)(NativeContext* context);
+
+    // Layout of code that does not depend on the MemoryMap layout.
+    static const uint32_t ANY_LAYOUT = 0xFFFFFFFF;
+
+    // Runs the instructions and returns the number of PPU cycles they
+    // took. The program counter is left at the next instruction.
+    Function function;
+
+    // The number of instructions from the start of the block covered
+    // by the native code.
+    size_t size;
+
+    // The native code runs every instruction without checking the clock.
+    // It can only be used if more than budget PPU cycles remain, since
+    // then the interpreter would have run the same instructions.
+    uint64_t budget;
+
+    // The MemoryMap layout the code was compiled against. Memory
+    // accesses are resolved to host pointers at compile time.
+    uint32_t layout;
+};
+
+/*
+ *  \func - runNative
+ *  \brief - Runs native code against the CPU state.
+ *
+ *  \param context - The context handed to the native code.
+ *  \param remaining - The PPU cycles left before the target clock.
+ *  \return - The number of PPU cycles taken.
+ */
+inline uint32_t runNative(const NativeBlock& block,
+                          NativeContext& context,
+                          CPURegisters& registers,
+                          CPUInfo& info,
+                          uint64_t remaining)
+{
+    // Keeps the loop checks in native code from overflowing.
+    static const uint32_t MAX_REMAINING = 0x40000000;
+
+    context.remaining = static_cast<uint32_t>(
+            std::min<uint64_t>(remaining, MAX_REMAINING));
+    context.accumulator = registers.accumulator;
+    context.xIndex = registers.xIndex;
+    context.yIndex = registers.yIndex;
+    context.stackPointer = registers.stackPointer;
+    context.status = registers.getStatus();
+    context.programCounter = info.programCounter;
+
+    const uint32_t cycles = block.function(&context);
+
+    registers.accumulator = context.accumulator;
+    registers.xIndex = context.xIndex;
+    registers.yIndex = context.yIndex;
+    registers.stackPointer = context.stackPointer;
+    registers.setStatus(context.status);
+    info.programCounter = context.programCounter;
+    return cycles;
+}
+}
+}
+
+#endif
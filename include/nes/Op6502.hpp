@@ -35,76 +35,75 @@ namespace nyra
 namespace nes
 {
 /*****************************************************************************/
-uint8_t shiftRight(uint8_t value,
-                   bool rotate,
-                   std::bitset<FLAG_SIZE>& statusRegister)
+inline uint8_t shiftRight(uint8_t value,
+                          bool rotate,
+                          CPURegisters& registers)
 {
     uint8_t ret = value >> 1;
     if (rotate)
     {
-        ret |= (statusRegister[CARRY] << 7);
+        ret |= (registers.status & (1 << CARRY)) << 7;
     }
-    statusRegister[CARRY] = (value & 0x01) != 0;
+    registers.status = (registers.status & ~(1 << CARRY)) | (value & 0x01);
     return ret;
 }
 
 /*****************************************************************************/
-uint8_t shiftLeft(uint8_t value,
-                  bool rotate,
-                  std::bitset<FLAG_SIZE>& statusRegister)
+inline uint8_t shiftLeft(uint8_t value,
+                         bool rotate,
+                         CPURegisters& registers)
 {
     uint8_t ret = value << 1;
     if (rotate)
     {
-        ret |= static_cast<uint8_t>(
-                statusRegister[CARRY]);
+        ret |= registers.status & (1 << CARRY);
     }
-    statusRegister[CARRY] = (value & 0x80) != 0;
+    registers.status = (registers.status & ~(1 << CARRY)) | (value >> 7);
     return ret;
 }
 
 /*****************************************************************************/
-void compare(uint8_t value,
-             uint8_t reg,
-             std::bitset<FLAG_SIZE>& statusRegister)
+inline void compare(uint8_t value,
+                    uint8_t reg,
+                    CPURegisters& registers)
 {
-    statusRegister[CARRY] = reg >= value;
-    statusRegister[ZERO] = reg == value;
-    statusRegister[SIGN] =
-            static_cast<uint8_t>(reg - value) >= 0x80;
+    registers.status = (registers.status & ~(1 << CARRY)) |
+            (reg >= value ? (1 << CARRY) : 0);
+    registers.setResult(reg - value);
 }
 
 /*****************************************************************************/
-void setRegister(uint8_t value,
-                 uint8_t& reg,
-                 std::bitset<FLAG_SIZE>& statusRegister)
+inline void setRegister(uint8_t value,
+                        uint8_t& reg,
+                        CPURegisters& registers)
 {
-    statusRegister[SIGN] = (value >= 0x80);
-    statusRegister[ZERO] = (value == 0);
+    registers.setResult(value);
     reg = value;
 }
 
 /*****************************************************************************/
-void add(uint8_t value, CPURegisters& registers)
+inline void add(uint8_t value, CPURegisters& registers)
 {
     const size_t sum = registers.accumulator + value +
-            registers.statusRegister[CARRY];
-    registers.statusRegister[OFLOW] =
-            ((registers.accumulator ^ sum) & (value ^ sum) & 0x80) != 0;
-    registers.statusRegister[CARRY] = (sum > 0xFF) != 0;
+            (registers.status & (1 << CARRY));
+    registers.status = (registers.status & ~((1 << CARRY) | (1 << OFLOW))) |
+            (sum >> 8) |
+            (((registers.accumulator ^ sum) & (value ^ sum) & 0x80) >> 1);
     setRegister(static_cast<uint8_t>(sum),
-                registers.accumulator, registers.statusRegister);
+                registers.accumulator, registers);
 }
 
 /*****************************************************************************/
-void pushStack(uint8_t value, MemoryMap& ram, uint8_t& stackPointer)
+template <typename BusT>
+inline void pushStack(uint8_t value, BusT& ram, uint8_t& stackPointer)
 {
     ram.writeByte(static_cast<size_t>(stackPointer | 0x100), value);
     --stackPointer;
 }
 
 /*****************************************************************************/
-uint8_t popStack(MemoryMap& ram, uint8_t& stackPointer)
+template <typename BusT>
+inline uint8_t popStack(BusT& ram, uint8_t& stackPointer)
 {
     ++stackPointer;
     return ram.readByte(static_cast<size_t>(stackPointer | 0x100));
@@ -115,15 +114,15 @@ class OpNUL : public OpCode
 {
 public:
     OpNUL(uint8_t opCode) :
-        OpCode("NUL", "Null Opcode", opCode,
-               0, 0, new ModeImplied())
+        OpCode(opCode, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& ,
+    void op(const Operand& ,
+            CPURegisters& ,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         throw std::runtime_error("Attempting to run null op");
     }
@@ -134,17 +133,18 @@ template <typename ModeT>
 class OpJMP : public OpCode
 {
 public:
-    OpJMP(uint8_t opcode, uint8_t time) :
-        OpCode("JMP", "Jump", opcode, 0, time, new ModeT())
+    OpJMP(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& ,
+    void op(const Operand& operand,
+            CPURegisters& ,
             CPUInfo& info,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        info.programCounter = mMode->getArg();
+        info.programCounter = operand.arg;
     }
 };
 
@@ -153,20 +153,20 @@ template <typename ModeT>
 class OpLDX : public OpCode
 {
 public:
-    OpLDX(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("LDX", "Load X register",
-               opcode, length, time, new ModeT())
+    OpLDX(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(mMode->getValue(),
+        setRegister(operand.value,
                     registers.xIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -175,20 +175,20 @@ template <typename ModeT>
 class OpLDY : public OpCode
 {
 public:
-    OpLDY(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("LDY", "Load Y register",
-               opcode, length, time, new ModeT())
+    OpLDY(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(mMode->getValue(),
+        setRegister(operand.value,
                     registers.yIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -197,29 +197,29 @@ template <typename ModeT>
 class OpLDA : public OpCode
 {
 public:
-    OpLDA(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("LDA", "Load accumulator",
-               opcode, length, time, new ModeT())
+    OpLDA(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         // Special case for ppu
-        /*if (mMode->getArg() == ppu.statusAddress)
+        /*if (operand.arg == ppu.statusAddress)
         {
             setRegister(static_cast<uint8_t>(ppu.status.to_ulong()),
                         registers.accumulator,
-                        registers.statusRegister);
+                        registers);
             return;
         }*/
 
-        setRegister(mMode->getValue(),
+        setRegister(operand.value,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -228,23 +228,22 @@ template <typename ModeT>
 class OpLSR : public OpCode
 {
 public:
-    OpLSR(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("LSR", "Logical shift right",
-               opcode, length, time, new ModeT())
+    OpLSR(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        const uint8_t value = shiftRight(mMode->getValue(),
+        const uint8_t value = shiftRight(operand.value,
                                          false,
-                                         registers.statusRegister);
-        uint8_t garbage;
-        setRegister(value, garbage, registers.statusRegister);
-        memory.writeByte(mMode->getArg(), value);
+                                         registers);
+        registers.setResult(value);
+        memory.writeByte(operand.arg, value);
     }
 };
 
@@ -253,22 +252,22 @@ template <>
 class OpLSR <ModeAccumulator> : public OpCode
 {
 public:
-    OpLSR(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("LSR", "Logical shift right",
-               opcode, length, time, new ModeAccumulator())
+    OpLSR(uint8_t opcode) :
+        OpCode(opcode, new ModeAccumulator())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(shiftRight(mMode->getValue(),
+        setRegister(shiftRight(operand.value,
                                false,
-                               registers.statusRegister),
+                               registers),
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -277,23 +276,22 @@ template <typename ModeT>
 class OpASL : public OpCode
 {
 public:
-    OpASL(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ASL", "Arithmetic shift left",
-               opcode, length, time, new ModeT())
+    OpASL(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        const uint8_t value = shiftLeft(mMode->getValue(),
+        const uint8_t value = shiftLeft(operand.value,
                                          false,
-                                         registers.statusRegister);
-        uint8_t garbage;
-        setRegister(value, garbage, registers.statusRegister);
-        memory.writeByte(mMode->getArg(), value);
+                                         registers);
+        registers.setResult(value);
+        memory.writeByte(operand.arg, value);
     }
 };
 
@@ -302,22 +300,22 @@ template <>
 class OpASL <ModeAccumulator> : public OpCode
 {
 public:
-    OpASL(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ASL", "Arithmetic shift left",
-               opcode, length, time, new ModeAccumulator())
+    OpASL(uint8_t opcode) :
+        OpCode(opcode, new ModeAccumulator())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(shiftLeft(mMode->getValue(),
+        setRegister(shiftLeft(operand.value,
                               false,
-                              registers.statusRegister),
+                              registers),
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -326,23 +324,22 @@ template <typename ModeT>
 class OpROR : public OpCode
 {
 public:
-    OpROR(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ROR", "Rotate right",
-               opcode, length, time, new ModeT())
+    OpROR(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        const uint8_t value = shiftRight(mMode->getValue(),
+        const uint8_t value = shiftRight(operand.value,
                                          true,
-                                         registers.statusRegister);
-        uint8_t garbage;
-        setRegister(value, garbage, registers.statusRegister);
-        memory.writeByte(mMode->getArg(), value);
+                                         registers);
+        registers.setResult(value);
+        memory.writeByte(operand.arg, value);
     }
 };
 
@@ -351,22 +348,22 @@ template <>
 class OpROR <ModeAccumulator> : public OpCode
 {
 public:
-    OpROR(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ROR", "Rotate right",
-               opcode, length, time, new ModeAccumulator())
+    OpROR(uint8_t opcode) :
+        OpCode(opcode, new ModeAccumulator())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(shiftRight(mMode->getValue(),
+        setRegister(shiftRight(operand.value,
                                true,
-                               registers.statusRegister),
+                               registers),
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -375,23 +372,22 @@ template <typename ModeT>
 class OpROL : public OpCode
 {
 public:
-    OpROL(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ROL", "Rotate left",
-               opcode, length, time, new ModeT())
+    OpROL(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        const uint8_t value = shiftLeft(mMode->getValue(),
+        const uint8_t value = shiftLeft(operand.value,
                                         true,
-                                        registers.statusRegister);
-        uint8_t garbage;
-        setRegister(value, garbage, registers.statusRegister);
-        memory.writeByte(mMode->getArg(), value);
+                                        registers);
+        registers.setResult(value);
+        memory.writeByte(operand.arg, value);
     }
 };
 
@@ -400,22 +396,22 @@ template <>
 class OpROL <ModeAccumulator> : public OpCode
 {
 public:
-    OpROL(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ROL", "Rotate left",
-               opcode, length, time, new ModeAccumulator())
+    OpROL(uint8_t opcode) :
+        OpCode(opcode, new ModeAccumulator())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(shiftLeft(mMode->getValue(),
+        setRegister(shiftLeft(operand.value,
                               true,
-                              registers.statusRegister),
+                              registers),
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -424,18 +420,18 @@ template <typename ModeT>
 class OpSTA : public OpCode
 {
 public:
-    OpSTA(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("STA", "Store accumulator",
-               opcode, length, time, new ModeT())
+    OpSTA(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        memory.writeByte(mMode->getArg(), registers.accumulator);
+        memory.writeByte(operand.arg, registers.accumulator);
     }
 };
 
@@ -444,18 +440,18 @@ template <typename ModeT>
 class OpSTX : public OpCode
 {
 public:
-    OpSTX(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("STX", "Store X register",
-               opcode, length, time, new ModeT())
+    OpSTX(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        memory.writeByte(mMode->getArg(), registers.xIndex);
+        memory.writeByte(operand.arg, registers.xIndex);
     }
 };
 
@@ -464,18 +460,18 @@ template <typename ModeT>
 class OpSTY : public OpCode
 {
 public:
-    OpSTY(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("STY", "Store Y register",
-               opcode, length, time, new ModeT())
+    OpSTY(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        memory.writeByte(mMode->getArg(), registers.yIndex);
+        memory.writeByte(operand.arg, registers.yIndex);
     }
 };
 
@@ -484,8 +480,7 @@ class OpJSR : public OpCode
 {
 public:
     OpJSR() :
-        OpCode("JSR", "Jump to subroutine",
-               0x20, 0, 6, new ModeAbsolute<false>())
+        OpCode(0x20, new ModeAbsolute<TracePolicy::None, ACCESS_NONE>())
     {
     }
 
@@ -494,15 +489,16 @@ public:
     }
 
 protected:
-    virtual void op(CPURegisters& registers,
+    virtual void op(const Operand& operand,
+                    CPURegisters& registers,
                     CPUInfo& info,
-                    MemoryMap& memory)
+                    MemoryMap& memory) const
     {
         pushStack(((info.programCounter + 2) >> 8) & 0xFF,
                   memory, registers.stackPointer);
         pushStack((info.programCounter + 2) & 0xFF,
                   memory, registers.stackPointer);
-        info.programCounter = mMode->getArg();
+        info.programCounter = operand.arg;
     }
 };
 
@@ -511,23 +507,23 @@ class OpJMI : public OpCode
 {
 public:
     OpJMI() : 
-        OpCode("JMI", "Jump to interrupt, NYRA created",
-               0x00, 0, 6, new ModeAbsolute<false>())
+        OpCode(0x100, new ModeAbsolute<TracePolicy::None, ACCESS_NONE>())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& info,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         pushStack(((info.programCounter) >> 8) & 0xFF,
                   memory, registers.stackPointer);
         pushStack((info.programCounter) & 0xFF,
                   memory, registers.stackPointer);
-        pushStack(static_cast<uint8_t>(registers.statusRegister.to_ulong()),
+        pushStack(registers.getStatus(),
                   memory, registers.stackPointer);
-        info.programCounter = mMode->getArg();
+        info.programCounter = operand.arg;
     }
 };
 
@@ -536,15 +532,15 @@ class OpNOP : public OpCode
 {
 public:
     OpNOP() :
-        OpCode("NOP", "No operation",
-               0xEA, 1, 2, new ModeImplied())
+        OpCode(0xEA, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& ,
+    void op(const Operand& ,
+            CPURegisters& ,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         // NOP
     }
@@ -555,20 +551,20 @@ class OpRTI : public OpCode
 {
 public:
     OpRTI() :
-        OpCode("RTI", "Return from interrupt",
-               0x40, 0, 6, new ModeImplied())
+        OpCode(0x40, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& info,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         // TODO: Make sure this is correct. I don't think the
         //       stack pointer is manipulated correctly.
-        registers.statusRegister = popStack(memory, registers.stackPointer) |
-                (1 << IGNORE);
+        registers.setStatus(popStack(memory, registers.stackPointer) |
+                (1 << IGNORE));
         info.programCounter = popStack(memory, registers.stackPointer) |
                 (popStack(memory, registers.stackPointer) << 8);
     }
@@ -579,15 +575,15 @@ class OpRTS : public OpCode
 {
 public:
     OpRTS() :
-        OpCode("RTS", "Return from subroutine",
-               0x60, 1, 6, new ModeImplied())
+        OpCode(0x60, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& info,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         info.programCounter = popStack(memory, registers.stackPointer) |
                               (popStack(memory, registers.stackPointer) << 8);
@@ -599,19 +595,19 @@ class OpINY : public OpCode
 {
 public:
     OpINY() :
-        OpCode("INY", "Increment Y",
-               0xC8, 1, 2, new ModeImplied())
+        OpCode(0xC8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.yIndex + 1,
                     registers.yIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -620,19 +616,19 @@ class OpINX : public OpCode
 {
 public:
     OpINX() :
-        OpCode("INX", "Increment X",
-               0xC8, 1, 2, new ModeImplied())
+        OpCode(0xE8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.xIndex + 1,
                     registers.xIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -641,22 +637,22 @@ template <typename ModeT>
 class OpINC : public OpCode
 {
 public:
-    OpINC(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("INC", "Increment memory",
-               opcode, length, time, new ModeT())
+    OpINC(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         uint8_t garbage;
-        setRegister(mMode->getValue() + 1,
+        setRegister(operand.value + 1,
                     garbage,
-                    registers.statusRegister);
-        memory.writeByte(mMode->getArg(), mMode->getValue() + 1);
+                    registers);
+        memory.writeByte(operand.arg, operand.value + 1);
     }
 };
 
@@ -665,22 +661,22 @@ template <typename ModeT>
 class OpDEC : public OpCode
 {
 public:
-    OpDEC(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("DEC", "Decrement memory",
-               opcode, length, time, new ModeT())
+    OpDEC(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         uint8_t garbage;
-        setRegister(mMode->getValue() - 1,
+        setRegister(operand.value - 1,
                     garbage,
-                    registers.statusRegister);
-        memory.writeByte(mMode->getArg(), mMode->getValue() - 1);
+                    registers);
+        memory.writeByte(operand.arg, operand.value - 1);
     }
 };
 
@@ -689,19 +685,19 @@ class OpDEY : public OpCode
 {
 public:
     OpDEY() :
-        OpCode("DEY", "Decrement Y",
-               0x88, 1, 2, new ModeImplied())
+        OpCode(0x88, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.yIndex - 1,
                     registers.yIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -710,19 +706,19 @@ class OpDEX : public OpCode
 {
 public:
     OpDEX() :
-        OpCode("DEX", "Decrement X",
-               0xCA, 1, 2, new ModeImplied())
+        OpCode(0xCA, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.xIndex - 1,
                     registers.xIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -731,19 +727,19 @@ class OpTAX : public OpCode
 {
 public:
     OpTAX() :
-        OpCode("TAX", "Transfer A to X",
-               0xAA, 1, 2, new ModeImplied())
+        OpCode(0xAA, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.accumulator,
                     registers.xIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -752,19 +748,19 @@ class OpTXA : public OpCode
 {
 public:
     OpTXA() :
-        OpCode("TXA", "Transfer X to A",
-               0x8A, 1, 2, new ModeImplied())
+        OpCode(0x8A, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.xIndex,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -773,19 +769,19 @@ class OpTAY : public OpCode
 {
 public:
     OpTAY() :
-        OpCode("TAY", "Transfer A to Y",
-               0xA8, 1, 2, new ModeImplied())
+        OpCode(0xA8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.accumulator,
                     registers.yIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -794,19 +790,19 @@ class OpTYA : public OpCode
 {
 public:
     OpTYA() :
-        OpCode("TYA", "Transfer Y to A",
-               0x98, 1, 2, new ModeImplied())
+        OpCode(0x98, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.yIndex,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -815,17 +811,17 @@ class OpSEC : public OpCode
 {
 public:
     OpSEC() :
-        OpCode("SEC", "Set carry",
-               0x38, 1, 2, new ModeImplied())
+        OpCode(0x38, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[CARRY] = 1;
+        registers.setFlag(CARRY, 1);
     }
 };
 
@@ -834,17 +830,17 @@ class OpCLC : public OpCode
 {
 public:
     OpCLC() :
-        OpCode("CLC", "Clear carry",
-               0x18, 1, 2, new ModeImplied())
+        OpCode(0x18, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[CARRY] = 0;
+        registers.setFlag(CARRY, 0);
     }
 };
 
@@ -853,17 +849,17 @@ class OpCLV : public OpCode
 {
 public:
     OpCLV() :
-        OpCode("CLV", "Clear overflow",
-               0xB8, 1, 2, new ModeImplied())
+        OpCode(0xB8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[OFLOW] = 0;
+        registers.setFlag(OFLOW, 0);
     }
 };
 
@@ -872,17 +868,17 @@ class OpSEI : public OpCode
 {
 public:
     OpSEI() :
-        OpCode("SEI", "Set interrupt",
-               0x78, 1, 2, new ModeImplied())
+        OpCode(0x78, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[INTERRUPT] = 1;
+        registers.setFlag(INTERRUPT, 1);
     }
 };
 
@@ -891,17 +887,17 @@ class OpSED : public OpCode
 {
 public:
     OpSED() :
-        OpCode("SED", "Set decimal",
-               0xF8, 1, 2, new ModeImplied())
+        OpCode(0xF8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[DECIMAL] = 1;
+        registers.setFlag(DECIMAL, 1);
     }
 };
 
@@ -910,17 +906,17 @@ class OpCLD : public OpCode
 {
 public:
     OpCLD() :
-        OpCode("CLD", "Clear decimal",
-               0xD8, 1, 2, new ModeImplied())
+        OpCode(0xD8, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        registers.statusRegister[DECIMAL] = 0;
+        registers.setFlag(DECIMAL, 0);
     }
 };
 
@@ -929,19 +925,19 @@ class OpTSX : public OpCode
 {
 public:
     OpTSX() :
-        OpCode("TSX", "Transfer stack ptr to X",
-               0xBA, 1, 2, new ModeImplied())
+        OpCode(0xBA, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         setRegister(registers.stackPointer,
                     registers.xIndex,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -950,15 +946,15 @@ class OpTXS : public OpCode
 {
 public:
     OpTXS() :
-        OpCode("TXS", "Transfer X to stack ptr",
-               0x9A, 1, 2, new ModeImplied())
+        OpCode(0x9A, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
         registers.stackPointer = registers.xIndex;
     }
@@ -969,19 +965,19 @@ class OpPLA : public OpCode
 {
 public:
     OpPLA() :
-        OpCode("PLA", "Pull accumulator",
-               0x68, 1, 4, new ModeImplied())
+        OpCode(0x68, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         setRegister(popStack(memory, registers.stackPointer),
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -990,15 +986,15 @@ class OpPHA : public OpCode
 {
 public:
     OpPHA() :
-        OpCode("PHA", "Push accumulator",
-               0x48, 1, 3, new ModeImplied())
+        OpCode(0x48, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
         pushStack(static_cast<uint8_t>(registers.accumulator),
                   memory, registers.stackPointer);
@@ -1010,18 +1006,18 @@ class OpPLP : public OpCode
 {
 public:
     OpPLP() :
-        OpCode("PLP", "Pull processor status",
-               0x28, 1, 4, new ModeImplied())
+        OpCode(0x28, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        registers.statusRegister =
-            ((popStack(memory, registers.stackPointer) |
+        registers.setStatus(
+            (popStack(memory, registers.stackPointer) |
             (1 << IGNORE)) &
             ~(1 << STACK));
     }
@@ -1031,18 +1027,17 @@ class OpPHP : public OpCode
 {
 public:
     OpPHP() :
-        OpCode("PHP", "Push processor status",
-               0x08, 1, 3, new ModeImplied())
+        OpCode(0x08, new ModeImplied())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& ,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& memory)
+            MemoryMap& memory) const
     {
-        pushStack(static_cast<uint8_t>(registers.statusRegister.to_ulong()) |
-                          (1 << STACK),
+        pushStack(registers.getStatus() | (1 << STACK),
                   memory, registers.stackPointer);
     }
 };
@@ -1051,25 +1046,23 @@ private:
 class OpBranch : public OpCode
 {
 public:
-    OpBranch(const std::string& name,
-             const std::string& extendedName,
-             uint8_t opcode) :
-        OpCode(name, extendedName, opcode,
-               0, 2, new ModeRelative())
+    OpBranch(uint8_t opcode) :
+        OpCode(opcode, new ModeRelative())
     {
     }
 
 private:
     virtual bool branchArg(
-            const std::bitset<8>& statusRegister) const = 0;
+            const CPURegisters& registers) const = 0;
 
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& info,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        if (branchArg(registers.statusRegister))
+        if (branchArg(registers))
         {
-            info.programCounter = mMode->getArg();
+            info.programCounter = operand.arg;
             info.cycles += 3;
         }
         else
@@ -1078,13 +1071,14 @@ private:
         }
     }
 
-    void alt(CPURegisters& registers,
+    void alt(const Operand& operand,
+             CPURegisters& registers,
              CPUInfo& info,
-             MemoryMap& )
+             MemoryMap& ) const
     {
-        if (!branchArg(registers.statusRegister))
+        if (!branchArg(registers))
         {
-            info.programCounter = mMode->getArg();
+            info.programCounter = operand.arg;
             info.cycles += 3;
         }
         else
@@ -1099,14 +1093,14 @@ private:
 class OpBCS : public OpBranch
 {
 public:
-    OpBCS() : OpBranch("BCS", "Branch on carry set", 0xB0)
+    OpBCS() : OpBranch(0xB0)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return statusRegister[CARRY];
+        return registers.getFlag(CARRY);
     }
 };
 
@@ -1114,14 +1108,14 @@ private:
 class OpBEQ : public OpBranch
 {
 public:
-    OpBEQ() : OpBranch("BEQ", "Branch on equal", 0xF0)
+    OpBEQ() : OpBranch(0xF0)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return statusRegister[ZERO];
+        return registers.getFlag(ZERO);
     }
 };
 
@@ -1129,14 +1123,14 @@ private:
 class OpBNE : public OpBranch
 {
 public:
-    OpBNE() : OpBranch("BNE", "Branch on not equal", 0xD0)
+    OpBNE() : OpBranch(0xD0)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return !statusRegister[ZERO];
+        return !registers.getFlag(ZERO);
     }
 };
 
@@ -1144,14 +1138,14 @@ private:
 class OpBCC : public OpBranch
 {
 public:
-    OpBCC() : OpBranch("BCC", "Branch on carry clear", 0x90)
+    OpBCC() : OpBranch(0x90)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return !statusRegister[CARRY];
+        return !registers.getFlag(CARRY);
     }
 };
 
@@ -1159,14 +1153,14 @@ private:
 class OpBVS : public OpBranch
 {
 public:
-    OpBVS() : OpBranch("BVS", "Branch on overflow set", 0x70)
+    OpBVS() : OpBranch(0x70)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return statusRegister[OFLOW];
+        return registers.getFlag(OFLOW);
     }
 };
 
@@ -1174,14 +1168,14 @@ private:
 class OpBVC : public OpBranch
 {
 public:
-    OpBVC() : OpBranch("BVC", "Branch on overflow clear",0x50)
+    OpBVC() : OpBranch(0x50)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return !statusRegister[OFLOW];
+        return !registers.getFlag(OFLOW);
     }
 };
 
@@ -1189,14 +1183,14 @@ private:
 class OpBPL : public OpBranch
 {
 public:
-    OpBPL() : OpBranch("BPL", "Branch on plus", 0x10)
+    OpBPL() : OpBranch(0x10)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return !statusRegister[SIGN];
+        return !registers.getFlag(SIGN);
     }
 };
 
@@ -1204,14 +1198,14 @@ private:
 class OpBMI : public OpBranch
 {
 public:
-    OpBMI() : OpBranch("BMI", "Branch on minus", 0x30)
+    OpBMI() : OpBranch(0x30)
     {
     }
 
 private:
-    bool branchArg(const std::bitset<8>& statusRegister) const
+    bool branchArg(const CPURegisters& registers) const
     {
-        return statusRegister[SIGN];
+        return registers.getFlag(SIGN);
     }
 };
 
@@ -1220,21 +1214,21 @@ template <typename ModeT>
 class OpBIT : public OpCode
 {
 public:
-    OpBIT(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("BIT", "Test bits",
-               opcode, length, time, new ModeT())
+    OpBIT(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        const size_t param = mMode->getValue();
-        registers.statusRegister[ZERO] = (param & registers.accumulator) == 0;
-        registers.statusRegister[OFLOW] = (param & (1 << OFLOW)) != 0;
-        registers.statusRegister[SIGN] = (param & (1 << SIGN)) != 0;
+        const size_t param = operand.value;
+        registers.zeroResult = param & registers.accumulator;
+        registers.signResult = param;
+        registers.setFlag(OFLOW, (param & (1 << OFLOW)) != 0);
     }
 };
 
@@ -1243,20 +1237,20 @@ template <typename ModeT>
 class OpCMP : public OpCode
 {
 public:
-    OpCMP(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("CMP", "Compare accumulator",
-               opcode, length, time, new ModeT())
+    OpCMP(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        compare(mMode->getValue(),
+        compare(operand.value,
                 registers.accumulator,
-                registers.statusRegister);
+                registers);
     }
 };
 
@@ -1265,20 +1259,20 @@ template <typename ModeT>
 class OpCPY : public OpCode
 {
 public:
-    OpCPY(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("CPY", "Compare Y register",
-               opcode, length, time, new ModeT())
+    OpCPY(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        compare(mMode->getValue(),
+        compare(operand.value,
                 registers.yIndex,
-                registers.statusRegister);
+                registers);
     }
 };
 
@@ -1287,20 +1281,20 @@ template <typename ModeT>
 class OpCPX : public OpCode
 {
 public:
-    OpCPX(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("CPX", "Compare X register",
-               opcode, length, time, new ModeT())
+    OpCPX(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        compare(mMode->getValue(),
+        compare(operand.value,
                 registers.xIndex,
-                registers.statusRegister);
+                registers);
     }
 };
 
@@ -1309,20 +1303,20 @@ template <typename ModeT>
 class OpAND : public OpCode
 {
 public:
-    OpAND(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("AND", "Bitwise AND with accumulator",
-               opcode, length, time, new ModeT())
+    OpAND(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(mMode->getValue() & registers.accumulator,
+        setRegister(operand.value & registers.accumulator,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -1331,20 +1325,20 @@ template <typename ModeT>
 class OpORA : public OpCode
 {
 public:
-    OpORA(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ORA", "Bitwise OR with accumulator",
-               opcode, length, time, new ModeT())
+    OpORA(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(mMode->getValue() | registers.accumulator,
+        setRegister(operand.value | registers.accumulator,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -1353,20 +1347,20 @@ template <typename ModeT>
 class OpEOR : public OpCode
 {
 public:
-    OpEOR(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("EOR", "Bitwise exclusive OR",
-               opcode, length, time, new ModeT())
+    OpEOR(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        setRegister(mMode->getValue() ^ registers.accumulator,
+        setRegister(operand.value ^ registers.accumulator,
                     registers.accumulator,
-                    registers.statusRegister);
+                    registers);
     }
 };
 
@@ -1375,18 +1369,18 @@ template <typename ModeT>
 class OpADC : public OpCode
 {
 public:
-    OpADC(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("ADC", "Add with carry",
-               opcode, length, time, new ModeT())
+    OpADC(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        add(mMode->getValue(), registers);
+        add(operand.value, registers);
     }
 };
 /*****************************************************************************/
@@ -1394,18 +1388,18 @@ template <typename ModeT>
 class OpSBC : public OpCode
 {
 public:
-    OpSBC(uint8_t opcode, uint8_t length, uint8_t time) :
-        OpCode("SBC", "Subtract with carry",
-               opcode, length, time, new ModeT())
+    OpSBC(uint8_t opcode) :
+        OpCode(opcode, new ModeT())
     {
     }
 
 private:
-    void op(CPURegisters& registers,
+    void op(const Operand& operand,
+            CPURegisters& registers,
             CPUInfo& ,
-            MemoryMap& )
+            MemoryMap& ) const
     {
-        add(~mMode->getValue(), registers);
+        add(~operand.value, registers);
     }
 };
 }
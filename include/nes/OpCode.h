@@ -31,16 +31,51 @@
 #include <nes/CPUHelper.h>
 #include <nes/MemoryMap.h>
 #include <nes/Mode.h>
+#include <nes/TracePolicy.h>
 
 namespace nyra
 {
 namespace nes
 {
+/*
+ *  \struct OpCodeInfo
+ *  \brief - The fixed details of an opcode. These never change, so they
+ *           live in one table shared by everything that decodes 6502.
+ */
+struct OpCodeInfo
+{
+    // The three letter name and a more user friendly version of it.
+    const char* name;
+    const char* extendedName;
+
+    // The amount the program counter should move after calling the
+    // opcode. Opcodes that set the program counter themselves use 0.
+    uint8_t length;
+
+    // The base number of cycles, not counting page crossing or branch
+    // penalties.
+    uint8_t time;
+
+    // Does the mode use the first and second byte arguments? If the mode
+    // uses both arguments as a single 2 byte value, both are true.
+    bool usesArg1;
+    bool usesArg2;
+};
+
+/*
+ *  \var - OP_CODE_INFO
+ *  \brief - The details of every opcode, indexed by the opcode. The
+ *           extra entry at 0x100 is the interrupt the CPU runs for an NMI.
+ *           Unknown opcodes are named NUL and take no time.
+ */
+extern const OpCodeInfo OP_CODE_INFO[257];
+
 /*
  *  \class OpCode
  *  \brief - Represents a single abstract processing operation. This class
  *           is heavily abstracted. Be careful when trying to use it in new
- *           ways.
+ *           ways. OpCodes hold no state, the operand is passed in by the
+ *           CPU.
  */
 class OpCode
 {
@@ -49,21 +84,13 @@ public:
      *  \func - Constructor
      *  \brief - Creates a generalized OpCode
      *
-     *  \param name - The three letter name of the OpCode
-     *  \param extendedName - A more user friendly version of the name.
-     *  \param opCode - The opCode index.
-     *  \param length - The amount the program counter should move
-     *                  after calling the opcode.
-     *  \param time - The number of cycles for the opcode.
+     *  \param opCode - The opCode index. The name, length and time are
+     *         looked up in OP_CODE_INFO.
      *  \param mode - A specialized mode which tells the opcode how to use
-     *                parameters.
+     *                parameters. This takes ownership of it.
      */
-    OpCode(const std::string& name,
-           const std::string& extendedName,
-           uint8_t opCode,
-           uint8_t length,
-           uint8_t time,
-           Mode* mode);
+    OpCode(size_t opCode,
+           const Mode* mode);
 
     /*
      *  \func - Destructor
@@ -79,13 +106,14 @@ public:
      *         should use the modified mode arguments.
      *  \param registers - The current CPU registers.
      *  \param info - The current CPU info.
-     *  \param ppu - The current PPU registers.
      *  \param memory - The current memory banks.
+     *  \param operand - Scratch space for the mode to fill out for the op.
      */
     void operator()(const CPUArgs& args,
                     CPURegisters& registers,
                     CPUInfo& info,
-                    MemoryMap& memory);
+                    MemoryMap& memory,
+                    Operand& operand) const;
 
     /*
      *  \func - getName
@@ -93,7 +121,7 @@ public:
      */
     inline std::string getName() const
     {
-        return mName;
+        return mInfo.name;
     }
 
     /*
@@ -102,7 +130,7 @@ public:
      */
     inline std::string getExtendedName() const
     {
-        return mExtendedName;
+        return mInfo.extendedName;
     }
 
     /*
@@ -114,6 +142,15 @@ public:
         return *mMode;
     }
 
+    /*
+     *  \func - getInfo
+     *  \brief - Returns the fixed details of this opcode.
+     */
+    inline const OpCodeInfo& getInfo() const
+    {
+        return mInfo;
+    }
+
     /*
      *  \func - getOpCode
      *  \brief - Returns the identifier value of this opcode.
@@ -123,38 +160,50 @@ public:
         return mOpCode;
     }
 
-    virtual void op(CPURegisters& registers,
+    /*
+     *  \func - getTime
+     *  \brief - Returns the base number of cycles for this opcode, not
+     *           counting page crossing or branch penalties.
+     */
+    inline uint8_t getTime() const
+    {
+        return mInfo.time;
+    }
+
+    virtual void op(const Operand& operand,
+                    CPURegisters& registers,
                     CPUInfo& info,
-                    MemoryMap& memory) = 0;
+                    MemoryMap& memory) const = 0;
 
-    virtual void alt(CPURegisters& registers,
+    virtual void alt(const Operand& operand,
+                     CPURegisters& registers,
                      CPUInfo& info,
-                     MemoryMap& memory)
+                     MemoryMap& memory) const
     {
-        op(registers, info, memory);
+        op(operand, registers, info, memory);
     }
 
 protected:
-    const std::string mName;
-    const std::string mExtendedName;
+    const OpCodeInfo& mInfo;
     const uint8_t mOpCode;
-    const uint8_t mLength;
-    const uint8_t mTime;
-    const std::unique_ptr<Mode> mMode;
+    const std::unique_ptr<const Mode> mMode;
 };
 
 /*
  *  \type - OpCodeArray
  *  \brief - An array of opcodes which can then be indexed for calling ops.
  */
-typedef std::vector<std::unique_ptr<OpCode> > OpCodeArray;
+typedef std::vector<std::unique_ptr<const OpCode> > OpCodeArray;
 
 /*
- *  \func - allocateOpCodes
- *  \brief - Sets up an array of opcodes so the correct values are in each
- *           index. This is a pretty specialized function for 6502.
+ *  \func - getOpCodes
+ *  \brief - Returns the opcodes for 6502 with the correct values in each
+ *           index. They are built on first use and shared from then on,
+ *           so this does not allocate after the first call. The library
+ *           provides TracePolicy::None and TracePolicy::Full.
  */
-void allocateOpCodes(OpCodeArray& opCodes);
+template <typename TraceT>
+const OpCodeArray& getOpCodes();
 }
 }
 #endif
@@ -30,6 +30,7 @@
 #include <nes/PPURegisters.h>
 #include <nes/VRAM.h>
 #include <nes/Constants.h>
+#include <nes/SaveState.h>
 
 namespace nyra
 {
@@ -48,9 +49,16 @@ public:
     /*
      *  \func - Constructor
      *  \brief - Sets a default internal structure for the PPU.
+     *
+     *  \param chrROM - The CHR banks from the cartridge.
+     *  \param mirroring - The nametable mirroring of the cartridge.
+     *  \param chrTiles - The CHR ROM already decoded, see
+     *         Cartridge::getTileRows. If this is nullptr it is decoded
+     *         here.
      */
     PPU(const ROMBanks& chrROM,
-        Mirroring mirroring);
+        Mirroring mirroring,
+        const uint16_t* chrTiles = nullptr);
 
     /*
      *  \func - tick
@@ -61,7 +69,17 @@ public:
                          const MemoryMap& memory,
                          uint32_t* buffer = nullptr);
 
-    uint32_t extractPixel(uint32_t address,
+    /*
+     *  \func - extractPixel
+     *  \brief - Returns the color of a single pixel in a decoded tile row.
+     *
+     *  \param tileRow - The row from VRAM::getTileRow.
+     *  \param bitPosition - The pixel in the row. 7 is the leftmost.
+     *  \param palette - The VRAM address of the palette to use.
+     *  \param backgroundColor - The color used for transparent pixels.
+     *  \param paletteAddress[OUTPUT] - The 2 bit color index of the pixel.
+     */
+    uint32_t extractPixel(uint16_t tileRow,
                           size_t bitPosition,
                           size_t palette,
                           uint32_t backgroundColor,
@@ -77,6 +95,28 @@ public:
         return mRegisters;
     }
 
+    /*
+     *  \func - getVRAM
+     *  \brief - Returns the PPU address space. Mappers switch the CHR
+     *           banks and nametables through it.
+     */
+    inline VRAM& getVRAM()
+    {
+        return mVRAM;
+    }
+
+    /*
+     *  \func - saveState
+     *  \brief - Writes the registers, OAM and VRAM into a save state.
+     */
+    void saveState(StateWriter& state) const;
+
+    /*
+     *  \func - loadState
+     *  \brief - Restores the PPU from a save state.
+     */
+    void loadState(StateReader& state);
+
 private:
     void renderScanline(int16_t scanLine,
                         uint32_t* buffer = nullptr);
@@ -87,9 +127,20 @@ private:
     void renderBackground(int16_t scanLine,
                           uint32_t* buffer);
 
+    /*
+     *  \func - evaluateSprites
+     *  \brief - Rebuilds the list of sprites on every visible scanline.
+     *           This must be called whenever OAM changes.
+     */
+    void evaluateSprites();
+
+    static const size_t NUM_SPRITES = 64;
+
     VRAM mVRAM;
     PPURegisters mRegisters;
     RAM mOAM;
+    uint8_t mSpriteCounts[SCREEN_HEIGHT];
+    uint8_t mSpriteLines[SCREEN_HEIGHT][NUM_SPRITES];
 };
 }
 }
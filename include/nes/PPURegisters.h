@@ -26,8 +26,10 @@
 
 #include <nes/Memory.h>
 #include <nes/MemoryMap.h>
+#include <nes/VRAM.h>
 #include <nes/Constants.h>
 #include <nes/HiLowLatch.h>
+#include <nes/SaveState.h>
 #include <bitset>
 #include <vector>
 
@@ -64,6 +66,18 @@ public:
         return temp;
     }
 
+    inline void saveState(StateWriter& state) const
+    {
+        state.writeFlags(mMemory);
+        state.write(mNeedsCopy);
+    }
+
+    inline void loadState(StateReader& state)
+    {
+        state.readFlags(mMemory);
+        state.read(mNeedsCopy);
+    }
+
 private:
     std::bitset<FLAG_SIZE> mMemory;
     HiLowLatch& mSpriteRamAddress;
@@ -118,13 +132,24 @@ public:
         EMPHASIZE_BLUE
     };
 
-    PPURegisters(MemoryMap& vram);
+    PPURegisters(VRAM& vram);
 
     uint8_t readByte(size_t address);
 
     virtual void writeByte(size_t address,
                            uint8_t value);
 
+    /*
+     *  \func - writeRepeated
+     *  \brief - Writes to PPUDATA go straight into VRAM without going
+     *           back through writeByte for each one. Stepping by one fills
+     *           the run of addresses at once and decodes each tile row it
+     *           touches once. Stepping by 32 writes one byte at a time.
+     */
+    virtual void writeRepeated(size_t address,
+                               uint8_t value,
+                               size_t count);
+
     std::bitset<FLAG_SIZE>& getRegister(Register reg)
     {
         return reg != OAMDMA ? mMemory[reg] : mOamDma.getRegister();
@@ -150,7 +175,23 @@ public:
         return mScrollPosition.getLow();
     }
 
+    /*
+     *  \func - saveState
+     *  \brief - Writes every register, latch and the read buffer into a
+     *           save state.
+     */
+    void saveState(StateWriter& state) const;
+
+    /*
+     *  \func - loadState
+     *  \brief - Restores the registers from a save state.
+     */
+    void loadState(StateReader& state);
+
 protected:
+    // The address register wraps after 15 bits.
+    static const size_t PPU_ADDRESS_SIZE = 0x8000;
+
     std::bitset<FLAG_SIZE> mMemory[MAX_REGISTER];
 
     HiLowLatch mSpriteRamAddress;
@@ -159,7 +200,7 @@ protected:
     // High is x, low is y
     HiLowLatch mScrollPosition;
     OamDma mOamDma;
-    MemoryMap& mVRAM;
+    VRAM& mVRAM;
     uint8_t mByteBuffer;
 };
 }
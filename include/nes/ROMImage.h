@@ -0,0 +1,142 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_ROM_IMAGE_H__
+#define __NYRA_NES_ROM_IMAGE_H__
+
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <nes/Constants.h>
+#include <nes/MappedFile.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - ROMImage
+ *  \brief - The read only contents of a ROM file along with data derived
+ *           from it. Images are cached for the whole process by a hash
+ *           of their contents, so every cartridge of the same game
+ *           shares one copy no matter how it was loaded. An image is
+ *           released once the last cartridge using it is gone.
+ */
+class ROMImage
+{
+public:
+    /*
+     *  \func - load
+     *  \brief - Returns the image for a file on disk. The file is mapped
+     *           into memory and dropped again if an image with the same
+     *           contents is already loaded.
+     *
+     *  \param pathname - The full path of the file on disk.
+     *  \throw - If the file cannot be opened or mapped.
+     */
+    static std::shared_ptr<const ROMImage> load(const std::string& pathname);
+
+    /*
+     *  \func - share
+     *  \brief - Returns the image for a file already in memory. If an
+     *           image with the same contents is loaded it is used instead
+     *           of the buffer. Otherwise the image points into the buffer
+     *           and is not cached, since the buffer is not owned.
+     *
+     *  \param buffer - The contents of the ROM file. This must outlive
+     *         the image if it is not found in the cache.
+     *  \param size - The size of the buffer in bytes.
+     */
+    static std::shared_ptr<const ROMImage> share(const uint8_t* buffer,
+                                                 size_t size);
+
+    /*
+     *  \func - hash
+     *  \brief - Returns the 64 bit FNV-1a hash of a buffer. This is the
+     *           key images are cached by.
+     */
+    static uint64_t hash(const uint8_t* buffer,
+                         size_t size);
+
+    /*
+     *  \func - getData
+     *  \brief - Returns the contents of the file.
+     */
+    inline const uint8_t* getData() const
+    {
+        return mData;
+    }
+
+    /*
+     *  \func - getSize
+     *  \brief - Returns the size of the file in bytes.
+     */
+    inline size_t getSize() const
+    {
+        return mSize;
+    }
+
+    /*
+     *  \func - getHash
+     *  \brief - Returns the hash of the contents, see hash.
+     */
+    inline uint64_t getHash() const
+    {
+        return mHash;
+    }
+
+    /*
+     *  \func - getTileRows
+     *  \brief - Returns the CHR ROM decoded by TileCache::decode. It is
+     *           decoded by the first caller and shared after that.
+     *
+     *  \param chrBanks - The CHR banks of a cartridge built from this
+     *         image. Every cartridge of the image has the same banks.
+     */
+    const uint16_t* getTileRows(const ROMBanks& chrBanks) const;
+
+private:
+    ROMImage(std::unique_ptr<const MappedFile> file,
+             const uint8_t* data,
+             size_t size,
+             uint64_t hash);
+
+    static std::shared_ptr<const ROMImage> insert(
+            std::unique_ptr<const MappedFile> file,
+            const uint8_t* data,
+            size_t size);
+
+    const std::unique_ptr<const MappedFile> mFile;
+    const uint8_t* const mData;
+    const size_t mSize;
+    const uint64_t mHash;
+
+    mutable std::once_flag mTilesDecoded;
+    mutable std::vector<uint16_t> mTileRows;
+};
+}
+}
+
+#endif
@@ -0,0 +1,207 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_RECOMPILED_6502_HPP__
+#define __NYRA_NES_RECOMPILED_6502_HPP__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <nes/CPUHelper.h>
+#include <nes/NativeBlock.h>
+
+/*
+ *  The symbol every recompiled module exports. It is a RecompiledModule.
+ */
+#define NYRA_NES_RECOMPILED_SYMBOL nyraNesRecompiledModule
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \var - RECOMPILED_ABI_VERSION
+ *  \brief - Bumped whenever the module layout, NativeContext or the
+ *           helpers below change. Modules built against another version
+ *           are rejected.
+ */
+static const uint32_t RECOMPILED_ABI_VERSION = 1;
+
+/*
+ *  \struct - RecompiledBlock
+ *  \brief - The native code for the block starting at address. size and
+ *           budget have the same meaning as in NativeBlock.
+ */
+struct RecompiledBlock
+{
+    uint16_t address;
+    uint16_t size;
+    uint32_t budget;
+    NativeBlock::Function function;
+};
+
+/*
+ *  \struct - RecompiledModule
+ *  \brief - Everything a module generated by nes_aot exports. romHash is
+ *           the Cartridge hash of the ROM the code was generated from.
+ */
+struct RecompiledModule
+{
+    uint32_t abiVersion;
+    uint64_t romHash;
+    const RecompiledBlock* blocks;
+    size_t numBlocks;
+};
+
+/*
+ *  \struct - RecompiledState
+ *  \brief - The registers of a recompiled block. Generated code works on
+ *           a local copy so the host compiler can keep it in registers,
+ *           exit writes it back to the context.
+ *
+ *           Only the 2KB of internal RAM is reached through the context.
+ *           ROM is baked into the generated code.
+ */
+struct RecompiledState
+{
+    explicit RecompiledState(NativeContext* context) :
+        context(context),
+        a(context->accumulator),
+        x(context->xIndex),
+        y(context->yIndex),
+        s(context->stackPointer),
+        p(context->status)
+    {
+    }
+
+    inline uint32_t exit(uint16_t programCounter, uint32_t cycles)
+    {
+        context->accumulator = a;
+        context->xIndex = x;
+        context->yIndex = y;
+        context->stackPointer = s;
+        context->status = p;
+        context->programCounter = programCounter;
+        return cycles;
+    }
+
+    inline bool flag(size_t bit) const
+    {
+        return (p & (1 << bit)) != 0;
+    }
+
+    inline void setFlag(size_t bit, bool set)
+    {
+        p = set ? (p | (1 << bit)) : (p & ~(1 << bit));
+    }
+
+    inline uint8_t zeroSign(uint8_t value)
+    {
+        p = (p & ~((1 << ZERO) | (1 << SIGN))) | context->zeroSign[value];
+        return value;
+    }
+
+    inline uint8_t read(uint16_t address) const
+    {
+        return context->ramPages[(address & RAM_MASK) >> 8][address & 0xFF];
+    }
+
+    inline void write(uint16_t address, uint8_t value)
+    {
+        const size_t page = (address & RAM_MASK) >> 8;
+        context->ramPages[page][address & 0xFF] = value;
+        ++(*context->ramVersions[page]);
+    }
+
+    inline void push(uint8_t value)
+    {
+        write(STACK_PAGE | s, value);
+        --s;
+    }
+
+    inline uint8_t pop()
+    {
+        ++s;
+        return read(STACK_PAGE | s);
+    }
+
+    inline void adc(uint8_t value)
+    {
+        const uint32_t sum = a + value + (p & (1 << CARRY));
+        setFlag(OFLOW, ((a ^ sum) & (value ^ sum) & 0x80) != 0);
+        setFlag(CARRY, sum > 0xFF);
+        a = zeroSign(static_cast<uint8_t>(sum));
+    }
+
+    inline void compare(uint8_t reg, uint8_t value)
+    {
+        setFlag(CARRY, reg >= value);
+        zeroSign(static_cast<uint8_t>(reg - value));
+    }
+
+    inline void bit(uint8_t value)
+    {
+        p = (p & ~((1 << ZERO) | (1 << OFLOW) | (1 << SIGN))) |
+                (value & ((1 << OFLOW) | (1 << SIGN))) |
+                ((value & a) == 0 ? (1 << ZERO) : 0);
+    }
+
+    inline uint8_t asl(uint8_t value)
+    {
+        setFlag(CARRY, (value & 0x80) != 0);
+        return zeroSign(static_cast<uint8_t>(value << 1));
+    }
+
+    inline uint8_t lsr(uint8_t value)
+    {
+        setFlag(CARRY, (value & 0x01) != 0);
+        return zeroSign(value >> 1);
+    }
+
+    inline uint8_t rol(uint8_t value)
+    {
+        const uint8_t carry = p & (1 << CARRY);
+        setFlag(CARRY, (value & 0x80) != 0);
+        return zeroSign(static_cast<uint8_t>((value << 1) | carry));
+    }
+
+    inline uint8_t ror(uint8_t value)
+    {
+        const uint8_t carry = (p & (1 << CARRY)) << 7;
+        setFlag(CARRY, (value & 0x01) != 0);
+        return zeroSign((value >> 1) | carry);
+    }
+
+    static const uint16_t RAM_MASK = 0x07FF;
+    static const uint16_t STACK_PAGE = 0x0100;
+
+    NativeContext* const context;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t s;
+    uint8_t p;
+};
+}
+}
+
+#endif
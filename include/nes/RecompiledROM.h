@@ -0,0 +1,114 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_RECOMPILED_ROM_H__
+#define __NYRA_NES_RECOMPILED_ROM_H__
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nes/NativeBlock.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - RecompiledROM
+ *  \brief - A shared library of native code generated ahead of time by
+ *           nes_aot for a single ROM. The blocks are attached to the
+ *           BlockCache the first time they run. Anything the module does
+ *           not cover falls back to the interpreter or the JIT.
+ *
+ *           Modules are shared between every emulator running the same
+ *           ROM and unloaded once the last one is gone.
+ */
+class RecompiledROM
+{
+public:
+    /*
+     *  \func - Destructor
+     *  \brief - Unloads the shared library.
+     */
+    ~RecompiledROM();
+
+    /*
+     *  \func - load
+     *  \brief - Loads a module from disk.
+     *
+     *  \param pathname - The full path of the shared library.
+     *  \param romHash - The Cartridge hash of the ROM being run.
+     *  \throw - If the library cannot be loaded, is not a module, was
+     *           built for another ABI version or another ROM.
+     */
+    static std::shared_ptr<const RecompiledROM> load(
+            const std::string& pathname,
+            uint64_t romHash);
+
+    /*
+     *  \func - find
+     *  \brief - Searches the directories in the NYRA_NES_AOT_PATH
+     *           environment variable (separated by ':') for a module
+     *           built from a ROM. Libraries that fail to load are skipped.
+     *
+     *  \param romHash - The Cartridge hash of the ROM being run.
+     *  \return - The module, or nullptr if there is none.
+     */
+    static std::shared_ptr<const RecompiledROM> find(uint64_t romHash);
+
+    /*
+     *  \func - getBlock
+     *  \brief - Returns the native code for the block starting at an
+     *           address, or nullptr if the module does not have it.
+     */
+    inline const NativeBlock* getBlock(uint16_t address) const
+    {
+        const uint16_t index = mIndex[address];
+        return index == NO_BLOCK ? nullptr : &mBlocks[index];
+    }
+
+    /*
+     *  \func - getNumBlocks
+     *  \brief - Returns the number of blocks in the module.
+     */
+    inline size_t getNumBlocks() const
+    {
+        return mBlocks.size();
+    }
+
+private:
+    RecompiledROM(const std::string& pathname,
+                  uint64_t romHash);
+
+    static const uint16_t NO_BLOCK = 0xFFFF;
+
+    void* mHandle;
+    const uint64_t mHash;
+    std::vector<NativeBlock> mBlocks;
+    std::vector<uint16_t> mIndex;
+};
+}
+}
+
+#endif
@@ -0,0 +1,212 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_SAVE_STATE_H__
+#define __NYRA_NES_SAVE_STATE_H__
+
+#include <stdint.h>
+#include <cstring>
+#include <bitset>
+#include <stdexcept>
+#include <nes/Constants.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \Constant - SAVE_STATE_MAGIC
+ *  \brief - The first four bytes of every save state ("NYRS").
+ */
+static const uint32_t SAVE_STATE_MAGIC = 0x5352594E;
+
+/*
+ *  \Constant - SAVE_STATE_VERSION
+ *  \brief - The layout version of a save state. This must be bumped any
+ *           time a field is added, removed or reordered.
+ */
+static const uint32_t SAVE_STATE_VERSION = 2;
+
+/*
+ *  \class - StateWriter
+ *  \brief - Writes values one after another into a flat byte buffer.
+ *           Values are written in host byte order.
+ *           If the buffer is nullptr nothing is written and the writer
+ *           only counts bytes. This is used to find the size of a state.
+ *
+ *  TODO: This is setup for a little endian system. States are not
+ *        portable to a big endian system.
+ */
+class StateWriter
+{
+public:
+    /*
+     *  \func - Constructor (buffer)
+     *  \brief - Creates a writer over an existing buffer. The writer does
+     *           not take ownership of the buffer.
+     *
+     *  \param buffer - The output buffer, or nullptr to only count bytes.
+     *  \param size - The size of the buffer in bytes.
+     */
+    StateWriter(uint8_t* buffer,
+                size_t size) :
+        mBuffer(buffer),
+        mSize(size),
+        mOffset(0)
+    {
+    }
+
+    /*
+     *  \func - write
+     *  \brief - Writes a single plain value.
+     */
+    template <typename ValueT>
+    inline void write(ValueT value)
+    {
+        writeBuffer(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+    }
+
+    /*
+     *  \func - writeFlags
+     *  \brief - Writes an 8 bit register as a single byte.
+     */
+    inline void writeFlags(const std::bitset<FLAG_SIZE>& flags)
+    {
+        write(static_cast<uint8_t>(flags.to_ulong()));
+    }
+
+    /*
+     *  \func - writeBuffer
+     *  \brief - Copies a block of memory into the state.
+     *
+     *  \throw - If the state buffer is too small.
+     */
+    inline void writeBuffer(const uint8_t* data,
+                            size_t size)
+    {
+        if (mBuffer)
+        {
+            if (mOffset + size > mSize)
+            {
+                throw std::runtime_error("Save state buffer is too small");
+            }
+            std::memcpy(mBuffer + mOffset, data, size);
+        }
+        mOffset += size;
+    }
+
+    /*
+     *  \func - getOffset
+     *  \brief - Returns the number of bytes written so far.
+     */
+    inline size_t getOffset() const
+    {
+        return mOffset;
+    }
+
+private:
+    uint8_t* const mBuffer;
+    const size_t mSize;
+    size_t mOffset;
+};
+
+/*
+ *  \class - StateReader
+ *  \brief - Reads values back out of a buffer created by a StateWriter.
+ *           Reading never allocates.
+ */
+class StateReader
+{
+public:
+    /*
+     *  \func - Constructor (buffer)
+     *  \brief - Creates a reader over an existing buffer. The reader does
+     *           not take ownership of the buffer.
+     *
+     *  \param buffer - The save state.
+     *  \param size - The size of the save state in bytes.
+     */
+    StateReader(const uint8_t* buffer,
+                size_t size) :
+        mBuffer(buffer),
+        mSize(size),
+        mOffset(0)
+    {
+    }
+
+    /*
+     *  \func - read
+     *  \brief - Reads a single plain value.
+     */
+    template <typename ValueT>
+    inline void read(ValueT& value)
+    {
+        readBuffer(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    }
+
+    /*
+     *  \func - readFlags
+     *  \brief - Reads an 8 bit register that was stored as a single byte.
+     */
+    inline void readFlags(std::bitset<FLAG_SIZE>& flags)
+    {
+        uint8_t value;
+        read(value);
+        flags = std::bitset<FLAG_SIZE>(value);
+    }
+
+    /*
+     *  \func - readBuffer
+     *  \brief - Copies a block of memory out of the state.
+     *
+     *  \throw - If the state does not hold enough bytes.
+     */
+    inline void readBuffer(uint8_t* data,
+                           size_t size)
+    {
+        if (mOffset + size > mSize)
+        {
+            throw std::runtime_error("Save state is truncated");
+        }
+        std::memcpy(data, mBuffer + mOffset, size);
+        mOffset += size;
+    }
+
+    /*
+     *  \func - getOffset
+     *  \brief - Returns the number of bytes read so far.
+     */
+    inline size_t getOffset() const
+    {
+        return mOffset;
+    }
+
+private:
+    const uint8_t* const mBuffer;
+    const size_t mSize;
+    size_t mOffset;
+};
+}
+}
+
+#endif
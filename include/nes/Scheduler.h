@@ -0,0 +1,154 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_SCHEDULER_H__
+#define __NYRA_NES_SCHEDULER_H__
+
+#include <stdint.h>
+#include <nes/SaveState.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - Scheduler
+ *  \brief - Keeps the timestamps of upcoming events on the master clock
+ *           (in PPU cycles, see CPUInfo::clock). The CPU runs straight up
+ *           to the next event, then the event is handled and usually
+ *           schedules its follow up.
+ *
+ *           Each event type has a single slot, so scheduling an event that
+ *           is already pending moves it. Events due at the same time are
+ *           returned in the order of the Event enum.
+ */
+class Scheduler
+{
+public:
+    /*
+     *  \enum - Event
+     *  \brief - Everything that can be scheduled. New hardware (APU frame
+     *           counter, mapper IRQs, DMA stalls) is added here along with
+     *           a handler in the Emulator.
+     */
+    enum Event
+    {
+        SCANLINE_END,
+        SCANLINE_START,
+        NUM_EVENTS
+    };
+
+    /*
+     *  \Constant - NEVER
+     *  \brief - The time of an event that is not scheduled.
+     */
+    static const uint64_t NEVER = ~static_cast<uint64_t>(0);
+
+    /*
+     *  \func - Constructor
+     *  \brief - Creates a scheduler with nothing scheduled.
+     */
+    Scheduler();
+
+    /*
+     *  \func - schedule
+     *  \brief - Schedules (or moves) an event.
+     *
+     *  \param event - The event type.
+     *  \param time - The master clock time the event is due.
+     */
+    inline void schedule(Event event,
+                         uint64_t time)
+    {
+        mTimes[event] = time;
+        update();
+    }
+
+    /*
+     *  \func - cancel
+     *  \brief - Removes a pending event.
+     */
+    inline void cancel(Event event)
+    {
+        schedule(event, NEVER);
+    }
+
+    /*
+     *  \func - getNextTime
+     *  \brief - Returns the time of the earliest pending event. This is
+     *           the budget the CPU can run to.
+     */
+    inline uint64_t getNextTime() const
+    {
+        return mTimes[mNext];
+    }
+
+    /*
+     *  \func - getTime
+     *  \brief - Returns the time a single event is due, or NEVER.
+     */
+    inline uint64_t getTime(Event event) const
+    {
+        return mTimes[event];
+    }
+
+    /*
+     *  \func - pop
+     *  \brief - Removes the earliest pending event and returns it.
+     *
+     *  \param time[OUTPUT] - The time the event was due.
+     */
+    inline Event pop(uint64_t& time)
+    {
+        const Event ret = mNext;
+        time = mTimes[ret];
+        cancel(ret);
+        return ret;
+    }
+
+    void saveState(StateWriter& state) const;
+
+    void loadState(StateReader& state);
+
+private:
+    inline void update()
+    {
+        // There are only a handful of event types so a linear scan is
+        // cheaper than keeping a heap.
+        mNext = static_cast<Event>(0);
+        for (size_t ii = 1; ii < NUM_EVENTS; ++ii)
+        {
+            if (mTimes[ii] < mTimes[mNext])
+            {
+                mNext = static_cast<Event>(ii);
+            }
+        }
+    }
+
+    uint64_t mTimes[NUM_EVENTS];
+    Event mNext;
+};
+}
+}
+
+#endif
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_TILE_CACHE_H__
+#define __NYRA_NES_TILE_CACHE_H__
+
+#include <stdint.h>
+#include <vector>
+#include <nes/Memory.h>
+#include <nes/Constants.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - TileCache
+ *  \brief - Holds every CHR bank pre-decoded into packed tile rows. A tile
+ *           is 16 bytes of CHR memory, eight bytes for the low bit plane
+ *           followed by eight bytes for the high bit plane. Each row of
+ *           eight pixels is decoded into a single uint16_t with two bits
+ *           per pixel, so a whole row comes out of one load.
+ *
+ *           The pixel with bit position b (7 is the leftmost pixel) is
+ *           (row >> (b * 2)) & 0x03.
+ *
+ *           CHR ROM can be decoded once per ROMImage and shared. Only the
+ *           writable banks are then decoded by each cache.
+ */
+class TileCache
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Decodes every bank of CHR memory.
+     *
+     *  \param chrBanks - The CHR banks from the cartridge.
+     *  \param sharedRows - The banks already decoded by decode, or
+     *         nullptr to decode them here. Writable banks are always
+     *         decoded here. This is not owned.
+     */
+    TileCache(const ROMBanks& chrBanks,
+              const uint16_t* sharedRows = nullptr);
+
+    /*
+     *  \func - decode
+     *  \brief - Decodes every bank into one buffer in bank order. This is
+     *           the layout the constructor takes as sharedRows.
+     *
+     *  \param chrBanks - The CHR banks to decode.
+     */
+    static std::vector<uint16_t> decode(const ROMBanks& chrBanks);
+
+    /*
+     *  \func - getRows
+     *  \brief - Returns the decoded rows for a bank. A row is found at
+     *           index (tile * 8) + row, see getRowIndex.
+     *
+     *  \param bank - The index of the bank.
+     */
+    inline const uint16_t* getRows(size_t bank) const
+    {
+        return mBankRows[bank];
+    }
+
+    /*
+     *  \func - getRowIndex
+     *  \brief - Converts an address inside of a bank into the index of
+     *           the row that holds it. This works for either bit plane.
+     */
+    static inline size_t getRowIndex(size_t address)
+    {
+        return ((address >> 1) & ~static_cast<size_t>(0x07)) |
+                (address & 0x07);
+    }
+
+    /*
+     *  \func - decodeRow
+     *  \brief - Interleaves the two bit planes of a tile row.
+     *
+     *  \param low - The low bit plane.
+     *  \param high - The high bit plane.
+     */
+    static uint16_t decodeRow(uint8_t low,
+                              uint8_t high);
+
+    /*
+     *  \func - invalidate
+     *  \brief - Decodes a single row again after its CHR memory has been
+     *           written. Only the row holding the address is touched.
+     *
+     *  \param bank - The index of the bank that was written.
+     *  \param address - The address inside of the bank.
+     */
+    void invalidate(size_t bank,
+                    size_t address);
+
+    /*
+     *  \func - refresh
+     *  \brief - Decodes every writable (CHR RAM) bank again. This is used
+     *           after the whole bank has been replaced, like when loading
+     *           a save state. ROM banks are skipped.
+     */
+    void refresh();
+
+private:
+    void decodeBank(size_t bank);
+
+    std::vector<ROM*> mBanks;
+    std::vector<const uint16_t*> mBankRows;
+
+    // Where each bank decoded here starts in mRows.
+    std::vector<size_t> mBankOffsets;
+    std::vector<uint16_t> mRows;
+};
+}
+}
+
+#endif
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_TILE_KERNEL_HPP__
+#define __NYRA_NES_TILE_KERNEL_HPP__
+
+#include <stdint.h>
+#include <nes/Constants.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \Constant - TILE_WIDTH
+ *  \brief - The number of pixels in a row of a tile.
+ */
+static const size_t TILE_WIDTH = 8;
+
+/*****************************************************************************/
+/*
+ *  \func - renderTileRowScalar
+ *  \brief - Expands a decoded tile row (see TileCache) into eight pixels,
+ *           leftmost first.
+ *
+ *  \param tileRow - The decoded row.
+ *  \param colors - The four RGB colors of the palette. Index zero is the
+ *         color used for transparent pixels.
+ *  \param output - Where to write the eight pixels.
+ */
+inline void renderTileRowScalar(uint16_t tileRow,
+                                const uint32_t* colors,
+                                uint32_t* output)
+{
+    for (size_t ii = 0; ii < TILE_WIDTH; ++ii)
+    {
+        output[ii] = colors[(tileRow >> ((TILE_WIDTH - 1 - ii) * 2)) & 0x03];
+    }
+}
+
+#if defined(__SSE2__)
+/*****************************************************************************/
+/*
+ *  \func - renderTileRowSSE2
+ *  \brief - Same as renderTileRowScalar, but four pixels at a time. Each
+ *           lane tests its two bits of the row and selects between the
+ *           four splatted colors, so there are no branches or table loads.
+ */
+inline void renderTileRowSSE2(uint16_t tileRow,
+                              const uint32_t* colors,
+                              uint32_t* output)
+{
+    // Low and high bit of each pixel. Lanes are in memory order so lane
+    // zero is the leftmost pixel (bit position 7).
+    const __m128i lowLeft = _mm_setr_epi32(1 << 14, 1 << 12, 1 << 10, 1 << 8);
+    const __m128i lowRight = _mm_setr_epi32(1 << 6, 1 << 4, 1 << 2, 1 << 0);
+    const __m128i highLeft = _mm_slli_epi32(lowLeft, 1);
+    const __m128i highRight = _mm_slli_epi32(lowRight, 1);
+
+    const __m128i row = _mm_set1_epi32(tileRow);
+    const __m128i color0 = _mm_set1_epi32(colors[0]);
+    const __m128i color1 = _mm_set1_epi32(colors[1]);
+    const __m128i color2 = _mm_set1_epi32(colors[2]);
+    const __m128i color3 = _mm_set1_epi32(colors[3]);
+
+    const __m128i masks[2][2] = {{lowLeft, highLeft}, {lowRight, highRight}};
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        const __m128i low = _mm_cmpeq_epi32(
+                _mm_and_si128(row, masks[ii][0]), masks[ii][0]);
+        const __m128i high = _mm_cmpeq_epi32(
+                _mm_and_si128(row, masks[ii][1]), masks[ii][1]);
+
+        // Select on the low bit, then on the high bit.
+        const __m128i clear = _mm_or_si128(_mm_and_si128(low, color1),
+                                           _mm_andnot_si128(low, color0));
+        const __m128i set = _mm_or_si128(_mm_and_si128(low, color3),
+                                         _mm_andnot_si128(low, color2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + (ii * 4)),
+                         _mm_or_si128(_mm_and_si128(high, set),
+                                      _mm_andnot_si128(high, clear)));
+    }
+}
+#endif
+
+/*****************************************************************************/
+/*
+ *  \func - renderTileRow
+ *  \brief - Expands a decoded tile row with the fastest kernel the target
+ *           supports. Every kernel produces identical output.
+ */
+inline void renderTileRow(uint16_t tileRow,
+                          const uint32_t* colors,
+                          uint32_t* output)
+{
+#if defined(__SSE2__)
+    renderTileRowSSE2(tileRow, colors, output);
+#else
+    renderTileRowScalar(tileRow, colors, output);
+#endif
+}
+}
+}
+
+#endif
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_TRACE_H__
+#define __NYRA_NES_TRACE_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <memory>
+#include <nes/CPUHelper.h>
+#include <nes/MemoryMap.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \struct - TraceRecord
+ *  \brief - The state of the CPU as an instruction was about to run. The
+ *           address and value are the effective address of the
+ *           instruction and the byte at it, which is everything the
+ *           Nintendulator format shows beyond the registers. Records are
+ *           written to files as is, so the layout must not change without
+ *           bumping the trace file version.
+ */
+struct TraceRecord
+{
+    uint16_t programCounter;
+    uint16_t cycles;
+    int16_t scanLine;
+    uint16_t address;
+    uint8_t opcode;
+    uint8_t arg1;
+    uint8_t arg2;
+    uint8_t accumulator;
+    uint8_t xIndex;
+    uint8_t yIndex;
+    uint8_t status;
+    uint8_t stackPointer;
+    uint8_t value;
+    uint8_t reserved;
+};
+
+/*
+ *  \class - TraceBuffer
+ *  \brief - A fixed size ring buffer of trace records. Once full the
+ *           oldest records are overwritten, so after a crash it holds
+ *           the instructions that led up to it. It can also stream every
+ *           record into a binary file as the ring fills up.
+ */
+class TraceBuffer
+{
+public:
+    /*
+     *  \func - Constructor
+     *  \brief - Creates an empty buffer.
+     *
+     *  \param capacity - The number of records kept.
+     *  \throw - If capacity is zero.
+     */
+    TraceBuffer(size_t capacity);
+
+    /*
+     *  \func - Destructor
+     *  \brief - Flushes anything left to the stream.
+     */
+    ~TraceBuffer();
+
+    /*
+     *  \func - record
+     *  \brief - Adds an instruction that is about to run.
+     *
+     *  \param args - The opcode and operands.
+     *  \param registers - The registers before the instruction.
+     *  \param programCounter - The address of the instruction.
+     *  \param cycles - The PPU cycle within the scanline.
+     *  \param scanLine - The current scanline.
+     *  \param memory - Used to resolve the effective address. Only plain
+     *         RAM and ROM are read so tracing has no side effects.
+     */
+    inline void record(const CPUArgs& args,
+                       const CPURegisters& registers,
+                       uint16_t programCounter,
+                       uint16_t cycles,
+                       int16_t scanLine,
+                       const MemoryMap& memory)
+    {
+        TraceRecord& record = mRecords[mNext];
+        record.programCounter = programCounter;
+        record.cycles = cycles;
+        record.scanLine = scanLine;
+        record.opcode = args.opcode;
+        record.arg1 = args.arg1;
+        record.arg2 = args.arg2;
+        record.accumulator = registers.accumulator;
+        record.xIndex = registers.xIndex;
+        record.yIndex = registers.yIndex;
+        record.status = registers.getStatus();
+        record.stackPointer = registers.stackPointer;
+        record.reserved = 0;
+        resolve(record, memory);
+
+        ++mTotal;
+        if (++mNext == mRecords.size())
+        {
+            wrap();
+        }
+    }
+
+    /*
+     *  \func - getSize
+     *  \brief - Returns the number of records held.
+     */
+    inline size_t getSize() const
+    {
+        return mTotal < mRecords.size() ?
+                static_cast<size_t>(mTotal) : mRecords.size();
+    }
+
+    /*
+     *  \func - getCapacity
+     *  \brief - Returns the number of records the buffer can hold.
+     */
+    inline size_t getCapacity() const
+    {
+        return mRecords.size();
+    }
+
+    /*
+     *  \func - getTotal
+     *  \brief - Returns the number of records added since the buffer was
+     *           created or cleared, including overwritten ones.
+     */
+    inline uint64_t getTotal() const
+    {
+        return mTotal;
+    }
+
+    /*
+     *  \func - get
+     *  \brief - Returns a held record, oldest first.
+     *
+     *  \throw - If the index is out of range.
+     */
+    const TraceRecord& get(size_t index) const;
+
+    /*
+     *  \func - clear
+     *  \brief - Drops every record. The stream is flushed first.
+     */
+    void clear();
+
+    /*
+     *  \func - openStream
+     *  \brief - Writes every record added from now on into a trace file.
+     *           Records are written in chunks as the ring fills, call
+     *           flush to write the rest.
+     *
+     *  \throw - If the file cannot be opened.
+     */
+    void openStream(const std::string& pathname);
+
+    /*
+     *  \func - closeStream
+     *  \brief - Flushes and closes the stream, if there is one.
+     */
+    void closeStream();
+
+    /*
+     *  \func - flush
+     *  \brief - Writes the records not yet in the stream.
+     */
+    void flush();
+
+    /*
+     *  \func - save
+     *  \brief - Writes the held records, oldest first, into a trace file.
+     */
+    void save(const std::string& pathname) const;
+
+    /*
+     *  \func - load
+     *  \brief - Reads every record from a trace file.
+     *
+     *  \throw - If the file is not a trace file.
+     */
+    static std::vector<TraceRecord> load(const std::string& pathname);
+
+private:
+    void resolve(TraceRecord& record, const MemoryMap& memory) const;
+
+    void wrap();
+
+    void write(size_t begin, size_t end);
+
+    std::vector<TraceRecord> mRecords;
+    size_t mNext;
+    size_t mFlushed;
+    uint64_t mTotal;
+    std::unique_ptr<std::ofstream> mStream;
+};
+
+/*
+ *  \func - toNintendulator
+ *  \brief - Prints a record the way Nintendulator logs an instruction,
+ *           for example "C000  4C F5 C5  JMP $C5F5  A:00 X:00 Y:00 P:24
+ *           SP:FD CYC:  0 SL:241", with the columns padded.
+ */
+std::string toNintendulator(const TraceRecord& record);
+
+/*
+ *  \func - decodeTrace
+ *  \brief - Prints every record in a trace file in the Nintendulator
+ *           format, one per line.
+ */
+void decodeTrace(const std::string& pathname, std::ostream& stream);
+}
+}
+
+#endif
@@ -28,23 +28,120 @@
 #include <nes/Memory.h>
 #include <nes/MemoryMap.h>
 #include <nes/Constants.h>
+#include <nes/TileCache.h>
 
 namespace nyra
 {
 namespace nes
 {
+/*
+ *  \class - VRAM
+ *  \brief - The PPU address space. The pattern tables show two of the 4KB
+ *           CHR banks, which is 8KB of CHR RAM if the cartridge has no
+ *           CHR ROM. Mappers can switch the banks and the nametable
+ *           mirroring after the table is locked.
+ */
 class VRAM : public MemoryMap
 {
 public:
     VRAM(const ROMBanks& chrROM,
-         Mirroring mirroring);
+         Mirroring mirroring,
+         const uint16_t* chrTiles = nullptr);
+
+    /*
+     *  \func - getNumPatternBanks
+     *  \brief - Returns the number of 4KB CHR banks.
+     */
+    inline size_t getNumPatternBanks() const
+    {
+        return mChrBanks.size();
+    }
+
+    /*
+     *  \func - switchPatternTable
+     *  \brief - Shows a different CHR bank in one of the pattern tables.
+     *
+     *  \param table - The pattern table, 0 for 0x0000 or 1 for 0x1000.
+     *  \param bank - The index of the 4KB CHR bank.
+     */
+    void switchPatternTable(size_t table,
+                            size_t bank);
+
+    /*
+     *  \func - setMirroring
+     *  \brief - Changes which nametable is seen at each address.
+     */
+    void setMirroring(Mirroring mirroring);
 
     inline uint8_t getBackgroundColor()
     {
         return mUniversalBackgroundColor[0]->readByte(0);
     }
 
+    /*
+     *  \func - getTileRow
+     *  \brief - Returns a decoded row of a tile in the pattern tables.
+     *           See TileCache for the layout.
+     *
+     *  \param address - The address of the low bit plane of the row.
+     */
+    inline uint16_t getTileRow(size_t address) const
+    {
+        return mPatternTables[(address >> PATTERN_TABLE_SHIFT) & 0x01]
+                [TileCache::getRowIndex(address & PATTERN_TABLE_MASK)];
+    }
+
+    /*
+     *  \func - invalidateTile
+     *  \brief - Must be called after a write into the pattern tables so
+     *           the decoded tile matches CHR RAM.
+     *
+     *  \param address - The address that was written.
+     */
+    inline void invalidateTile(size_t address)
+    {
+        mTileCache.invalidate(
+                mPatternBanks[(address >> PATTERN_TABLE_SHIFT) & 0x01],
+                address & PATTERN_TABLE_MASK);
+    }
+
+    /*
+     *  \func - invalidateTiles
+     *  \brief - Same as invalidateTile for a run of writes. Each row is
+     *           only decoded once, even when both bit planes were written.
+     *
+     *  \param address - The first address that was written.
+     *  \param count - The number of addresses written.
+     */
+    void invalidateTiles(size_t address,
+                         size_t count);
+
+    /*
+     *  \func - refreshTiles
+     *  \brief - Decodes all CHR RAM again. This is needed after the whole
+     *           of VRAM has been replaced.
+     */
+    inline void refreshTiles()
+    {
+        mTileCache.refresh();
+    }
+
+    static const size_t PATTERN_TABLE_END = 0x2000;
+
 private:
+    static const size_t PATTERN_TABLE_SHIFT = 12;
+    static const size_t PATTERN_TABLE_MASK = 0x0FFF;
+    static const size_t BIT_PLANE_OFFSET = 8;
+
+    static const size_t NAMETABLE_START = 0x2000;
+    static const size_t NAMETABLE_SIZE = 0x0400;
+
+    ROMBanks mChrRAM;
+    const ROMBanks& mChrBanks;
+    TileCache mTileCache;
+    Mirroring mMirroring;
+    size_t mPatternBanks[2];
+    const uint16_t* mPatternTables[2];
     //RAM mNametable;
     RAMBanks mNametables;
     RAMBanks mUniversalBackgroundColor;
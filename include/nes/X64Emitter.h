@@ -0,0 +1,183 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#ifndef __NYRA_NES_X64_EMITTER_H__
+#define __NYRA_NES_X64_EMITTER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace nyra
+{
+namespace nes
+{
+/*
+ *  \class - X64Emitter
+ *  \brief - A tiny x86-64 assembler covering only the instructions the
+ *           6502 recompiler needs. Register operations are 32 bit unless
+ *           the name says otherwise. Memory operands are always
+ *           [base + index + disp32], pass NONE to skip the index.
+ */
+class X64Emitter
+{
+public:
+    /*
+     *  \enum - Register
+     *  \brief - The general purpose registers in encoding order.
+     */
+    enum Register
+    {
+        RAX = 0, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+        R8, R9, R10, R11, R12, R13, R14, R15,
+        NONE = -1
+    };
+
+    /*
+     *  \enum - AluOp
+     *  \brief - The group 1 arithmetic operations.
+     */
+    enum AluOp
+    {
+        ADD = 0, OR = 1, AND = 4, SUB = 5, XOR = 6, CMP = 7
+    };
+
+    /*
+     *  \enum - Condition
+     *  \brief - Condition codes for jcc and setcc.
+     */
+    enum Condition
+    {
+        BELOW = 0x2,
+        ABOVE_EQUAL = 0x3,
+        EQUAL = 0x4,
+        NOT_EQUAL = 0x5
+    };
+
+    void movReg(Register dst, Register src);
+
+    void movReg64(Register dst, Register src);
+
+    void movImm(Register dst, uint32_t value);
+
+    void movImm64(Register dst, uint64_t value);
+
+    void alu(AluOp op, Register dst, Register src);
+
+    void alu64(AluOp op, Register dst, Register src);
+
+    void aluImm(AluOp op, Register dst, int32_t value);
+
+    void shl(Register dst, uint8_t count);
+
+    void shr(Register dst, uint8_t count);
+
+    void test(Register first, Register second);
+
+    void testImm(Register dst, uint32_t value);
+
+    void setcc(Condition condition, Register dst);
+
+    void movzx8(Register dst, Register src);
+
+    void loadByte(Register dst, Register base, Register index, int32_t disp);
+
+    void storeByte(Register base, Register index, int32_t disp,
+                   Register src);
+
+    void storeWord(Register base, int32_t disp, Register src);
+
+    void incMem(Register base);
+
+    void lea(Register dst, Register base, int32_t disp);
+
+    void lea(Register dst, Register base, Register index,
+             uint8_t shift, int32_t disp);
+
+    void cmpMem(Register reg, Register base, int32_t disp);
+
+    void push(Register reg);
+
+    void pop(Register reg);
+
+    void ret();
+
+    /*
+     *  \func - jcc
+     *  \brief - Emits a conditional jump with an unresolved target.
+     *
+     *  \return - The label to pass to bind once the target is known.
+     */
+    size_t jcc(Condition condition);
+
+    /*
+     *  \func - bind
+     *  \brief - Points a jump from jcc at a position, by default the
+     *           current one.
+     */
+    inline void bind(size_t label)
+    {
+        bind(label, mCode.size());
+    }
+
+    void bind(size_t label, size_t position);
+
+    /*
+     *  \func - getPosition
+     *  \brief - Returns the current position, used to bind jumps back.
+     */
+    inline size_t getPosition() const
+    {
+        return mCode.size();
+    }
+
+    /*
+     *  \func - getCode
+     *  \brief - Returns the machine code emitted so far.
+     */
+    inline const std::vector<uint8_t>& getCode() const
+    {
+        return mCode;
+    }
+
+    inline void clear()
+    {
+        mCode.clear();
+    }
+
+private:
+    void rex(bool wide, int reg, int index, int base, bool byteReg);
+
+    void modRM(int reg, int rm);
+
+    void modRM(int reg, Register base, Register index, int32_t disp,
+               uint8_t shift = 0);
+
+    void emit32(uint32_t value);
+
+    std::vector<uint8_t> mCode;
+};
+}
+}
+
+#endif
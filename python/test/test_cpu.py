@@ -1,9 +1,11 @@
-
 import unittest
 import os
-from nes import CPU, Cartridge, create_memory_map, DisassemblyVector, PPU, Controller
+from nes import CPU, Cartridge, create_memory_map, TraceBuffer, PPU, APU, Controller
 from print_disassembly import print_nintendulator
 
+# The lines of nestest.log before the first unofficial opcode.
+OFFICIAL_LINES = 5003
+
 class TestCPU(unittest.TestCase):
     def test_cpu(self):
         cart_pathname = os.path.join(
@@ -13,31 +15,36 @@ class TestCPU(unittest.TestCase):
         cart = Cartridge(cart_pathname)
         
         ppu = PPU(cart.get_chr_rom(), 0)
+        apu = APU()
         controller1 = Controller()
         controller2 = Controller()
-        memory = create_memory_map(cart, ppu, controller1, controller2)
+        memory = create_memory_map(cart, ppu, apu, controller1, controller2)
 
         lines = open(log_pathname).readlines()
 
-        disassembly = DisassemblyVector()
+        trace = TraceBuffer(len(lines))
         cpu = CPU(0xC000)
         cpu.get_info().scan_line = 241
-        
+        cpu.set_trace(trace)
+
+        # The official opcodes run until the first unofficial one throws.
+        # That one is recorded before it runs, so it is the last record.
         keep_going = True
-        index = 0
         while keep_going:
             try:
-                disassembly.clear()
-                cpu.process_scanline(memory, disassembly)
+                cpu.process_scanline(memory)
             except:
                 keep_going = False
-                if not disassembly.empty():
-                    disassembly.pop()
 
-            for data in disassembly:
-                self.assertEqual(print_nintendulator(data),
-                                 lines[index].strip())
-                index += 1
+        self.assertEqual(trace.get_size(), OFFICIAL_LINES + 1)
+        for index in range(OFFICIAL_LINES):
+            self.assertEqual(print_nintendulator(trace.get(index)),
+                             lines[index].strip())
+
+        # The CPU names unofficial opcodes NUL, everything else matches.
+        self.assertEqual(print_nintendulator(trace.get(OFFICIAL_LINES)),
+                         lines[OFFICIAL_LINES].strip().replace('*NOP',
+                                                               ' NUL'))
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,63 @@
+import unittest
+from nes import CPU, Cartridge, create_memory_map, PPU, APU, Controller
+
+# Fill loops the interpreter runs as bulk writes. Counting down from zero
+# stores to index 0 first and then 255 down to 1.
+PROGRAM = bytes([
+    0xA9, 0xAA,              # 8000 LDA #$AA
+    0xA2, 0x00,              # 8002 LDX #$00
+    0x9D, 0x00, 0x04,        # 8004 STA $0400,X
+    0xCA,                    # 8007 DEX
+    0xD0, 0xFA,              # 8008 BNE $8004
+    0xA0, 0x00,              # 800A LDY #$00
+    0x4C, 0x0F, 0x80,        # 800C JMP $800F
+    0x99, 0x00, 0x05,        # 800F STA $0500,Y
+    0x88,                    # 8012 DEY
+    0xD0, 0xFA,              # 8013 BNE $800F
+    0xA2, 0x00,              # 8015 LDX #$00
+    0x4C, 0x1A, 0x80,        # 8017 JMP $801A
+    0x95, 0x20,              # 801A STA $20,X
+    0xCA,                    # 801C DEX
+    0xD0, 0xFB,              # 801D BNE $801A
+    0xA2, 0x10,              # 801F LDX #$10
+    0x9D, 0x00, 0x06,        # 8021 STA $0600,X
+    0xE8,                    # 8024 INX
+    0xD0, 0xFA,              # 8025 BNE $8021
+    0x4C, 0x27, 0x80])       # 8027 JMP $8027
+DONE = 0x8027
+
+def create_rom():
+    header = b'NES\x1a' + bytes([1, 1]) + bytes(10)
+    prg = PROGRAM + bytes(0x4000 - len(PROGRAM))
+    return header + prg + bytes(0x2000)
+
+def is_filled(address):
+    return (address < 0x0100 or
+            0x0400 <= address < 0x0600 or
+            0x0610 <= address < 0x0700)
+
+class TestFill(unittest.TestCase):
+    def run_core(self, core):
+        cart = Cartridge(create_rom())
+        ppu = PPU(cart.get_chr_rom(), 0)
+        apu = APU()
+        controller1 = Controller()
+        controller2 = Controller()
+        memory = create_memory_map(cart, ppu, apu, controller1, controller2)
+
+        cpu = CPU(0x8000, core)
+        cpu.run_cycles(memory, 20000)
+        self.assertEqual(cpu.get_info().program_counter, DONE)
+        return [memory.read_byte(address) for address in range(0x0800)]
+
+    def test_fill(self):
+        expected = self.run_core(CPU.OPCODE_CORE)
+        for address in range(0x0800):
+            self.assertEqual(expected[address],
+                             0xAA if is_filled(address) else 0x00)
+
+        for core in (CPU.INTERPRETER_CORE, CPU.JIT_CORE):
+            self.assertEqual(self.run_core(core), expected)
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,225 @@
+import unittest
+import os
+import tempfile
+from nes import Emulator
+
+PRG_BANK_SIZE = 0x4000
+CHR_BANK_SIZE = 0x1000
+
+# What each nametable address reads once the lower nametable holds 0xA0
+# and the upper one holds 0xA1.
+LOWER = (0xA0, 0xA0, 0xA0, 0xA0)
+UPPER = (0xA1, 0xA1, 0xA1, 0xA1)
+VERTICAL = (0xA0, 0xA1, 0xA0, 0xA1)
+HORIZONTAL = (0xA0, 0xA0, 0xA1, 0xA1)
+
+def create_rom(mapper, prg_banks, chr_banks, vertical):
+    # The first byte of every 16KB PRG bank and 4KB CHR bank says which
+    # bank it is. CHR banks are marked with the high bit set.
+    header = (b'NES\x1a' +
+              bytes([prg_banks,
+                     chr_banks // 2,
+                     ((mapper & 0x0F) << 4) | (1 if vertical else 0),
+                     mapper & 0xF0]) +
+              bytes(8))
+    prg = b''.join(bytes([bank]) + bytes(PRG_BANK_SIZE - 1)
+                   for bank in range(prg_banks))
+    chr = b''.join(bytes([0x80 | bank]) + bytes(CHR_BANK_SIZE - 1)
+                   for bank in range(chr_banks))
+    return header + prg + chr
+
+def set_vram_address(memory, address):
+    memory.read_byte(0x2002)
+    memory.write_byte(0x2006, address >> 8)
+    memory.write_byte(0x2006, address & 0xFF)
+
+def read_vram(memory, address):
+    # Reads are delayed by one byte.
+    set_vram_address(memory, address)
+    memory.read_byte(0x2007)
+    return memory.read_byte(0x2007)
+
+def write_vram(memory, address, value):
+    set_vram_address(memory, address)
+    memory.write_byte(0x2007, value)
+
+def get_prg(memory):
+    return (memory.read_byte(0x8000), memory.read_byte(0xC000))
+
+def get_chr(memory):
+    return (read_vram(memory, 0x0000), read_vram(memory, 0x1000))
+
+def get_nametables(memory):
+    return tuple(read_vram(memory, 0x2000 + ii * 0x400) for ii in range(4))
+
+def write_mmc1(memory, address, value, first=0, last=5):
+    # The register is loaded one bit at a time, low bit first.
+    for bit in range(first, last):
+        memory.write_byte(address, (value >> bit) & 0x01)
+
+class TestMapper(unittest.TestCase):
+    def create_emulator(self, mapper, prg_banks, chr_banks, vertical=False):
+        handle, pathname = tempfile.mkstemp(suffix='.nes')
+        with os.fdopen(handle, 'wb') as rom:
+            rom.write(create_rom(mapper, prg_banks, chr_banks, vertical))
+        self.addCleanup(os.remove, pathname)
+        return Emulator(pathname)
+
+    def test_uxrom(self):
+        emulator = self.create_emulator(2, 8, 0, vertical=True)
+        memory = emulator.get_memory_map()
+        self.assertEqual(get_prg(memory), (0, 7))
+
+        memory.write_byte(0x8000, 3)
+        self.assertEqual(get_prg(memory), (3, 7))
+        memory.write_byte(0xFFFF, 9)
+        self.assertEqual(get_prg(memory), (1, 7))
+
+        # Without CHR ROM the pattern tables are RAM.
+        write_vram(memory, 0x0010, 0x5A)
+        write_vram(memory, 0x1010, 0xA5)
+        self.assertEqual(read_vram(memory, 0x0010), 0x5A)
+        self.assertEqual(read_vram(memory, 0x1010), 0xA5)
+
+        write_vram(memory, 0x2000, 0xA0)
+        write_vram(memory, 0x2400, 0xA1)
+        self.assertEqual(get_nametables(memory), VERTICAL)
+
+        memory.write_byte(0x8000, 5)
+        state = emulator.save_state()
+        memory.write_byte(0x8000, 2)
+        write_vram(memory, 0x0010, 0x00)
+        emulator.load_state(state)
+        self.assertEqual(get_prg(memory), (5, 7))
+        self.assertEqual(read_vram(memory, 0x0010), 0x5A)
+
+    def test_cnrom(self):
+        emulator = self.create_emulator(3, 2, 8)
+        memory = emulator.get_memory_map()
+        self.assertEqual(get_prg(memory), (0, 1))
+        self.assertEqual(get_chr(memory), (0x80, 0x81))
+
+        memory.write_byte(0x8000, 2)
+        self.assertEqual(get_prg(memory), (0, 1))
+        self.assertEqual(get_chr(memory), (0x84, 0x85))
+        memory.write_byte(0xFFFF, 7)
+        self.assertEqual(get_chr(memory), (0x86, 0x87))
+
+        write_vram(memory, 0x2000, 0xA0)
+        write_vram(memory, 0x2800, 0xA1)
+        self.assertEqual(get_nametables(memory), HORIZONTAL)
+
+        memory.write_byte(0x8000, 1)
+        state = emulator.save_state()
+        memory.write_byte(0x8000, 3)
+        self.assertEqual(get_chr(memory), (0x86, 0x87))
+        emulator.load_state(state)
+        self.assertEqual(get_chr(memory), (0x82, 0x83))
+
+    def test_axrom(self):
+        emulator = self.create_emulator(7, 16, 0)
+        memory = emulator.get_memory_map()
+        self.assertEqual(get_prg(memory), (0, 1))
+
+        memory.write_byte(0x8000, 0x03)
+        self.assertEqual(get_prg(memory), (6, 7))
+
+        # Bit 4 picks the nametable every address shows.
+        memory.write_byte(0x8000, 0x00)
+        write_vram(memory, 0x2000, 0xA0)
+        memory.write_byte(0x8000, 0x10)
+        write_vram(memory, 0x2000, 0xA1)
+        self.assertEqual(get_nametables(memory), UPPER)
+        memory.write_byte(0x8000, 0x00)
+        self.assertEqual(get_nametables(memory), LOWER)
+        self.assertEqual(get_prg(memory), (0, 1))
+
+        memory.write_byte(0xFFFF, 0x15)
+        self.assertEqual(get_prg(memory), (10, 11))
+        self.assertEqual(get_nametables(memory), UPPER)
+
+        state = emulator.save_state()
+        memory.write_byte(0x8000, 0x02)
+        self.assertEqual(get_prg(memory), (4, 5))
+        self.assertEqual(get_nametables(memory), LOWER)
+        emulator.load_state(state)
+        self.assertEqual(get_prg(memory), (10, 11))
+        self.assertEqual(get_nametables(memory), UPPER)
+
+    def test_mmc1(self):
+        emulator = self.create_emulator(1, 8, 8, vertical=True)
+        memory = emulator.get_memory_map()
+
+        # Power on fixes the last bank at 0xC000 and uses 8KB CHR banks.
+        self.assertEqual(get_prg(memory), (0, 7))
+        self.assertEqual(get_chr(memory), (0x80, 0x81))
+
+        write_mmc1(memory, 0xE000, 2)
+        self.assertEqual(get_prg(memory), (2, 7))
+
+        # Fix the first bank at 0x8000 instead, with vertical mirroring.
+        write_mmc1(memory, 0x8000, 0x0A)
+        self.assertEqual(get_prg(memory), (0, 2))
+        write_mmc1(memory, 0xE000, 5)
+        self.assertEqual(get_prg(memory), (0, 5))
+
+        # 32KB mode ignores the low bit.
+        write_mmc1(memory, 0x8000, 0x02)
+        self.assertEqual(get_prg(memory), (4, 5))
+
+        # 4KB CHR mode switches each pattern table on its own.
+        write_mmc1(memory, 0x8000, 0x1E)
+        write_mmc1(memory, 0xA000, 3)
+        write_mmc1(memory, 0xC000, 6)
+        self.assertEqual(get_prg(memory), (5, 7))
+        self.assertEqual(get_chr(memory), (0x83, 0x86))
+
+        # 8KB CHR mode ignores the low bit and the second register.
+        write_mmc1(memory, 0x8000, 0x0E)
+        self.assertEqual(get_chr(memory), (0x82, 0x83))
+
+        write_vram(memory, 0x2000, 0xA0)
+        write_vram(memory, 0x2400, 0xA1)
+        self.assertEqual(get_nametables(memory), VERTICAL)
+        write_mmc1(memory, 0x8000, 0x0F)
+        self.assertEqual(get_nametables(memory), HORIZONTAL)
+        write_mmc1(memory, 0x8000, 0x0C)
+        self.assertEqual(get_nametables(memory), LOWER)
+        write_mmc1(memory, 0x8000, 0x0D)
+        self.assertEqual(get_nametables(memory), UPPER)
+
+        # Only the fifth write loads the register.
+        write_mmc1(memory, 0x8000, 0x0A)
+        self.assertEqual(get_prg(memory), (0, 5))
+        write_mmc1(memory, 0xE000, 3, 0, 4)
+        self.assertEqual(get_prg(memory), (0, 5))
+        write_mmc1(memory, 0xE000, 3, 4, 5)
+        self.assertEqual(get_prg(memory), (0, 3))
+
+        # Bit 7 drops the bits written so far and fixes the last bank.
+        write_mmc1(memory, 0xE000, 0x1F, 0, 3)
+        memory.write_byte(0xE000, 0x80)
+        self.assertEqual(get_prg(memory), (3, 7))
+        self.assertEqual(get_nametables(memory), VERTICAL)
+        write_mmc1(memory, 0xE000, 1)
+        self.assertEqual(get_prg(memory), (1, 7))
+
+        # A state saved part way through loading a register finishes the
+        # same way after it is loaded.
+        write_mmc1(memory, 0xE000, 6, 0, 2)
+        state = emulator.save_state()
+        write_mmc1(memory, 0xE000, 6, 2, 5)
+        self.assertEqual(get_prg(memory), (6, 7))
+        write_mmc1(memory, 0x8000, 0x1F)
+        self.assertEqual(get_chr(memory), (0x83, 0x86))
+        self.assertEqual(get_nametables(memory), HORIZONTAL)
+
+        emulator.load_state(state)
+        self.assertEqual(get_prg(memory), (1, 7))
+        self.assertEqual(get_chr(memory), (0x82, 0x83))
+        self.assertEqual(get_nametables(memory), VERTICAL)
+        write_mmc1(memory, 0xE000, 6, 2, 5)
+        self.assertEqual(get_prg(memory), (6, 7))
+
+if __name__ == "__main__":
+    unittest.main()
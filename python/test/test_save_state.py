@@ -0,0 +1,54 @@
+import unittest
+import os
+import ctypes
+from nes import CPU, Emulator, Controller
+
+SCREEN_SIZE = 256 * 240
+FRAMES = 60
+
+class TestSaveState(unittest.TestCase):
+    def run_frames(self, emulator):
+        # Start is held for a few frames so the replay has input in it.
+        frames = []
+        for index in range(FRAMES):
+            emulator.get_controller(0).set_key(Controller.BUTTON_START,
+                                               5 <= index < 10)
+            buffer = (ctypes.c_uint32 * SCREEN_SIZE)()
+            emulator.run_frame(ctypes.addressof(buffer))
+            frames.append(bytes(buffer))
+        return frames
+
+    def cpu_state(self, emulator):
+        cpu = emulator.get_cpu()
+        return (cpu.info.program_counter,
+                cpu.info.clock,
+                cpu.info.scan_line,
+                cpu.registers.accumulator,
+                cpu.registers.x_index,
+                cpu.registers.y_index,
+                cpu.registers.stack_pointer,
+                cpu.registers.get_status())
+
+    def test_save_state(self):
+        cart_pathname = os.path.join(
+                os.path.dirname(os.path.realpath(__file__)), 'nestest.nes')
+
+        for core in (CPU.OPCODE_CORE, CPU.INTERPRETER_CORE, CPU.JIT_CORE):
+            emulator = Emulator(cart_pathname, core)
+            for index in range(30):
+                emulator.run_frame()
+
+            state = emulator.save_state()
+            self.assertEqual(len(state), emulator.get_state_size())
+            frames = self.run_frames(emulator)
+            cpu = self.cpu_state(emulator)
+            end = emulator.save_state()
+
+            emulator.load_state(state)
+            self.assertEqual(emulator.save_state(), state)
+            self.assertEqual(self.run_frames(emulator), frames)
+            self.assertEqual(self.cpu_state(emulator), cpu)
+            self.assertEqual(emulator.save_state(), end)
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,72 @@
+import unittest
+from nes import CPU, Cartridge, create_memory_map, PPU, APU, Controller
+
+# Stores to PPUDATA through every store addressing mode. Reading PPUDATA
+# moves the VRAM address, so a store that reads its target first would
+# leave gaps between the values.
+PROGRAM = bytes([
+    0xA9, 0x20,              # 8000 LDA #$20
+    0x8D, 0x06, 0x20,        # 8002 STA $2006
+    0xA9, 0x00,              # 8005 LDA #$00
+    0x8D, 0x06, 0x20,        # 8007 STA $2006
+    0xA2, 0x00,              # 800A LDX #$00
+    0xA0, 0x00,              # 800C LDY #$00
+    0xA9, 0x11,              # 800E LDA #$11
+    0x8D, 0x07, 0x20,        # 8010 STA $2007
+    0xA9, 0x22,              # 8013 LDA #$22
+    0x9D, 0x07, 0x20,        # 8015 STA $2007,X
+    0xA9, 0x33,              # 8018 LDA #$33
+    0x99, 0x07, 0x20,        # 801A STA $2007,Y
+    0xA2, 0x44,              # 801D LDX #$44
+    0x8E, 0x07, 0x20,        # 801F STX $2007
+    0xA0, 0x55,              # 8022 LDY #$55
+    0x8C, 0x07, 0x20,        # 8024 STY $2007
+    0xA9, 0x07,              # 8027 LDA #$07
+    0x85, 0x10,              # 8029 STA $10
+    0xA9, 0x20,              # 802B LDA #$20
+    0x85, 0x11,              # 802D STA $11
+    0xA2, 0x00,              # 802F LDX #$00
+    0xA0, 0x00,              # 8031 LDY #$00
+    0xA9, 0x66,              # 8033 LDA #$66
+    0x91, 0x10,              # 8035 STA ($10),Y
+    0xA9, 0x77,              # 8037 LDA #$77
+    0x81, 0x10,              # 8039 STA ($10,X)
+    0x4C, 0x3B, 0x80])       # 803B JMP $803B
+DONE = 0x803B
+EXPECTED = [0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x00]
+
+def create_rom():
+    header = b'NES\x1a' + bytes([1, 1]) + bytes(10)
+    prg = PROGRAM + bytes(0x4000 - len(PROGRAM))
+    return header + prg + bytes(0x2000)
+
+class TestTracePolicy(unittest.TestCase):
+    def run_core(self, core, trace):
+        cart = Cartridge(create_rom())
+        ppu = PPU(cart.get_chr_rom(), 0)
+        apu = APU()
+        controller1 = Controller()
+        controller2 = Controller()
+        memory = create_memory_map(cart, ppu, apu, controller1, controller2)
+
+        cpu = CPU(0x8000, core, trace)
+        cpu.run_cycles(memory, 1000)
+        self.assertEqual(cpu.get_info().program_counter, DONE)
+
+        # Reads are delayed by one byte.
+        memory.read_byte(0x2002)
+        memory.write_byte(0x2006, 0x20)
+        memory.write_byte(0x2006, 0x00)
+        memory.read_byte(0x2007)
+        vram = [memory.read_byte(0x2007) for index in range(8)]
+        return vram, [memory.read_byte(address) for address in range(0x0800)]
+
+    def test_stores(self):
+        for core in (CPU.OPCODE_CORE, CPU.INTERPRETER_CORE, CPU.JIT_CORE):
+            vram, ram = self.run_core(core, CPU.TRACE_NONE)
+            self.assertEqual(vram, EXPECTED)
+            self.assertEqual(self.run_core(core, CPU.TRACE_FULL),
+                             (vram, ram))
+
+if __name__ == "__main__":
+    unittest.main()
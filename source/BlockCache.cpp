@@ -0,0 +1,326 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/BlockCache.h>
+#include <nes/Constants.h>
+#include <nes/Encoding6502.h>
+#include <nes/Interpreter6502.hpp>
+#include <algorithm>
+
+namespace
+{
+/*****************************************************************************/
+// Branches, jumps, calls and returns. These end a block since the next
+// instruction is not the one following them in memory.
+static const uint8_t CONTROL_FLOW[] =
+{
+    0x10, 0x20, 0x30, 0x40, 0x4C, 0x50, 0x60,
+    0x6C, 0x70, 0x90, 0xB0, 0xD0, 0xF0
+};
+
+/*****************************************************************************/
+// Reading PPUSTATUS clears VBLANK and the address latches. Once it has
+// been read the next read changes nothing.
+static const size_t PPU_STATUS = 0x02;
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+const uint16_t BlockCache::NOT_DECODED;
+const uint16_t BlockCache::UNCACHEABLE;
+
+/*****************************************************************************/
+BlockCache::Page::Page() :
+    version(nullptr),
+    expected(0)
+{
+}
+
+/*****************************************************************************/
+BlockCache::BlockCache() :
+    mPages(NUM_PAGES)
+{
+    for (size_t ii = 0; ii < 256; ++ii)
+    {
+        mEndsBlock[ii] = false;
+    }
+
+    for (size_t ii = 0; ii < sizeof(CONTROL_FLOW); ++ii)
+    {
+        mEndsBlock[CONTROL_FLOW[ii]] = true;
+    }
+}
+
+/*****************************************************************************/
+void BlockCache::resetPage(uint16_t address, MemoryMap& memory)
+{
+    Page& page = mPages[address >> PAGE_SHIFT];
+    page.starts.clear();
+    page.sizes.clear();
+    page.instructions.clear();
+    page.natives.clear();
+    page.hits.clear();
+    page.polls.clear();
+    page.fills.clear();
+
+    // Registers can change between reads, only plain memory is cached.
+    if (memory.getReadPage(address))
+    {
+        memory.watchCode(address);
+        page.starts.assign(PAGE_SIZE, NOT_DECODED);
+        page.sizes.assign(PAGE_SIZE, 0);
+        page.natives.assign(PAGE_SIZE, nullptr);
+        page.hits.assign(PAGE_SIZE, 0);
+        page.polls.assign(PAGE_SIZE, 0);
+        page.fills.assign(PAGE_SIZE, 0);
+    }
+
+    // Watching the page can move it onto a shared version, so this has
+    // to be read afterwards.
+    page.version = memory.getPageVersion(address);
+    page.expected = *page.version;
+}
+
+/*****************************************************************************/
+void BlockCache::setNative(uint16_t address, const NativeBlock* native)
+{
+    Page& page = mPages[address >> PAGE_SHIFT];
+    page.natives[address & PAGE_MASK] = native;
+    page.hits[address & PAGE_MASK] = 0;
+}
+
+/*****************************************************************************/
+void BlockCache::clearNative()
+{
+    for (size_t ii = 0; ii < mPages.size(); ++ii)
+    {
+        std::fill(mPages[ii].natives.begin(),
+                  mPages[ii].natives.end(),
+                  nullptr);
+    }
+}
+
+/*****************************************************************************/
+void BlockCache::decode(uint16_t address, const MemoryMap& memory)
+{
+    Page& page = mPages[address >> PAGE_SHIFT];
+    const size_t start = page.instructions.size();
+    const size_t pageBase = address & ~PAGE_MASK;
+
+    size_t current = address;
+    while (page.instructions.size() - start < MAX_BLOCK_SIZE)
+    {
+        // getOpInfo reads three bytes no matter the length. Stopping
+        // before the last two bytes keeps every operand inside the page.
+        if ((current & ~PAGE_MASK) != pageBase ||
+            (current & PAGE_MASK) >= PAGE_SIZE - 2)
+        {
+            break;
+        }
+
+        Instruction instruction;
+        memory.getOpInfo(current, instruction.args);
+        const OpCodeInfo& info = OP_CODE_INFO[instruction.args.opcode];
+
+        // Null ops take no time. The block ends before them so they are
+        // fetched and run normally, which is where they throw.
+        if (!info.time)
+        {
+            break;
+        }
+        instruction.length = 1 + info.usesArg1 + info.usesArg2;
+        instruction.cycles = info.time;
+        instruction.fusion = Interpreter6502::FUSE_NONE;
+
+        page.instructions.push_back(instruction);
+        current += instruction.length;
+        if (mEndsBlock[instruction.args.opcode])
+        {
+            break;
+        }
+    }
+
+    const size_t size = page.instructions.size() - start;
+    for (size_t ii = start + 1; ii < page.instructions.size(); ++ii)
+    {
+        page.instructions[ii - 1].fusion = Interpreter6502::findFusion(
+                page.instructions[ii - 1].args.opcode,
+                page.instructions[ii].args.opcode);
+    }
+
+    const size_t index = address & PAGE_MASK;
+    page.starts[index] = size ? static_cast<uint16_t>(start) : UNCACHEABLE;
+    page.sizes[index] = static_cast<uint8_t>(size);
+    page.polls[index] = size &&
+            isPoll(address, &page.instructions[start], size, memory);
+    page.fills[index] = size &&
+            isFill(address, &page.instructions[start], size);
+}
+
+/*****************************************************************************/
+bool BlockCache::isFill(uint16_t address,
+                        const Instruction* instructions,
+                        size_t size) const
+{
+    // One or more stores, a step of the index register and a BNE back to
+    // the start.
+    if (size < 3)
+    {
+        return false;
+    }
+
+    const Instruction& branch = instructions[size - 1];
+    size_t current = address;
+    for (size_t ii = 0; ii < size - 1; ++ii)
+    {
+        current += instructions[ii].length;
+    }
+    if (branch.args.opcode != 0xD0 ||
+        ((current + 2 + static_cast<int8_t>(branch.args.arg1)) & 0xFFFF) !=
+                address)
+    {
+        return false;
+    }
+
+    const uint8_t step = instructions[size - 2].args.opcode;
+    const bool xIndex = step == 0xE8 || step == 0xCA;
+    if (!xIndex && step != 0xC8 && step != 0x88)
+    {
+        return false;
+    }
+
+    // STA abs,X and STA zp,X step with X, STA abs,Y steps with Y. STA abs
+    // writes the same address every time, for example PPUDATA.
+    for (size_t ii = 0; ii < size - 2; ++ii)
+    {
+        switch (instructions[ii].args.opcode)
+        {
+        case 0x8D:
+            break;
+        case 0x95:
+        case 0x9D:
+            if (!xIndex)
+            {
+                return false;
+            }
+            break;
+        case 0x99:
+            if (xIndex)
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************/
+bool BlockCache::isPoll(uint16_t address,
+                        const Instruction* instructions,
+                        size_t size,
+                        const MemoryMap& memory) const
+{
+    // The loop must end with a branch or jump back to the start.
+    size_t current = address;
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        const CPUArgs& args = instructions[ii].args;
+        const Encoding* encoding = findEncoding(args.opcode);
+        if (!encoding)
+        {
+            return false;
+        }
+
+        if (ii == size - 1)
+        {
+            if (encoding->operation == OP_JMP)
+            {
+                return args.darg == address;
+            }
+            return encoding->operation >= OP_BPL &&
+                   encoding->operation <= OP_BEQ &&
+                   ((current + 2 + static_cast<int8_t>(args.arg1)) &
+                    0xFFFF) == address;
+        }
+
+        // Anything that writes memory or the stack could be what ends
+        // the loop.
+        switch (encoding->operation)
+        {
+        case OP_STA:
+        case OP_STX:
+        case OP_STY:
+        case OP_INC:
+        case OP_DEC:
+        case OP_PHA:
+        case OP_PHP:
+        case OP_PLA:
+        case OP_PLP:
+        case OP_JSR:
+        case OP_RTS:
+        case OP_JMP:
+            return false;
+        case OP_ASL:
+        case OP_LSR:
+        case OP_ROL:
+        case OP_ROR:
+            if (encoding->mode != MODE_IMPLIED)
+            {
+                return false;
+            }
+            break;
+        default:
+            break;
+        }
+
+        // Only reads at fixed addresses whose values cannot change under
+        // the loop.
+        switch (encoding->mode)
+        {
+        case MODE_IMPLIED:
+        case MODE_IMMEDIATE:
+        case MODE_ZERO_PAGE:
+            break;
+        case MODE_ABSOLUTE:
+            if (!memory.getReadPage(args.darg) &&
+                !(args.darg >= PPU_START && args.darg < PPU_END &&
+                  (args.darg & PPU_MASK) == PPU_STATUS))
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+        current += instructions[ii].length;
+    }
+    return false;
+}
+}
+}
@@ -22,6 +22,26 @@
  * IN THE SOFTWARE.
  *****************************************************************************/
 #include <nes/CPU.h>
+#include <nes/Constants.h>
+#include <nes/Interpreter6502.hpp>
+#include <nes/MemoryNROM.h>
+#include <algorithm>
+
+namespace
+{
+/*****************************************************************************/
+bool isFillable(const nyra::nes::MemoryMap& memory,
+                size_t address,
+                size_t count,
+                const uint32_t* codeVersion)
+{
+    // Counts are under a page so this touches at most two.
+    const size_t last = (address + count - 1) & 0xFFFF;
+    return memory.getWritePage(address) && memory.getWritePage(last) &&
+           memory.getPageVersion(address) != codeVersion &&
+           memory.getPageVersion(last) != codeVersion;
+}
+}
 
 namespace nyra
 {
@@ -29,35 +49,613 @@ namespace nes
 {
 /*****************************************************************************/
 const size_t CPU::INTERRUPT_OPCODE = 0x100;
+const uint16_t CPU::NMI_VECTOR = 0xFFFA;
+const uint8_t CPU::HOT_BLOCK = 16;
+
+/*****************************************************************************/
+CPU::Stop::Stop() :
+    instructions(~static_cast<size_t>(0)),
+    conditions(nullptr),
+    reached(false)
+{
+}
+
+/*****************************************************************************/
+CPU::CPU(uint16_t startAddress,
+         Core core,
+         Trace trace) :
+    mCore(core),
+    mInfo(startAddress),
+    mOpCodes(trace == TRACE_FULL ? getOpCodes<TracePolicy::Full>() :
+                                   getOpCodes<TracePolicy::None>()),
+    mNativeRAM(false),
+    mTrace(nullptr),
+    mStop(nullptr)
+{
+    if (mCore == JIT_CORE)
+    {
+        mJit.reset(new Jit6502());
+        if (!mJit->isEnabled())
+        {
+            mJit.reset();
+        }
+    }
+}
+
+/*****************************************************************************/
+void CPU::run(MemoryMap& ram,
+              uint64_t targetClock)
+{
+    if (mTrace)
+    {
+        runCore<TracePolicy::Full, false>(ram, targetClock);
+    }
+    else
+    {
+        runCore<TracePolicy::None, false>(ram, targetClock);
+    }
+}
+
+/*****************************************************************************/
+bool CPU::run(MemoryMap& ram,
+              uint64_t targetClock,
+              Stop& stop)
+{
+    stop.reached = stop.instructions == 0;
+    if (stop.reached)
+    {
+        return true;
+    }
+
+    mStop = &stop;
+    if (mTrace)
+    {
+        runCore<TracePolicy::Full, true>(ram, targetClock);
+    }
+    else
+    {
+        runCore<TracePolicy::None, true>(ram, targetClock);
+    }
+    return stop.reached;
+}
+
+/*****************************************************************************/
+template <typename TraceT, bool StepT>
+void CPU::runCore(MemoryMap& ram,
+                  uint64_t targetClock)
+{
+    if (mCore == OPCODE_CORE)
+    {
+        runOpCodes<TraceT, StepT>(ram, targetClock);
+    }
+    else if (ram.getBus() == MemoryMap::BUS_NROM)
+    {
+        runInterpreter<TraceT, StepT>(
+                ram, static_cast<MemoryNROM&>(ram).getNROMBus(),
+                targetClock);
+    }
+    else
+    {
+        runInterpreter<TraceT, StepT>(ram, ram, targetClock);
+    }
+}
+
+/*****************************************************************************/
+uint64_t CPU::runCycles(MemoryMap& ram,
+                        uint64_t cycles)
+{
+    return runLines(ram, mInfo.clock + cycles * 3, nullptr);
+}
 
 /*****************************************************************************/
-CPU::CPU(uint16_t startAddress) :
-    mInfo(startAddress)
+uint64_t CPU::runInstructions(MemoryMap& ram,
+                              size_t count)
 {
-    allocateOpCodes(mOpCodes);
+    Stop stop;
+    stop.instructions = count;
+    return runLines(ram, ~static_cast<uint64_t>(0), &stop);
+}
+
+/*****************************************************************************/
+uint64_t CPU::runUntilPC(MemoryMap& ram,
+                         uint16_t address,
+                         uint64_t maxCycles)
+{
+    const std::vector<Condition> conditions(
+            1, Condition(Condition::PROGRAM_COUNTER, Condition::EQUAL,
+                         address));
+    return runUntil(ram, conditions, maxCycles);
+}
+
+/*****************************************************************************/
+uint64_t CPU::runUntil(MemoryMap& ram,
+                       const std::vector<Condition>& conditions,
+                       uint64_t maxCycles)
+{
+    for (size_t ii = 0; ii < conditions.size(); ++ii)
+    {
+        conditions[ii].check(ram);
+    }
+
+    Stop stop;
+    stop.conditions = &conditions;
+    return runLines(ram, mInfo.clock + maxCycles * 3, &stop);
+}
+
+/*****************************************************************************/
+uint64_t CPU::runLines(MemoryMap& ram,
+                       uint64_t targetClock,
+                       Stop* stop)
+{
+    const uint64_t start = mInfo.clock;
+    bool stopped = false;
+    while (!stopped && mInfo.clock < targetClock)
+    {
+        const uint64_t lineEnd =
+                mInfo.clock - mInfo.cycles + CYCLES_PER_SCANLINE;
+        if (stop)
+        {
+            stopped = run(ram, std::min(lineEnd, targetClock), *stop);
+        }
+        else
+        {
+            run(ram, std::min(lineEnd, targetClock));
+        }
+        if (mInfo.clock >= lineEnd)
+        {
+            endScanline(lineEnd);
+        }
+    }
+    return (mInfo.clock - start) / 3;
 }
 
 /*****************************************************************************/
 void CPU::processScanline(MemoryMap& ram)
 {
-    // Process one scanline
-    const int16_t scanline = mInfo.scanLine;
+    // Running moves the cycles on, so work out where the scanline ends
+    // first.
+    const uint64_t lineEnd =
+            mInfo.clock - mInfo.cycles + CYCLES_PER_SCANLINE;
+    run(ram, lineEnd);
+    endScanline(lineEnd);
+}
+
+/*****************************************************************************/
+void CPU::endScanline(uint64_t lineEnd)
+{
+    // Anything left over carries into the next scanline.
+    mInfo.cycles = static_cast<uint16_t>(mInfo.clock - lineEnd);
+    mInfo.scanLine = (mInfo.scanLine >= MAX_SCANLINES) ?
+            -1 : mInfo.scanLine + 1;
+}
+
+/*****************************************************************************/
+template <typename TraceT, bool StepT, typename BusT>
+void CPU::runInterpreter(MemoryMap& ram,
+                         BusT& bus,
+                         uint64_t targetClock)
+{
+    // The cycles within the scanline are brought up to date from here.
+    const uint64_t entryClock = mInfo.clock;
+
+    // Check for interrupts. A stop on the handler is checked before the
+    // first instruction of it runs.
+    bool stopped = false;
+    if (mInfo.generateNMI)
+    {
+        mInfo.clock += Interpreter6502::interrupt(
+                NMI_VECTOR, mRegisters, mInfo, bus) * 3;
+        mInfo.generateNMI = false;
+        stopped = StepT && isStopped(ram, 0);
+    }
+
+    // Recompiled code reaches RAM through the context.
+    if (mRecompiled)
+    {
+        mNativeRAM = true;
+        for (size_t ii = 0; ii < NativeContext::RAM_PAGES; ++ii)
+        {
+            mNative.ramPages[ii] = ram.getWritePage(ii << 8);
+            mNative.ramVersions[ii] = ram.getPageVersion(ii << 8);
+            mNativeRAM = mNativeRAM && mNative.ramPages[ii];
+        }
+    }
+
+    // The budget compare is the only timing check per instruction.
+    uint64_t clock = mInfo.clock;
+    BlockCache::Block block;
+    while (!stopped && clock < targetClock)
+    {
+        if (TraceT::RECORD || StepT)
+        {
+            // The cycles in the info are only brought up to date when
+            // the run returns.
+            ram.getOpInfo(mInfo.programCounter, mArgs);
+            if (TraceT::RECORD)
+            {
+                mTrace->record(mArgs, mRegisters, mInfo.programCounter,
+                               static_cast<uint16_t>(
+                                       mInfo.cycles + clock - entryClock),
+                               mInfo.scanLine, ram);
+            }
+            clock += Interpreter6502::execute(
+                    mArgs, mRegisters, mInfo, bus) * 3;
+            if (StepT && isStopped(ram, 1))
+            {
+                break;
+            }
+            continue;
+        }
+
+        if (!mBlockCache.lookUp(mInfo.programCounter, ram, block))
+        {
+            ram.getOpInfo(mInfo.programCounter, mArgs);
+            clock += Interpreter6502::execute(
+                    mArgs, mRegisters, mInfo, bus) * 3;
+            continue;
+        }
+
+        if (block.poll)
+        {
+            clock = runPoll(block, ram, clock, targetClock);
+            continue;
+        }
+
+        if (block.fill)
+        {
+            const uint64_t filled = runFill(block, ram, clock, targetClock);
+            if (filled != clock)
+            {
+                clock = filled;
+                continue;
+            }
+        }
+
+        size_t first = 0;
+        const NativeBlock* native = (mJit || mRecompiled) ?
+                findNative(mInfo.programCounter, block, ram) : nullptr;
+        if (native && clock + native->budget < targetClock)
+        {
+            clock += runNative(*native, mNative, mRegisters, mInfo,
+                               targetClock - clock);
+            first = native->size;
+        }
+
+        // Stop early if the budget runs out or the block wrote over its
+        // own page. A pair only runs fused if the budget would still be
+        // left after the first instruction, the first one never writes.
+        for (size_t ii = first; ii < block.size && clock < targetClock; ++ii)
+        {
+            const BlockCache::Instruction& instruction =
+                    block.instructions[ii];
+            if (instruction.fusion &&
+                clock + (instruction.cycles + 1) * 3 < targetClock)
+            {
+                clock += Interpreter6502::executeFused(
+                        instruction.fusion, instruction.args,
+                        block.instructions[++ii].args,
+                        mRegisters, mInfo, bus) * 3;
+            }
+            else
+            {
+                clock += Interpreter6502::execute(
+                        instruction.args, mRegisters, mInfo, bus) * 3;
+            }
+            if (*block.version != block.expected)
+            {
+                break;
+            }
+        }
+    }
+    mInfo.cycles += static_cast<uint16_t>(clock - entryClock);
+    mInfo.clock = clock;
+}
+
+/*****************************************************************************/
+uint64_t CPU::runPoll(const BlockCache::Block& block,
+                      MemoryMap& ram,
+                      uint64_t clock,
+                      uint64_t targetClock)
+{
+    // The first pass may still change what the loop reads, for example
+    // reading PPUSTATUS clears VBLANK. If the second pass leaves every
+    // register as it found it, every pass after it does the same until
+    // the next event. Those passes are skipped, stopping short of the
+    // target so the last one runs for real and ends on the same cycle.
+    const uint16_t address = mInfo.programCounter;
+    CPURegisters registers;
+    uint64_t passStart = clock;
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        registers = mRegisters;
+        passStart = clock;
+        for (size_t ii = 0; ii < block.size; ++ii)
+        {
+            if (clock >= targetClock)
+            {
+                return clock;
+            }
+            clock += Interpreter6502::execute(
+                    block.instructions[ii].args, mRegisters, mInfo, ram) * 3;
+        }
+        if (mInfo.programCounter != address)
+        {
+            return clock;
+        }
+    }
+
+    if (registers.accumulator != mRegisters.accumulator ||
+        registers.xIndex != mRegisters.xIndex ||
+        registers.yIndex != mRegisters.yIndex ||
+        registers.stackPointer != mRegisters.stackPointer ||
+        registers.getStatus() != mRegisters.getStatus())
+    {
+        // The loop is counting rather than waiting. Run it like any
+        // other block from now on.
+        mBlockCache.clearPoll(address);
+    }
+    else if (clock < targetClock)
+    {
+        const uint64_t passCycles = clock - passStart;
+        clock += (targetClock - clock - 1) / passCycles * passCycles;
+    }
+    return clock;
+}
+
+/*****************************************************************************/
+uint64_t CPU::runFill(const BlockCache::Block& block,
+                      MemoryMap& ram,
+                      uint64_t clock,
+                      uint64_t targetClock)
+{
+    // Every pass but the last is written in bulk. Passes are only skipped
+    // while the budget would still be left after them, so the loop ends
+    // on the same cycle as running it one instruction at a time.
+    const uint8_t step = block.instructions[block.size - 2].args.opcode;
+    const bool up = step == 0xE8 || step == 0xC8;
+    uint8_t& index = (step == 0xE8 || step == 0xCA) ?
+            mRegisters.xIndex : mRegisters.yIndex;
+
+    // The base cycles plus one for the branch being taken.
+    uint64_t passCycles = 1;
+    for (size_t ii = 0; ii < block.size; ++ii)
+    {
+        passCycles += block.instructions[ii].cycles;
+    }
+    passCycles *= 3;
+
+    // Counting down from zero stores to 0, 255 ... 1, which is not one
+    // run of addresses. That first pass runs normally and the rest are
+    // filled from 255 down.
+    if (!up && index == 0)
+    {
+        return clock;
+    }
+
+    const size_t passes = up ? 256 - index : index;
+    const size_t bulk = static_cast<size_t>(std::min<uint64_t>(
+            passes - 1, (targetClock - clock - 1) / passCycles));
+    if (!bulk)
+    {
+        return clock;
+    }
+
+    // Only plain RAM away from the loop itself can be written out of
+    // order. At most one store can go to a register.
+    const uint8_t low = up ? index : index - (bulk - 1);
+    size_t ports = 0;
+    for (size_t ii = 0; ii < block.size - 2; ++ii)
+    {
+        const CPUArgs& args = block.instructions[ii].args;
+        switch (args.opcode)
+        {
+        case 0x8D:
+            if (!ram.getWritePage(args.darg))
+            {
+                // Only a PPU register such as PPUDATA can take the
+                // stores. Anything else could be a mapper switching
+                // banks.
+                if (args.darg < PPU_START || args.darg >= PPU_END ||
+                    ++ports > 1)
+                {
+                    return clock;
+                }
+            }
+            else if (ram.getPageVersion(args.darg) == block.version)
+            {
+                return clock;
+            }
+            break;
+        case 0x95:
+            if (!isFillable(ram, 0, 1, block.version))
+            {
+                return clock;
+            }
+            break;
+        default:
+            if (!isFillable(ram, (args.darg + low) & 0xFFFF, bulk,
+                            block.version))
+            {
+                return clock;
+            }
+            break;
+        }
+    }
+
+    const uint8_t value = mRegisters.accumulator;
+    for (size_t ii = 0; ii < block.size - 2; ++ii)
+    {
+        const CPUArgs& args = block.instructions[ii].args;
+        switch (args.opcode)
+        {
+        case 0x8D:
+            ram.writeRepeated(args.darg, value, bulk);
+            break;
+        case 0x95:
+        {
+            // Zero page indexing wraps inside the zero page.
+            const size_t start = (args.arg1 + low) & 0xFF;
+            const size_t first = std::min<size_t>(bulk, 0x100 - start);
+            ram.fillBytes(start, value, first);
+            ram.fillBytes(0, value, bulk - first);
+            break;
+        }
+        default:
+            ram.fillBytes((args.darg + low) & 0xFFFF, value, bulk);
+            break;
+        }
+    }
+
+    index = up ? index + bulk : index - bulk;
+    mRegisters.setResult(index);
+    return clock + bulk * passCycles;
+}
+
+/*****************************************************************************/
+const NativeBlock* CPU::findNative(uint16_t address,
+                                   const BlockCache::Block& block,
+                                   const MemoryMap& ram)
+{
+    if (block.native)
+    {
+        if (block.native->layout == ram.getLayoutVersion() ||
+            (block.native->layout == NativeBlock::ANY_LAYOUT && mNativeRAM))
+        {
+            return block.native;
+        }
+
+        // A bank was switched since the block was compiled, start over.
+        mBlockCache.setNative(address, nullptr);
+        return nullptr;
+    }
+
+    // Code recompiled ahead of time is attached the first time the block
+    // runs.
+    if (mRecompiled && mNativeRAM && *block.hits == 0)
+    {
+        const NativeBlock* native = mRecompiled->getBlock(address);
+        if (native)
+        {
+            mBlockCache.setNative(address, native);
+            return native;
+        }
+    }
+    if (!mJit)
+    {
+        return nullptr;
+    }
 
-    // Check for interrupts
+    // Compile once the block has been run enough times. A failed compile
+    // is tried again once the count wraps around.
+    if (++(*block.hits) != HOT_BLOCK)
+    {
+        return nullptr;
+    }
+    if (mJit->isFull())
+    {
+        mBlockCache.clearNative();
+        mJit->clear();
+    }
+    const NativeBlock* native = mJit->compile(address, block, ram);
+    mBlockCache.setNative(address, native);
+    return native;
+}
+
+/*****************************************************************************/
+void CPU::setRecompiled(
+        const std::shared_ptr<const RecompiledROM>& recompiled)
+{
+    // Drop anything attached from the old module.
+    mBlockCache.clearNative();
+    if (mJit)
+    {
+        mJit->clear();
+    }
+    mRecompiled = recompiled;
+    mNativeRAM = false;
+}
+
+/*****************************************************************************/
+template <typename TraceT, bool StepT>
+void CPU::runOpCodes(MemoryMap& ram,
+                     uint64_t targetClock)
+{
+    // The OpCode objects count in cycles, so the master clock follows the
+    // difference.
+    uint16_t cycles = mInfo.cycles;
+    Operand operand;
+
+    // Check for interrupts. A stop on the handler is checked before the
+    // first instruction of it runs.
+    bool stopped = false;
     if (mInfo.generateNMI)
     {
         ram.getOpInfo(0XFFF9, mArgs);
-        (*mOpCodes[INTERRUPT_OPCODE])(mArgs, mRegisters, mInfo, ram);
+        (*mOpCodes[INTERRUPT_OPCODE])(mArgs, mRegisters, mInfo, ram,
+                                      operand);
         mInfo.generateNMI = false;
+        mInfo.clock += static_cast<uint16_t>(mInfo.cycles - cycles);
+        stopped = StepT && isStopped(ram, 0);
     }
 
-    while (scanline == mInfo.scanLine)
+    while (!stopped && mInfo.clock < targetClock)
     {
+        cycles = mInfo.cycles;
         ram.getOpInfo(mInfo.programCounter,
                       mArgs);
+        if (TraceT::RECORD)
+        {
+            mTrace->record(mArgs, mRegisters, mInfo.programCounter,
+                           mInfo.cycles, mInfo.scanLine, ram);
+        }
 
-        (*mOpCodes[mArgs.opcode])(mArgs, mRegisters, mInfo, ram);
+        (*mOpCodes[mArgs.opcode])(mArgs, mRegisters, mInfo, ram, operand);
+        mInfo.clock += static_cast<uint16_t>(mInfo.cycles - cycles);
+        if (StepT && isStopped(ram, 1))
+        {
+            break;
+        }
     }
 }
+
+/*****************************************************************************/
+void CPU::saveState(StateWriter& state) const
+{
+    state.write(mRegisters.accumulator);
+    state.write(mRegisters.xIndex);
+    state.write(mRegisters.yIndex);
+    state.write(mRegisters.stackPointer);
+    state.write(mRegisters.getStatus());
+    state.write(mInfo.programCounter);
+    state.write(mInfo.cycles);
+    state.write(mInfo.scanLine);
+    state.write(mInfo.generateNMI);
+    state.write(mInfo.clock);
+    state.write(mArgs.opcode);
+    state.write(mArgs.arg1);
+    state.write(mArgs.arg2);
+    state.write(mArgs.darg);
+}
+
+/*****************************************************************************/
+void CPU::loadState(StateReader& state)
+{
+    state.read(mRegisters.accumulator);
+    state.read(mRegisters.xIndex);
+    state.read(mRegisters.yIndex);
+    state.read(mRegisters.stackPointer);
+    uint8_t status;
+    state.read(status);
+    mRegisters.setStatus(status);
+    state.read(mInfo.programCounter);
+    state.read(mInfo.cycles);
+    state.read(mInfo.scanLine);
+    state.read(mInfo.generateNMI);
+    state.read(mInfo.clock);
+    state.read(mArgs.opcode);
+    state.read(mArgs.arg1);
+    state.read(mArgs.arg2);
+    state.read(mArgs.darg);
+}
 }
 }
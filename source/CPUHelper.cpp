@@ -42,8 +42,11 @@ CPURegisters::CPURegisters() :
     xIndex(0),
     yIndex(0),
     stackPointer(0xFD),
-    statusRegister(0x24)
+    status(0),
+    zeroResult(0),
+    signResult(0)
 {
+    setStatus(0x24);
 }
 
 /*****************************************************************************/
@@ -51,7 +54,8 @@ CPUInfo::CPUInfo() :
     programCounter(0),
     cycles(0),
     scanLine(241),
-    generateNMI(false)
+    generateNMI(false),
+    clock(0)
 {
 }
 
@@ -59,7 +63,9 @@ CPUInfo::CPUInfo() :
 CPUInfo::CPUInfo(uint16_t programCounter) :
     programCounter(programCounter),
     cycles(0),
-    scanLine(0)
+    scanLine(0),
+    generateNMI(false),
+    clock(0)
 {
 }
 }
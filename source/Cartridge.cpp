@@ -23,49 +23,6 @@
  *****************************************************************************/
 #include <nes/Cartridge.h>
 #include <stdexcept>
- #include <fstream>
-
-namespace
-{
-/*****************************************************************************/
-size_t getFileSize(const std::string& pathname)
-{
-    std::ifstream stream(pathname, std::ios::ate | std::ios::binary);
-    if (!stream.good())
-    {
-        throw std::runtime_error("Failed to open file: " + pathname);
-    }
-    return static_cast<size_t>(stream.tellg());
-}
-
-/*****************************************************************************/
-std::vector<uint8_t> readBinary(const std::string& pathname)
-{
-    // TODO: Is it better to just use the existing stream here even
-    //       thought we would rewrite some code?
-    const size_t bufferSize = getFileSize(pathname);
-
-    // Return an empty vector if there is nothing to read.
-    if (bufferSize == 0)
-    {
-        return std::vector<uint8_t>();
-    }
-
-    // Open the file in binary mode.
-    std::ifstream stream(pathname, std::ios::binary);
-    if (!stream.good())
-    {
-        throw std::runtime_error("Failed to open file: " + pathname);
-    }
-
-    // Go to the end of the stream to figure out how large it is.
-    std::vector<uint8_t> ret(bufferSize);
-
-    stream.read(reinterpret_cast<char*>(&ret[0]), bufferSize);
-
-    return ret;
-}    
-}
 
 namespace nyra
 {
@@ -77,14 +34,37 @@ static const size_t CHR_ROM_SIZE = 4096;
 
 /*****************************************************************************/
 Cartridge::Cartridge(const std::string& pathname) :
-    mFile(readBinary(pathname)),
-    mHeader(mFile),
+    mImage(ROMImage::load(pathname)),
+    mHeader(mImage->getData(), mImage->getSize()),
+    mProgROM(mHeader.getProgRomSize()),
+    mChrROM(mHeader.getChrRomSize() * 2)
+{
+    assignBanks();
+}
+
+/*****************************************************************************/
+Cartridge::Cartridge(const uint8_t* buffer,
+                     size_t size) :
+    mImage(ROMImage::share(buffer, size)),
+    mHeader(mImage->getData(), mImage->getSize()),
     mProgROM(mHeader.getProgRomSize()),
     mChrROM(mHeader.getChrRomSize() * 2)
 {
-    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(
-            &mFile[0] + mHeader.getHeaderSize());
+    assignBanks();
+}
+
+/*****************************************************************************/
+void Cartridge::assignBanks()
+{
+    // The banks point into the file, so a short file cannot be read past.
+    if (mImage->getSize() < mHeader.getHeaderSize() +
+                mProgROM.size() * PRG_ROM_SIZE +
+                mChrROM.size() * CHR_ROM_SIZE)
+    {
+        throw std::runtime_error("Incorrect NES file size");
+    }
 
+    const uint8_t* ptr = mImage->getData() + mHeader.getHeaderSize();
 
     //! Assign each piece of ROM
     for (size_t ii = 0; ii < mProgROM.size(); ++ii, ptr += PRG_ROM_SIZE)
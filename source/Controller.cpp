@@ -67,5 +67,35 @@ uint8_t Controller::readByte(size_t )
     mIndex = static_cast<ControllerBit>((mIndex + 1) % BUTTON_MAX);
     return ret;
 }
+
+/*****************************************************************************/
+void Controller::saveState(StateWriter& state) const
+{
+    state.write(mStrobe);
+    state.write(static_cast<uint8_t>(mIndex));
+    for (size_t ii = 0; ii < BUTTON_MAX; ++ii)
+    {
+        state.write(mButtons[ii]);
+        state.write(mButtonsQueued[ii]);
+    }
+}
+
+/*****************************************************************************/
+void Controller::loadState(StateReader& state)
+{
+    uint8_t index;
+    state.read(mStrobe);
+    state.read(index);
+    if (index >= BUTTON_MAX)
+    {
+        throw std::runtime_error("Invalid controller index in save state");
+    }
+    mIndex = static_cast<ControllerBit>(index);
+    for (size_t ii = 0; ii < BUTTON_MAX; ++ii)
+    {
+        state.read(mButtons[ii]);
+        state.read(mButtonsQueued[ii]);
+    }
+}
 }
 }
@@ -0,0 +1,291 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/Emulator.h>
+#include <nes/MemoryFactory.h>
+#include <stdexcept>
+#include <algorithm>
+
+namespace
+{
+/*****************************************************************************/
+static const uint16_t RESET_VECTOR = 0xFFFC;
+static const int16_t VBLANK_START = 241;
+static const size_t STATE_HEADER_SIZE = sizeof(uint32_t) * 3;
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+Emulator::Emulator(const std::string& pathname,
+                   CPU::Core core) :
+    mCartridge(pathname),
+    mPPU(mCartridge.getChrROM(),
+         mCartridge.getHeader().getMirroring(),
+         mCartridge.getTileRows()),
+    mMemoryMap(createMemoryMap(mCartridge,
+                               mPPU,
+                               mAPU,
+                               mControllers[0],
+                               mControllers[1])),
+    mCPU(mMemoryMap->readShort(RESET_VECTOR), core)
+{
+    mScheduler.schedule(Scheduler::SCANLINE_START, mCPU.getInfo().clock);
+
+    // Pick up code recompiled ahead of time for this game, if any.
+    if (core != CPU::OPCODE_CORE)
+    {
+        mCPU.setRecompiled(RecompiledROM::find(mCartridge.getHash()));
+    }
+}
+
+/*****************************************************************************/
+void Emulator::loadRecompiled(const std::string& pathname)
+{
+    mCPU.setRecompiled(RecompiledROM::load(pathname, mCartridge.getHash()));
+}
+
+/*****************************************************************************/
+bool Emulator::handleEvent(Scheduler::Event event,
+                           uint64_t time,
+                           uint32_t* buffer)
+{
+    CPUInfo& info = mCPU.getInfo();
+    switch (event)
+    {
+    case Scheduler::SCANLINE_START:
+        mPPU.processScanline(info, *mMemoryMap, buffer);
+        mScheduler.schedule(Scheduler::SCANLINE_END,
+                            time + CYCLES_PER_SCANLINE);
+        break;
+    case Scheduler::SCANLINE_END:
+        // The CPU usually runs a little past the end of the line. That
+        // carries into the next one.
+        info.cycles = static_cast<uint16_t>(info.clock - time);
+        info.scanLine = (info.scanLine >= MAX_SCANLINES) ?
+                -1 : info.scanLine + 1;
+        mScheduler.schedule(Scheduler::SCANLINE_START, time);
+
+        // The frame is done once the PPU is about to enter vertical blank.
+        return info.scanLine == VBLANK_START;
+    default:
+        throw std::runtime_error("Unhandled scheduler event");
+    }
+    return false;
+}
+
+/*****************************************************************************/
+void Emulator::runFrame(uint32_t* buffer)
+{
+    bool frameDone = false;
+    while (!frameDone)
+    {
+        // Run straight to the next event, then handle it.
+        mCPU.run(*mMemoryMap, mScheduler.getNextTime());
+
+        uint64_t time;
+        const Scheduler::Event event = mScheduler.pop(time);
+        frameDone = handleEvent(event, time, buffer);
+    }
+}
+
+/*****************************************************************************/
+void Emulator::runFrames(size_t numFrames,
+                         uint32_t* buffer)
+{
+    for (size_t ii = 0; ii < numFrames; ++ii)
+    {
+        runFrame(buffer);
+    }
+}
+
+/*****************************************************************************/
+uint64_t Emulator::runCycles(uint64_t cycles,
+                             uint32_t* buffer)
+{
+    return runTo(mCPU.getInfo().clock + cycles * 3, nullptr, buffer);
+}
+
+/*****************************************************************************/
+uint64_t Emulator::runInstructions(size_t count,
+                                   uint32_t* buffer)
+{
+    CPU::Stop stop;
+    stop.instructions = count;
+    return runTo(Scheduler::NEVER, &stop, buffer);
+}
+
+/*****************************************************************************/
+uint64_t Emulator::runUntilPC(uint16_t address,
+                              uint64_t maxCycles,
+                              uint32_t* buffer)
+{
+    const std::vector<Condition> conditions(
+            1, Condition(Condition::PROGRAM_COUNTER, Condition::EQUAL,
+                         address));
+    return runUntil(conditions, maxCycles, buffer);
+}
+
+/*****************************************************************************/
+uint64_t Emulator::runUntil(const std::vector<Condition>& conditions,
+                            uint64_t maxCycles,
+                            uint32_t* buffer)
+{
+    for (size_t ii = 0; ii < conditions.size(); ++ii)
+    {
+        conditions[ii].check(*mMemoryMap);
+    }
+
+    CPU::Stop stop;
+    stop.conditions = &conditions;
+    return runTo(mCPU.getInfo().clock + maxCycles * 3, &stop, buffer);
+}
+
+/*****************************************************************************/
+uint64_t Emulator::runTo(uint64_t targetClock,
+                         CPU::Stop* stop,
+                         uint32_t* buffer)
+{
+    const CPUInfo& info = mCPU.getInfo();
+    const uint64_t start = info.clock;
+    bool stopped = false;
+    while (true)
+    {
+        // Handle anything the CPU has reached first, the same as runFrame
+        // does. Events are never left due when this returns.
+        while (mScheduler.getNextTime() <= info.clock)
+        {
+            uint64_t time;
+            const Scheduler::Event event = mScheduler.pop(time);
+            handleEvent(event, time, buffer);
+        }
+        if (stopped || info.clock >= targetClock)
+        {
+            break;
+        }
+
+        const uint64_t target = std::min(mScheduler.getNextTime(),
+                                         targetClock);
+        if (stop)
+        {
+            stopped = mCPU.run(*mMemoryMap, target, *stop);
+        }
+        else
+        {
+            mCPU.run(*mMemoryMap, target);
+        }
+    }
+    return (info.clock - start) / 3;
+}
+
+/*****************************************************************************/
+Controller& Emulator::getController(size_t index)
+{
+    if (index >= NUM_CONTROLLERS)
+    {
+        throw std::runtime_error("Invalid controller index");
+    }
+    return mControllers[index];
+}
+
+/*****************************************************************************/
+void Emulator::saveState(StateWriter& state) const
+{
+    mCPU.saveState(state);
+    mScheduler.saveState(state);
+    mPPU.saveState(state);
+    for (size_t ii = 0; ii < NUM_CONTROLLERS; ++ii)
+    {
+        mControllers[ii].saveState(state);
+    }
+
+    // The APU only holds RAM so it is covered by the memory map.
+    mMemoryMap->saveState(state);
+}
+
+/*****************************************************************************/
+size_t Emulator::getStateSize() const
+{
+    StateWriter state(nullptr, 0);
+    saveState(state);
+    return STATE_HEADER_SIZE + state.getOffset();
+}
+
+/*****************************************************************************/
+void Emulator::saveState(uint8_t* buffer,
+                         size_t size) const
+{
+    const size_t stateSize = getStateSize();
+    StateWriter state(buffer, size);
+    state.write(SAVE_STATE_MAGIC);
+    state.write(SAVE_STATE_VERSION);
+    state.write(static_cast<uint32_t>(stateSize));
+    saveState(state);
+}
+
+/*****************************************************************************/
+std::vector<uint8_t> Emulator::saveState() const
+{
+    std::vector<uint8_t> ret(getStateSize());
+    saveState(ret.data(), ret.size());
+    return ret;
+}
+
+/*****************************************************************************/
+void Emulator::loadState(const uint8_t* buffer,
+                         size_t size)
+{
+    StateReader state(buffer, size);
+    uint32_t magic;
+    uint32_t version;
+    uint32_t stateSize;
+    state.read(magic);
+    state.read(version);
+    state.read(stateSize);
+
+    if (magic != SAVE_STATE_MAGIC)
+    {
+        throw std::runtime_error("Buffer is not a save state");
+    }
+    if (version != SAVE_STATE_VERSION)
+    {
+        throw std::runtime_error("Unsupported save state version");
+    }
+    if (stateSize != size || stateSize != getStateSize())
+    {
+        throw std::runtime_error("Save state does not match this emulator");
+    }
+
+    mCPU.loadState(state);
+    mScheduler.loadState(state);
+    mPPU.loadState(state);
+    for (size_t ii = 0; ii < NUM_CONTROLLERS; ++ii)
+    {
+        mControllers[ii].loadState(state);
+    }
+    mMemoryMap->loadState(state);
+}
+}
+}
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/EmulatorBatch.h>
+#include <stdexcept>
+#include <algorithm>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+EmulatorBatch::EmulatorBatch(const std::vector<std::string>& pathnames,
+                             size_t numThreads) :
+    mEmulators(pathnames.size()),
+    mFrameBuffer(pathnames.size() * NUM_PIXELS),
+    mActions(nullptr),
+    mGeneration(0),
+    mBusyThreads(0),
+    mStopping(false),
+    mNextJob(0)
+{
+    for (size_t ii = 0; ii < pathnames.size(); ++ii)
+    {
+        mEmulators[ii].reset(new Emulator(pathnames[ii]));
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // More threads than emulators would only sit idle.
+    numThreads = std::min(numThreads, std::max(mEmulators.size(),
+                                               static_cast<size_t>(1)));
+    for (size_t ii = 0; ii < numThreads; ++ii)
+    {
+        mThreads.push_back(std::thread(&EmulatorBatch::workerLoop, this));
+    }
+}
+
+/*****************************************************************************/
+EmulatorBatch::~EmulatorBatch()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mStart.notify_all();
+
+    for (size_t ii = 0; ii < mThreads.size(); ++ii)
+    {
+        mThreads[ii].join();
+    }
+}
+
+/*****************************************************************************/
+void EmulatorBatch::step(const uint8_t* actions,
+                         size_t size)
+{
+    if (size != mEmulators.size())
+    {
+        throw std::runtime_error("Expected one action per emulator");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mActions = actions;
+        mNextJob = 0;
+        mBusyThreads = mThreads.size();
+        mError = nullptr;
+        ++mGeneration;
+    }
+    mStart.notify_all();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [this]() { return mBusyThreads == 0; });
+    mActions = nullptr;
+
+    if (mError)
+    {
+        std::rethrow_exception(mError);
+    }
+}
+
+/*****************************************************************************/
+void EmulatorBatch::runJobs()
+{
+    // Emulators are handed out one at a time so a slow ROM does not hold
+    // up a whole slice of the batch.
+    for (size_t ii = mNextJob++; ii < mEmulators.size(); ii = mNextJob++)
+    {
+        Emulator& emulator = *mEmulators[ii];
+        Controller& controller = emulator.getController(0);
+        for (size_t button = 0; button < Controller::BUTTON_MAX; ++button)
+        {
+            if (mActions[ii] & (1 << button))
+            {
+                controller.setKey(
+                        static_cast<Controller::ControllerBit>(button));
+            }
+        }
+        emulator.runFrame(&mFrameBuffer[ii * NUM_PIXELS]);
+    }
+}
+
+/*****************************************************************************/
+void EmulatorBatch::workerLoop()
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStart.wait(lock, [this, generation]()
+            {
+                return mStopping || mGeneration != generation;
+            });
+            if (mStopping)
+            {
+                return;
+            }
+            generation = mGeneration;
+        }
+
+        std::exception_ptr error;
+        try
+        {
+            runJobs();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (error && !mError)
+        {
+            mError = error;
+        }
+        if (--mBusyThreads == 0)
+        {
+            mDone.notify_one();
+        }
+    }
+}
+}
+}
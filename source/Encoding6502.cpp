@@ -0,0 +1,126 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/Encoding6502.h>
+#include <stddef.h>
+
+namespace nyra
+{
+namespace nes
+{
+namespace
+{
+/*****************************************************************************/
+// Every opcode the recompilers handle. Indirect modes, RTI, JMP indirect
+// and anything else missing here are left to the interpreter.
+static const Encoding ENCODINGS[] =
+{
+    {0x05, OP_ORA, MODE_ZERO_PAGE}, {0x09, OP_ORA, MODE_IMMEDIATE},
+    {0x0D, OP_ORA, MODE_ABSOLUTE}, {0x15, OP_ORA, MODE_ZERO_PAGE_X},
+    {0x19, OP_ORA, MODE_ABSOLUTE_Y}, {0x1D, OP_ORA, MODE_ABSOLUTE_X},
+    {0x25, OP_AND, MODE_ZERO_PAGE}, {0x29, OP_AND, MODE_IMMEDIATE},
+    {0x2D, OP_AND, MODE_ABSOLUTE}, {0x35, OP_AND, MODE_ZERO_PAGE_X},
+    {0x39, OP_AND, MODE_ABSOLUTE_Y}, {0x3D, OP_AND, MODE_ABSOLUTE_X},
+    {0x45, OP_EOR, MODE_ZERO_PAGE}, {0x49, OP_EOR, MODE_IMMEDIATE},
+    {0x4D, OP_EOR, MODE_ABSOLUTE}, {0x55, OP_EOR, MODE_ZERO_PAGE_X},
+    {0x59, OP_EOR, MODE_ABSOLUTE_Y}, {0x5D, OP_EOR, MODE_ABSOLUTE_X},
+    {0x65, OP_ADC, MODE_ZERO_PAGE}, {0x69, OP_ADC, MODE_IMMEDIATE},
+    {0x6D, OP_ADC, MODE_ABSOLUTE}, {0x75, OP_ADC, MODE_ZERO_PAGE_X},
+    {0x79, OP_ADC, MODE_ABSOLUTE_Y}, {0x7D, OP_ADC, MODE_ABSOLUTE_X},
+    {0xE5, OP_SBC, MODE_ZERO_PAGE}, {0xE9, OP_SBC, MODE_IMMEDIATE},
+    {0xED, OP_SBC, MODE_ABSOLUTE}, {0xF5, OP_SBC, MODE_ZERO_PAGE_X},
+    {0xF9, OP_SBC, MODE_ABSOLUTE_Y}, {0xFD, OP_SBC, MODE_ABSOLUTE_X},
+    {0xC5, OP_CMP, MODE_ZERO_PAGE}, {0xC9, OP_CMP, MODE_IMMEDIATE},
+    {0xCD, OP_CMP, MODE_ABSOLUTE}, {0xD5, OP_CMP, MODE_ZERO_PAGE_X},
+    {0xD9, OP_CMP, MODE_ABSOLUTE_Y}, {0xDD, OP_CMP, MODE_ABSOLUTE_X},
+    {0xE0, OP_CPX, MODE_IMMEDIATE}, {0xE4, OP_CPX, MODE_ZERO_PAGE},
+    {0xEC, OP_CPX, MODE_ABSOLUTE},
+    {0xC0, OP_CPY, MODE_IMMEDIATE}, {0xC4, OP_CPY, MODE_ZERO_PAGE},
+    {0xCC, OP_CPY, MODE_ABSOLUTE},
+    {0x24, OP_BIT, MODE_ZERO_PAGE}, {0x2C, OP_BIT, MODE_ABSOLUTE},
+    {0xA5, OP_LDA, MODE_ZERO_PAGE}, {0xA9, OP_LDA, MODE_IMMEDIATE},
+    {0xAD, OP_LDA, MODE_ABSOLUTE}, {0xB5, OP_LDA, MODE_ZERO_PAGE_X},
+    {0xB9, OP_LDA, MODE_ABSOLUTE_Y}, {0xBD, OP_LDA, MODE_ABSOLUTE_X},
+    {0xA2, OP_LDX, MODE_IMMEDIATE}, {0xA6, OP_LDX, MODE_ZERO_PAGE},
+    {0xAE, OP_LDX, MODE_ABSOLUTE}, {0xB6, OP_LDX, MODE_ZERO_PAGE_Y},
+    {0xBE, OP_LDX, MODE_ABSOLUTE_Y},
+    {0xA0, OP_LDY, MODE_IMMEDIATE}, {0xA4, OP_LDY, MODE_ZERO_PAGE},
+    {0xAC, OP_LDY, MODE_ABSOLUTE}, {0xB4, OP_LDY, MODE_ZERO_PAGE_X},
+    {0xBC, OP_LDY, MODE_ABSOLUTE_X},
+    {0x85, OP_STA, MODE_ZERO_PAGE}, {0x8D, OP_STA, MODE_ABSOLUTE},
+    {0x95, OP_STA, MODE_ZERO_PAGE_X}, {0x99, OP_STA, MODE_ABSOLUTE_Y},
+    {0x9D, OP_STA, MODE_ABSOLUTE_X},
+    {0x86, OP_STX, MODE_ZERO_PAGE}, {0x8E, OP_STX, MODE_ABSOLUTE},
+    {0x96, OP_STX, MODE_ZERO_PAGE_Y},
+    {0x84, OP_STY, MODE_ZERO_PAGE}, {0x8C, OP_STY, MODE_ABSOLUTE},
+    {0x94, OP_STY, MODE_ZERO_PAGE_X},
+    {0x06, OP_ASL, MODE_ZERO_PAGE}, {0x0A, OP_ASL, MODE_IMPLIED},
+    {0x0E, OP_ASL, MODE_ABSOLUTE}, {0x16, OP_ASL, MODE_ZERO_PAGE_X},
+    {0x1E, OP_ASL, MODE_ABSOLUTE_X},
+    {0x46, OP_LSR, MODE_ZERO_PAGE}, {0x4A, OP_LSR, MODE_IMPLIED},
+    {0x4E, OP_LSR, MODE_ABSOLUTE}, {0x56, OP_LSR, MODE_ZERO_PAGE_X},
+    {0x5E, OP_LSR, MODE_ABSOLUTE_X},
+    {0x26, OP_ROL, MODE_ZERO_PAGE}, {0x2A, OP_ROL, MODE_IMPLIED},
+    {0x2E, OP_ROL, MODE_ABSOLUTE}, {0x36, OP_ROL, MODE_ZERO_PAGE_X},
+    {0x3E, OP_ROL, MODE_ABSOLUTE_X},
+    {0x66, OP_ROR, MODE_ZERO_PAGE}, {0x6A, OP_ROR, MODE_IMPLIED},
+    {0x6E, OP_ROR, MODE_ABSOLUTE}, {0x76, OP_ROR, MODE_ZERO_PAGE_X},
+    {0x7E, OP_ROR, MODE_ABSOLUTE_X},
+    {0xE6, OP_INC, MODE_ZERO_PAGE}, {0xEE, OP_INC, MODE_ABSOLUTE},
+    {0xF6, OP_INC, MODE_ZERO_PAGE_X}, {0xFE, OP_INC, MODE_ABSOLUTE_X},
+    {0xC6, OP_DEC, MODE_ZERO_PAGE}, {0xCE, OP_DEC, MODE_ABSOLUTE},
+    {0xD6, OP_DEC, MODE_ZERO_PAGE_X}, {0xDE, OP_DEC, MODE_ABSOLUTE_X},
+    {0xE8, OP_INX, MODE_IMPLIED}, {0xC8, OP_INY, MODE_IMPLIED},
+    {0xCA, OP_DEX, MODE_IMPLIED}, {0x88, OP_DEY, MODE_IMPLIED},
+    {0xAA, OP_TAX, MODE_IMPLIED}, {0xA8, OP_TAY, MODE_IMPLIED},
+    {0x8A, OP_TXA, MODE_IMPLIED}, {0x98, OP_TYA, MODE_IMPLIED},
+    {0xBA, OP_TSX, MODE_IMPLIED}, {0x9A, OP_TXS, MODE_IMPLIED},
+    {0x18, OP_CLC, MODE_IMPLIED}, {0x38, OP_SEC, MODE_IMPLIED},
+    {0x78, OP_SEI, MODE_IMPLIED}, {0xB8, OP_CLV, MODE_IMPLIED},
+    {0xD8, OP_CLD, MODE_IMPLIED}, {0xF8, OP_SED, MODE_IMPLIED},
+    {0x48, OP_PHA, MODE_IMPLIED}, {0x08, OP_PHP, MODE_IMPLIED},
+    {0x68, OP_PLA, MODE_IMPLIED}, {0x28, OP_PLP, MODE_IMPLIED},
+    {0x20, OP_JSR, MODE_ABSOLUTE}, {0x60, OP_RTS, MODE_IMPLIED},
+    {0x4C, OP_JMP, MODE_ABSOLUTE},
+    {0x10, OP_BPL, MODE_IMMEDIATE}, {0x30, OP_BMI, MODE_IMMEDIATE},
+    {0x50, OP_BVC, MODE_IMMEDIATE}, {0x70, OP_BVS, MODE_IMMEDIATE},
+    {0x90, OP_BCC, MODE_IMMEDIATE}, {0xB0, OP_BCS, MODE_IMMEDIATE},
+    {0xD0, OP_BNE, MODE_IMMEDIATE}, {0xF0, OP_BEQ, MODE_IMMEDIATE},
+    {0xEA, OP_NOP, MODE_IMPLIED}
+};
+}
+
+/*****************************************************************************/
+const Encoding* findEncoding(uint8_t opcode)
+{
+    for (size_t ii = 0; ii < sizeof(ENCODINGS) / sizeof(ENCODINGS[0]); ++ii)
+    {
+        if (ENCODINGS[ii].opcode == opcode)
+        {
+            return &ENCODINGS[ii];
+        }
+    }
+    return nullptr;
+}
+}
+}
@@ -74,8 +74,15 @@ const size_t Header::HEADER_SIZE = 16;
 
 /*****************************************************************************/
 Header::Header(const std::vector<uint8_t>& binary) :
-    mNESIdentifier(binary.size() >= HEADER_SIZE ?
-            std::string(reinterpret_cast<const char*>(&binary[0]), 0, 3) :
+    Header(binary.empty() ? nullptr : &binary[0], binary.size())
+{
+}
+
+/*****************************************************************************/
+Header::Header(const uint8_t* binary,
+               size_t size) :
+    mNESIdentifier(size >= HEADER_SIZE ?
+            std::string(reinterpret_cast<const char*>(binary), 3) :
             throw std::runtime_error("Incorrect NES file size")),
     mProgSize(binary[PROG_SIZE_LOCATION]),
     mChrRomSize(binary[CHR_SIZE_LOCATION]),
@@ -0,0 +1,764 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/Jit6502.h>
+#include <nes/Encoding6502.h>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/mman.h>
+#include <unistd.h>
+#define NYRA_NES_JIT
+#endif
+
+namespace
+{
+/*****************************************************************************/
+typedef nyra::nes::X64Emitter Emitter;
+
+// Host register assignment. All of them hold zero extended bytes.
+static const Emitter::Register CONTEXT = Emitter::RBX;
+static const Emitter::Register CYCLES = Emitter::RBP;
+static const Emitter::Register REG_A = Emitter::R12;
+static const Emitter::Register REG_X = Emitter::R13;
+static const Emitter::Register REG_Y = Emitter::R14;
+static const Emitter::Register REG_P = Emitter::R15;
+static const Emitter::Register REG_S = Emitter::R11;
+
+static const size_t STACK_PAGE = 0x100;
+static const size_t CODE_ALIGNMENT = 16;
+
+/*****************************************************************************/
+int32_t offsetOfPC()
+{
+    return offsetof(nyra::nes::NativeContext, programCounter);
+}
+
+/*****************************************************************************/
+int32_t offsetOfZeroSign()
+{
+    return offsetof(nyra::nes::NativeContext, zeroSign);
+}
+
+/*****************************************************************************/
+const uint8_t* getHostPage(const nyra::nes::MemoryMap& memory,
+                           size_t address,
+                           bool write)
+{
+    return write ? memory.getWritePage(address) :
+                   memory.getReadPage(address);
+}
+
+#ifdef NYRA_NES_JIT
+/*****************************************************************************/
+bool protectCode(uint8_t* code, size_t offset, size_t size, bool writable)
+{
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin = offset & ~(pageSize - 1);
+    const size_t end = (offset + size + pageSize - 1) & ~(pageSize - 1);
+    return mprotect(code + begin, end - begin,
+                    writable ? PROT_READ | PROT_WRITE :
+                               PROT_READ | PROT_EXEC) == 0;
+}
+#endif
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+Jit6502::Jit6502() :
+    mCode(nullptr),
+    mUsed(0),
+    mStack(nullptr),
+    mStackVersion(nullptr),
+    mStart(0),
+    mLoop(0)
+{
+#ifdef NYRA_NES_JIT
+    // The code is never writable and executable at the same time. Hosts
+    // that refuse to make it executable at all leave the JIT disabled.
+    void* code = mmap(nullptr, CODE_SIZE,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code != MAP_FAILED)
+    {
+        if (protectCode(static_cast<uint8_t*>(code), 0, CODE_SIZE, false))
+        {
+            mCode = static_cast<uint8_t*>(code);
+        }
+        else
+        {
+            munmap(code, CODE_SIZE);
+        }
+    }
+#endif
+}
+
+/*****************************************************************************/
+Jit6502::~Jit6502()
+{
+#ifdef NYRA_NES_JIT
+    if (mCode)
+    {
+        munmap(mCode, CODE_SIZE);
+    }
+#endif
+}
+
+/*****************************************************************************/
+void Jit6502::clear()
+{
+    mBlocks.clear();
+    mUsed = 0;
+}
+
+/*****************************************************************************/
+const NativeBlock* Jit6502::compile(uint16_t address,
+                                    const BlockCache::Block& block,
+                                    const MemoryMap& memory)
+{
+    // Code in RAM can change underneath the native code.
+    if (!isEnabled() || isFull() ||
+        !memory.getReadPage(address) || memory.getWritePage(address))
+    {
+        return nullptr;
+    }
+
+    mStack = memory.getWritePage(STACK_PAGE);
+    mStackVersion = memory.getPageVersion(STACK_PAGE);
+
+    mEmitter.clear();
+    mEmitter.push(Emitter::RBX);
+    mEmitter.push(Emitter::RBP);
+    mEmitter.push(Emitter::R12);
+    mEmitter.push(Emitter::R13);
+    mEmitter.push(Emitter::R14);
+    mEmitter.push(Emitter::R15);
+    mEmitter.movReg64(CONTEXT, Emitter::RDI);
+    mEmitter.loadByte(REG_A, CONTEXT, Emitter::NONE,
+                      offsetof(NativeContext, accumulator));
+    mEmitter.loadByte(REG_X, CONTEXT, Emitter::NONE,
+                      offsetof(NativeContext, xIndex));
+    mEmitter.loadByte(REG_Y, CONTEXT, Emitter::NONE,
+                      offsetof(NativeContext, yIndex));
+    mEmitter.loadByte(REG_S, CONTEXT, Emitter::NONE,
+                      offsetof(NativeContext, stackPointer));
+    mEmitter.loadByte(REG_P, CONTEXT, Emitter::NONE,
+                      offsetof(NativeContext, status));
+    mEmitter.alu(Emitter::XOR, CYCLES, CYCLES);
+    mStart = address;
+    mLoop = mEmitter.getPosition();
+
+    NativeBlock native;
+    native.size = 0;
+    native.budget = 0;
+    native.layout = memory.getLayoutVersion();
+
+    // The budget is the worst case time of everything but the last
+    // instruction. One extra cycle covers any page crossing.
+    uint64_t lastTime = 0;
+    uint32_t cycles = 0;
+    uint16_t programCounter = address;
+    bool exited = false;
+    while (native.size < block.size && !exited)
+    {
+        const BlockCache::Instruction& instruction =
+                block.instructions[native.size];
+        if (!compileInstruction(instruction, programCounter, memory,
+                                native.budget + lastTime, cycles, exited))
+        {
+            break;
+        }
+
+        native.budget += lastTime;
+        lastTime = (instruction.cycles + 1) * 3;
+        programCounter += instruction.length;
+        ++native.size;
+    }
+
+    if (native.size == 0)
+    {
+        return nullptr;
+    }
+    if (!exited)
+    {
+        emitExit(programCounter, cycles);
+    }
+
+    const std::vector<uint8_t>& code = mEmitter.getCode();
+    if (code.size() > MAX_BLOCK_CODE)
+    {
+        return nullptr;
+    }
+#ifdef NYRA_NES_JIT
+    // Only the pages the block lands on are writable, and only while it
+    // is copied in.
+    if (!protectCode(mCode, mUsed, code.size(), true))
+    {
+        return nullptr;
+    }
+    std::memcpy(mCode + mUsed, code.data(), code.size());
+    if (!protectCode(mCode, mUsed, code.size(), false))
+    {
+        throw std::runtime_error("Could not make native code executable");
+    }
+#endif
+    native.function = reinterpret_cast<NativeBlock::Function>(mCode + mUsed);
+    mUsed += (code.size() + CODE_ALIGNMENT - 1) & ~(CODE_ALIGNMENT - 1);
+
+    mBlocks.push_back(native);
+    return &mBlocks.back();
+}
+
+/*****************************************************************************/
+bool Jit6502::compileInstruction(const BlockCache::Instruction& instruction,
+                                 uint16_t address,
+                                 const MemoryMap& memory,
+                                 uint64_t budget,
+                                 uint32_t& cycles,
+                                 bool& exited)
+{
+    const Encoding* encoding = findEncoding(instruction.args.opcode);
+    if (!encoding)
+    {
+        return false;
+    }
+
+    // Check everything that can fail before emitting anything.
+    const AddressMode mode = encoding->mode;
+    const Operation operation = encoding->operation;
+    const bool stores = operation == OP_STA || operation == OP_STX ||
+                        operation == OP_STY;
+    const bool modifies = (operation >= OP_ASL && operation <= OP_DEC);
+    const bool usesStack = (operation >= OP_PHA && operation <= OP_RTS);
+    if (mode != MODE_IMPLIED && mode != MODE_IMMEDIATE &&
+        operation != OP_JSR && operation != OP_JMP &&
+        !canAddress(instruction, memory, stores || modifies))
+    {
+        return false;
+    }
+    if (usesStack && !mStack)
+    {
+        return false;
+    }
+
+    const CPUArgs& args = instruction.args;
+    cycles += instruction.cycles;
+    switch (operation)
+    {
+    case OP_LDA:
+    case OP_LDX:
+    case OP_LDY:
+    {
+        const Emitter::Register dst = (operation == OP_LDA) ? REG_A :
+                (operation == OP_LDX) ? REG_X : REG_Y;
+        emitOperand(instruction, memory);
+        mEmitter.movReg(dst, Emitter::RCX);
+        emitZeroSign(dst);
+        break;
+    }
+    case OP_STA:
+        emitAddress(instruction, memory, true);
+        emitWrite(instruction, memory, REG_A);
+        break;
+    case OP_STX:
+        emitAddress(instruction, memory, true);
+        emitWrite(instruction, memory, REG_X);
+        break;
+    case OP_STY:
+        emitAddress(instruction, memory, true);
+        emitWrite(instruction, memory, REG_Y);
+        break;
+    case OP_ORA:
+    case OP_AND:
+    case OP_EOR:
+        emitOperand(instruction, memory);
+        mEmitter.alu(operation == OP_ORA ? Emitter::OR :
+                     operation == OP_AND ? Emitter::AND : Emitter::XOR,
+                     REG_A, Emitter::RCX);
+        emitZeroSign(REG_A);
+        break;
+    case OP_ADC:
+    case OP_SBC:
+        emitOperand(instruction, memory);
+        if (operation == OP_SBC)
+        {
+            mEmitter.aluImm(Emitter::XOR, Emitter::RCX, 0xFF);
+        }
+
+        // sum = A + value + carry
+        mEmitter.movReg(Emitter::RAX, REG_P);
+        mEmitter.aluImm(Emitter::AND, Emitter::RAX, 1 << CARRY);
+        mEmitter.alu(Emitter::ADD, Emitter::RAX, REG_A);
+        mEmitter.alu(Emitter::ADD, Emitter::RAX, Emitter::RCX);
+
+        // Overflow is ((A ^ sum) & (value ^ sum) & 0x80), moved to bit 6
+        mEmitter.movReg(Emitter::RDX, REG_A);
+        mEmitter.alu(Emitter::XOR, Emitter::RDX, Emitter::RAX);
+        mEmitter.movReg(Emitter::RSI, Emitter::RCX);
+        mEmitter.alu(Emitter::XOR, Emitter::RSI, Emitter::RAX);
+        mEmitter.alu(Emitter::AND, Emitter::RDX, Emitter::RSI);
+        mEmitter.aluImm(Emitter::AND, Emitter::RDX, 0x80);
+        mEmitter.shr(Emitter::RDX, SIGN - OFLOW);
+        mEmitter.aluImm(Emitter::AND, REG_P,
+                        ~((1 << CARRY) | (1 << OFLOW)) & 0xFF);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RDX);
+
+        // Carry is bit 8 of the sum
+        mEmitter.movReg(Emitter::RDX, Emitter::RAX);
+        mEmitter.shr(Emitter::RDX, 8);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RDX);
+        mEmitter.movzx8(REG_A, Emitter::RAX);
+        emitZeroSign(REG_A);
+        break;
+    case OP_CMP:
+    case OP_CPX:
+    case OP_CPY:
+    {
+        const Emitter::Register reg = (operation == OP_CMP) ? REG_A :
+                (operation == OP_CPX) ? REG_X : REG_Y;
+        emitOperand(instruction, memory);
+        mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << CARRY) & 0xFF);
+        mEmitter.alu(Emitter::CMP, reg, Emitter::RCX);
+        mEmitter.setcc(Emitter::ABOVE_EQUAL, Emitter::RDX);
+        mEmitter.movzx8(Emitter::RDX, Emitter::RDX);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RDX);
+        mEmitter.movReg(Emitter::RSI, reg);
+        mEmitter.alu(Emitter::SUB, Emitter::RSI, Emitter::RCX);
+        mEmitter.movzx8(Emitter::RSI, Emitter::RSI);
+        emitZeroSign(Emitter::RSI);
+        break;
+    }
+    case OP_BIT:
+        emitOperand(instruction, memory);
+        mEmitter.aluImm(Emitter::AND, REG_P,
+                        ~((1 << ZERO) | (1 << OFLOW) | (1 << SIGN)) & 0xFF);
+        mEmitter.movReg(Emitter::RAX, Emitter::RCX);
+        mEmitter.aluImm(Emitter::AND, Emitter::RAX,
+                        (1 << OFLOW) | (1 << SIGN));
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RAX);
+        mEmitter.test(Emitter::RCX, REG_A);
+        mEmitter.setcc(Emitter::EQUAL, Emitter::RAX);
+        mEmitter.movzx8(Emitter::RAX, Emitter::RAX);
+        mEmitter.shl(Emitter::RAX, ZERO);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RAX);
+        break;
+    case OP_ASL:
+    case OP_LSR:
+    case OP_ROL:
+    case OP_ROR:
+    case OP_INC:
+    case OP_DEC:
+        if (mode == MODE_IMPLIED)
+        {
+            mEmitter.movReg(Emitter::RCX, REG_A);
+            emitModify(operation);
+            mEmitter.movReg(REG_A, Emitter::RCX);
+        }
+        else
+        {
+            emitAddress(instruction, memory, true);
+            mEmitter.loadByte(Emitter::RCX, Emitter::RAX, Emitter::NONE, 0);
+            emitModify(operation);
+            emitWrite(instruction, memory, Emitter::RCX);
+        }
+        emitZeroSign(Emitter::RCX);
+        break;
+    case OP_INX:
+    case OP_INY:
+    case OP_DEX:
+    case OP_DEY:
+    {
+        const Emitter::Register reg =
+                (operation == OP_INX || operation == OP_DEX) ? REG_X : REG_Y;
+        mEmitter.aluImm((operation == OP_INX || operation == OP_INY) ?
+                        Emitter::ADD : Emitter::SUB, reg, 1);
+        mEmitter.movzx8(reg, reg);
+        emitZeroSign(reg);
+        break;
+    }
+    case OP_TAX:
+        mEmitter.movReg(REG_X, REG_A);
+        emitZeroSign(REG_X);
+        break;
+    case OP_TAY:
+        mEmitter.movReg(REG_Y, REG_A);
+        emitZeroSign(REG_Y);
+        break;
+    case OP_TXA:
+        mEmitter.movReg(REG_A, REG_X);
+        emitZeroSign(REG_A);
+        break;
+    case OP_TYA:
+        mEmitter.movReg(REG_A, REG_Y);
+        emitZeroSign(REG_A);
+        break;
+    case OP_TSX:
+        mEmitter.movReg(REG_X, REG_S);
+        emitZeroSign(REG_X);
+        break;
+    case OP_TXS:
+        mEmitter.movReg(REG_S, REG_X);
+        break;
+    case OP_CLC:
+        mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << CARRY) & 0xFF);
+        break;
+    case OP_SEC:
+        mEmitter.aluImm(Emitter::OR, REG_P, 1 << CARRY);
+        break;
+    case OP_SEI:
+        mEmitter.aluImm(Emitter::OR, REG_P, 1 << INTERRUPT);
+        break;
+    case OP_CLV:
+        mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << OFLOW) & 0xFF);
+        break;
+    case OP_CLD:
+        mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << DECIMAL) & 0xFF);
+        break;
+    case OP_SED:
+        mEmitter.aluImm(Emitter::OR, REG_P, 1 << DECIMAL);
+        break;
+    case OP_PHA:
+        emitPush(REG_A);
+        break;
+    case OP_PHP:
+        mEmitter.movReg(Emitter::RCX, REG_P);
+        mEmitter.aluImm(Emitter::OR, Emitter::RCX, 1 << STACK);
+        emitPush(Emitter::RCX);
+        break;
+    case OP_PLA:
+        emitPop(REG_A);
+        emitZeroSign(REG_A);
+        break;
+    case OP_PLP:
+        emitPop(REG_P);
+        mEmitter.aluImm(Emitter::OR, REG_P, 1 << IGNORE);
+        mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << STACK) & 0xFF);
+        break;
+    case OP_JSR:
+    {
+        const uint16_t returnAddress = address + 2;
+        mEmitter.movImm(Emitter::RCX, returnAddress >> 8);
+        emitPush(Emitter::RCX);
+        mEmitter.movImm(Emitter::RCX, returnAddress & 0xFF);
+        emitPush(Emitter::RCX);
+        emitExit(args.darg, cycles);
+        exited = true;
+        break;
+    }
+    case OP_RTS:
+        emitPop(Emitter::RCX);
+        emitPop(Emitter::RDX);
+        mEmitter.shl(Emitter::RDX, 8);
+        mEmitter.alu(Emitter::OR, Emitter::RDX, Emitter::RCX);
+        mEmitter.aluImm(Emitter::ADD, Emitter::RDX, 1);
+        mEmitter.storeWord(CONTEXT, offsetOfPC(), Emitter::RDX);
+        emitExit(cycles);
+        exited = true;
+        break;
+    case OP_JMP:
+        emitBranch(args.darg, budget, cycles);
+        exited = true;
+        break;
+    case OP_BPL:
+    case OP_BMI:
+    case OP_BVC:
+    case OP_BVS:
+    case OP_BCC:
+    case OP_BCS:
+    case OP_BNE:
+    case OP_BEQ:
+    {
+        // The branches come in pairs, clear then set, for each flag.
+        static const uint8_t FLAGS[] = {SIGN, OFLOW, CARRY, ZERO};
+        const size_t branch = operation - OP_BPL;
+        const bool whenSet = (branch & 1) != 0;
+        mEmitter.testImm(REG_P, 1 << FLAGS[branch >> 1]);
+        const size_t taken = mEmitter.jcc(whenSet ? Emitter::NOT_EQUAL :
+                                                    Emitter::EQUAL);
+        emitExit(address + 2, cycles);
+        mEmitter.bind(taken);
+        emitBranch(address + 2 + static_cast<int8_t>(args.arg1),
+                   budget, cycles + 1);
+        exited = true;
+        break;
+    }
+    case OP_NOP:
+        break;
+    }
+    return true;
+}
+
+/*****************************************************************************/
+bool Jit6502::canAddress(const BlockCache::Instruction& instruction,
+                         const MemoryMap& memory,
+                         bool write) const
+{
+    const CPUArgs& args = instruction.args;
+    switch (findEncoding(args.opcode)->mode)
+    {
+    case MODE_ZERO_PAGE:
+    case MODE_ZERO_PAGE_X:
+    case MODE_ZERO_PAGE_Y:
+        return getHostPage(memory, 0, write) != nullptr;
+    case MODE_ABSOLUTE:
+        return getHostPage(memory, args.darg, write) != nullptr;
+    case MODE_ABSOLUTE_X:
+    case MODE_ABSOLUTE_Y:
+    {
+        // Any index has to land in memory that is contiguous on the host.
+        const size_t last = args.darg + 0xFF;
+        if (last > 0xFFFF)
+        {
+            return false;
+        }
+        const uint8_t* low = getHostPage(memory, args.darg, write);
+        const uint8_t* high = getHostPage(memory, last, write);
+        return low && high &&
+                (((args.darg ^ last) >> 8) == 0 || high == low + 0x100);
+    }
+    default:
+        return false;
+    }
+}
+
+/*****************************************************************************/
+void Jit6502::emitAddress(const BlockCache::Instruction& instruction,
+                          const MemoryMap& memory,
+                          bool write)
+{
+    const CPUArgs& args = instruction.args;
+    switch (findEncoding(args.opcode)->mode)
+    {
+    case MODE_ZERO_PAGE:
+        mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(
+                getHostPage(memory, 0, write) + args.arg1));
+        break;
+    case MODE_ZERO_PAGE_X:
+    case MODE_ZERO_PAGE_Y:
+    {
+        // Indexing wraps inside of the zero page
+        const Emitter::Register index =
+                (findEncoding(args.opcode)->mode == MODE_ZERO_PAGE_X) ?
+                REG_X : REG_Y;
+        mEmitter.lea(Emitter::RDX, index, args.arg1);
+        mEmitter.movzx8(Emitter::RDX, Emitter::RDX);
+        mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(
+                getHostPage(memory, 0, write)));
+        mEmitter.alu64(Emitter::ADD, Emitter::RAX, Emitter::RDX);
+        break;
+    }
+    case MODE_ABSOLUTE:
+        mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(
+                getHostPage(memory, args.darg, write) + (args.darg & 0xFF)));
+        break;
+    case MODE_ABSOLUTE_X:
+    case MODE_ABSOLUTE_Y:
+    {
+        const Emitter::Register index =
+                (findEncoding(args.opcode)->mode == MODE_ABSOLUTE_X) ?
+                REG_X : REG_Y;
+        mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(
+                getHostPage(memory, args.darg, write) + (args.darg & 0xFF)));
+        mEmitter.alu64(Emitter::ADD, Emitter::RAX, index);
+
+        // Reads take an extra cycle when the index crosses a page.
+        if (!write)
+        {
+            mEmitter.lea(Emitter::RDX, index, args.darg & 0xFF);
+            mEmitter.shr(Emitter::RDX, 8);
+            mEmitter.lea(Emitter::RDX, Emitter::RDX, Emitter::RDX, 1, 0);
+            mEmitter.alu(Emitter::ADD, CYCLES, Emitter::RDX);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/*****************************************************************************/
+void Jit6502::emitOperand(const BlockCache::Instruction& instruction,
+                          const MemoryMap& memory)
+{
+    if (findEncoding(instruction.args.opcode)->mode == MODE_IMMEDIATE)
+    {
+        mEmitter.movImm(Emitter::RCX, instruction.args.arg1);
+        return;
+    }
+    emitAddress(instruction, memory, false);
+    mEmitter.loadByte(Emitter::RCX, Emitter::RAX, Emitter::NONE, 0);
+}
+
+/*****************************************************************************/
+void Jit6502::emitWrite(const BlockCache::Instruction& instruction,
+                        const MemoryMap& memory,
+                        X64Emitter::Register value)
+{
+    mEmitter.storeByte(Emitter::RAX, Emitter::NONE, 0, value);
+
+    // Bump the version of every page the write could have landed in.
+    const CPUArgs& args = instruction.args;
+    const AddressMode mode = findEncoding(args.opcode)->mode;
+    const size_t address = (mode == MODE_ABSOLUTE ||
+                            mode == MODE_ABSOLUTE_X ||
+                            mode == MODE_ABSOLUTE_Y) ? args.darg : 0;
+    const uint32_t* first = memory.getPageVersion(address);
+    mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(first));
+    mEmitter.incMem(Emitter::RAX);
+
+    const uint32_t* second = memory.getPageVersion(address + 0xFF);
+    if ((mode == MODE_ABSOLUTE_X || mode == MODE_ABSOLUTE_Y) &&
+        second != first)
+    {
+        mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(second));
+        mEmitter.incMem(Emitter::RAX);
+    }
+}
+
+/*****************************************************************************/
+void Jit6502::emitModify(int operation)
+{
+    switch (operation)
+    {
+    case OP_INC:
+    case OP_DEC:
+        mEmitter.aluImm(operation == OP_INC ? Emitter::ADD : Emitter::SUB,
+                        Emitter::RCX, 1);
+        mEmitter.movzx8(Emitter::RCX, Emitter::RCX);
+        return;
+    case OP_ROL:
+    case OP_ROR:
+        // Keep the old carry for the bit shifted in
+        mEmitter.movReg(Emitter::RSI, REG_P);
+        mEmitter.aluImm(Emitter::AND, Emitter::RSI, 1 << CARRY);
+        break;
+    default:
+        mEmitter.alu(Emitter::XOR, Emitter::RSI, Emitter::RSI);
+        break;
+    }
+
+    mEmitter.movReg(Emitter::RDX, Emitter::RCX);
+    mEmitter.aluImm(Emitter::AND, REG_P, ~(1 << CARRY) & 0xFF);
+    if (operation == OP_ASL || operation == OP_ROL)
+    {
+        mEmitter.shr(Emitter::RDX, 7);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RDX);
+        mEmitter.shl(Emitter::RCX, 1);
+        mEmitter.movzx8(Emitter::RCX, Emitter::RCX);
+    }
+    else
+    {
+        mEmitter.aluImm(Emitter::AND, Emitter::RDX, 1);
+        mEmitter.alu(Emitter::OR, REG_P, Emitter::RDX);
+        mEmitter.shr(Emitter::RCX, 1);
+        mEmitter.shl(Emitter::RSI, 7);
+    }
+    mEmitter.alu(Emitter::OR, Emitter::RCX, Emitter::RSI);
+}
+
+/*****************************************************************************/
+void Jit6502::emitZeroSign(X64Emitter::Register value)
+{
+    mEmitter.aluImm(Emitter::AND, REG_P,
+                    ~((1 << ZERO) | (1 << SIGN)) & 0xFF);
+    mEmitter.loadByte(Emitter::RAX, CONTEXT, value, offsetOfZeroSign());
+    mEmitter.alu(Emitter::OR, REG_P, Emitter::RAX);
+}
+
+/*****************************************************************************/
+void Jit6502::emitPush(X64Emitter::Register value)
+{
+    mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(mStack));
+    mEmitter.storeByte(Emitter::RAX, REG_S, 0, value);
+    mEmitter.aluImm(Emitter::SUB, REG_S, 1);
+    mEmitter.movzx8(REG_S, REG_S);
+    mEmitter.movImm64(Emitter::RAX,
+                      reinterpret_cast<uintptr_t>(mStackVersion));
+    mEmitter.incMem(Emitter::RAX);
+}
+
+/*****************************************************************************/
+void Jit6502::emitPop(X64Emitter::Register value)
+{
+    mEmitter.aluImm(Emitter::ADD, REG_S, 1);
+    mEmitter.movzx8(REG_S, REG_S);
+    mEmitter.movImm64(Emitter::RAX, reinterpret_cast<uintptr_t>(mStack));
+    mEmitter.loadByte(value, Emitter::RAX, REG_S, 0);
+}
+
+/*****************************************************************************/
+void Jit6502::emitExit(uint32_t cycles)
+{
+    mEmitter.storeByte(CONTEXT, Emitter::NONE,
+                       offsetof(NativeContext, accumulator), REG_A);
+    mEmitter.storeByte(CONTEXT, Emitter::NONE,
+                       offsetof(NativeContext, xIndex), REG_X);
+    mEmitter.storeByte(CONTEXT, Emitter::NONE,
+                       offsetof(NativeContext, yIndex), REG_Y);
+    mEmitter.storeByte(CONTEXT, Emitter::NONE,
+                       offsetof(NativeContext, stackPointer), REG_S);
+    mEmitter.storeByte(CONTEXT, Emitter::NONE,
+                       offsetof(NativeContext, status), REG_P);
+    mEmitter.lea(Emitter::RAX, CYCLES, cycles * 3);
+    mEmitter.pop(Emitter::R15);
+    mEmitter.pop(Emitter::R14);
+    mEmitter.pop(Emitter::R13);
+    mEmitter.pop(Emitter::R12);
+    mEmitter.pop(Emitter::RBP);
+    mEmitter.pop(Emitter::RBX);
+    mEmitter.ret();
+}
+
+/*****************************************************************************/
+void Jit6502::emitBranch(uint16_t target, uint64_t budget, uint32_t cycles)
+{
+    if (target != mStart)
+    {
+        emitExit(target, cycles);
+        return;
+    }
+
+    // The block loops on itself. Go around again if the interpreter
+    // would have run the whole block before reaching the target clock.
+    mEmitter.aluImm(Emitter::ADD, CYCLES, cycles * 3);
+    mEmitter.lea(Emitter::RAX, CYCLES, static_cast<int32_t>(budget));
+    mEmitter.cmpMem(Emitter::RAX, CONTEXT,
+                    offsetof(NativeContext, remaining));
+    mEmitter.bind(mEmitter.jcc(Emitter::BELOW), mLoop);
+    emitExit(target, 0);
+}
+
+/*****************************************************************************/
+void Jit6502::emitExit(uint16_t programCounter, uint32_t cycles)
+{
+    mEmitter.movImm(Emitter::RDX, programCounter);
+    mEmitter.storeWord(CONTEXT, offsetOfPC(), Emitter::RDX);
+    emitExit(cycles);
+}
+}
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/MappedFile.h>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define NYRA_NES_MMAP
+#endif
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+MappedFile::MappedFile(const std::string& pathname) :
+    mData(nullptr),
+    mSize(0),
+    mMapped(false)
+{
+#ifdef NYRA_NES_MMAP
+    const int file = open(pathname.c_str(), O_RDONLY);
+    struct stat status;
+    if (file < 0 || fstat(file, &status) != 0)
+    {
+        if (file >= 0)
+        {
+            close(file);
+        }
+        throw std::runtime_error("Failed to open file: " + pathname);
+    }
+
+    // Mapping nothing is an error, an empty file is left empty.
+    mSize = static_cast<size_t>(status.st_size);
+    if (mSize > 0)
+    {
+        void* data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            close(file);
+            throw std::runtime_error("Failed to map file: " + pathname);
+        }
+        mData = static_cast<const uint8_t*>(data);
+        mMapped = true;
+    }
+
+    // The mapping holds its own reference to the file.
+    close(file);
+#else
+    std::ifstream stream(pathname, std::ios::ate | std::ios::binary);
+    if (!stream.good())
+    {
+        throw std::runtime_error("Failed to open file: " + pathname);
+    }
+    mBuffer.resize(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0);
+    if (!mBuffer.empty())
+    {
+        stream.read(reinterpret_cast<char*>(&mBuffer[0]), mBuffer.size());
+        mData = &mBuffer[0];
+    }
+    mSize = mBuffer.size();
+#endif
+}
+
+/*****************************************************************************/
+MappedFile::~MappedFile()
+{
+#ifdef NYRA_NES_MMAP
+    if (mMapped)
+    {
+        munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+#endif
+}
+}
+}
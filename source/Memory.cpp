@@ -65,6 +65,17 @@ void Memory::writeByte(size_t address,
     throw std::runtime_error("Cannot write to ram");
 }
 
+/*****************************************************************************/
+void Memory::writeRepeated(size_t address,
+                           uint8_t value,
+                           size_t count)
+{
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        writeByte(address, value);
+    }
+}
+
 /*****************************************************************************/
 uint8_t Memory::readByte(size_t address)
 {
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/MemoryAxROM.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+MemoryAxROM::MemoryAxROM(const ROMBanks& prgROM,
+                         PPU& ppu,
+                         APU& apu,
+                         Controller& controller1,
+                         Controller& controller2) :
+    MemoryMapper(prgROM, ppu, apu, controller1, controller2),
+    mBank(0)
+{
+}
+
+/*****************************************************************************/
+void MemoryAxROM::writeRegister(size_t /*address*/,
+                                uint8_t value)
+{
+    mBank = value;
+    applyBanks();
+}
+
+/*****************************************************************************/
+void MemoryAxROM::applyBanks()
+{
+    const size_t bank = mBank & 0x07;
+    switchPRG(0, bank * 2);
+    switchPRG(1, bank * 2 + 1);
+    setMirroring((mBank & 0x10) ? SINGLE_SCREEN_UPPER : SINGLE_SCREEN_LOWER);
+}
+
+/*****************************************************************************/
+void MemoryAxROM::saveRegisters(StateWriter& state) const
+{
+    state.write(mBank);
+}
+
+/*****************************************************************************/
+void MemoryAxROM::loadRegisters(StateReader& state)
+{
+    state.read(mBank);
+}
+}
+}
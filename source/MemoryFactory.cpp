@@ -23,6 +23,12 @@
  *****************************************************************************/
 #include <nes/MemoryFactory.h>
 #include <nes/MemoryNROM.h>
+#include <nes/MemoryMMC1.h>
+#include <nes/MemoryUxROM.h>
+#include <nes/MemoryCNROM.h>
+#include <nes/MemoryAxROM.h>
+#include <stdexcept>
+#include <string>
 
 namespace nyra
 {
@@ -36,12 +42,51 @@ std::shared_ptr<MemoryMap> createMemoryMap(
         Controller& controller1,
         Controller& controller2)
 {
-    std::shared_ptr<MemoryMap> ret(
-            new MemoryNROM(cart.getProgROM(),
-                           ppu.getRegisers(),
-                           apu,
-                           controller1,
-                           controller2));
+    // Each mapper has its own map, which also picks the bus the CPU
+    // runs against.
+    std::shared_ptr<MemoryMap> ret;
+    const size_t mapper = cart.getHeader().getMapperNumber();
+    switch (mapper)
+    {
+    case 0:
+        ret.reset(new MemoryNROM(cart.getProgROM(),
+                                 ppu.getRegisers(),
+                                 apu,
+                                 controller1,
+                                 controller2));
+        break;
+    case 1:
+        ret.reset(new MemoryMMC1(cart.getProgROM(),
+                                 ppu,
+                                 apu,
+                                 controller1,
+                                 controller2));
+        break;
+    case 2:
+        ret.reset(new MemoryUxROM(cart.getProgROM(),
+                                  ppu,
+                                  apu,
+                                  controller1,
+                                  controller2));
+        break;
+    case 3:
+        ret.reset(new MemoryCNROM(cart.getProgROM(),
+                                  ppu,
+                                  apu,
+                                  controller1,
+                                  controller2));
+        break;
+    case 7:
+        ret.reset(new MemoryAxROM(cart.getProgROM(),
+                                  ppu,
+                                  apu,
+                                  controller1,
+                                  controller2));
+        break;
+    default:
+        throw std::runtime_error("Mapper " + std::to_string(mapper) +
+                                 " is not supported");
+    }
     ret->lockLookUpTable();
     return ret;
 }
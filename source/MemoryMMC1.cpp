@@ -0,0 +1,164 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/MemoryMMC1.h>
+#include <stdexcept>
+
+namespace
+{
+/*****************************************************************************/
+static const uint8_t SHIFT_WRITES = 5;
+
+/*****************************************************************************/
+// The mirroring for the low two bits of the control register.
+static const nyra::nes::Mirroring MIRRORING[4] =
+{
+    nyra::nes::SINGLE_SCREEN_LOWER,
+    nyra::nes::SINGLE_SCREEN_UPPER,
+    nyra::nes::VERTICAL,
+    nyra::nes::HORIZONTAL
+};
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+MemoryMMC1::MemoryMMC1(const ROMBanks& prgROM,
+                       PPU& ppu,
+                       APU& apu,
+                       Controller& controller1,
+                       Controller& controller2) :
+    MemoryMapper(prgROM, ppu, apu, controller1, controller2),
+    mShift(0),
+    mShiftCount(0),
+    mControl(0x0C),
+    mCHRBank0(0),
+    mCHRBank1(0),
+    mPRGBank(0)
+{
+}
+
+/*****************************************************************************/
+void MemoryMMC1::writeRegister(size_t address,
+                               uint8_t value)
+{
+    // Writing bit 7 resets the shift register and goes back to fixing
+    // the last bank at 0xC000.
+    if (value & 0x80)
+    {
+        mShift = 0;
+        mShiftCount = 0;
+        mControl |= 0x0C;
+        applyBanks();
+        return;
+    }
+
+    mShift |= (value & 0x01) << mShiftCount;
+    if (++mShiftCount < SHIFT_WRITES)
+    {
+        return;
+    }
+
+    switch ((address >> 13) & 0x03)
+    {
+    case 0:
+        mControl = mShift;
+        break;
+    case 1:
+        mCHRBank0 = mShift;
+        break;
+    case 2:
+        mCHRBank1 = mShift;
+        break;
+    default:
+        mPRGBank = mShift;
+    }
+    mShift = 0;
+    mShiftCount = 0;
+    applyBanks();
+}
+
+/*****************************************************************************/
+void MemoryMMC1::applyBanks()
+{
+    setMirroring(MIRRORING[mControl & 0x03]);
+
+    const size_t prg = mPRGBank & 0x0F;
+    switch ((mControl >> 2) & 0x03)
+    {
+    case 2:
+        switchPRG(0, 0);
+        switchPRG(1, prg);
+        break;
+    case 3:
+        switchPRG(0, prg);
+        switchPRG(1, getNumPRGBanks() - 1);
+        break;
+    default:
+        // 32KB mode ignores the low bit.
+        switchPRG(0, prg & ~1);
+        switchPRG(1, prg | 1);
+    }
+
+    if (mControl & 0x10)
+    {
+        switchCHR(0, mCHRBank0);
+        switchCHR(1, mCHRBank1);
+    }
+    else
+    {
+        // 8KB mode ignores the low bit.
+        switchCHR(0, mCHRBank0 & ~1);
+        switchCHR(1, mCHRBank0 | 1);
+    }
+}
+
+/*****************************************************************************/
+void MemoryMMC1::saveRegisters(StateWriter& state) const
+{
+    state.write(mShift);
+    state.write(mShiftCount);
+    state.write(mControl);
+    state.write(mCHRBank0);
+    state.write(mCHRBank1);
+    state.write(mPRGBank);
+}
+
+/*****************************************************************************/
+void MemoryMMC1::loadRegisters(StateReader& state)
+{
+    state.read(mShift);
+    state.read(mShiftCount);
+    state.read(mControl);
+    state.read(mCHRBank0);
+    state.read(mCHRBank1);
+    state.read(mPRGBank);
+    if (mShiftCount >= SHIFT_WRITES)
+    {
+        throw std::runtime_error("Invalid MMC1 shift count in save state");
+    }
+}
+}
+}
@@ -22,13 +22,25 @@
  * IN THE SOFTWARE.
  *****************************************************************************/
 #include <nes/MemoryMap.h>
-#include <iostream>
 #include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+/*****************************************************************************/
+bool isPowerOfTwo(size_t value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+}
 
 namespace nyra
 {
 namespace nes
 {
+/*****************************************************************************/
+const uint16_t MemoryMap::UNMAPPED = 0xFFFF;
+
 /*****************************************************************************/
 MemoryMap::MemoryHandle::MemoryHandle(size_t offset, Memory& memory) :
     memory(&memory),
@@ -36,53 +48,382 @@ MemoryMap::MemoryHandle::MemoryHandle(size_t offset, Memory& memory) :
 {
 }
 
+/*****************************************************************************/
+MemoryMap::Page::Page() :
+    read(nullptr),
+    write(nullptr),
+    memory(nullptr),
+    offset(0),
+    mask(0),
+    byteHandles(0),
+    version(nullptr),
+    codeWrite(nullptr)
+{
+}
+
+/*****************************************************************************/
+MemoryMap::MemoryMap() :
+    mPages(NUM_PAGES),
+    mVersions(NUM_PAGES),
+    mLayoutVersion(0),
+    mBus(BUS_MEMORY_MAP)
+{
+    for (size_t ii = 0; ii < mPages.size(); ++ii)
+    {
+        mPages[ii].version = &mVersions[ii];
+    }
+}
+
 /*****************************************************************************/
 MemoryMap::~MemoryMap()
 {
 }
 
 /*****************************************************************************/
-const MemoryMap::MemoryHandle& MemoryMap::getMemoryBank(size_t& address) const
+uint8_t MemoryMap::readHandler(size_t address) const
+{
+    const Page& page = mPages[address >> PAGE_SHIFT];
+    if (page.memory)
+    {
+        return page.memory->readByte((address - page.offset) & page.mask);
+    }
+
+    const uint16_t index = mByteHandles.empty() ? UNMAPPED :
+            mByteHandles[page.byteHandles + (address & PAGE_MASK)];
+
+    // Unmapped addresses behave like an open bus and read back as zero.
+    if (index == UNMAPPED)
+    {
+        return 0;
+    }
+    const MemoryHandle& handle = mMemory[index];
+    return handle.memory->readByte(address - handle.offset);
+}
+
+/*****************************************************************************/
+void MemoryMap::writeHandler(size_t address, uint8_t value)
+{
+    const Page& page = mPages[address >> PAGE_SHIFT];
+    if (page.codeWrite)
+    {
+        page.codeWrite[address & PAGE_MASK] = value;
+        ++(*page.version);
+        return;
+    }
+
+    if (page.memory)
+    {
+        page.memory->writeByte((address - page.offset) & page.mask, value);
+        return;
+    }
+
+    const uint16_t index = mByteHandles.empty() ? UNMAPPED :
+            mByteHandles[page.byteHandles + (address & PAGE_MASK)];
+
+    // Writes to unmapped addresses are dropped.
+    if (index != UNMAPPED)
+    {
+        const MemoryHandle& handle = mMemory[index];
+        handle.memory->writeByte(address - handle.offset, value);
+    }
+}
+
+/*****************************************************************************/
+void MemoryMap::fillBytes(size_t address, uint8_t value, size_t count)
+{
+    while (count)
+    {
+        const Page& page = mPages[address >> PAGE_SHIFT];
+        const size_t index = address & PAGE_MASK;
+        const size_t size = std::min(count, PAGE_SIZE - index);
+        if (page.write || page.codeWrite)
+        {
+            std::fill_n((page.write ? page.write : page.codeWrite) + index,
+                        size, value);
+            if (!page.write)
+            {
+                *page.version += static_cast<uint32_t>(size);
+            }
+        }
+        else
+        {
+            for (size_t ii = 0; ii < size; ++ii)
+            {
+                writeHandler(address + ii, value);
+            }
+        }
+        address = (address + size) & ADDRESS_MASK;
+        count -= size;
+    }
+}
+
+/*****************************************************************************/
+void MemoryMap::writeRepeated(size_t address, uint8_t value, size_t count)
 {
-    const MemoryHandle& handle = mMemory[mLookUpTable[address]];
-    address -= handle.offset;
-    return handle;
+    const Page& page = mPages[address >> PAGE_SHIFT];
+    if (page.write || page.codeWrite)
+    {
+        // Only the last write to plain memory is seen.
+        if (count)
+        {
+            writeByte(address, value);
+            if (!page.write)
+            {
+                *page.version += static_cast<uint32_t>(count - 1);
+            }
+        }
+    }
+    else if (page.memory)
+    {
+        page.memory->writeRepeated((address - page.offset) & page.mask,
+                                   value, count);
+    }
+    else
+    {
+        for (size_t ii = 0; ii < count; ++ii)
+        {
+            writeHandler(address, value);
+        }
+    }
 }
 
 /*****************************************************************************/
 uint16_t MemoryMap::readShort(size_t address) const
 {
-    size_t modAddress = address;
-    const MemoryHandle* handle = &getMemoryBank(modAddress);
-    const uint16_t ret = handle->memory->readByte(modAddress);
+    const uint16_t ret = readByte(address);
 
     // Check if this is zero page
     // TODO: Is this logic correct for VRAM as well?
-    if (address >= 0x0100)
+    const size_t next = (address >= 0x0100) ?
+            ((address + 1) & ADDRESS_MASK) : ((address + 1) & 0xFF);
+    return (readByte(next) << 8) | ret;
+}
+
+/*****************************************************************************/
+void MemoryMap::buildPage(size_t pageIndex)
+{
+    Page& page = mPages[pageIndex];
+
+    // Anything decoded from the old page is stale, including code running
+    // from a mirror that shared its version.
+    ++(*page.version);
+    page = Page();
+    page.version = &mVersions[pageIndex];
+    ++(*page.version);
+    ++mLayoutVersion;
+
+    const size_t begin = pageIndex << PAGE_SHIFT;
+    const size_t end = begin + PAGE_SIZE;
+
+    // Find every bank that touches this page. Banks are sorted and do not
+    // overlap so this is a contiguous range.
+    const size_t first = std::lower_bound(
+            mMemory.begin(), mMemory.end(), begin,
+            [](const MemoryHandle& handle, size_t address)
+            {
+                return handle.offset + handle.memory->getSize() <= address;
+            }) - mMemory.begin();
+    size_t last = first;
+    while (last < mMemory.size() && mMemory[last].offset < end)
     {
-        modAddress = address + 1;
-        handle = &getMemoryBank(modAddress);
+        ++last;
     }
-    else
+
+    if (first == last)
+    {
+        // Nothing is mapped here. The first page of byte handles is
+        // always unmapped.
+        return;
+    }
+
+    const MemoryHandle& handle = mMemory[first];
+    Memory* const memory = handle.memory;
+
+    // A single bank covers the whole page.
+    if (last - first == 1 && handle.offset <= begin &&
+        handle.offset + memory->getSize() >= end)
+    {
+        const size_t bankAddress = begin - handle.offset;
+        const uint8_t* read = memory->getReadBuffer();
+        uint8_t* write = memory->getWriteBuffer();
+        page.read = read ? read + bankAddress : nullptr;
+        page.write = write ? write + bankAddress : nullptr;
+        page.memory = memory;
+        page.offset = handle.offset;
+        page.mask = ~static_cast<size_t>(0);
+
+        // Mirrors share one version, so a write through any of them is
+        // seen by code decoded from the others.
+        for (size_t ii = 0; page.write && ii < mPages.size(); ++ii)
+        {
+            if (ii != pageIndex && (mPages[ii].write == page.write ||
+                                    mPages[ii].codeWrite == page.write))
+            {
+                page.version = mPages[ii].version;
+                break;
+            }
+        }
+        return;
+    }
+
+    // The same small bank mirrored across the whole page, like the PPU
+    // registers. This can be resolved with a mask.
+    const size_t size = memory->getSize();
+    bool mirrored = isPowerOfTwo(size) && (PAGE_SIZE % size) == 0 &&
+                    (last - first) == (PAGE_SIZE / size);
+    for (size_t ii = first; mirrored && ii < last; ++ii)
+    {
+        mirrored = mMemory[ii].memory == memory &&
+                   mMemory[ii].offset == begin + (ii - first) * size;
+    }
+    if (mirrored)
+    {
+        page.memory = memory;
+        page.offset = begin;
+        page.mask = size - 1;
+        return;
+    }
+
+    // Several banks share this page. Resolve each byte on its own.
+    page.byteHandles = mByteHandles.size();
+    mByteHandles.insert(mByteHandles.end(), PAGE_SIZE, UNMAPPED);
+    for (size_t ii = first; ii < last; ++ii)
+    {
+        const size_t bankBegin = std::max(begin, mMemory[ii].offset);
+        const size_t bankEnd = std::min(
+                end, mMemory[ii].offset + mMemory[ii].memory->getSize());
+        for (size_t address = bankBegin; address < bankEnd; ++address)
+        {
+            mByteHandles[page.byteHandles + (address - begin)] =
+                    static_cast<uint16_t>(ii);
+        }
+    }
+}
+
+/*****************************************************************************/
+void MemoryMap::switchBank(size_t memoryOffset, Memory& memory)
+{
+    const std::vector<MemoryHandle>::iterator handle = std::lower_bound(
+            mMemory.begin(), mMemory.end(),
+            MemoryHandle(memoryOffset, memory));
+    if (handle == mMemory.end() || handle->offset != memoryOffset ||
+        handle->memory->getSize() != memory.getSize())
+    {
+        throw std::runtime_error("No bank of the same size to switch");
+    }
+    handle->memory = &memory;
+
+    const size_t first = memoryOffset >> PAGE_SHIFT;
+    const size_t last = (memoryOffset + memory.getSize() - 1) >> PAGE_SHIFT;
+
+    // Read only banks that cover whole pages, like PRG and CHR ROM, are
+    // laid out here without searching the banks. Anything else may share
+    // a version with its mirrors and goes through buildPage.
+    if (memory.getWriteBuffer() || (memoryOffset & PAGE_MASK) ||
+        (memory.getSize() & PAGE_MASK))
+    {
+        for (size_t ii = first; ii <= last; ++ii)
+        {
+            buildPage(ii);
+        }
+        return;
+    }
+
+    const uint8_t* read = memory.getReadBuffer();
+    for (size_t ii = first; ii <= last; ++ii)
     {
-        modAddress = (modAddress + 1) & 0xFF;
+        Page& page = mPages[ii];
+        ++(*page.version);
+        page.read = read;
+        page.write = nullptr;
+        page.memory = &memory;
+        page.offset = memoryOffset;
+        page.mask = ~static_cast<size_t>(0);
+        page.byteHandles = 0;
+        page.version = &mVersions[ii];
+        page.codeWrite = nullptr;
+        ++(*page.version);
+        read = read ? read + PAGE_SIZE : nullptr;
+    }
+    ++mLayoutVersion;
+}
+
+/*****************************************************************************/
+void MemoryMap::watchCode(size_t address)
+{
+    const Page& page = mPages[address >> PAGE_SHIFT];
+    uint8_t* const write = page.write;
+    if (!write)
+    {
+        return;
+    }
+
+    // Mirrors point at the same buffer, so every one of them has to leave
+    // the direct write path.
+    uint32_t* const version = page.version;
+    for (size_t ii = 0; ii < mPages.size(); ++ii)
+    {
+        Page& mirror = mPages[ii];
+        if (mirror.write == write || mirror.codeWrite == write)
+        {
+            mirror.write = nullptr;
+            mirror.codeWrite = write;
+            mirror.version = version;
+        }
     }
-    return (handle->memory->readByte(modAddress) << 8) | ret;
 }
 
 /*****************************************************************************/
 void MemoryMap::lockLookUpTable()
 {
-    mLookUpTable.clear();
     std::sort(mMemory.begin(), mMemory.end());
+    mByteHandles.assign(PAGE_SIZE, UNMAPPED);
 
+    for (size_t ii = 0; ii < mPages.size(); ++ii)
+    {
+        buildPage(ii);
+    }
+
+    // Collect each writable bank once, in address order, so save states
+    // have a fixed layout.
+    mStateBanks.clear();
     for (size_t ii = 0; ii < mMemory.size(); ++ii)
     {
-        for (size_t jj = 0; jj < mMemory[ii].memory->getSize(); ++jj)
+        Memory* const memory = mMemory[ii].memory;
+        if (memory->getWriteBuffer() &&
+            std::find(mStateBanks.begin(),
+                      mStateBanks.end(),
+                      memory) == mStateBanks.end())
         {
-            mLookUpTable.push_back(ii);
+            mStateBanks.push_back(memory);
         }
     }
 }
+
+/*****************************************************************************/
+void MemoryMap::saveState(StateWriter& state) const
+{
+    for (size_t ii = 0; ii < mStateBanks.size(); ++ii)
+    {
+        state.writeBuffer(mStateBanks[ii]->getReadBuffer(),
+                          mStateBanks[ii]->getSize());
+    }
+}
+
+/*****************************************************************************/
+void MemoryMap::loadState(StateReader& state)
+{
+    for (size_t ii = 0; ii < mStateBanks.size(); ++ii)
+    {
+        state.readBuffer(mStateBanks[ii]->getWriteBuffer(),
+                         mStateBanks[ii]->getSize());
+    }
+
+    // The banks were written behind the page table's back.
+    for (size_t ii = 0; ii < mVersions.size(); ++ii)
+    {
+        ++mVersions[ii];
+    }
+}
 }
 }
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/MemoryMapper.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+MemoryMapper::Window::Window(MemoryMapper& mapper,
+                             size_t address,
+                             const ROM& bank) :
+    Memory(PRG_BANK_SIZE),
+    mMapper(mapper),
+    mAddress(address),
+    mBank(&bank)
+{
+}
+
+/*****************************************************************************/
+MemoryMapper::MemoryMapper(const ROMBanks& prgROM,
+                           PPU& ppu,
+                           APU& apu,
+                           Controller& controller1,
+                           Controller& controller2) :
+    MemorySystem(ppu.getRegisers(), apu, controller1, controller2),
+    mPRGROM(prgROM),
+    mVRAM(ppu.getVRAM()),
+    mWindows{Window(*this, PRG_START, *prgROM.front()),
+             Window(*this, PRG_START + PRG_BANK_SIZE, *prgROM.back())}
+{
+    setMemoryBank(PRG_START, mWindows[0]);
+    setMemoryBank(PRG_START + PRG_BANK_SIZE, mWindows[1]);
+}
+
+/*****************************************************************************/
+void MemoryMapper::lockLookUpTable()
+{
+    MemorySystem::lockLookUpTable();
+    applyBanks();
+}
+
+/*****************************************************************************/
+void MemoryMapper::saveState(StateWriter& state) const
+{
+    MemorySystem::saveState(state);
+    saveRegisters(state);
+}
+
+/*****************************************************************************/
+void MemoryMapper::loadState(StateReader& state)
+{
+    MemorySystem::loadState(state);
+    loadRegisters(state);
+    applyBanks();
+}
+
+/*****************************************************************************/
+void MemoryMapper::switchPRG(size_t window,
+                             size_t bank)
+{
+    Window& target = mWindows[window];
+    const ROM* const rom = mPRGROM[bank % mPRGROM.size()].get();
+    if (target.mBank != rom)
+    {
+        target.mBank = rom;
+        switchBank(target.mAddress, target);
+    }
+}
+
+/*****************************************************************************/
+void MemoryMapper::switchCHR(size_t table,
+                             size_t bank)
+{
+    mVRAM.switchPatternTable(table, bank % mVRAM.getNumPatternBanks());
+}
+}
+}
@@ -33,10 +33,20 @@ MemoryNROM::MemoryNROM(const ROMBanks& rom,
                        APU& apu,
                        Controller& controller1,
                        Controller& controller2) :
-    MemorySystem(ppu, apu, controller1, controller2)
+    MemorySystem(ppu, apu, controller1, controller2),
+    mPRGROM(rom),
+    mPPU(ppu)
 {
     setMemoryBank(0x8000, *rom[0]);
     setMemoryBank(0xC000, *rom[(rom.size() == 2) ? 1 : 0]);
 }
+
+/*****************************************************************************/
+void MemoryNROM::lockLookUpTable()
+{
+    MemorySystem::lockLookUpTable();
+    mBus.reset(new NROMBus(*this, mPPU, mPRGROM));
+    setBus(BUS_NROM);
+}
 }
 }
@@ -45,7 +45,7 @@ MemorySystem::MemorySystem(PPURegisters& ppu,
     }
 
     // PPU Memory
-    for (size_t ii = 0x2000; ii < 0x4000; ii += ppu.getSize())
+    for (size_t ii = PPU_START; ii < PPU_END; ii += ppu.getSize())
     {
         setMemoryBank(ii, ppu);
     }
@@ -0,0 +1,68 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/MemoryUxROM.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+MemoryUxROM::MemoryUxROM(const ROMBanks& prgROM,
+                         PPU& ppu,
+                         APU& apu,
+                         Controller& controller1,
+                         Controller& controller2) :
+    MemoryMapper(prgROM, ppu, apu, controller1, controller2),
+    mBank(0)
+{
+}
+
+/*****************************************************************************/
+void MemoryUxROM::writeRegister(size_t /*address*/,
+                                uint8_t value)
+{
+    mBank = value;
+    applyBanks();
+}
+
+/*****************************************************************************/
+void MemoryUxROM::applyBanks()
+{
+    switchPRG(0, mBank);
+    switchPRG(1, getNumPRGBanks() - 1);
+}
+
+/*****************************************************************************/
+void MemoryUxROM::saveRegisters(StateWriter& state) const
+{
+    state.write(mBank);
+}
+
+/*****************************************************************************/
+void MemoryUxROM::loadRegisters(StateReader& state)
+{
+    state.read(mBank);
+}
+}
+}
@@ -27,15 +27,6 @@ namespace nyra
 {
 namespace nes
 {
-/*****************************************************************************/
-Mode::Mode(bool usesArg1, bool usesArg2) :
-    mUsesArg1(usesArg1),
-    mUsesArg2(usesArg2),
-    mArg(0),
-    mValue(0)
-{
-}
-
 /*****************************************************************************/
 Mode::~Mode()
 {
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/NROMBus.h>
+#include <stdexcept>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+NROMBus::NROMBus(MemoryMap& memory,
+                 PPURegisters& ppu,
+                 const ROMBanks& prgROM) :
+    mMemory(memory),
+    mPPU(ppu)
+{
+    // Mirrors share their version, so the first 2KB covers every one.
+    for (size_t ii = 0; ii < RAM_PAGES; ++ii)
+    {
+        mRAMPages[ii] = memory.getWritePage(ii << 8);
+        mRAMVersions[ii] = memory.getPageVersion(ii << 8);
+        if (!mRAMPages[ii])
+        {
+            throw std::runtime_error("NROM bus requires RAM at 0x0000");
+        }
+    }
+
+    // NROM-128 mirrors its only bank into 0xC000.
+    mPRG[0] = prgROM[0]->getReadBuffer();
+    mPRG[1] = prgROM[prgROM.size() == 2 ? 1 : 0]->getReadBuffer();
+}
+}
+}
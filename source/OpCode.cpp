@@ -25,172 +25,443 @@
 #include <nes/Op6502.hpp>
 #include <nes/Mode6502.hpp>
 
-namespace
-{
-/*****************************************************************************/
-static const uint16_t CYCLES_PER_SCANLINE = 341;
-static const uint16_t MAX_SCANLINES = 260;
-}
-
 namespace nyra
 {
 namespace nes
 {
 /*****************************************************************************/
-void allocateOpCodes(OpCodeArray& opCodes)
+constexpr OpCodeInfo OP_CODE_INFO[257] =
 {
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x00
+    {"ORA", "Bitwise OR with accumulator", 2, 6, true, false},    // 0x01
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x02
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x03
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x04
+    {"ORA", "Bitwise OR with accumulator", 2, 3, true, false},    // 0x05
+    {"ASL", "Arithmetic shift left", 2, 5, true, false},          // 0x06
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x07
+    {"PHP", "Push processor status", 1, 3, false, false},         // 0x08
+    {"ORA", "Bitwise OR with accumulator", 2, 2, true, false},    // 0x09
+    {"ASL", "Arithmetic shift left", 1, 2, false, false},         // 0x0A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x0B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x0C
+    {"ORA", "Bitwise OR with accumulator", 3, 4, true, true},     // 0x0D
+    {"ASL", "Arithmetic shift left", 3, 6, true, true},           // 0x0E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x0F
+    {"BPL", "Branch on plus", 0, 2, true, false},                 // 0x10
+    {"ORA", "Bitwise OR with accumulator", 2, 5, true, false},    // 0x11
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x12
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x13
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x14
+    {"ORA", "Bitwise OR with accumulator", 2, 4, true, false},    // 0x15
+    {"ASL", "Arithmetic shift left", 2, 6, true, false},          // 0x16
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x17
+    {"CLC", "Clear carry", 1, 2, false, false},                   // 0x18
+    {"ORA", "Bitwise OR with accumulator", 3, 4, true, true},     // 0x19
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x1A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x1B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x1C
+    {"ORA", "Bitwise OR with accumulator", 3, 4, true, true},     // 0x1D
+    {"ASL", "Arithmetic shift left", 3, 7, true, true},           // 0x1E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x1F
+    {"JSR", "Jump to subroutine", 0, 6, true, true},              // 0x20
+    {"AND", "Bitwise AND with accumulator", 2, 6, true, false},   // 0x21
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x22
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x23
+    {"BIT", "Test bits", 2, 3, true, false},                      // 0x24
+    {"AND", "Bitwise AND with accumulator", 2, 3, true, false},   // 0x25
+    {"ROL", "Rotate left", 2, 5, true, false},                    // 0x26
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x27
+    {"PLP", "Pull processor status", 1, 4, false, false},         // 0x28
+    {"AND", "Bitwise AND with accumulator", 2, 2, true, false},   // 0x29
+    {"ROL", "Rotate left", 1, 2, false, false},                   // 0x2A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x2B
+    {"BIT", "Test bits", 3, 4, true, true},                       // 0x2C
+    {"AND", "Bitwise AND with accumulator", 3, 4, true, true},    // 0x2D
+    {"ROL", "Rotate left", 3, 6, true, true},                     // 0x2E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x2F
+    {"BMI", "Branch on minus", 0, 2, true, false},                // 0x30
+    {"AND", "Bitwise AND with accumulator", 2, 5, true, false},   // 0x31
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x32
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x33
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x34
+    {"AND", "Bitwise AND with accumulator", 2, 4, true, false},   // 0x35
+    {"ROL", "Rotate left", 2, 6, true, false},                    // 0x36
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x37
+    {"SEC", "Set carry", 1, 2, false, false},                     // 0x38
+    {"AND", "Bitwise AND with accumulator", 3, 4, true, true},    // 0x39
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x3A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x3B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x3C
+    {"AND", "Bitwise AND with accumulator", 3, 4, true, true},    // 0x3D
+    {"ROL", "Rotate left", 3, 7, true, true},                     // 0x3E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x3F
+    {"RTI", "Return from interrupt", 0, 6, false, false},         // 0x40
+    {"EOR", "Bitwise exclusive OR", 2, 6, true, false},           // 0x41
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x42
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x43
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x44
+    {"EOR", "Bitwise exclusive OR", 2, 3, true, false},           // 0x45
+    {"LSR", "Logical shift right", 2, 5, true, false},            // 0x46
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x47
+    {"PHA", "Push accumulator", 1, 3, false, false},              // 0x48
+    {"EOR", "Bitwise exclusive OR", 2, 2, true, false},           // 0x49
+    {"LSR", "Logical shift right", 1, 2, false, false},           // 0x4A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x4B
+    {"JMP", "Jump", 0, 3, true, true},                            // 0x4C
+    {"EOR", "Bitwise exclusive OR", 3, 4, true, true},            // 0x4D
+    {"LSR", "Logical shift right", 3, 6, true, true},             // 0x4E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x4F
+    {"BVC", "Branch on overflow clear", 0, 2, true, false},       // 0x50
+    {"EOR", "Bitwise exclusive OR", 2, 5, true, false},           // 0x51
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x52
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x53
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x54
+    {"EOR", "Bitwise exclusive OR", 2, 4, true, false},           // 0x55
+    {"LSR", "Logical shift right", 2, 6, true, false},            // 0x56
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x57
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x58
+    {"EOR", "Bitwise exclusive OR", 3, 4, true, true},            // 0x59
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x5A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x5B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x5C
+    {"EOR", "Bitwise exclusive OR", 3, 4, true, true},            // 0x5D
+    {"LSR", "Logical shift right", 3, 7, true, true},             // 0x5E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x5F
+    {"RTS", "Return from subroutine", 1, 6, false, false},        // 0x60
+    {"ADC", "Add with carry", 2, 6, true, false},                 // 0x61
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x62
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x63
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x64
+    {"ADC", "Add with carry", 2, 3, true, false},                 // 0x65
+    {"ROR", "Rotate right", 2, 5, true, false},                   // 0x66
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x67
+    {"PLA", "Pull accumulator", 1, 4, false, false},              // 0x68
+    {"ADC", "Add with carry", 2, 2, true, false},                 // 0x69
+    {"ROR", "Rotate right", 1, 2, false, false},                  // 0x6A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x6B
+    {"JMP", "Jump", 0, 5, true, true},                            // 0x6C
+    {"ADC", "Add with carry", 3, 4, true, true},                  // 0x6D
+    {"ROR", "Rotate right", 3, 6, true, true},                    // 0x6E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x6F
+    {"BVS", "Branch on overflow set", 0, 2, true, false},         // 0x70
+    {"ADC", "Add with carry", 2, 5, true, false},                 // 0x71
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x72
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x73
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x74
+    {"ADC", "Add with carry", 2, 4, true, false},                 // 0x75
+    {"ROR", "Rotate right", 2, 6, true, false},                   // 0x76
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x77
+    {"SEI", "Set interrupt", 1, 2, false, false},                 // 0x78
+    {"ADC", "Add with carry", 3, 4, true, true},                  // 0x79
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x7A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x7B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x7C
+    {"ADC", "Add with carry", 3, 4, true, true},                  // 0x7D
+    {"ROR", "Rotate right", 3, 7, true, true},                    // 0x7E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x7F
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x80
+    {"STA", "Store accumulator", 2, 6, true, false},              // 0x81
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x82
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x83
+    {"STY", "Store Y register", 2, 3, true, false},               // 0x84
+    {"STA", "Store accumulator", 2, 3, true, false},              // 0x85
+    {"STX", "Store X register", 2, 3, true, false},               // 0x86
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x87
+    {"DEY", "Decrement Y", 1, 2, false, false},                   // 0x88
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x89
+    {"TXA", "Transfer X to A", 1, 2, false, false},               // 0x8A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x8B
+    {"STY", "Store Y register", 3, 4, true, true},                // 0x8C
+    {"STA", "Store accumulator", 3, 4, true, true},               // 0x8D
+    {"STX", "Store X register", 3, 4, true, true},                // 0x8E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x8F
+    {"BCC", "Branch on carry clear", 0, 2, true, false},          // 0x90
+    {"STA", "Store accumulator", 2, 6, true, false},              // 0x91
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x92
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x93
+    {"STY", "Store Y register", 2, 4, true, false},               // 0x94
+    {"STA", "Store accumulator", 2, 4, true, false},              // 0x95
+    {"STX", "Store X register", 2, 4, true, false},               // 0x96
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x97
+    {"TYA", "Transfer Y to A", 1, 2, false, false},               // 0x98
+    {"STA", "Store accumulator", 3, 5, true, true},               // 0x99
+    {"TXS", "Transfer X to stack ptr", 1, 2, false, false},       // 0x9A
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x9B
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x9C
+    {"STA", "Store accumulator", 3, 5, true, true},               // 0x9D
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x9E
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0x9F
+    {"LDY", "Load Y register", 2, 2, true, false},                // 0xA0
+    {"LDA", "Load accumulator", 2, 6, true, false},               // 0xA1
+    {"LDX", "Load X register", 2, 2, true, false},                // 0xA2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xA3
+    {"LDY", "Load Y register", 2, 3, true, false},                // 0xA4
+    {"LDA", "Load accumulator", 2, 3, true, false},               // 0xA5
+    {"LDX", "Load X register", 2, 3, true, false},                // 0xA6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xA7
+    {"TAY", "Transfer A to Y", 1, 2, false, false},               // 0xA8
+    {"LDA", "Load accumulator", 2, 2, true, false},               // 0xA9
+    {"TAX", "Transfer A to X", 1, 2, false, false},               // 0xAA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xAB
+    {"LDY", "Load Y register", 3, 4, true, true},                 // 0xAC
+    {"LDA", "Load accumulator", 3, 4, true, true},                // 0xAD
+    {"LDX", "Load X register", 3, 4, true, true},                 // 0xAE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xAF
+    {"BCS", "Branch on carry set", 0, 2, true, false},            // 0xB0
+    {"LDA", "Load accumulator", 2, 5, true, false},               // 0xB1
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xB2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xB3
+    {"LDY", "Load Y register", 2, 4, true, false},                // 0xB4
+    {"LDA", "Load accumulator", 2, 4, true, false},               // 0xB5
+    {"LDX", "Load X register", 2, 4, true, false},                // 0xB6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xB7
+    {"CLV", "Clear overflow", 1, 2, false, false},                // 0xB8
+    {"LDA", "Load accumulator", 3, 4, true, true},                // 0xB9
+    {"TSX", "Transfer stack ptr to X", 1, 2, false, false},       // 0xBA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xBB
+    {"LDY", "Load Y register", 3, 4, true, true},                 // 0xBC
+    {"LDA", "Load accumulator", 3, 4, true, true},                // 0xBD
+    {"LDX", "Load X register", 3, 4, true, true},                 // 0xBE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xBF
+    {"CPY", "Compare Y register", 2, 2, true, false},             // 0xC0
+    {"CMP", "Compare accumulator", 2, 6, true, false},            // 0xC1
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xC2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xC3
+    {"CPY", "Compare Y register", 2, 3, true, false},             // 0xC4
+    {"CMP", "Compare accumulator", 2, 3, true, false},            // 0xC5
+    {"DEC", "Decrement memory", 2, 5, true, false},               // 0xC6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xC7
+    {"INY", "Increment Y", 1, 2, false, false},                   // 0xC8
+    {"CMP", "Compare accumulator", 2, 2, true, false},            // 0xC9
+    {"DEX", "Decrement X", 1, 2, false, false},                   // 0xCA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xCB
+    {"CPY", "Compare Y register", 3, 4, true, true},              // 0xCC
+    {"CMP", "Compare accumulator", 3, 4, true, true},             // 0xCD
+    {"DEC", "Decrement memory", 3, 6, true, true},                // 0xCE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xCF
+    {"BNE", "Branch on not equal", 0, 2, true, false},            // 0xD0
+    {"CMP", "Compare accumulator", 2, 5, true, false},            // 0xD1
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xD2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xD3
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xD4
+    {"CMP", "Compare accumulator", 2, 4, true, false},            // 0xD5
+    {"DEC", "Decrement memory", 2, 6, true, false},               // 0xD6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xD7
+    {"CLD", "Clear decimal", 1, 2, false, false},                 // 0xD8
+    {"CMP", "Compare accumulator", 3, 4, true, true},             // 0xD9
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xDA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xDB
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xDC
+    {"CMP", "Compare accumulator", 3, 4, true, true},             // 0xDD
+    {"DEC", "Decrement memory", 3, 7, true, true},                // 0xDE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xDF
+    {"CPX", "Compare X register", 2, 2, true, false},             // 0xE0
+    {"SBC", "Subtract with carry", 2, 6, true, false},            // 0xE1
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xE2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xE3
+    {"CPX", "Compare X register", 2, 3, true, false},             // 0xE4
+    {"SBC", "Subtract with carry", 2, 3, true, false},            // 0xE5
+    {"INC", "Increment memory", 2, 5, true, false},               // 0xE6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xE7
+    {"INX", "Increment X", 1, 2, false, false},                   // 0xE8
+    {"SBC", "Subtract with carry", 2, 2, true, false},            // 0xE9
+    {"NOP", "No operation", 1, 2, false, false},                  // 0xEA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xEB
+    {"CPX", "Compare X register", 3, 4, true, true},              // 0xEC
+    {"SBC", "Subtract with carry", 3, 4, true, true},             // 0xED
+    {"INC", "Increment memory", 3, 6, true, true},                // 0xEE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xEF
+    {"BEQ", "Branch on equal", 0, 2, true, false},                // 0xF0
+    {"SBC", "Subtract with carry", 2, 5, true, false},            // 0xF1
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xF2
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xF3
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xF4
+    {"SBC", "Subtract with carry", 2, 4, true, false},            // 0xF5
+    {"INC", "Increment memory", 2, 6, true, false},               // 0xF6
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xF7
+    {"SED", "Set decimal", 1, 2, false, false},                   // 0xF8
+    {"SBC", "Subtract with carry", 3, 4, true, true},             // 0xF9
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xFA
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xFB
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xFC
+    {"SBC", "Subtract with carry", 3, 4, true, true},             // 0xFD
+    {"INC", "Increment memory", 3, 7, true, true},                // 0xFE
+    {"NUL", "Null Opcode", 0, 0, false, false},                   // 0xFF
+    {"JMI", "Jump to interrupt, NYRA created", 0, 6, true, true}  // 0x100
+};
+
+/*****************************************************************************/
+template <typename TraceT>
+static OpCodeArray allocateOpCodes()
+{
+    OpCodeArray opCodes;
     opCodes.resize(257);
 
     // Fill the known opcodes
-    opCodes[0x01].reset(new OpORA<ModeIndirectX>(0x01, 2, 6));
-    opCodes[0x05].reset(new OpORA<ModeZeroPage>(0x05, 2, 3));
-    opCodes[0x06].reset(new OpASL<ModeZeroPage>(0x06, 2, 5));
+    opCodes[0x01].reset(new OpORA<ModeIndirectX<TraceT> >(0x01));
+    opCodes[0x05].reset(new OpORA<ModeZeroPage<TraceT> >(0x05));
+    opCodes[0x06].reset(new OpASL<ModeZeroPage<TraceT> >(0x06));
     opCodes[0x08].reset(new OpPHP());
-    opCodes[0x09].reset(new OpORA<ModeImmediate>(0x09, 2, 2));
-    opCodes[0x0A].reset(new OpASL<ModeAccumulator>(0x0A, 1, 2));
-    opCodes[0x0D].reset(new OpORA<ModeAbsolute<true> >(0x0D, 3, 4));
-    opCodes[0x0E].reset(new OpASL<ModeAbsolute<true> >(0x0E, 3, 6));
+    opCodes[0x09].reset(new OpORA<ModeImmediate>(0x09));
+    opCodes[0x0A].reset(new OpASL<ModeAccumulator>(0x0A));
+    opCodes[0x0D].reset(new OpORA<ModeAbsolute<TraceT> >(0x0D));
+    opCodes[0x0E].reset(new OpASL<ModeAbsolute<TraceT> >(0x0E));
     opCodes[0x10].reset(new OpBPL());
-    opCodes[0x11].reset(new OpORA<ModeIndirectY<true> >(0x11, 2, 5));
-    opCodes[0x15].reset(new OpORA<ModeZeroPageX>(0x15, 2, 4));
-    opCodes[0x16].reset(new OpASL<ModeZeroPageX>(0x16, 2, 6));
+    opCodes[0x11].reset(new OpORA<ModeIndirectY<TraceT, true> >(0x11));
+    opCodes[0x15].reset(new OpORA<ModeZeroPageX<TraceT> >(0x15));
+    opCodes[0x16].reset(new OpASL<ModeZeroPageX<TraceT> >(0x16));
     opCodes[0x18].reset(new OpCLC());
-    opCodes[0x19].reset(new OpORA<ModeAbsoluteY<true> >(0x19, 3, 4));
-    opCodes[0x1D].reset(new OpORA<ModeAbsoluteX<true> >(0x1D, 3, 4));
-    opCodes[0x1E].reset(new OpASL<ModeAbsoluteX<false> >(0x1E, 3, 7));
+    opCodes[0x19].reset(new OpORA<ModeAbsoluteY<TraceT, true> >(0x19));
+    opCodes[0x1D].reset(new OpORA<ModeAbsoluteX<TraceT, true> >(0x1D));
+    opCodes[0x1E].reset(new OpASL<ModeAbsoluteX<TraceT, false> >(0x1E));
     opCodes[0x20].reset(new OpJSR());
-    opCodes[0x21].reset(new OpAND<ModeIndirectX>(0x21, 2, 6));
-    opCodes[0x24].reset(new OpBIT<ModeZeroPage>(0x24, 2, 3));
-    opCodes[0x25].reset(new OpAND<ModeZeroPage>(0x25, 2, 3));
-    opCodes[0x26].reset(new OpROL<ModeZeroPage>(0x26, 2, 5));
+    opCodes[0x21].reset(new OpAND<ModeIndirectX<TraceT> >(0x21));
+    opCodes[0x24].reset(new OpBIT<ModeZeroPage<TraceT> >(0x24));
+    opCodes[0x25].reset(new OpAND<ModeZeroPage<TraceT> >(0x25));
+    opCodes[0x26].reset(new OpROL<ModeZeroPage<TraceT> >(0x26));
     opCodes[0x28].reset(new OpPLP());
-    opCodes[0x29].reset(new OpAND<ModeImmediate>(0x29, 2, 2));
-    opCodes[0x2A].reset(new OpROL<ModeAccumulator>(0x2A, 1, 2));
-    opCodes[0x2C].reset(new OpBIT<ModeAbsolute<true> >(0x2C, 3, 4));
-    opCodes[0x2D].reset(new OpAND<ModeAbsolute<true> >(0x2D, 3, 4));
-    opCodes[0x2E].reset(new OpROL<ModeAbsolute<true> >(0x2E, 3, 6));
+    opCodes[0x29].reset(new OpAND<ModeImmediate>(0x29));
+    opCodes[0x2A].reset(new OpROL<ModeAccumulator>(0x2A));
+    opCodes[0x2C].reset(new OpBIT<ModeAbsolute<TraceT> >(0x2C));
+    opCodes[0x2D].reset(new OpAND<ModeAbsolute<TraceT> >(0x2D));
+    opCodes[0x2E].reset(new OpROL<ModeAbsolute<TraceT> >(0x2E));
     opCodes[0x30].reset(new OpBMI());
-    opCodes[0x31].reset(new OpAND<ModeIndirectY<true> >(0x31, 2, 5));
-    opCodes[0x35].reset(new OpAND<ModeZeroPageX>(0x35, 2, 4));
-    opCodes[0x36].reset(new OpROL<ModeZeroPageX>(0x36, 2, 6));
+    opCodes[0x31].reset(new OpAND<ModeIndirectY<TraceT, true> >(0x31));
+    opCodes[0x35].reset(new OpAND<ModeZeroPageX<TraceT> >(0x35));
+    opCodes[0x36].reset(new OpROL<ModeZeroPageX<TraceT> >(0x36));
     opCodes[0x38].reset(new OpSEC());
-    opCodes[0x39].reset(new OpAND<ModeAbsoluteY<true> >(0x39, 3, 4));
-    opCodes[0x3D].reset(new OpAND<ModeAbsoluteX<true> >(0x3D, 3, 4));
-    opCodes[0x3E].reset(new OpROL<ModeAbsoluteX<false> >(0x3E, 3, 7));
+    opCodes[0x39].reset(new OpAND<ModeAbsoluteY<TraceT, true> >(0x39));
+    opCodes[0x3D].reset(new OpAND<ModeAbsoluteX<TraceT, true> >(0x3D));
+    opCodes[0x3E].reset(new OpROL<ModeAbsoluteX<TraceT, false> >(0x3E));
     opCodes[0x40].reset(new OpRTI());
-    opCodes[0x41].reset(new OpEOR<ModeIndirectX>(0x41, 2, 6));
-    opCodes[0x45].reset(new OpEOR<ModeZeroPage>(0x45, 2, 3));
-    opCodes[0x46].reset(new OpLSR<ModeZeroPage>(0x46, 2, 5));
-    opCodes[0x4C].reset(new OpJMP<ModeAbsolute<false> >(0x4C, 3));
-    opCodes[0x4D].reset(new OpEOR<ModeAbsolute<true> >(0x4D, 3, 4));
+    opCodes[0x41].reset(new OpEOR<ModeIndirectX<TraceT> >(0x41));
+    opCodes[0x45].reset(new OpEOR<ModeZeroPage<TraceT> >(0x45));
+    opCodes[0x46].reset(new OpLSR<ModeZeroPage<TraceT> >(0x46));
+    opCodes[0x4C].reset(
+            new OpJMP<ModeAbsolute<TraceT, ACCESS_NONE> >(0x4C));
+    opCodes[0x4D].reset(new OpEOR<ModeAbsolute<TraceT> >(0x4D));
     opCodes[0x48].reset(new OpPHA());
-    opCodes[0x49].reset(new OpEOR<ModeImmediate>(0x49, 2, 2));
-    opCodes[0x4A].reset(new OpLSR<ModeAccumulator>(0x4A, 1, 2));
-    opCodes[0x4E].reset(new OpLSR<ModeAbsolute<true> >(0x4E, 3, 6));
+    opCodes[0x49].reset(new OpEOR<ModeImmediate>(0x49));
+    opCodes[0x4A].reset(new OpLSR<ModeAccumulator>(0x4A));
+    opCodes[0x4E].reset(new OpLSR<ModeAbsolute<TraceT> >(0x4E));
     opCodes[0x50].reset(new OpBVC());
-    opCodes[0x51].reset(new OpEOR<ModeIndirectY<true> >(0x51, 2, 5));
-    opCodes[0x55].reset(new OpEOR<ModeZeroPageX>(0x55, 2, 4));
-    opCodes[0x56].reset(new OpLSR<ModeZeroPageX>(0x56, 2, 6));
-    opCodes[0x59].reset(new OpEOR<ModeAbsoluteY<true> >(0x59, 3, 4));
-    opCodes[0x5D].reset(new OpEOR<ModeAbsoluteX<true> >(0x5D, 3, 4));
-    opCodes[0x5E].reset(new OpLSR<ModeAbsoluteX<false> >(0x5E, 3, 7));
+    opCodes[0x51].reset(new OpEOR<ModeIndirectY<TraceT, true> >(0x51));
+    opCodes[0x55].reset(new OpEOR<ModeZeroPageX<TraceT> >(0x55));
+    opCodes[0x56].reset(new OpLSR<ModeZeroPageX<TraceT> >(0x56));
+    opCodes[0x59].reset(new OpEOR<ModeAbsoluteY<TraceT, true> >(0x59));
+    opCodes[0x5D].reset(new OpEOR<ModeAbsoluteX<TraceT, true> >(0x5D));
+    opCodes[0x5E].reset(new OpLSR<ModeAbsoluteX<TraceT, false> >(0x5E));
     opCodes[0x60].reset(new OpRTS());
-    opCodes[0x61].reset(new OpADC<ModeIndirectX>(0x61, 2, 6));
-    opCodes[0x65].reset(new OpADC<ModeZeroPage>(0x65, 2, 3));
-    opCodes[0x66].reset(new OpROR<ModeZeroPage>(0x66, 2, 5));
+    opCodes[0x61].reset(new OpADC<ModeIndirectX<TraceT> >(0x61));
+    opCodes[0x65].reset(new OpADC<ModeZeroPage<TraceT> >(0x65));
+    opCodes[0x66].reset(new OpROR<ModeZeroPage<TraceT> >(0x66));
     opCodes[0x68].reset(new OpPLA());
-    opCodes[0x69].reset(new OpADC<ModeImmediate>(0x69, 2, 2));
-    opCodes[0x6A].reset(new OpROR<ModeAccumulator>(0x6A, 1, 2));
-    opCodes[0x6C].reset(new OpJMP<ModeIndirect>(0x6C, 5));
-    opCodes[0x6D].reset(new OpADC<ModeAbsolute<true> >(0x6D, 3, 4));
-    opCodes[0x6E].reset(new OpROR<ModeAbsolute<true> >(0x6E, 3, 6));
+    opCodes[0x69].reset(new OpADC<ModeImmediate>(0x69));
+    opCodes[0x6A].reset(new OpROR<ModeAccumulator>(0x6A));
+    opCodes[0x6C].reset(new OpJMP<ModeIndirect>(0x6C));
+    opCodes[0x6D].reset(new OpADC<ModeAbsolute<TraceT> >(0x6D));
+    opCodes[0x6E].reset(new OpROR<ModeAbsolute<TraceT> >(0x6E));
     opCodes[0x70].reset(new OpBVS());
-    opCodes[0x71].reset(new OpADC<ModeIndirectY<true> >(0x71, 2, 5));
-    opCodes[0x75].reset(new OpADC<ModeZeroPageX>(0x75, 2, 4));
-    opCodes[0x76].reset(new OpROR<ModeZeroPageX>(0x76, 2, 6));
+    opCodes[0x71].reset(new OpADC<ModeIndirectY<TraceT, true> >(0x71));
+    opCodes[0x75].reset(new OpADC<ModeZeroPageX<TraceT> >(0x75));
+    opCodes[0x76].reset(new OpROR<ModeZeroPageX<TraceT> >(0x76));
     opCodes[0x78].reset(new OpSEI());
-    opCodes[0x79].reset(new OpADC<ModeAbsoluteY<true> >(0x79, 3, 4));
-    opCodes[0x7D].reset(new OpADC<ModeAbsoluteX<true> >(0x7D, 3, 4));
-    opCodes[0x7E].reset(new OpROR<ModeAbsoluteX<false> >(0x7E, 3, 7));
-    opCodes[0x81].reset(new OpSTA<ModeIndirectX>(0x81, 2, 6));
-    opCodes[0x84].reset(new OpSTY<ModeZeroPage>(0x84, 2, 3));
-    opCodes[0x85].reset(new OpSTA<ModeZeroPage>(0x85, 2, 3));
-    opCodes[0x86].reset(new OpSTX<ModeZeroPage>(0x86, 2, 3));
+    opCodes[0x79].reset(new OpADC<ModeAbsoluteY<TraceT, true> >(0x79));
+    opCodes[0x7D].reset(new OpADC<ModeAbsoluteX<TraceT, true> >(0x7D));
+    opCodes[0x7E].reset(new OpROR<ModeAbsoluteX<TraceT, false> >(0x7E));
+    opCodes[0x81].reset(
+            new OpSTA<ModeIndirectX<TraceT, ACCESS_TRACE> >(0x81));
+    opCodes[0x84].reset(
+            new OpSTY<ModeZeroPage<TraceT, ACCESS_TRACE> >(0x84));
+    opCodes[0x85].reset(
+            new OpSTA<ModeZeroPage<TraceT, ACCESS_TRACE> >(0x85));
+    opCodes[0x86].reset(
+            new OpSTX<ModeZeroPage<TraceT, ACCESS_TRACE> >(0x86));
     opCodes[0x88].reset(new OpDEY());
     opCodes[0x8A].reset(new OpTXA());
-    opCodes[0x8C].reset(new OpSTY<ModeAbsolute<true> >(0x8C, 3, 4));
-    opCodes[0x8D].reset(new OpSTA<ModeAbsolute<false> >(0x8D, 3, 4));
-    opCodes[0x8E].reset(new OpSTX<ModeAbsolute<true> >(0x8E, 3, 4));
+    opCodes[0x8C].reset(
+            new OpSTY<ModeAbsolute<TraceT, ACCESS_TRACE> >(0x8C));
+    opCodes[0x8D].reset(
+            new OpSTA<ModeAbsolute<TraceT, ACCESS_TRACE> >(0x8D));
+    opCodes[0x8E].reset(
+            new OpSTX<ModeAbsolute<TraceT, ACCESS_TRACE> >(0x8E));
     opCodes[0x90].reset(new OpBCC());
-    opCodes[0x91].reset(new OpSTA<ModeIndirectY<false> >(0x91, 2, 6));
-    opCodes[0x94].reset(new OpSTY<ModeZeroPageX>(0x94, 2, 4));
-    opCodes[0x95].reset(new OpSTA<ModeZeroPageX>(0x95, 2, 4));
-    opCodes[0x96].reset(new OpSTX<ModeZeroPageY>(0x96, 2, 4));
+    opCodes[0x91].reset(
+            new OpSTA<ModeIndirectY<TraceT, false, ACCESS_TRACE> >(0x91));
+    opCodes[0x94].reset(
+            new OpSTY<ModeZeroPageX<TraceT, ACCESS_TRACE> >(0x94));
+    opCodes[0x95].reset(
+            new OpSTA<ModeZeroPageX<TraceT, ACCESS_TRACE> >(0x95));
+    opCodes[0x96].reset(
+            new OpSTX<ModeZeroPageY<TraceT, ACCESS_TRACE> >(0x96));
     opCodes[0x98].reset(new OpTYA());
-    opCodes[0x99].reset(new OpSTA<ModeAbsoluteY<false> >(0x99, 3, 5));
+    opCodes[0x99].reset(
+            new OpSTA<ModeAbsoluteY<TraceT, false, ACCESS_TRACE> >(0x99));
     opCodes[0x9A].reset(new OpTXS());
-    opCodes[0x9D].reset(new OpSTA<ModeAbsoluteX<false> >(0x9D, 3, 5));
-    opCodes[0xA0].reset(new OpLDY<ModeImmediate>(0xA0, 2, 2));
-    opCodes[0xA1].reset(new OpLDA<ModeIndirectX>(0xA1, 2, 6));
-    opCodes[0xA2].reset(new OpLDX<ModeImmediate>(0xA2, 2, 2));
-    opCodes[0xA4].reset(new OpLDY<ModeZeroPage>(0xA4, 2, 3));
-    opCodes[0xA5].reset(new OpLDA<ModeZeroPage>(0xA5, 2, 3));
-    opCodes[0xA6].reset(new OpLDX<ModeZeroPage>(0xA6, 2, 3));
+    opCodes[0x9D].reset(
+            new OpSTA<ModeAbsoluteX<TraceT, false, ACCESS_TRACE> >(0x9D));
+    opCodes[0xA0].reset(new OpLDY<ModeImmediate>(0xA0));
+    opCodes[0xA1].reset(new OpLDA<ModeIndirectX<TraceT> >(0xA1));
+    opCodes[0xA2].reset(new OpLDX<ModeImmediate>(0xA2));
+    opCodes[0xA4].reset(new OpLDY<ModeZeroPage<TraceT> >(0xA4));
+    opCodes[0xA5].reset(new OpLDA<ModeZeroPage<TraceT> >(0xA5));
+    opCodes[0xA6].reset(new OpLDX<ModeZeroPage<TraceT> >(0xA6));
     opCodes[0xA8].reset(new OpTAY());
-    opCodes[0xA9].reset(new OpLDA<ModeImmediate>(0xA9, 2, 2));
+    opCodes[0xA9].reset(new OpLDA<ModeImmediate>(0xA9));
     opCodes[0xAA].reset(new OpTAX());
-    opCodes[0xAC].reset(new OpLDY<ModeAbsolute<true> >(0xAC, 3, 4));
-    opCodes[0xAD].reset(new OpLDA<ModeAbsolute<true> >(0xAD, 3, 4));
-    opCodes[0xAE].reset(new OpLDX<ModeAbsolute<true> >(0xAE, 3, 4));
+    opCodes[0xAC].reset(new OpLDY<ModeAbsolute<TraceT> >(0xAC));
+    opCodes[0xAD].reset(new OpLDA<ModeAbsolute<TraceT> >(0xAD));
+    opCodes[0xAE].reset(new OpLDX<ModeAbsolute<TraceT> >(0xAE));
     opCodes[0xB0].reset(new OpBCS());
-    opCodes[0xB1].reset(new OpLDA<ModeIndirectY<true> >(0xB1, 2, 5));
-    opCodes[0xB4].reset(new OpLDY<ModeZeroPageX>(0xB4, 2, 4));
-    opCodes[0xB5].reset(new OpLDA<ModeZeroPageX>(0xB5, 2, 4));
-    opCodes[0xB6].reset(new OpLDX<ModeZeroPageY>(0xB6, 2, 4));
+    opCodes[0xB1].reset(new OpLDA<ModeIndirectY<TraceT, true> >(0xB1));
+    opCodes[0xB4].reset(new OpLDY<ModeZeroPageX<TraceT> >(0xB4));
+    opCodes[0xB5].reset(new OpLDA<ModeZeroPageX<TraceT> >(0xB5));
+    opCodes[0xB6].reset(new OpLDX<ModeZeroPageY<TraceT> >(0xB6));
     opCodes[0xB8].reset(new OpCLV());
-    opCodes[0xB9].reset(new OpLDA<ModeAbsoluteY<true> >(0xB9, 3, 4));
+    opCodes[0xB9].reset(new OpLDA<ModeAbsoluteY<TraceT, true> >(0xB9));
     opCodes[0xBA].reset(new OpTSX());
-    opCodes[0xBC].reset(new OpLDY<ModeAbsoluteX<true> >(0xBC, 3, 4));
-    opCodes[0xBD].reset(new OpLDA<ModeAbsoluteX<true> >(0xBD, 3, 4));
-    opCodes[0xBE].reset(new OpLDX<ModeAbsoluteY<true> >(0xBE, 3, 4));
-    opCodes[0xC0].reset(new OpCPY<ModeImmediate>(0xC0, 2, 2));
-    opCodes[0xC1].reset(new OpCMP<ModeIndirectX>(0xC1, 2, 6));
-    opCodes[0xC4].reset(new OpCPY<ModeZeroPage>(0xC4, 2, 3));
-    opCodes[0xC5].reset(new OpCMP<ModeZeroPage>(0xC5, 2, 3));
-    opCodes[0xC6].reset(new OpDEC<ModeZeroPage>(0xC6, 2, 5));
+    opCodes[0xBC].reset(new OpLDY<ModeAbsoluteX<TraceT, true> >(0xBC));
+    opCodes[0xBD].reset(new OpLDA<ModeAbsoluteX<TraceT, true> >(0xBD));
+    opCodes[0xBE].reset(new OpLDX<ModeAbsoluteY<TraceT, true> >(0xBE));
+    opCodes[0xC0].reset(new OpCPY<ModeImmediate>(0xC0));
+    opCodes[0xC1].reset(new OpCMP<ModeIndirectX<TraceT> >(0xC1));
+    opCodes[0xC4].reset(new OpCPY<ModeZeroPage<TraceT> >(0xC4));
+    opCodes[0xC5].reset(new OpCMP<ModeZeroPage<TraceT> >(0xC5));
+    opCodes[0xC6].reset(new OpDEC<ModeZeroPage<TraceT> >(0xC6));
     opCodes[0xC8].reset(new OpINY());
-    opCodes[0xC9].reset(new OpCMP<ModeImmediate>(0xC9, 2, 2));
+    opCodes[0xC9].reset(new OpCMP<ModeImmediate>(0xC9));
     opCodes[0xCA].reset(new OpDEX());
-    opCodes[0xCC].reset(new OpCPY<ModeAbsolute<true> >(0xCC, 3, 4));
-    opCodes[0xCD].reset(new OpCMP<ModeAbsolute<true> >(0xCD, 3, 4));
-    opCodes[0xCE].reset(new OpDEC<ModeAbsolute<true> >(0xCE, 3, 6));
+    opCodes[0xCC].reset(new OpCPY<ModeAbsolute<TraceT> >(0xCC));
+    opCodes[0xCD].reset(new OpCMP<ModeAbsolute<TraceT> >(0xCD));
+    opCodes[0xCE].reset(new OpDEC<ModeAbsolute<TraceT> >(0xCE));
     opCodes[0xD0].reset(new OpBNE());
-    opCodes[0xD1].reset(new OpCMP<ModeIndirectY<true> >(0xD1, 2, 5));
-    opCodes[0xD5].reset(new OpCMP<ModeZeroPageX>(0xD5, 2, 4));
-    opCodes[0xD6].reset(new OpDEC<ModeZeroPageX>(0xD6, 2, 6));
+    opCodes[0xD1].reset(new OpCMP<ModeIndirectY<TraceT, true> >(0xD1));
+    opCodes[0xD5].reset(new OpCMP<ModeZeroPageX<TraceT> >(0xD5));
+    opCodes[0xD6].reset(new OpDEC<ModeZeroPageX<TraceT> >(0xD6));
     opCodes[0xD8].reset(new OpCLD());
-    opCodes[0xD9].reset(new OpCMP<ModeAbsoluteY<true> >(0xD9, 3, 4));
-    opCodes[0xDD].reset(new OpCMP<ModeAbsoluteX<true> >(0xDD, 3, 4));
-    opCodes[0xDE].reset(new OpDEC<ModeAbsoluteX<false> >(0xDE, 3, 7));
-    opCodes[0xE0].reset(new OpCPX<ModeImmediate>(0xE0, 2, 2));
-    opCodes[0xE1].reset(new OpSBC<ModeIndirectX>(0xE1, 2, 6));
-    opCodes[0xE4].reset(new OpCPX<ModeZeroPage>(0xE4, 2, 3));
-    opCodes[0xE5].reset(new OpSBC<ModeZeroPage>(0xE5, 2, 3));
-    opCodes[0xE6].reset(new OpINC<ModeZeroPage>(0xE6, 2, 5));
+    opCodes[0xD9].reset(new OpCMP<ModeAbsoluteY<TraceT, true> >(0xD9));
+    opCodes[0xDD].reset(new OpCMP<ModeAbsoluteX<TraceT, true> >(0xDD));
+    opCodes[0xDE].reset(new OpDEC<ModeAbsoluteX<TraceT, false> >(0xDE));
+    opCodes[0xE0].reset(new OpCPX<ModeImmediate>(0xE0));
+    opCodes[0xE1].reset(new OpSBC<ModeIndirectX<TraceT> >(0xE1));
+    opCodes[0xE4].reset(new OpCPX<ModeZeroPage<TraceT> >(0xE4));
+    opCodes[0xE5].reset(new OpSBC<ModeZeroPage<TraceT> >(0xE5));
+    opCodes[0xE6].reset(new OpINC<ModeZeroPage<TraceT> >(0xE6));
     opCodes[0xE8].reset(new OpINX());
-    opCodes[0xE9].reset(new OpSBC<ModeImmediate>(0xE9, 2, 2));
+    opCodes[0xE9].reset(new OpSBC<ModeImmediate>(0xE9));
     opCodes[0xEA].reset(new OpNOP());
-    opCodes[0xEC].reset(new OpCPX<ModeAbsolute<true> >(0xEC, 3, 4));
-    opCodes[0xED].reset(new OpSBC<ModeAbsolute<true> >(0xED, 3, 4));
-    opCodes[0xEE].reset(new OpINC<ModeAbsolute<true> >(0xEE, 3, 6));
+    opCodes[0xEC].reset(new OpCPX<ModeAbsolute<TraceT> >(0xEC));
+    opCodes[0xED].reset(new OpSBC<ModeAbsolute<TraceT> >(0xED));
+    opCodes[0xEE].reset(new OpINC<ModeAbsolute<TraceT> >(0xEE));
     opCodes[0xF0].reset(new OpBEQ());
-    opCodes[0xF1].reset(new OpSBC<ModeIndirectY<true> >(0xF1, 2, 5));
-    opCodes[0xF5].reset(new OpSBC<ModeZeroPageX>(0xF5, 2, 4));
-    opCodes[0xF6].reset(new OpINC<ModeZeroPageX>(0xF6, 2, 6));
+    opCodes[0xF1].reset(new OpSBC<ModeIndirectY<TraceT, true> >(0xF1));
+    opCodes[0xF5].reset(new OpSBC<ModeZeroPageX<TraceT> >(0xF5));
+    opCodes[0xF6].reset(new OpINC<ModeZeroPageX<TraceT> >(0xF6));
     opCodes[0xF8].reset(new OpSED());
-    opCodes[0xF9].reset(new OpSBC<ModeAbsoluteY<true> >(0xF9, 3, 4));
-    opCodes[0xFD].reset(new OpSBC<ModeAbsoluteX<true> >(0xFD, 3, 4));
-    opCodes[0xFE].reset(new OpINC<ModeAbsoluteX<false> >(0xFE, 3, 7));
+    opCodes[0xF9].reset(new OpSBC<ModeAbsoluteY<TraceT, true> >(0xF9));
+    opCodes[0xFD].reset(new OpSBC<ModeAbsoluteX<TraceT, true> >(0xFD));
+    opCodes[0xFE].reset(new OpINC<ModeAbsoluteX<TraceT, false> >(0xFE));
     opCodes[0x100].reset(new OpJMI());
 
     // Fill all other opcodes with null values
@@ -201,20 +472,26 @@ void allocateOpCodes(OpCodeArray& opCodes)
             opCodes[ii].reset(new OpNUL(static_cast<uint8_t>(ii)));
         }
     }
+    return opCodes;
+}
+
+/*****************************************************************************/
+template <typename TraceT>
+const OpCodeArray& getOpCodes()
+{
+    // The opcodes hold no state, so every CPU can run the same ones.
+    static const OpCodeArray opCodes(allocateOpCodes<TraceT>());
+    return opCodes;
 }
 
+template const OpCodeArray& getOpCodes<TracePolicy::None>();
+template const OpCodeArray& getOpCodes<TracePolicy::Full>();
+
 /*****************************************************************************/
-OpCode::OpCode(const std::string& name,
-               const std::string& extendedName,
-               uint8_t opCode,
-               uint8_t length,
-               uint8_t time,
-               Mode* mode) :
-    mName(name),
-    mExtendedName(extendedName),
-    mOpCode(opCode),
-    mLength(length),
-    mTime(time),
+OpCode::OpCode(size_t opCode,
+               const Mode* mode) :
+    mInfo(OP_CODE_INFO[opCode]),
+    mOpCode(static_cast<uint8_t>(opCode)),
     mMode(mode)
 {
 }
@@ -228,23 +505,15 @@ OpCode::~OpCode()
 void OpCode::operator()(const CPUArgs& args,
                         CPURegisters& registers,
                         CPUInfo& info,
-                        MemoryMap& memory)
+                        MemoryMap& memory,
+                        Operand& operand) const
 {
     // Setup the mode values
-    (*mMode)(args, registers, memory, info);
+    (*mMode)(args, registers, memory, info, operand);
 
-    op(registers, info, memory);
-    info.programCounter += mLength;
-    info.cycles += mTime * 3;
-    if (info.cycles >= CYCLES_PER_SCANLINE)
-    {
-        info.cycles -= CYCLES_PER_SCANLINE;
-        ++info.scanLine;
-        if (info.scanLine > MAX_SCANLINES)
-        {
-            info.scanLine = -1;
-        }
-    }
+    op(operand, registers, info, memory);
+    info.programCounter += mInfo.length;
+    info.cycles += mInfo.time * 3;
 }
 }
 }
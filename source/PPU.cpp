@@ -23,6 +23,9 @@
  *****************************************************************************/
 #include <nes/PPU.h>
 #include <nes/Constants.h>
+#include <nes/TileKernel.hpp>
+#include <cstring>
+#include <algorithm>
 #include <iostream>
 
 namespace
@@ -38,6 +41,12 @@ static const int16_t VBLANK_START = 241;
 static const int16_t VBLANK_END = -1;
 static const size_t SPRITE_PALETTE_ADDRESS = 0x3F10;
 static const size_t BACKGROUND_PALETTE_ADDRESS = 0x3F00;
+static const size_t NUM_PALETTES = 4;
+static const size_t PALETTE_SIZE = 4;
+static const size_t BACKGROUND_TILES = 33;
+static const size_t SPRITE_HEIGHT = 8;
+static const size_t BYTES_PER_SPRITE = 4;
+static const size_t MAX_SPRITES_PER_LINE = 8;
 static const uint32_t RGB_PALLETE[64] =
 {
 rgb( 84,  84,  84), rgb(  0,  30, 116), rgb(  8,  16, 144), rgb( 48,   0, 136),
@@ -65,11 +74,13 @@ namespace nes
 {
 /*****************************************************************************/
 PPU::PPU(const ROMBanks& chrROM,
-         Mirroring mirroring) :
-    mVRAM(chrROM, mirroring),
+         Mirroring mirroring,
+         const uint16_t* chrTiles) :
+    mVRAM(chrROM, mirroring, chrTiles),
     mRegisters(mVRAM),
-    mOAM(256)
+    mOAM(NUM_SPRITES * BYTES_PER_SPRITE)
 {
+    evaluateSprites();
 }
 
 /*****************************************************************************/
@@ -87,6 +98,7 @@ void PPU::processScanline(CPUInfo& info,
         {
             mOAM.writeByte(ii, memory.readByte(address + ii));
         }
+        evaluateSprites();
     }
 
     switch (info.scanLine)
@@ -106,6 +118,22 @@ void PPU::processScanline(CPUInfo& info,
                 PPURegisters::PPUSTATUS)[PPURegisters::VBLANK] = false;
         mRegisters.getRegister(
                 PPURegisters::PPUSTATUS)[PPURegisters::SPRITE_HIT_0] = false;
+        mRegisters.getRegister(
+                PPURegisters::PPUSTATUS)[PPURegisters::SPRITE_OFLOW] = false;
+        break;
+    default:
+        // Sprite evaluation only happens while rendering is enabled.
+        if (info.scanLine < static_cast<int16_t>(SCREEN_HEIGHT) &&
+            mSpriteCounts[info.scanLine] > MAX_SPRITES_PER_LINE &&
+            (mRegisters.getRegister(PPURegisters::PPUMASK)
+                    [PPURegisters::SHOW_SPRITES] ||
+             mRegisters.getRegister(PPURegisters::PPUMASK)
+                    [PPURegisters::SHOW_BACKGROUND]))
+        {
+            mRegisters.getRegister(
+                    PPURegisters::PPUSTATUS)[PPURegisters::SPRITE_OFLOW] =
+                            true;
+        }
         break;
     }
 
@@ -121,7 +149,6 @@ void PPU::renderBackground(int16_t scanLine,
 {
     const uint32_t backgroundColor =
             RGB_PALLETE[mVRAM.getBackgroundColor()];
-    size_t paletteAddress;
     const uint8_t scrollX = mRegisters.getScrollX();
     const size_t backgroundPatternTable =
             mRegisters.getRegister(PPURegisters::PPUCTRL)
@@ -136,8 +163,24 @@ void PPU::renderBackground(int16_t scanLine,
     //! Render background
     const size_t backgroundY = scanLine / 8;
 
+    // Resolve the four background palettes once for the whole line.
+    uint32_t colors[NUM_PALETTES][PALETTE_SIZE];
+    for (size_t ii = 0; ii < NUM_PALETTES; ++ii)
+    {
+        colors[ii][0] = backgroundColor;
+        for (size_t jj = 1; jj < PALETTE_SIZE; ++jj)
+        {
+            colors[ii][jj] = RGB_PALLETE[mVRAM.readByte(
+                    BACKGROUND_PALETTE_ADDRESS + (ii * PALETTE_SIZE) + jj)];
+        }
+    }
+
+    // Render every visible tile whole, starting at the first (possibly
+    // partial) tile, then shift by the fine scroll on the way out.
+    uint32_t row[BACKGROUND_TILES * TILE_WIDTH];
+
     //! TODO: This needs a lot of clean up.
-    for (int32_t ii = 0; ii < 33; ++ii)
+    for (int32_t ii = 0; ii < static_cast<int32_t>(BACKGROUND_TILES); ++ii)
     {
         // Get the background X position
         int32_t backgroundX = ii + (scrollX / 8);
@@ -159,7 +202,6 @@ void PPU::renderBackground(int16_t scanLine,
         const size_t backgroundIndex = mVRAM.readByte(
                 baseNametableAddress + (backgroundY * 32) + backgroundX);
 
-        const size_t pixelPosition = (ii * 8) - (scrollX % 8);
         const size_t address = backgroundPatternTable +
                 (backgroundIndex * 16);
 
@@ -180,20 +222,14 @@ void PPU::renderBackground(int16_t scanLine,
         const uint8_t paletteNumber = (attributeIndex >> paletteIndex) & 0x03;
 
         // Render this background
-        for (size_t jj = 0; jj < 8; ++jj)
-        {
-            // Make sure the pixel is in a valid range
-            if (pixelPosition + jj >= 0 && pixelPosition + jj < 256)
-            {
-                buffer[pixelPosition + jj] = extractPixel(
-                        address + (scanLine % 8),
-                        7 - jj,
-                        BACKGROUND_PALETTE_ADDRESS + (paletteNumber * 4),
-                        backgroundColor,
-                        paletteAddress);
-            }
-        }
+        renderTileRow(mVRAM.getTileRow(address + (scanLine % 8)),
+                      colors[paletteNumber],
+                      row + (ii * TILE_WIDTH));
     }
+
+    std::memcpy(buffer,
+                row + (scrollX % TILE_WIDTH),
+                SCREEN_WIDTH * sizeof(uint32_t));
 }
 
 /*****************************************************************************/
@@ -203,72 +239,94 @@ void PPU::renderSprites(int16_t scanLine,
     const uint32_t backgroundColor =
             RGB_PALLETE[mVRAM.getBackgroundColor()];
     size_t paletteAddress;
-    const uint16_t spriteAddress = 0;
+    const uint8_t* const oam = mOAM.getReadBuffer();
+    const uint8_t* const sprites = mSpriteLines[scanLine];
 
-    //! Get the values
-    for (size_t ii = 0; ii < 64 * 4; ii += 4)
+    //! Only visit the sprites that were found on this line, in OAM order.
+    for (size_t kk = 0; kk < mSpriteCounts[scanLine]; ++kk)
     {
+        const size_t ii = sprites[kk] * BYTES_PER_SPRITE;
+
         // Get the y position
-        const int16_t renderLine = static_cast<int16_t>(
-                mOAM.readByte(spriteAddress + ii)) - scanLine + 8;
-        if (renderLine < 8 && renderLine >= 0)
-        {
-            // Get the sprite number
-            const size_t address =
-                    mOAM.readByte(spriteAddress + ii + 1) * 16;
+        const int16_t renderLine = static_cast<int16_t>(oam[ii]) -
+                scanLine + 8;
+
+        // Get the sprite number
+        const size_t address = oam[ii + 1] * 16;
+
+        const size_t attributes = oam[ii + 2];
+        const size_t paletteNumber = attributes & 0x03;
+        const bool flipHorizontally = (attributes & 0x40) > 0;
+        const bool flipVertically = (attributes & 0x80) > 0;
+        const bool frontOfBackground = (attributes & 0x20) == 0;
 
-            const size_t attributes = mOAM.readByte(spriteAddress + ii + 2);
-            const size_t paletteNumber = attributes & 0x03;
-            const bool flipHorizontally = (attributes & 0x40) > 0;
-            const bool flipVertically = (attributes & 0x80) > 0;
-            const bool frontOfBackground = (attributes & 0x20) == 0;
+        const size_t xPosition = oam[ii + 3];
 
-            const size_t xPosition = mOAM.readByte(spriteAddress + ii + 3);
+        const uint16_t tileRow = mVRAM.getTileRow(
+                address + (flipVertically ? renderLine :
+                                            (7 - renderLine)));
 
-            // Render this sprite into this line
-            for (size_t jj = 0; jj < 8; ++jj)
+        // Render this sprite into this line
+        for (size_t jj = 0; jj < 8; ++jj)
+        {
+            const size_t pixelPosition = xPosition +
+                    (flipHorizontally ? (7 - jj) : jj);
+
+            // Note that pixelPosition is unsigned. If it goes negative,
+            // it because max unsigned int.
+            if (pixelPosition > 255)
             {
-                const size_t pixelPosition = xPosition +
-                        (flipHorizontally ? (7 - jj) : jj);
+                continue;
+            }
+
+            const uint32_t pixel = extractPixel(
+                    tileRow,
+                    7 - jj,
+                    SPRITE_PALETTE_ADDRESS + (paletteNumber * 4),
+                    backgroundColor,
+                    paletteAddress);
 
-                // Note that pixelPosition is unsigned. If it goes negative,
-                // it because max unsigned int.
-                if (pixelPosition > 255)
+            if (paletteAddress != 0)
+            {
+                //! TODO: This actually needs to check if the pixel has
+                //        a palette of 0. There is the posibility that
+                //        a palette reuses the background color.
+                // Check for sprite hit 0
+                if (ii == 0 && buffer[pixelPosition] != backgroundColor)
                 {
-                    continue;
+                    mRegisters.getRegister(PPURegisters::PPUSTATUS)
+                            [PPURegisters::SPRITE_HIT_0] = true;
                 }
 
-                const uint32_t pixel = extractPixel(
-                        address + (flipVertically ? renderLine :
-                                                    (7 - renderLine)),
-                        7 - jj,
-                        SPRITE_PALETTE_ADDRESS + (paletteNumber * 4),
-                        backgroundColor,
-                        paletteAddress);
-
-                if (paletteAddress != 0)
+                if (frontOfBackground ||
+                    buffer[pixelPosition] == backgroundColor)
                 {
-                    //! TODO: This actually needs to check if the pixel has
-                    //        a palette of 0. There is the posibility that
-                    //        a palette reuses the background color.
-                    // Check for sprite hit 0
-                    if (ii == 0 && buffer[pixelPosition] != backgroundColor)
-                    {
-                        mRegisters.getRegister(PPURegisters::PPUSTATUS)
-                                [PPURegisters::SPRITE_HIT_0] = true;
-                    }
-
-                    if (frontOfBackground ||
-                        buffer[pixelPosition] == backgroundColor)
-                    {
-                        buffer[pixelPosition] = pixel;
-                    }
+                    buffer[pixelPosition] = pixel;
                 }
             }
         }
     }
 }
 
+/*****************************************************************************/
+void PPU::evaluateSprites()
+{
+    const uint8_t* const oam = mOAM.getReadBuffer();
+    std::fill_n(mSpriteCounts, SCREEN_HEIGHT, 0);
+
+    // A sprite is drawn on the eight lines after its y position.
+    for (size_t ii = 0; ii < NUM_SPRITES; ++ii)
+    {
+        const size_t top = oam[ii * BYTES_PER_SPRITE] + 1;
+        const size_t bottom = std::min(top + SPRITE_HEIGHT, SCREEN_HEIGHT);
+        for (size_t line = top; line < bottom; ++line)
+        {
+            mSpriteLines[line][mSpriteCounts[line]++] =
+                    static_cast<uint8_t>(ii);
+        }
+    }
+}
+
 /*****************************************************************************/
 void PPU::renderScanline(int16_t scanLine,
                          uint32_t* buffer)
@@ -295,24 +353,15 @@ void PPU::renderScanline(int16_t scanLine,
 }
 
 /*****************************************************************************/
-uint32_t PPU::extractPixel(uint32_t address,
+uint32_t PPU::extractPixel(uint16_t tileRow,
                            size_t bitPosition,
                            size_t palette,
                            uint32_t backgroundColor,
                            size_t& paletteAddress)
 {
-    //! TODO: Is there a reliable way to preprocess this
-    //        information? I need more information about CHR ROM
-    //        before I decide.If not is there a way to speed this
-    //        up and do an entire line at a time followed by
-    //        a memcpy?
-    const uint8_t val1 =
-            (mVRAM.readByte(address) >>
-                    (bitPosition)) & 0x01;
-    const uint8_t val2 =
-            ((mVRAM.readByte(address + 8) >>
-                    (bitPosition) & 0x01)) << 1;
-    paletteAddress = (val1 | val2);
+    // The CHR memory is decoded ahead of time by the TileCache, so both
+    // bit planes come out of the same row.
+    paletteAddress = (tileRow >> (bitPosition * 2)) & 0x03;
 
     if (paletteAddress == 0)
     {
@@ -321,5 +370,23 @@ uint32_t PPU::extractPixel(uint32_t address,
 
     return RGB_PALLETE[mVRAM.readByte(palette + paletteAddress)];
 }
+
+/*****************************************************************************/
+void PPU::saveState(StateWriter& state) const
+{
+    mRegisters.saveState(state);
+    state.writeBuffer(mOAM.getReadBuffer(), mOAM.getSize());
+    mVRAM.saveState(state);
+}
+
+/*****************************************************************************/
+void PPU::loadState(StateReader& state)
+{
+    mRegisters.loadState(state);
+    state.readBuffer(mOAM.getWriteBuffer(), mOAM.getSize());
+    evaluateSprites();
+    mVRAM.loadState(state);
+    mVRAM.refreshTiles();
+}
 }
 }
@@ -22,6 +22,7 @@
  * IN THE SOFTWARE.
  *****************************************************************************/
 #include <nes/PPURegisters.h>
+#include <algorithm>
 
 namespace nyra
 {
@@ -36,7 +37,7 @@ OamDma::OamDma(HiLowLatch& spriteRamAddress) :
 }
 
 /*****************************************************************************/
-PPURegisters::PPURegisters(MemoryMap& vram) :
+PPURegisters::PPURegisters(VRAM& vram) :
     Memory(8),
     mOamDma(mSpriteRamAddress),
     mVRAM(vram),
@@ -98,9 +99,16 @@ void PPURegisters::writeByte(size_t address, uint8_t value)
         mPPUAddress.set(value);
         break;
     case PPUDATA:
-        mVRAM.writeByte(mPPUAddress.get(), value);
+    {
+        const size_t ppuAddress = mPPUAddress.get();
+        mVRAM.writeByte(ppuAddress, value);
+        if (ppuAddress < VRAM::PATTERN_TABLE_END)
+        {
+            mVRAM.invalidateTile(ppuAddress);
+        }
         mPPUAddress.inc(mMemory[PPUCTRL][VRAM_INC ] ? 32 : 1);
         break;
+    }
     case PPUSCROLL:
         mScrollPosition.set(value);
         mMemory[address] = value;
@@ -112,5 +120,71 @@ void PPURegisters::writeByte(size_t address, uint8_t value)
         break;
     }
 }
+
+/*****************************************************************************/
+void PPURegisters::writeRepeated(size_t address,
+                                 uint8_t value,
+                                 size_t count)
+{
+    if (address != PPUDATA)
+    {
+        Memory::writeRepeated(address, value, count);
+        return;
+    }
+
+    if (mMemory[PPUCTRL][VRAM_INC])
+    {
+        for (size_t ii = 0; ii < count; ++ii)
+        {
+            const size_t ppuAddress = mPPUAddress.get();
+            mVRAM.writeByte(ppuAddress, value);
+            if (ppuAddress < VRAM::PATTERN_TABLE_END)
+            {
+                mVRAM.invalidateTile(ppuAddress);
+            }
+            mPPUAddress.inc(32);
+        }
+        return;
+    }
+
+    // Stepping by one is a single run, split where the address wraps.
+    while (count)
+    {
+        const size_t ppuAddress = mPPUAddress.get();
+        const size_t size = std::min(count, PPU_ADDRESS_SIZE - ppuAddress);
+        mVRAM.fillBytes(ppuAddress, value, size);
+        mVRAM.invalidateTiles(ppuAddress, size);
+        mPPUAddress.inc(static_cast<uint16_t>(size));
+        count -= size;
+    }
+}
+
+/*****************************************************************************/
+void PPURegisters::saveState(StateWriter& state) const
+{
+    for (size_t ii = 0; ii < MAX_REGISTER; ++ii)
+    {
+        state.writeFlags(mMemory[ii]);
+    }
+    mSpriteRamAddress.saveState(state);
+    mPPUAddress.saveState(state);
+    mScrollPosition.saveState(state);
+    mOamDma.saveState(state);
+    state.write(mByteBuffer);
+}
+
+/*****************************************************************************/
+void PPURegisters::loadState(StateReader& state)
+{
+    for (size_t ii = 0; ii < MAX_REGISTER; ++ii)
+    {
+        state.readFlags(mMemory[ii]);
+    }
+    mSpriteRamAddress.loadState(state);
+    mPPUAddress.loadState(state);
+    mScrollPosition.loadState(state);
+    mOamDma.loadState(state);
+    state.read(mByteBuffer);
+}
 }
 }
@@ -0,0 +1,136 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/ROMImage.h>
+#include <nes/TileCache.h>
+#include <cstring>
+#include <map>
+
+namespace
+{
+/*****************************************************************************/
+typedef std::weak_ptr<const nyra::nes::ROMImage> ImageHandle;
+
+/*****************************************************************************/
+// Every cached image by the hash of its contents.
+std::map<uint64_t, ImageHandle>& getImages()
+{
+    static std::map<uint64_t, ImageHandle> images;
+    return images;
+}
+
+/*****************************************************************************/
+std::mutex& getImagesMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+ROMImage::ROMImage(std::unique_ptr<const MappedFile> file,
+                   const uint8_t* data,
+                   size_t size,
+                   uint64_t hash) :
+    mFile(std::move(file)),
+    mData(data),
+    mSize(size),
+    mHash(hash)
+{
+}
+
+/*****************************************************************************/
+std::shared_ptr<const ROMImage> ROMImage::load(const std::string& pathname)
+{
+    std::unique_ptr<const MappedFile> file(new MappedFile(pathname));
+    const uint8_t* const data = file->getData();
+    const size_t size = file->getSize();
+    return insert(std::move(file), data, size);
+}
+
+/*****************************************************************************/
+std::shared_ptr<const ROMImage> ROMImage::share(const uint8_t* buffer,
+                                                size_t size)
+{
+    return insert(std::unique_ptr<const MappedFile>(), buffer, size);
+}
+
+/*****************************************************************************/
+std::shared_ptr<const ROMImage> ROMImage::insert(
+        std::unique_ptr<const MappedFile> file,
+        const uint8_t* data,
+        size_t size)
+{
+    const uint64_t key = hash(data, size);
+
+    std::lock_guard<std::mutex> lock(getImagesMutex());
+    ImageHandle& handle = getImages()[key];
+    std::shared_ptr<const ROMImage> image = handle.lock();
+
+    // The contents are compared as well so a hash collision cannot hand
+    // out the wrong game. The losing image is simply not cached.
+    if (image && image->mSize == size &&
+        (size == 0 || std::memcmp(image->mData, data, size) == 0))
+    {
+        return image;
+    }
+
+    const bool cache = file && !image;
+    image.reset(new ROMImage(std::move(file), data, size, key));
+    if (cache)
+    {
+        handle = image;
+    }
+    return image;
+}
+
+/*****************************************************************************/
+uint64_t ROMImage::hash(const uint8_t* buffer,
+                        size_t size)
+{
+    static const uint64_t FNV_OFFSET = 0xCBF29CE484222325ULL;
+    static const uint64_t FNV_PRIME = 0x100000001B3ULL;
+
+    uint64_t ret = FNV_OFFSET;
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        ret = (ret ^ buffer[ii]) * FNV_PRIME;
+    }
+    return ret;
+}
+
+/*****************************************************************************/
+const uint16_t* ROMImage::getTileRows(const ROMBanks& chrBanks) const
+{
+    std::call_once(mTilesDecoded, [this, &chrBanks]()
+    {
+        mTileRows = TileCache::decode(chrBanks);
+    });
+    return mTileRows.empty() ? nullptr : &mTileRows[0];
+}
+}
+}
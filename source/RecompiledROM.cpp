@@ -0,0 +1,244 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/RecompiledROM.h>
+#include <nes/Recompiled6502.hpp>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <dlfcn.h>
+#define NYRA_NES_AOT
+#endif
+
+#define NYRA_NES_STRINGIFY(x) NYRA_NES_STRINGIFY_VALUE(x)
+#define NYRA_NES_STRINGIFY_VALUE(x) #x
+
+namespace
+{
+/*****************************************************************************/
+static const char* const MODULE_SYMBOL =
+        NYRA_NES_STRINGIFY(NYRA_NES_RECOMPILED_SYMBOL);
+static const char* const SEARCH_PATH = "NYRA_NES_AOT_PATH";
+static const char SEARCH_PATH_SEPARATOR = ':';
+#ifdef __APPLE__
+static const std::string MODULE_SUFFIX = ".dylib";
+#else
+static const std::string MODULE_SUFFIX = ".so";
+#endif
+
+/*****************************************************************************/
+typedef std::weak_ptr<const nyra::nes::RecompiledROM> ModuleHandle;
+
+/*****************************************************************************/
+// Every loaded module by pathname, so emulators running the same game
+// share one copy.
+std::map<std::string, ModuleHandle>& getLoaded()
+{
+    static std::map<std::string, ModuleHandle> loaded;
+    return loaded;
+}
+
+/*****************************************************************************/
+// The modules found on the search path by ROM hash.
+std::map<uint64_t, ModuleHandle>& getFound()
+{
+    static std::map<uint64_t, ModuleHandle> found;
+    return found;
+}
+
+/*****************************************************************************/
+std::mutex& getRegistryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*****************************************************************************/
+bool hasSuffix(const std::string& name, const std::string& suffix)
+{
+    return name.size() > suffix.size() &&
+            name.compare(name.size() - suffix.size(),
+                         suffix.size(), suffix) == 0;
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+const uint16_t RecompiledROM::NO_BLOCK;
+
+/*****************************************************************************/
+RecompiledROM::RecompiledROM(const std::string& pathname,
+                             uint64_t romHash) :
+    mHandle(nullptr),
+    mHash(romHash),
+    mIndex(0x10000, NO_BLOCK)
+{
+#ifdef NYRA_NES_AOT
+    mHandle = dlopen(pathname.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!mHandle)
+    {
+        throw std::runtime_error("Failed to load recompiled ROM: " +
+                                 pathname);
+    }
+
+    const RecompiledModule* module = static_cast<const RecompiledModule*>(
+            dlsym(mHandle, MODULE_SYMBOL));
+    std::string error;
+    if (!module)
+    {
+        error = "Not a recompiled ROM: ";
+    }
+    else if (module->abiVersion != RECOMPILED_ABI_VERSION)
+    {
+        error = "Recompiled ROM was built for another version: ";
+    }
+    else if (module->romHash != romHash)
+    {
+        error = "Recompiled ROM was built for another ROM: ";
+    }
+    else if (module->numBlocks >= NO_BLOCK)
+    {
+        error = "Recompiled ROM has too many blocks: ";
+    }
+    if (!error.empty())
+    {
+        dlclose(mHandle);
+        throw std::runtime_error(error + pathname);
+    }
+
+    mBlocks.resize(module->numBlocks);
+    for (size_t ii = 0; ii < module->numBlocks; ++ii)
+    {
+        const RecompiledBlock& block = module->blocks[ii];
+        mBlocks[ii].function = block.function;
+        mBlocks[ii].size = block.size;
+        mBlocks[ii].budget = block.budget;
+        mBlocks[ii].layout = NativeBlock::ANY_LAYOUT;
+        mIndex[block.address] = static_cast<uint16_t>(ii);
+    }
+#else
+    throw std::runtime_error(
+            "Recompiled ROMs are not supported on this host");
+#endif
+}
+
+/*****************************************************************************/
+RecompiledROM::~RecompiledROM()
+{
+#ifdef NYRA_NES_AOT
+    dlclose(mHandle);
+#endif
+}
+
+/*****************************************************************************/
+std::shared_ptr<const RecompiledROM> RecompiledROM::load(
+        const std::string& pathname,
+        uint64_t romHash)
+{
+    std::lock_guard<std::mutex> lock(getRegistryMutex());
+    ModuleHandle& entry = getLoaded()[pathname];
+    std::shared_ptr<const RecompiledROM> ret = entry.lock();
+    if (!ret)
+    {
+        ret.reset(new RecompiledROM(pathname, romHash));
+        entry = ret;
+    }
+    else if (ret->mHash != romHash)
+    {
+        throw std::runtime_error(
+                "Recompiled ROM was built for another ROM: " + pathname);
+    }
+    return ret;
+}
+
+/*****************************************************************************/
+std::shared_ptr<const RecompiledROM> RecompiledROM::find(uint64_t romHash)
+{
+    {
+        std::lock_guard<std::mutex> lock(getRegistryMutex());
+        std::shared_ptr<const RecompiledROM> ret = getFound()[romHash].lock();
+        if (ret)
+        {
+            return ret;
+        }
+    }
+
+#ifdef NYRA_NES_AOT
+    const char* searchPath = std::getenv(SEARCH_PATH);
+    if (!searchPath)
+    {
+        return nullptr;
+    }
+
+    std::istringstream directories(searchPath);
+    std::string directory;
+    std::shared_ptr<const RecompiledROM> ret;
+    while (!ret &&
+           std::getline(directories, directory, SEARCH_PATH_SEPARATOR))
+    {
+        DIR* dir = directory.empty() ? nullptr : opendir(directory.c_str());
+        if (!dir)
+        {
+            continue;
+        }
+
+        for (dirent* entry = readdir(dir); entry && !ret;
+             entry = readdir(dir))
+        {
+            const std::string name(entry->d_name);
+            if (!hasSuffix(name, MODULE_SUFFIX))
+            {
+                continue;
+            }
+            try
+            {
+                ret = load(directory + "/" + name, romHash);
+            }
+            catch (const std::runtime_error&)
+            {
+                // Modules for other games are expected here.
+            }
+        }
+        closedir(dir);
+    }
+
+    if (ret)
+    {
+        std::lock_guard<std::mutex> lock(getRegistryMutex());
+        getFound()[romHash] = ret;
+    }
+    return ret;
+#else
+    return nullptr;
+#endif
+}
+}
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/Scheduler.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+const uint64_t Scheduler::NEVER;
+
+/*****************************************************************************/
+Scheduler::Scheduler() :
+    mNext(static_cast<Event>(0))
+{
+    for (size_t ii = 0; ii < NUM_EVENTS; ++ii)
+    {
+        mTimes[ii] = NEVER;
+    }
+}
+
+/*****************************************************************************/
+void Scheduler::saveState(StateWriter& state) const
+{
+    for (size_t ii = 0; ii < NUM_EVENTS; ++ii)
+    {
+        state.write(mTimes[ii]);
+    }
+}
+
+/*****************************************************************************/
+void Scheduler::loadState(StateReader& state)
+{
+    for (size_t ii = 0; ii < NUM_EVENTS; ++ii)
+    {
+        state.read(mTimes[ii]);
+    }
+    update();
+}
+}
+}
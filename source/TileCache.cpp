@@ -0,0 +1,162 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/TileCache.h>
+
+namespace
+{
+/*****************************************************************************/
+static const size_t BYTES_PER_TILE = 16;
+static const size_t ROWS_PER_TILE = 8;
+
+/*****************************************************************************/
+uint16_t spreadBits(uint8_t value)
+{
+    // Move bit n to bit 2n
+    uint16_t ret = value;
+    ret = (ret | (ret << 4)) & 0x0F0F;
+    ret = (ret | (ret << 2)) & 0x3333;
+    ret = (ret | (ret << 1)) & 0x5555;
+    return ret;
+}
+
+/*****************************************************************************/
+size_t getNumRows(const nyra::nes::ROM& bank)
+{
+    return bank.getSize() / BYTES_PER_TILE * ROWS_PER_TILE;
+}
+
+/*****************************************************************************/
+void decodeRows(const nyra::nes::ROM& bank,
+                uint16_t* rows)
+{
+    const uint8_t* const buffer = bank.getReadBuffer();
+    const size_t numTiles = bank.getSize() / BYTES_PER_TILE;
+    for (size_t tile = 0; tile < numTiles; ++tile)
+    {
+        const uint8_t* const planes = buffer + (tile * BYTES_PER_TILE);
+        for (size_t row = 0; row < ROWS_PER_TILE; ++row)
+        {
+            rows[(tile * ROWS_PER_TILE) + row] =
+                    nyra::nes::TileCache::decodeRow(
+                            planes[row], planes[row + ROWS_PER_TILE]);
+        }
+    }
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+TileCache::TileCache(const ROMBanks& chrBanks,
+                     const uint16_t* sharedRows) :
+    mBanks(chrBanks.size()),
+    mBankRows(chrBanks.size()),
+    mBankOffsets(chrBanks.size())
+{
+    // Only the banks that are not shared take up room here.
+    size_t offset = 0;
+    for (size_t ii = 0; ii < chrBanks.size(); ++ii)
+    {
+        mBanks[ii] = chrBanks[ii].get();
+        mBankOffsets[ii] = offset;
+        if (!sharedRows || mBanks[ii]->getWriteBuffer())
+        {
+            offset += getNumRows(*mBanks[ii]);
+        }
+    }
+    mRows.resize(offset);
+
+    size_t shared = 0;
+    for (size_t ii = 0; ii < mBanks.size(); ++ii)
+    {
+        if (!sharedRows || mBanks[ii]->getWriteBuffer())
+        {
+            mBankRows[ii] = mRows.data() + mBankOffsets[ii];
+            decodeBank(ii);
+        }
+        else
+        {
+            mBankRows[ii] = sharedRows + shared;
+        }
+        shared += getNumRows(*mBanks[ii]);
+    }
+}
+
+/*****************************************************************************/
+std::vector<uint16_t> TileCache::decode(const ROMBanks& chrBanks)
+{
+    size_t size = 0;
+    for (size_t ii = 0; ii < chrBanks.size(); ++ii)
+    {
+        size += getNumRows(*chrBanks[ii]);
+    }
+
+    std::vector<uint16_t> ret(size);
+    size_t offset = 0;
+    for (size_t ii = 0; ii < chrBanks.size(); ++ii)
+    {
+        decodeRows(*chrBanks[ii], ret.data() + offset);
+        offset += getNumRows(*chrBanks[ii]);
+    }
+    return ret;
+}
+
+/*****************************************************************************/
+uint16_t TileCache::decodeRow(uint8_t low,
+                              uint8_t high)
+{
+    return spreadBits(low) | (spreadBits(high) << 1);
+}
+
+/*****************************************************************************/
+void TileCache::decodeBank(size_t bank)
+{
+    decodeRows(*mBanks[bank], mRows.data() + mBankOffsets[bank]);
+}
+
+/*****************************************************************************/
+void TileCache::invalidate(size_t bank,
+                           size_t address)
+{
+    const uint8_t* const buffer = mBanks[bank]->getReadBuffer();
+    const size_t low = address & ~static_cast<size_t>(ROWS_PER_TILE);
+    mRows[mBankOffsets[bank] + getRowIndex(address)] =
+            decodeRow(buffer[low], buffer[low + ROWS_PER_TILE]);
+}
+
+/*****************************************************************************/
+void TileCache::refresh()
+{
+    for (size_t ii = 0; ii < mBanks.size(); ++ii)
+    {
+        if (mBanks[ii]->getWriteBuffer())
+        {
+            decodeBank(ii);
+        }
+    }
+}
+}
+}
@@ -0,0 +1,479 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/Trace.h>
+#include <nes/OpCode.h>
+#include <stdexcept>
+#include <cstdio>
+
+namespace
+{
+/*****************************************************************************/
+static const uint32_t TRACE_MAGIC = 0x5254594E;
+static const uint32_t TRACE_VERSION = 1;
+
+/*****************************************************************************/
+// How the Nintendulator format shows the operands of an instruction.
+enum TraceMode
+{
+    TRACE_IMPLIED,
+    TRACE_ACCUMULATOR,
+    TRACE_IMMEDIATE,
+    TRACE_ZERO_PAGE,
+    TRACE_ZERO_PAGE_X,
+    TRACE_ZERO_PAGE_Y,
+    TRACE_ABSOLUTE,
+    TRACE_ABSOLUTE_X,
+    TRACE_ABSOLUTE_Y,
+    TRACE_INDIRECT,
+    TRACE_INDIRECT_X,
+    TRACE_INDIRECT_Y,
+    TRACE_RELATIVE,
+    TRACE_JUMP
+};
+
+/*****************************************************************************/
+// Official opcodes are laid out as aaabbbcc, where bbb picks the address
+// mode within each cc group. The exceptions are picked off first.
+TraceMode getTraceMode(uint8_t opcode)
+{
+    switch (opcode)
+    {
+    case 0x20:
+    case 0x4C:
+        return TRACE_JUMP;
+    case 0x6C:
+        return TRACE_INDIRECT;
+    case 0x0A:
+    case 0x2A:
+    case 0x4A:
+    case 0x6A:
+        return TRACE_ACCUMULATOR;
+    case 0xA0:
+    case 0xA2:
+    case 0xC0:
+    case 0xE0:
+        return TRACE_IMMEDIATE;
+    case 0x96:
+    case 0xB6:
+        return TRACE_ZERO_PAGE_Y;
+    case 0xBE:
+        return TRACE_ABSOLUTE_Y;
+    default:
+        break;
+    }
+
+    if ((opcode & 0x1F) == 0x10)
+    {
+        return TRACE_RELATIVE;
+    }
+
+    static const TraceMode GROUP_ONE[] =
+    {
+        TRACE_INDIRECT_X, TRACE_ZERO_PAGE, TRACE_IMMEDIATE, TRACE_ABSOLUTE,
+        TRACE_INDIRECT_Y, TRACE_ZERO_PAGE_X, TRACE_ABSOLUTE_Y,
+        TRACE_ABSOLUTE_X
+    };
+    static const TraceMode GROUP_OTHER[] =
+    {
+        TRACE_IMPLIED, TRACE_ZERO_PAGE, TRACE_IMPLIED, TRACE_ABSOLUTE,
+        TRACE_IMPLIED, TRACE_ZERO_PAGE_X, TRACE_IMPLIED, TRACE_ABSOLUTE_X
+    };
+
+    const size_t mode = (opcode >> 2) & 0x07;
+    switch (opcode & 0x03)
+    {
+    case 0x01:
+        return GROUP_ONE[mode];
+    case 0x00:
+    case 0x02:
+        return GROUP_OTHER[mode];
+    default:
+        return TRACE_IMPLIED;
+    }
+}
+
+/*****************************************************************************/
+size_t getLength(TraceMode mode)
+{
+    switch (mode)
+    {
+    case TRACE_IMPLIED:
+    case TRACE_ACCUMULATOR:
+        return 1;
+    case TRACE_ABSOLUTE:
+    case TRACE_ABSOLUTE_X:
+    case TRACE_ABSOLUTE_Y:
+    case TRACE_INDIRECT:
+    case TRACE_JUMP:
+        return 3;
+    default:
+        return 2;
+    }
+}
+
+/*****************************************************************************/
+std::vector<std::string> createNames()
+{
+    std::vector<std::string> names;
+    for (size_t ii = 0; ii < 256; ++ii)
+    {
+        names.push_back(nyra::nes::OP_CODE_INFO[ii].name);
+    }
+    return names;
+}
+
+/*****************************************************************************/
+const std::vector<std::string>& getNames()
+{
+    static const std::vector<std::string> names = createNames();
+    return names;
+}
+
+/*****************************************************************************/
+void writeHeader(std::ostream& stream)
+{
+    const uint32_t header[] =
+    {
+        TRACE_MAGIC,
+        TRACE_VERSION,
+        static_cast<uint32_t>(sizeof(nyra::nes::TraceRecord))
+    };
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+}
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+TraceBuffer::TraceBuffer(size_t capacity) :
+    mRecords(capacity),
+    mNext(0),
+    mFlushed(0),
+    mTotal(0)
+{
+    if (capacity == 0)
+    {
+        throw std::runtime_error("Trace buffer must hold at least one record");
+    }
+}
+
+/*****************************************************************************/
+TraceBuffer::~TraceBuffer()
+{
+    try
+    {
+        closeStream();
+    }
+    catch (...)
+    {
+    }
+}
+
+/*****************************************************************************/
+const TraceRecord& TraceBuffer::get(size_t index) const
+{
+    if (index >= getSize())
+    {
+        throw std::runtime_error("Trace record index out of range");
+    }
+    const size_t oldest = mTotal > mRecords.size() ? mNext : 0;
+    return mRecords[(oldest + index) % mRecords.size()];
+}
+
+/*****************************************************************************/
+void TraceBuffer::clear()
+{
+    flush();
+    mNext = 0;
+    mFlushed = 0;
+    mTotal = 0;
+}
+
+/*****************************************************************************/
+void TraceBuffer::openStream(const std::string& pathname)
+{
+    closeStream();
+    mStream.reset(new std::ofstream(pathname, std::ios::binary));
+    if (!mStream->good())
+    {
+        mStream.reset();
+        throw std::runtime_error("Failed to open file: " + pathname);
+    }
+    writeHeader(*mStream);
+    mFlushed = mNext;
+}
+
+/*****************************************************************************/
+void TraceBuffer::closeStream()
+{
+    flush();
+    mStream.reset();
+}
+
+/*****************************************************************************/
+void TraceBuffer::flush()
+{
+    if (mStream)
+    {
+        write(mFlushed, mNext);
+        mStream->flush();
+    }
+    mFlushed = mNext;
+}
+
+/*****************************************************************************/
+void TraceBuffer::save(const std::string& pathname) const
+{
+    std::ofstream stream(pathname, std::ios::binary);
+    if (!stream.good())
+    {
+        throw std::runtime_error("Failed to open file: " + pathname);
+    }
+    writeHeader(stream);
+
+    const char* records = reinterpret_cast<const char*>(&mRecords[0]);
+    if (mTotal > mRecords.size())
+    {
+        stream.write(records + mNext * sizeof(TraceRecord),
+                     (mRecords.size() - mNext) * sizeof(TraceRecord));
+    }
+    stream.write(records, mNext * sizeof(TraceRecord));
+}
+
+/*****************************************************************************/
+std::vector<TraceRecord> TraceBuffer::load(const std::string& pathname)
+{
+    std::ifstream stream(pathname, std::ios::binary | std::ios::ate);
+    if (!stream.good())
+    {
+        throw std::runtime_error("Failed to open file: " + pathname);
+    }
+    const size_t size = static_cast<size_t>(stream.tellg());
+    stream.seekg(0);
+
+    uint32_t header[3] = {0, 0, 0};
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!stream.good() || header[0] != TRACE_MAGIC)
+    {
+        throw std::runtime_error("File is not a trace: " + pathname);
+    }
+    if (header[1] != TRACE_VERSION || header[2] != sizeof(TraceRecord))
+    {
+        throw std::runtime_error("Unsupported trace version: " + pathname);
+    }
+
+    std::vector<TraceRecord> ret(
+            (size - sizeof(header)) / sizeof(TraceRecord));
+    if (!ret.empty())
+    {
+        stream.read(reinterpret_cast<char*>(&ret[0]),
+                    ret.size() * sizeof(TraceRecord));
+    }
+    return ret;
+}
+
+/*****************************************************************************/
+void TraceBuffer::resolve(TraceRecord& record,
+                          const MemoryMap& memory) const
+{
+    const uint16_t darg = (record.arg2 << 8) | record.arg1;
+    bool hasValue = true;
+    uint16_t address = 0;
+    switch (getTraceMode(record.opcode))
+    {
+    case TRACE_ZERO_PAGE:
+        address = record.arg1;
+        break;
+    case TRACE_ZERO_PAGE_X:
+        address = (record.arg1 + record.xIndex) & 0xFF;
+        break;
+    case TRACE_ZERO_PAGE_Y:
+        address = (record.arg1 + record.yIndex) & 0xFF;
+        break;
+    case TRACE_ABSOLUTE:
+        address = darg;
+        break;
+    case TRACE_ABSOLUTE_X:
+        address = darg + record.xIndex;
+        break;
+    case TRACE_ABSOLUTE_Y:
+        address = darg + record.yIndex;
+        break;
+    case TRACE_INDIRECT_X:
+    {
+        const uint8_t pointer = record.arg1 + record.xIndex;
+        address = memory.peekByte(pointer) |
+                  (memory.peekByte((pointer + 1) & 0xFF) << 8);
+        break;
+    }
+    case TRACE_INDIRECT_Y:
+        address = (memory.peekByte(record.arg1) |
+                   (memory.peekByte((record.arg1 + 1) & 0xFF) << 8)) +
+                  record.yIndex;
+        break;
+    case TRACE_INDIRECT:
+        // Nintendulator shows the pointer as read without the page
+        // wrap bug, the same as the OpCode disassembly did.
+        address = memory.peekByte(darg) |
+                  (memory.peekByte((darg + 1) & 0xFFFF) << 8);
+        hasValue = false;
+        break;
+    case TRACE_RELATIVE:
+        address = record.programCounter + 2 +
+                  static_cast<int8_t>(record.arg1);
+        hasValue = false;
+        break;
+    case TRACE_JUMP:
+        address = darg;
+        hasValue = false;
+        break;
+    default:
+        hasValue = false;
+        break;
+    }
+    record.address = address;
+
+    // Registers show up as 0xFF the way Nintendulator shows them.
+    record.value = hasValue ? memory.peekByte(address) : 0;
+}
+
+/*****************************************************************************/
+void TraceBuffer::wrap()
+{
+    if (mStream)
+    {
+        write(mFlushed, mRecords.size());
+    }
+    mNext = 0;
+    mFlushed = 0;
+}
+
+/*****************************************************************************/
+void TraceBuffer::write(size_t begin, size_t end)
+{
+    if (end > begin)
+    {
+        mStream->write(reinterpret_cast<const char*>(&mRecords[begin]),
+                       (end - begin) * sizeof(TraceRecord));
+    }
+}
+
+/*****************************************************************************/
+std::string toNintendulator(const TraceRecord& record)
+{
+    const TraceMode mode = getTraceMode(record.opcode);
+    const uint16_t darg = (record.arg2 << 8) | record.arg1;
+    const uint16_t pointer = record.address - record.yIndex;
+    char operands[32] = "";
+    switch (mode)
+    {
+    case TRACE_ACCUMULATOR:
+        snprintf(operands, sizeof(operands), "A");
+        break;
+    case TRACE_IMMEDIATE:
+        snprintf(operands, sizeof(operands), "#$%02X", record.arg1);
+        break;
+    case TRACE_ZERO_PAGE:
+        snprintf(operands, sizeof(operands), "$%02X = %02X",
+                 record.arg1, record.value);
+        break;
+    case TRACE_ZERO_PAGE_X:
+    case TRACE_ZERO_PAGE_Y:
+        snprintf(operands, sizeof(operands), "$%02X,%c @ %02X = %02X",
+                 record.arg1, mode == TRACE_ZERO_PAGE_X ? 'X' : 'Y',
+                 record.address, record.value);
+        break;
+    case TRACE_ABSOLUTE:
+        snprintf(operands, sizeof(operands), "$%04X = %02X",
+                 darg, record.value);
+        break;
+    case TRACE_ABSOLUTE_X:
+    case TRACE_ABSOLUTE_Y:
+        snprintf(operands, sizeof(operands), "$%04X,%c @ %04X = %02X",
+                 darg, mode == TRACE_ABSOLUTE_X ? 'X' : 'Y',
+                 record.address, record.value);
+        break;
+    case TRACE_INDIRECT:
+        snprintf(operands, sizeof(operands), "($%04X) = %04X",
+                 darg, record.address);
+        break;
+    case TRACE_INDIRECT_X:
+        snprintf(operands, sizeof(operands), "($%02X,X) @ %02X = %04X = %02X",
+                 record.arg1, (record.arg1 + record.xIndex) & 0xFF,
+                 record.address, record.value);
+        break;
+    case TRACE_INDIRECT_Y:
+        snprintf(operands, sizeof(operands), "($%02X),Y = %04X @ %04X = %02X",
+                 record.arg1, pointer, record.address, record.value);
+        break;
+    case TRACE_RELATIVE:
+    case TRACE_JUMP:
+        snprintf(operands, sizeof(operands), "$%04X", record.address);
+        break;
+    default:
+        break;
+    }
+
+    char bytes[16];
+    switch (getLength(mode))
+    {
+    case 1:
+        snprintf(bytes, sizeof(bytes), "%02X", record.opcode);
+        break;
+    case 2:
+        snprintf(bytes, sizeof(bytes), "%02X %02X",
+                 record.opcode, record.arg1);
+        break;
+    default:
+        snprintf(bytes, sizeof(bytes), "%02X %02X %02X",
+                 record.opcode, record.arg1, record.arg2);
+        break;
+    }
+
+    const std::string instruction =
+            getNames()[record.opcode] + " " + operands;
+    char line[128];
+    snprintf(line, sizeof(line),
+             "%04X  %-9s %-32sA:%02X X:%02X Y:%02X P:%02X SP:%02X "
+             "CYC:%3d SL:%d",
+             record.programCounter, bytes, instruction.c_str(),
+             record.accumulator, record.xIndex, record.yIndex,
+             record.status, record.stackPointer,
+             record.cycles, record.scanLine);
+    return line;
+}
+
+/*****************************************************************************/
+void decodeTrace(const std::string& pathname, std::ostream& stream)
+{
+    const std::vector<TraceRecord> records = TraceBuffer::load(pathname);
+    for (size_t ii = 0; ii < records.size(); ++ii)
+    {
+        stream << toNintendulator(records[ii]) << "\n";
+    }
+}
+}
+}
@@ -23,40 +23,74 @@
  *****************************************************************************/
 #include <nes/VRAM.h>
 
+namespace
+{
+/*****************************************************************************/
+static const size_t CHR_RAM_BANKS = 2;
+static const size_t CHR_BANK_SIZE = 0x1000;
+
+/*****************************************************************************/
+// Which of the two nametables is seen at each of the four addresses.
+static const size_t NAMETABLE_LAYOUT[4][4] =
+{
+    {0, 0, 1, 1},   // HORIZONTAL
+    {0, 1, 0, 1},   // VERTICAL
+    {0, 0, 0, 0},   // SINGLE_SCREEN_LOWER
+    {1, 1, 1, 1}    // SINGLE_SCREEN_UPPER
+};
+
+/*****************************************************************************/
+nyra::nes::ROMBanks createChrRAM(const nyra::nes::ROMBanks& chrROM)
+{
+    // Cartridges without CHR ROM have 8KB of CHR RAM instead.
+    nyra::nes::ROMBanks ret;
+    if (chrROM.empty())
+    {
+        for (size_t ii = 0; ii < CHR_RAM_BANKS; ++ii)
+        {
+            ret.emplace_back(new nyra::nes::RAM(CHR_BANK_SIZE));
+        }
+    }
+    return ret;
+}
+}
+
 namespace nyra
 {
 namespace nes
 {
 /*****************************************************************************/
 VRAM::VRAM(const ROMBanks& chrROM,
-           Mirroring mirroring) :
+           Mirroring mirroring,
+           const uint16_t* chrTiles) :
     MemoryMap(),
+    mChrRAM(createChrRAM(chrROM)),
+    mChrBanks(chrROM.empty() ? mChrRAM : chrROM),
+    mTileCache(mChrBanks, chrTiles),
+    mMirroring(mirroring),
     mNametables(2),
     mUniversalBackgroundColor(4),
     mPalettes(8),
     mFill(0x0F00)
 {
-    setMemoryBank(0x0000, *chrROM[0]);
-    setMemoryBank(0x1000, *chrROM[1]);
+    setMemoryBank(0x0000, *mChrBanks[0]);
+    setMemoryBank(0x1000, *mChrBanks[1]);
+
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        mPatternBanks[ii] = ii;
+        mPatternTables[ii] = mTileCache.getRows(ii);
+    }
 
     mNametables[0].reset(new RAM(0x400));
     mNametables[1].reset(new RAM(0x400));
 
-    if (mirroring == HORIZONTAL)
-    {
-        setMemoryBank(0x2000, *mNametables[0]);
-        setMemoryBank(0x2400, *mNametables[0]);
-        setMemoryBank(0x2800, *mNametables[1]);
-        setMemoryBank(0x2C00, *mNametables[1]);
-    }
-    else if (mirroring == VERTICAL)
+    for (size_t ii = 0; ii < 4; ++ii)
     {
-        setMemoryBank(0x2000, *mNametables[0]);
-        setMemoryBank(0x2400, *mNametables[1]);
-        setMemoryBank(0x2800, *mNametables[0]);
-        setMemoryBank(0x2C00, *mNametables[1]);
+        setMemoryBank(NAMETABLE_START + ii * NAMETABLE_SIZE,
+                      *mNametables[NAMETABLE_LAYOUT[mirroring][ii]]);
     }
-    // TODO: Implement single screen and four screen
+    // TODO: Implement four screen
 
     // TODO: This should actually be a mirror of $2000 - $2EFF
     setMemoryBank(0x3000, mFill);
@@ -79,5 +113,50 @@ VRAM::VRAM(const ROMBanks& chrROM,
 
     lockLookUpTable();
 }
+
+/*****************************************************************************/
+void VRAM::switchPatternTable(size_t table,
+                              size_t bank)
+{
+    if (mPatternBanks[table] == bank)
+    {
+        return;
+    }
+    mPatternBanks[table] = bank;
+    mPatternTables[table] = mTileCache.getRows(bank);
+    switchBank(table * CHR_BANK_SIZE, *mChrBanks[bank]);
+}
+
+/*****************************************************************************/
+void VRAM::invalidateTiles(size_t address,
+                           size_t count)
+{
+    // A row is decoded from both bit planes. The high plane only needs it
+    // when the low plane was not part of the run.
+    const size_t end = address + count < PATTERN_TABLE_END ?
+            address + count : PATTERN_TABLE_END;
+    for (size_t ii = address; ii < end; ++ii)
+    {
+        if (!(ii & BIT_PLANE_OFFSET) || ii - BIT_PLANE_OFFSET < address)
+        {
+            invalidateTile(ii);
+        }
+    }
+}
+
+/*****************************************************************************/
+void VRAM::setMirroring(Mirroring mirroring)
+{
+    if (mMirroring == mirroring)
+    {
+        return;
+    }
+    mMirroring = mirroring;
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        switchBank(NAMETABLE_START + ii * NAMETABLE_SIZE,
+                   *mNametables[NAMETABLE_LAYOUT[mirroring][ii]]);
+    }
+}
 }
 }
@@ -0,0 +1,299 @@
+/******************************************************************************
+ * The MIT License(MIT)
+ *
+ * Copyright(c) 2015 Clyde Stanfield
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions :
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *****************************************************************************/
+#include <nes/X64Emitter.h>
+
+namespace nyra
+{
+namespace nes
+{
+/*****************************************************************************/
+void X64Emitter::rex(bool wide, int reg, int index, int base, bool byteReg)
+{
+    // spl, bpl, sil and dil can only be reached through a REX prefix.
+    const uint8_t prefix = 0x40 | (wide << 3) |
+            (((reg >> 3) & 1) << 2) |
+            (((index >> 3) & 1) << 1) |
+            ((base >> 3) & 1);
+    if (prefix != 0x40 || byteReg)
+    {
+        mCode.push_back(prefix);
+    }
+}
+
+/*****************************************************************************/
+void X64Emitter::modRM(int reg, int rm)
+{
+    mCode.push_back(0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+/*****************************************************************************/
+void X64Emitter::modRM(int reg,
+                       Register base,
+                       Register index,
+                       int32_t disp,
+                       uint8_t shift)
+{
+    if (index == NONE && (base & 7) != RSP)
+    {
+        mCode.push_back(0x80 | ((reg & 7) << 3) | (base & 7));
+    }
+    else
+    {
+        // An index of RSP means no index
+        const int sibIndex = (index == NONE) ? RSP : index;
+        mCode.push_back(0x80 | ((reg & 7) << 3) | RSP);
+        mCode.push_back((shift << 6) | ((sibIndex & 7) << 3) | (base & 7));
+    }
+    emit32(static_cast<uint32_t>(disp));
+}
+
+/*****************************************************************************/
+void X64Emitter::emit32(uint32_t value)
+{
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        mCode.push_back((value >> (ii * 8)) & 0xFF);
+    }
+}
+
+/*****************************************************************************/
+void X64Emitter::movReg(Register dst, Register src)
+{
+    rex(false, src, 0, dst, false);
+    mCode.push_back(0x89);
+    modRM(src, dst);
+}
+
+/*****************************************************************************/
+void X64Emitter::movReg64(Register dst, Register src)
+{
+    rex(true, src, 0, dst, false);
+    mCode.push_back(0x89);
+    modRM(src, dst);
+}
+
+/*****************************************************************************/
+void X64Emitter::movImm(Register dst, uint32_t value)
+{
+    rex(false, 0, 0, dst, false);
+    mCode.push_back(0xB8 | (dst & 7));
+    emit32(value);
+}
+
+/*****************************************************************************/
+void X64Emitter::movImm64(Register dst, uint64_t value)
+{
+    rex(true, 0, 0, dst, false);
+    mCode.push_back(0xB8 | (dst & 7));
+    emit32(static_cast<uint32_t>(value));
+    emit32(static_cast<uint32_t>(value >> 32));
+}
+
+/*****************************************************************************/
+void X64Emitter::alu(AluOp op, Register dst, Register src)
+{
+    rex(false, src, 0, dst, false);
+    mCode.push_back((op << 3) | 0x01);
+    modRM(src, dst);
+}
+
+/*****************************************************************************/
+void X64Emitter::alu64(AluOp op, Register dst, Register src)
+{
+    rex(true, src, 0, dst, false);
+    mCode.push_back((op << 3) | 0x01);
+    modRM(src, dst);
+}
+
+/*****************************************************************************/
+void X64Emitter::aluImm(AluOp op, Register dst, int32_t value)
+{
+    rex(false, 0, 0, dst, false);
+    mCode.push_back(0x81);
+    modRM(op, dst);
+    emit32(static_cast<uint32_t>(value));
+}
+
+/*****************************************************************************/
+void X64Emitter::shl(Register dst, uint8_t count)
+{
+    rex(false, 0, 0, dst, false);
+    mCode.push_back(0xC1);
+    modRM(4, dst);
+    mCode.push_back(count);
+}
+
+/*****************************************************************************/
+void X64Emitter::shr(Register dst, uint8_t count)
+{
+    rex(false, 0, 0, dst, false);
+    mCode.push_back(0xC1);
+    modRM(5, dst);
+    mCode.push_back(count);
+}
+
+/*****************************************************************************/
+void X64Emitter::test(Register first, Register second)
+{
+    rex(false, second, 0, first, false);
+    mCode.push_back(0x85);
+    modRM(second, first);
+}
+
+/*****************************************************************************/
+void X64Emitter::testImm(Register dst, uint32_t value)
+{
+    rex(false, 0, 0, dst, false);
+    mCode.push_back(0xF7);
+    modRM(0, dst);
+    emit32(value);
+}
+
+/*****************************************************************************/
+void X64Emitter::setcc(Condition condition, Register dst)
+{
+    rex(false, 0, 0, dst, dst >= RSP);
+    mCode.push_back(0x0F);
+    mCode.push_back(0x90 | condition);
+    modRM(0, dst);
+}
+
+/*****************************************************************************/
+void X64Emitter::movzx8(Register dst, Register src)
+{
+    rex(false, dst, 0, src, src >= RSP);
+    mCode.push_back(0x0F);
+    mCode.push_back(0xB6);
+    modRM(dst, src);
+}
+
+/*****************************************************************************/
+void X64Emitter::loadByte(Register dst,
+                          Register base,
+                          Register index,
+                          int32_t disp)
+{
+    rex(false, dst, index == NONE ? 0 : index, base, false);
+    mCode.push_back(0x0F);
+    mCode.push_back(0xB6);
+    modRM(dst, base, index, disp);
+}
+
+/*****************************************************************************/
+void X64Emitter::storeByte(Register base,
+                           Register index,
+                           int32_t disp,
+                           Register src)
+{
+    rex(false, src, index == NONE ? 0 : index, base, src >= RSP);
+    mCode.push_back(0x88);
+    modRM(src, base, index, disp);
+}
+
+/*****************************************************************************/
+void X64Emitter::storeWord(Register base, int32_t disp, Register src)
+{
+    mCode.push_back(0x66);
+    rex(false, src, 0, base, false);
+    mCode.push_back(0x89);
+    modRM(src, base, NONE, disp);
+}
+
+/*****************************************************************************/
+void X64Emitter::incMem(Register base)
+{
+    rex(false, 0, 0, base, false);
+    mCode.push_back(0xFF);
+    modRM(0, base, NONE, 0);
+}
+
+/*****************************************************************************/
+void X64Emitter::lea(Register dst, Register base, int32_t disp)
+{
+    rex(false, dst, 0, base, false);
+    mCode.push_back(0x8D);
+    modRM(dst, base, NONE, disp);
+}
+
+/*****************************************************************************/
+void X64Emitter::lea(Register dst,
+                     Register base,
+                     Register index,
+                     uint8_t shift,
+                     int32_t disp)
+{
+    rex(false, dst, index, base, false);
+    mCode.push_back(0x8D);
+    modRM(dst, base, index, disp, shift);
+}
+
+/*****************************************************************************/
+void X64Emitter::cmpMem(Register reg, Register base, int32_t disp)
+{
+    rex(false, reg, 0, base, false);
+    mCode.push_back(0x3B);
+    modRM(reg, base, NONE, disp);
+}
+
+/*****************************************************************************/
+void X64Emitter::push(Register reg)
+{
+    rex(false, 0, 0, reg, false);
+    mCode.push_back(0x50 | (reg & 7));
+}
+
+/*****************************************************************************/
+void X64Emitter::pop(Register reg)
+{
+    rex(false, 0, 0, reg, false);
+    mCode.push_back(0x58 | (reg & 7));
+}
+
+/*****************************************************************************/
+void X64Emitter::ret()
+{
+    mCode.push_back(0xC3);
+}
+
+/*****************************************************************************/
+size_t X64Emitter::jcc(Condition condition)
+{
+    mCode.push_back(0x0F);
+    mCode.push_back(0x80 | condition);
+    const size_t label = mCode.size();
+    emit32(0);
+    return label;
+}
+
+/*****************************************************************************/
+void X64Emitter::bind(size_t label, size_t position)
+{
+    const uint32_t offset = static_cast<uint32_t>(position - (label + 4));
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        mCode[label + ii] = (offset >> (ii * 8)) & 0xFF;
+    }
+}
+}
+}
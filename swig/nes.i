@@ -14,6 +14,10 @@
     #include "nes/Mode.h"
     #include "nes/Controller.h"
     #include "nes/APU.h"
+    #include "nes/Emulator.h"
+    #include "nes/EmulatorBatch.h"
+    #include "nes/Trace.h"
+    #include "nes/Condition.h"
 
     #include <sstream>
 %}
@@ -37,17 +41,40 @@
 %include "std_string.i"
 %include "std_vector.i"
 %include "std_shared_ptr.i"
+%include "pybuffer.i"
 
 %shared_ptr(nyra::nes::MemoryMap)
 
+// Cartridges can be built straight from bytes without a copy. The bytes
+// are kept alive by the Python object for as long as the banks use them.
+%pybuffer_binary(const uint8_t* buffer, size_t size);
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER)
+        (const uint8_t* buffer, size_t size)
+{
+    $1 = PyObject_CheckBuffer($input) ? 1 : 0;
+}
+%pythonappend nyra::nes::Cartridge::Cartridge %{
+    self._source = args[0]
+%}
+
+%ignore nyra::nes::Emulator::saveState(uint8_t*, size_t) const;
+%ignore nyra::nes::Emulator::loadState(const uint8_t*, size_t);
+%ignore nyra::nes::EmulatorBatch::step(const uint8_t*, size_t);
+%ignore nyra::nes::EmulatorBatch::getFrameBuffer();
+%ignore nyra::nes::CPU::setRecompiled;
+%ignore nyra::nes::TraceBuffer::record;
+%ignore nyra::nes::decodeTrace;
+%ignore nyra::nes::OP_CODE_INFO;
+%ignore nyra::nes::getOpCodes;
+
 %attribute(nyra::nes::Header, nyra::nes::Mirroring, mirroring, getMirroring)
 %attribute2(nyra::nes::Cartridge, nyra::nes::Header, header, getHeader)
 %attribute2(nyra::nes::Cartridge, nyra::nes::ROMBanks, chr_rom, getChrROM)
 %attribute2(nyra::nes::OpCode, nyra::nes::Mode, mode, getMode)
-%attribute(nyra::nes::Mode, bool, uses_arg1, usesArg1)
-%attribute(nyra::nes::Mode, bool, uses_arg2, usesArg2)
+%attribute2(nyra::nes::OpCode, nyra::nes::OpCodeInfo, info, getInfo)
 %attributestring(nyra::nes::OpCode, std::string, name, getName)
 %attribute2(nyra::nes::CPU, nyra::nes::CPUInfo, info, getInfo)
+%attribute2(nyra::nes::CPU, nyra::nes::CPURegisters, registers, getRegisters)
 
 %rename("%(undercase)s", %$isfunction) "";
 %rename("%(undercase)s", %$isvariable) "";
@@ -66,9 +93,17 @@
 %include "nes/MemoryFactory.h"
 %include "nes/Mode.h"
 %include "nes/OpCode.h"
+%include "nes/Trace.h"
+%include "nes/Condition.h"
 %include "nes/CPU.h"
+%include "nes/Emulator.h"
+%include "nes/EmulatorBatch.h"
 
 %template(PixelVector) std::vector<uint32_t>;
+%template(ByteVector) std::vector<uint8_t>;
+%template(StringVector) std::vector<std::string>;
+%template(TraceRecordVector) std::vector<nyra::nes::TraceRecord>;
+%template(ConditionVector) std::vector<nyra::nes::Condition>;
 
 %extend nyra::nes::Header
 {
@@ -84,7 +119,7 @@
 {
     uint8_t get_status() const
     {
-        return static_cast<uint8_t>(self->statusRegister.to_ulong());
+        return self->getStatus();
     }
 };
 
@@ -96,5 +131,26 @@
     }
 }
 
+%extend nyra::nes::Emulator
+{
+    void runFrame(size_t buffer)
+    {
+        $self->runFrame(reinterpret_cast<uint32_t*>(buffer));
+    }
 
+    void runFrames(size_t numFrames, size_t buffer)
+    {
+        $self->runFrames(numFrames, reinterpret_cast<uint32_t*>(buffer));
+    }
+}
 
+%extend nyra::nes::EmulatorBatch
+{
+    // The address of the N x 240 x 256 frame buffer so it can be wrapped
+    // (numpy, ctypes) without a copy. It stays valid for the life of the
+    // batch.
+    size_t getFrameBufferAddress()
+    {
+        return reinterpret_cast<size_t>($self->getFrameBuffer());
+    }
+}